@@ -7,12 +7,25 @@
 	-DVERSION=\"${VERSION}\" \
 	-DCURRENT_YEAR=\"${CURRENT_YEAR}\"
 
+# position independent objects for libcjit
+%.pic.o: %.c
+	$(cc) \
+	$(cflags) -fPIC \
+	-MMD -MP -MF $(@:.o=.d) \
+	-c $< -o $@ \
+	-DPREFIX=\"${PREFIX}\" \
+	-DVERSION=\"${VERSION}\" \
+	-DCURRENT_YEAR=\"${CURRENT_YEAR}\"
+
 lib/tinycc/libtcc.a lib/tinycc/libtcc1.a:
 	cd lib/tinycc \
 		&& ./configure ${tinycc_config} ${extra_tinycc_config}
 	"${MAKE}" -C lib/tinycc libtcc.a
 	"${MAKE}" -C lib/tinycc libtcc1.a
 
+lib/tinycc/libtcc1.so: lib/tinycc/libtcc1.a
+	"${MAKE}" -C lib/tinycc libtcc1.so
+
 # UNUSED EXPERIMENTS:
 lib/glfw/src/libglfw3.a:
 	cd lib/glfw \
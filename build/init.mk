@@ -27,11 +27,23 @@ SOURCES := src/file.o src/cjit.o \
 		   src/adapters/cli/route_parser.o \
 		   src/adapters/cli/render_response.o \
 		   src/adapters/compiler/tinycc_adapter.o \
+		   src/adapters/compiler/codegen_report.o \
+		   src/adapters/compiler/unit_pool.o \
+		   src/adapters/compiler/layout_profile.o \
+		   src/adapters/compiler/object_cache.o \
+		   src/adapters/compiler/make_deps.o \
 		   src/adapters/fs/local_filesystem.o \
 		   src/adapters/fs/local_asset.o \
 		   src/adapters/platform/library_resolver_posix.o \
            src/adapters/platform/library_resolver_windows.o \
            src/adapters/platform/runtime_platform.o \
+           src/adapters/platform/tier_runtime.o \
+           src/adapters/platform/hot_reload.o \
+           src/adapters/platform/watch.o \
+           src/adapters/platform/relink.o \
+           src/adapters/platform/symbol_map.o \
+           src/adapters/platform/job_pool.o \
+           src/adapters/platform/compile_server.o \
            src/main.o src/assets.o \
            lib/muntarfs/muntarfs_runtime.o \
            lib/muntarfs/muntar.o lib/muntarfs/tinflate.o lib/muntarfs/tinfgzip.o \
@@ -57,6 +69,7 @@ embed-posix: lib/tinycc/libtcc1.a
 	bash build/init-assets.sh
 	bash build/embed-asset-path.sh lib/tinycc/libtcc1.a
 	bash build/embed-asset-path.sh lib/tinycc/include
+	$(foreach asset,${embed_posix_extra},bash build/embed-asset-path.sh ${asset};)
 	@echo                 >> src/assets.c
 	@echo "return(true);" >> src/assets.c
 	@echo "}"             >> src/assets.c
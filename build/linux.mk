@@ -3,6 +3,12 @@ include build/init.mk
 GENERATED_POSIX_FILES := src/assets.c src/assets.h \
 	src/embed_libtcc1.a.c src/embed_include.c
 
+# libtcc1 prelinked, mapped by tinycc in place of libtcc1.a
+embed_posix_extra := lib/tinycc/libtcc1.so
+GENERATED_POSIX_FILES += src/embed_libtcc1.so.c
+SOURCES += src/embed_libtcc1.so.o
+embed-posix: ${embed_posix_extra}
+
 cflags += -DLIBC_GNU
 cflags += -DKILO_SUPPORTED
 cflags += -DCJIT_BUILD_LINUX
@@ -42,6 +48,25 @@ cjit: embed-posix ${SOURCES}
 
 ${GENERATED_POSIX_FILES}: embed-posix
 
+# libcjit: everything but the command line, including libtcc
+LIBCJIT_OBJECTS := $(patsubst %.o,%.pic.o,$(filter-out src/main.o src/cjit-ar.o,${SOURCES})) \
+                   src/libcjit.pic.o
+DEPFILES += ${LIBCJIT_OBJECTS:.o=.d}
+
+libcjit: libcjit.a libcjit.so
+
+lib/tinycc/libtcc.pic.a lib/tinycc/libtcc.pic-ie.a: lib/tinycc/libtcc.a
+	"${MAKE}" -C lib/tinycc $(notdir $@)
+
+libcjit.a: embed-posix ${LIBCJIT_OBJECTS} lib/tinycc/libtcc.pic-ie.a
+	rm -f $@
+	printf 'create $@\naddlib lib/tinycc/libtcc.pic-ie.a\naddmod %s\nsave\nend\n' \
+		"${LIBCJIT_OBJECTS}" | ar -M
+
+libcjit.so: embed-posix ${LIBCJIT_OBJECTS} lib/tinycc/libtcc.pic.a
+	$(cc) -shared -Wl,-soname,$@ -Wl,--version-script=build/libcjit.map \
+		-o $@ ${LIBCJIT_OBJECTS} lib/tinycc/libtcc.pic.a ${ldflags} -lm -ldl -lpthread
+
 cjit-ar: cflags += -DCJIT_AR_MAIN
 cjit-ar:
 	$(cc) $(cflags) -o $@ src/cjit-ar.c ${ldflags} lib/tinycc/libtcc.a
@@ -6,7 +6,6 @@
 // example usage: ./cjit frei0r_generator.c /usr/lib/frei0r-1/ising0r.so
 
 #pragma comment(lib, "SDL2")
-#define SDL_DISABLE_IMMINTRIN_H 1
 
 #include <SDL2/SDL.h>
 #include <dlfcn.h>
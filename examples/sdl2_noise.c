@@ -1,6 +1,5 @@
 #!/usr/bin/env cjit
 #pragma comment(lib, "SDL2")
-#define SDL_DISABLE_IMMINTRIN_H 1
 #define SDL_MAIN_HANDLED 1
 
 #include <SDL2/SDL.h>
@@ -176,17 +176,17 @@ ST_DATA const int reg_classes[NB_REGS] = {
 #endif
 };
 
-static int func_sub_sp_offset, last_itod_magic;
-static int leaffunc;
+static TCC_TLS int func_sub_sp_offset, last_itod_magic;
+static TCC_TLS int leaffunc;
 
 #if defined(CONFIG_TCC_BCHECK)
-static addr_t func_bound_offset;
-static unsigned long func_bound_ind;
-ST_DATA int func_bound_add_epilog;
+static TCC_TLS addr_t func_bound_offset;
+static TCC_TLS unsigned long func_bound_ind;
+ST_DATA TCC_TLS int func_bound_add_epilog;
 #endif
 
 #if defined(TCC_ARM_EABI) && defined(TCC_ARM_VFP)
-static CType float_type, double_type, func_float_type, func_double_type;
+static TCC_TLS CType float_type, double_type, func_float_type, func_double_type;
 ST_FUNC void arm_init(struct TCCState *s)
 {
     float_type.t = VT_FLOAT;
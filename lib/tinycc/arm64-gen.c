@@ -92,9 +92,9 @@ ST_DATA const int reg_classes[NB_REGS] = {
 };
 
 #if defined(CONFIG_TCC_BCHECK)
-static addr_t func_bound_offset;
-static unsigned long func_bound_ind;
-ST_DATA int func_bound_add_epilog;
+static TCC_TLS addr_t func_bound_offset;
+static TCC_TLS unsigned long func_bound_ind;
+ST_DATA TCC_TLS int func_bound_add_epilog;
 #endif
 
 #define IS_FREG(x) ((x) >= TREG_F(0))
@@ -1170,10 +1170,10 @@ ST_FUNC void gfunc_call(int nb_args)
     tcc_free(t);
 }
 
-static unsigned long arm64_func_va_list_stack;
-static int arm64_func_va_list_gr_offs;
-static int arm64_func_va_list_vr_offs;
-static int arm64_func_sub_sp_offset;
+static TCC_TLS unsigned long arm64_func_va_list_stack;
+static TCC_TLS int arm64_func_va_list_gr_offs;
+static TCC_TLS int arm64_func_va_list_vr_offs;
+static TCC_TLS int arm64_func_sub_sp_offset;
 
 ST_FUNC void gfunc_prolog(Sym *func_sym)
 {
@@ -17,6 +17,10 @@
 #define PCRELATIVE_DLLPLT 1
 #define RELOCATE_DLLPLT 1
 
+/* relocations may be applied in parallel */
+#define RELOCATE_PARALLEL 1
+#define RELOC_WITH_NEXT(t) 0
+
 #else /* !TARGET_DEFS_ONLY */
 
 #include "tcc.h"
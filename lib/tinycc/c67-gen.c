@@ -156,10 +156,10 @@ ST_DATA const int reg_classes[NB_REGS] = {
 // reg (pair)
 
 #define NoCallArgsPassedOnStack 10
-int NoOfCurFuncArgs;
-int TranslateStackToReg[NoCallArgsPassedOnStack];
-int ParamLocOnStack[NoCallArgsPassedOnStack];
-int TotalBytesPushedOnStack;
+TCC_TLS int NoOfCurFuncArgs;
+TCC_TLS int TranslateStackToReg[NoCallArgsPassedOnStack];
+TCC_TLS int ParamLocOnStack[NoCallArgsPassedOnStack];
+TCC_TLS int TotalBytesPushedOnStack;
 
 #ifndef FALSE
 # define FALSE 0
@@ -176,11 +176,11 @@ do {\
 } while (0)
 
 /******************************************************/
-static unsigned long func_sub_sp_offset;
-static int func_ret_sub;
+static TCC_TLS unsigned long func_sub_sp_offset;
+static TCC_TLS int func_ret_sub;
 
-static BOOL C67_invert_test;
-static int C67_compare_reg;
+static TCC_TLS BOOL C67_invert_test;
+static TCC_TLS int C67_compare_reg;
 
 #ifdef ASSEMBLY_LISTING_C67
 FILE *f = NULL;
@@ -18,6 +18,11 @@
 #define PCRELATIVE_DLLPLT 0
 #define RELOCATE_DLLPLT 1
 
+/* relocations may be applied in parallel, except those rewriting the
+   code of the next one, which must stay with it */
+#define RELOCATE_PARALLEL 1
+#define RELOC_WITH_NEXT(t) ((t) == R_386_TLS_GD || (t) == R_386_TLS_LDM)
+
 #else /* !TARGET_DEFS_ONLY */
 
 #include "tcc.h"
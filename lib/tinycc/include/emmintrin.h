@@ -0,0 +1,156 @@
+/* SSE2 intrinsics for tcc, see xmmintrin.h */
+#ifndef _EMMINTRIN_H
+#define _EMMINTRIN_H
+
+#include <xmmintrin.h>
+
+typedef double __m128d __attribute__((__vector_size__(16)));
+typedef long long __m128i __attribute__((__vector_size__(16)));
+typedef double __m128d_u __attribute__((__vector_size__(16)));
+typedef long long __m128i_u __attribute__((__vector_size__(16)));
+typedef double __v2df __attribute__((__vector_size__(16)));
+typedef long long __v2di __attribute__((__vector_size__(16)));
+typedef short __v8hi __attribute__((__vector_size__(16)));
+typedef char __v16qi __attribute__((__vector_size__(16)));
+typedef unsigned int __v4su __attribute__((__vector_size__(16)));
+typedef unsigned short __v8hu __attribute__((__vector_size__(16)));
+typedef unsigned char __v16qu __attribute__((__vector_size__(16)));
+
+/* double */
+__TCC_MM __m128d _mm_setzero_pd(void)
+{ __m128d r = { 0, 0 }; return r; }
+__TCC_MM __m128d _mm_set1_pd(double d)
+{ __m128d r = { d, d }; return r; }
+#define _mm_set_pd1 _mm_set1_pd
+__TCC_MM __m128d _mm_set_pd(double e1, double e0)
+{ __m128d r = { e0, e1 }; return r; }
+__TCC_MM __m128d _mm_setr_pd(double e0, double e1)
+{ __m128d r = { e0, e1 }; return r; }
+__TCC_MM __m128d _mm_load_pd(const double *p) { return *(const __m128d *)p; }
+__TCC_MM __m128d _mm_loadu_pd(const double *p) { return *(const __m128d_u *)p; }
+__TCC_MM void _mm_store_pd(double *p, __m128d a) { *(__m128d *)p = a; }
+__TCC_MM void _mm_storeu_pd(double *p, __m128d a) { *(__m128d_u *)p = a; }
+__TCC_MM double _mm_cvtsd_f64(__m128d a) { return a[0]; }
+
+__TCC_MM __m128d _mm_add_pd(__m128d a, __m128d b) { return a + b; }
+__TCC_MM __m128d _mm_sub_pd(__m128d a, __m128d b) { return a - b; }
+__TCC_MM __m128d _mm_mul_pd(__m128d a, __m128d b) { return a * b; }
+__TCC_MM __m128d _mm_div_pd(__m128d a, __m128d b) { return a / b; }
+__TCC_MM __m128d _mm_min_pd(__m128d a, __m128d b)
+{ int i; for (i = 0; i < 2; i++) if (b[i] < a[i]) a[i] = b[i]; return a; }
+__TCC_MM __m128d _mm_max_pd(__m128d a, __m128d b)
+{ int i; for (i = 0; i < 2; i++) if (b[i] > a[i]) a[i] = b[i]; return a; }
+__TCC_MM __m128d _mm_and_pd(__m128d a, __m128d b)
+{ return (__m128d)((__v2di)a & (__v2di)b); }
+__TCC_MM __m128d _mm_or_pd(__m128d a, __m128d b)
+{ return (__m128d)((__v2di)a | (__v2di)b); }
+__TCC_MM __m128d _mm_xor_pd(__m128d a, __m128d b)
+{ return (__m128d)((__v2di)a ^ (__v2di)b); }
+__TCC_MM __m128d _mm_cmpeq_pd(__m128d a, __m128d b) { return (__m128d)(a == b); }
+__TCC_MM __m128d _mm_cmplt_pd(__m128d a, __m128d b) { return (__m128d)(a < b); }
+__TCC_MM __m128d _mm_cmpgt_pd(__m128d a, __m128d b) { return (__m128d)(a > b); }
+
+/* integer */
+__TCC_MM __m128i _mm_setzero_si128(void)
+{ __m128i r = { 0, 0 }; return r; }
+__TCC_MM __m128i _mm_set_epi64x(long long e1, long long e0)
+{ __m128i r = { e0, e1 }; return r; }
+__TCC_MM __m128i _mm_set1_epi64x(long long e)
+{ __m128i r = { e, e }; return r; }
+__TCC_MM __m128i _mm_set_epi32(int e3, int e2, int e1, int e0)
+{ __v4si r = { e0, e1, e2, e3 }; return (__m128i)r; }
+__TCC_MM __m128i _mm_setr_epi32(int e0, int e1, int e2, int e3)
+{ __v4si r = { e0, e1, e2, e3 }; return (__m128i)r; }
+__TCC_MM __m128i _mm_set1_epi32(int e)
+{ __v4si r = { e, e, e, e }; return (__m128i)r; }
+__TCC_MM __m128i _mm_set1_epi16(short e)
+{ __v8hi r = { e, e, e, e, e, e, e, e }; return (__m128i)r; }
+__TCC_MM __m128i _mm_set1_epi8(char e)
+{
+    __v16qi r = { e, e, e, e, e, e, e, e, e, e, e, e, e, e, e, e };
+    return (__m128i)r;
+}
+__TCC_MM __m128i _mm_load_si128(const __m128i *p) { return *p; }
+__TCC_MM __m128i _mm_loadu_si128(const __m128i_u *p) { return *p; }
+__TCC_MM void _mm_store_si128(__m128i *p, __m128i a) { *p = a; }
+__TCC_MM void _mm_storeu_si128(__m128i_u *p, __m128i a) { *p = a; }
+__TCC_MM int _mm_cvtsi128_si32(__m128i a) { return ((__v4si)a)[0]; }
+__TCC_MM __m128i _mm_cvtsi32_si128(int a) { return _mm_set_epi32(0, 0, 0, a); }
+
+__TCC_MM __m128i _mm_add_epi8(__m128i a, __m128i b)
+{ return (__m128i)((__v16qi)a + (__v16qi)b); }
+__TCC_MM __m128i _mm_add_epi16(__m128i a, __m128i b)
+{ return (__m128i)((__v8hi)a + (__v8hi)b); }
+__TCC_MM __m128i _mm_add_epi32(__m128i a, __m128i b)
+{ return (__m128i)((__v4si)a + (__v4si)b); }
+__TCC_MM __m128i _mm_add_epi64(__m128i a, __m128i b) { return a + b; }
+__TCC_MM __m128i _mm_sub_epi8(__m128i a, __m128i b)
+{ return (__m128i)((__v16qi)a - (__v16qi)b); }
+__TCC_MM __m128i _mm_sub_epi16(__m128i a, __m128i b)
+{ return (__m128i)((__v8hi)a - (__v8hi)b); }
+__TCC_MM __m128i _mm_sub_epi32(__m128i a, __m128i b)
+{ return (__m128i)((__v4si)a - (__v4si)b); }
+__TCC_MM __m128i _mm_sub_epi64(__m128i a, __m128i b) { return a - b; }
+__TCC_MM __m128i _mm_mullo_epi16(__m128i a, __m128i b)
+{ return (__m128i)((__v8hi)a * (__v8hi)b); }
+
+__TCC_MM __m128i _mm_and_si128(__m128i a, __m128i b) { return a & b; }
+__TCC_MM __m128i _mm_andnot_si128(__m128i a, __m128i b) { return ~a & b; }
+__TCC_MM __m128i _mm_or_si128(__m128i a, __m128i b) { return a | b; }
+__TCC_MM __m128i _mm_xor_si128(__m128i a, __m128i b) { return a ^ b; }
+
+__TCC_MM __m128i _mm_slli_epi16(__m128i a, int n)
+{ return n > 15 ? _mm_setzero_si128() : (__m128i)((__v8hu)a << n); }
+__TCC_MM __m128i _mm_slli_epi32(__m128i a, int n)
+{ return n > 31 ? _mm_setzero_si128() : (__m128i)((__v4su)a << n); }
+__TCC_MM __m128i _mm_slli_epi64(__m128i a, int n)
+{ return n > 63 ? _mm_setzero_si128() : a << n; }
+__TCC_MM __m128i _mm_srli_epi16(__m128i a, int n)
+{ return n > 15 ? _mm_setzero_si128() : (__m128i)((__v8hu)a >> n); }
+__TCC_MM __m128i _mm_srli_epi32(__m128i a, int n)
+{ return n > 31 ? _mm_setzero_si128() : (__m128i)((__v4su)a >> n); }
+__TCC_MM __m128i _mm_srai_epi16(__m128i a, int n)
+{ return (__m128i)((__v8hi)a >> (n > 15 ? 15 : n)); }
+__TCC_MM __m128i _mm_srai_epi32(__m128i a, int n)
+{ return (__m128i)((__v4si)a >> (n > 31 ? 31 : n)); }
+
+__TCC_MM __m128i _mm_cmpeq_epi8(__m128i a, __m128i b)
+{ __v16qi r; int i; for (i = 0; i < 16; i++) r[i] = -(((__v16qi)a)[i] == ((__v16qi)b)[i]); return (__m128i)r; }
+__TCC_MM __m128i _mm_cmpeq_epi32(__m128i a, __m128i b)
+{ return (__m128i)((__v4si)a == (__v4si)b); }
+__TCC_MM __m128i _mm_cmpgt_epi32(__m128i a, __m128i b)
+{ return (__m128i)((__v4si)a > (__v4si)b); }
+__TCC_MM __m128i _mm_cmplt_epi32(__m128i a, __m128i b)
+{ return (__m128i)((__v4si)a < (__v4si)b); }
+__TCC_MM int _mm_movemask_epi8(__m128i a)
+{
+    __v16qi v = (__v16qi)a;
+    int i, m = 0;
+    for (i = 0; i < 16; i++)
+        m |= (v[i] < 0) << i;
+    return m;
+}
+
+/* conversions and casts */
+__TCC_MM __m128 _mm_cvtepi32_ps(__m128i a)
+{
+    __v4si v = (__v4si)a;
+    __m128 r = { v[0], v[1], v[2], v[3] };
+    return r;
+}
+__TCC_MM __m128i _mm_cvttps_epi32(__m128 a)
+{ __v4si r = { a[0], a[1], a[2], a[3] }; return (__m128i)r; }
+__TCC_MM __m128 _mm_castsi128_ps(__m128i a) { return (__m128)a; }
+__TCC_MM __m128i _mm_castps_si128(__m128 a) { return (__m128i)a; }
+__TCC_MM __m128d _mm_castsi128_pd(__m128i a) { return (__m128d)a; }
+__TCC_MM __m128i _mm_castpd_si128(__m128d a) { return (__m128i)a; }
+__TCC_MM __m128 _mm_castpd_ps(__m128d a) { return (__m128)a; }
+__TCC_MM __m128d _mm_castps_pd(__m128 a) { return (__m128d)a; }
+
+#if defined __i386__ || defined __x86_64__
+__TCC_MM void _mm_lfence(void) { __asm__ __volatile__("lfence" ::: "memory"); }
+__TCC_MM void _mm_mfence(void) { __asm__ __volatile__("mfence" ::: "memory"); }
+__TCC_MM void _mm_pause(void) { __asm__ __volatile__("pause"); }
+#endif
+
+#endif /* _EMMINTRIN_H */
@@ -0,0 +1,100 @@
+/* SSE/AVX intrinsics for tcc, see xmmintrin.h.  The 256 bit types are
+   processed as two 128 bit halves. */
+#ifndef _IMMINTRIN_H
+#define _IMMINTRIN_H
+
+#include <emmintrin.h>
+#include <smmintrin.h>
+
+typedef float __m256 __attribute__((__vector_size__(32)));
+typedef double __m256d __attribute__((__vector_size__(32)));
+typedef long long __m256i __attribute__((__vector_size__(32)));
+typedef float __m256_u __attribute__((__vector_size__(32)));
+typedef double __m256d_u __attribute__((__vector_size__(32)));
+typedef long long __m256i_u __attribute__((__vector_size__(32)));
+typedef int __v8si __attribute__((__vector_size__(32)));
+typedef long long __v4di __attribute__((__vector_size__(32)));
+
+/* float */
+__TCC_MM __m256 _mm256_setzero_ps(void)
+{ __m256 r = { 0, 0, 0, 0, 0, 0, 0, 0 }; return r; }
+__TCC_MM __m256 _mm256_set1_ps(float f)
+{ __m256 r = { f, f, f, f, f, f, f, f }; return r; }
+__TCC_MM __m256 _mm256_set_ps(float e7, float e6, float e5, float e4,
+                              float e3, float e2, float e1, float e0)
+{ __m256 r = { e0, e1, e2, e3, e4, e5, e6, e7 }; return r; }
+__TCC_MM __m256 _mm256_setr_ps(float e0, float e1, float e2, float e3,
+                               float e4, float e5, float e6, float e7)
+{ __m256 r = { e0, e1, e2, e3, e4, e5, e6, e7 }; return r; }
+__TCC_MM __m256 _mm256_load_ps(const float *p) { return *(const __m256 *)p; }
+__TCC_MM __m256 _mm256_loadu_ps(const float *p) { return *(const __m256_u *)p; }
+__TCC_MM void _mm256_store_ps(float *p, __m256 a) { *(__m256 *)p = a; }
+__TCC_MM void _mm256_storeu_ps(float *p, __m256 a) { *(__m256_u *)p = a; }
+__TCC_MM float _mm256_cvtss_f32(__m256 a) { return a[0]; }
+__TCC_MM __m256 _mm256_add_ps(__m256 a, __m256 b) { return a + b; }
+__TCC_MM __m256 _mm256_sub_ps(__m256 a, __m256 b) { return a - b; }
+__TCC_MM __m256 _mm256_mul_ps(__m256 a, __m256 b) { return a * b; }
+__TCC_MM __m256 _mm256_div_ps(__m256 a, __m256 b) { return a / b; }
+__TCC_MM __m256 _mm256_fmadd_ps(__m256 a, __m256 b, __m256 c) { return a * b + c; }
+__TCC_MM __m256 _mm256_min_ps(__m256 a, __m256 b)
+{ int i; for (i = 0; i < 8; i++) if (b[i] < a[i]) a[i] = b[i]; return a; }
+__TCC_MM __m256 _mm256_max_ps(__m256 a, __m256 b)
+{ int i; for (i = 0; i < 8; i++) if (b[i] > a[i]) a[i] = b[i]; return a; }
+__TCC_MM __m256 _mm256_and_ps(__m256 a, __m256 b)
+{ return (__m256)((__v8si)a & (__v8si)b); }
+__TCC_MM __m256 _mm256_or_ps(__m256 a, __m256 b)
+{ return (__m256)((__v8si)a | (__v8si)b); }
+__TCC_MM __m256 _mm256_xor_ps(__m256 a, __m256 b)
+{ return (__m256)((__v8si)a ^ (__v8si)b); }
+__TCC_MM __m128 _mm256_castps256_ps128(__m256 a)
+{ __m128 r = { a[0], a[1], a[2], a[3] }; return r; }
+__TCC_MM __m128 _mm256_extractf128_ps(__m256 a, int i)
+{ i = (i & 1) * 4; { __m128 r = { a[i], a[i + 1], a[i + 2], a[i + 3] }; return r; } }
+__TCC_MM __m128 _mm_fmadd_ps(__m128 a, __m128 b, __m128 c) { return a * b + c; }
+
+/* double */
+__TCC_MM __m256d _mm256_setzero_pd(void)
+{ __m256d r = { 0, 0, 0, 0 }; return r; }
+__TCC_MM __m256d _mm256_set1_pd(double d)
+{ __m256d r = { d, d, d, d }; return r; }
+__TCC_MM __m256d _mm256_set_pd(double e3, double e2, double e1, double e0)
+{ __m256d r = { e0, e1, e2, e3 }; return r; }
+__TCC_MM __m256d _mm256_load_pd(const double *p) { return *(const __m256d *)p; }
+__TCC_MM __m256d _mm256_loadu_pd(const double *p) { return *(const __m256d_u *)p; }
+__TCC_MM void _mm256_store_pd(double *p, __m256d a) { *(__m256d *)p = a; }
+__TCC_MM void _mm256_storeu_pd(double *p, __m256d a) { *(__m256d_u *)p = a; }
+__TCC_MM __m256d _mm256_add_pd(__m256d a, __m256d b) { return a + b; }
+__TCC_MM __m256d _mm256_sub_pd(__m256d a, __m256d b) { return a - b; }
+__TCC_MM __m256d _mm256_mul_pd(__m256d a, __m256d b) { return a * b; }
+__TCC_MM __m256d _mm256_div_pd(__m256d a, __m256d b) { return a / b; }
+__TCC_MM __m256d _mm256_fmadd_pd(__m256d a, __m256d b, __m256d c) { return a * b + c; }
+
+/* integer */
+__TCC_MM __m256i _mm256_setzero_si256(void)
+{ __m256i r = { 0, 0, 0, 0 }; return r; }
+__TCC_MM __m256i _mm256_set1_epi32(int e)
+{ __v8si r = { e, e, e, e, e, e, e, e }; return (__m256i)r; }
+__TCC_MM __m256i _mm256_load_si256(const __m256i *p) { return *p; }
+__TCC_MM __m256i _mm256_loadu_si256(const __m256i_u *p) { return *p; }
+__TCC_MM void _mm256_store_si256(__m256i *p, __m256i a) { *p = a; }
+__TCC_MM void _mm256_storeu_si256(__m256i_u *p, __m256i a) { *p = a; }
+__TCC_MM __m256i _mm256_add_epi32(__m256i a, __m256i b)
+{ return (__m256i)((__v8si)a + (__v8si)b); }
+__TCC_MM __m256i _mm256_sub_epi32(__m256i a, __m256i b)
+{ return (__m256i)((__v8si)a - (__v8si)b); }
+__TCC_MM __m256i _mm256_mullo_epi32(__m256i a, __m256i b)
+{ return (__m256i)((__v8si)a * (__v8si)b); }
+__TCC_MM __m256i _mm256_add_epi64(__m256i a, __m256i b) { return a + b; }
+__TCC_MM __m256i _mm256_and_si256(__m256i a, __m256i b) { return a & b; }
+__TCC_MM __m256i _mm256_or_si256(__m256i a, __m256i b) { return a | b; }
+__TCC_MM __m256i _mm256_xor_si256(__m256i a, __m256i b) { return a ^ b; }
+__TCC_MM __m256 _mm256_castsi256_ps(__m256i a) { return (__m256)a; }
+__TCC_MM __m256i _mm256_castps_si256(__m256 a) { return (__m256i)a; }
+__TCC_MM __m256 _mm256_cvtepi32_ps(__m256i a)
+{
+    __v8si v = (__v8si)a;
+    __m256 r = { v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7] };
+    return r;
+}
+
+#endif /* _IMMINTRIN_H */
@@ -0,0 +1,40 @@
+/* SSE4.1 intrinsics for tcc, see xmmintrin.h */
+#ifndef _SMMINTRIN_H
+#define _SMMINTRIN_H
+
+#include <emmintrin.h>
+
+__TCC_MM __m128i _mm_mullo_epi32(__m128i a, __m128i b)
+{ return (__m128i)((__v4si)a * (__v4si)b); }
+__TCC_MM __m128i _mm_min_epi32(__m128i a, __m128i b)
+{
+    __v4si x = (__v4si)a, y = (__v4si)b;
+    int i;
+    for (i = 0; i < 4; i++) if (y[i] < x[i]) x[i] = y[i];
+    return (__m128i)x;
+}
+__TCC_MM __m128i _mm_max_epi32(__m128i a, __m128i b)
+{
+    __v4si x = (__v4si)a, y = (__v4si)b;
+    int i;
+    for (i = 0; i < 4; i++) if (y[i] > x[i]) x[i] = y[i];
+    return (__m128i)x;
+}
+__TCC_MM int _mm_extract_epi32(__m128i a, int i) { return ((__v4si)a)[i & 3]; }
+__TCC_MM __m128i _mm_insert_epi32(__m128i a, int v, int i)
+{ __v4si x = (__v4si)a; x[i & 3] = v; return (__m128i)x; }
+__TCC_MM float __tcc_mm_dp(__m128 a, __m128 b, int m)
+{
+    float s = 0;
+    int i;
+    for (i = 0; i < 4; i++) if (m & (16 << i)) s += a[i] * b[i];
+    return s;
+}
+__TCC_MM __m128 _mm_dp_ps(__m128 a, __m128 b, int m)
+{
+    float s = __tcc_mm_dp(a, b, m);
+    __m128 r = { m & 1 ? s : 0, m & 2 ? s : 0, m & 4 ? s : 0, m & 8 ? s : 0 };
+    return r;
+}
+
+#endif /* _SMMINTRIN_H */
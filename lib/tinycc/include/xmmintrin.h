@@ -0,0 +1,103 @@
+/* SSE intrinsics for tcc, on top of __attribute__((vector_size(N))).
+   Vectors are held in memory, tcc emits SSE instructions for the
+   element-wise arithmetic and plain C for everything else. */
+#ifndef _XMMINTRIN_H
+#define _XMMINTRIN_H
+
+typedef float __m128 __attribute__((__vector_size__(16)));
+typedef float __m128_u __attribute__((__vector_size__(16)));
+typedef float __v4sf __attribute__((__vector_size__(16)));
+typedef int __v4si __attribute__((__vector_size__(16)));
+
+#define __TCC_MM static __inline__
+
+__TCC_MM __m128 _mm_setzero_ps(void)
+{ __m128 r = { 0, 0, 0, 0 }; return r; }
+__TCC_MM __m128 _mm_set1_ps(float f)
+{ __m128 r = { f, f, f, f }; return r; }
+#define _mm_set_ps1 _mm_set1_ps
+__TCC_MM __m128 _mm_set_ps(float e3, float e2, float e1, float e0)
+{ __m128 r = { e0, e1, e2, e3 }; return r; }
+__TCC_MM __m128 _mm_setr_ps(float e0, float e1, float e2, float e3)
+{ __m128 r = { e0, e1, e2, e3 }; return r; }
+__TCC_MM __m128 _mm_set_ss(float f)
+{ __m128 r = { f, 0, 0, 0 }; return r; }
+
+__TCC_MM __m128 _mm_load_ps(const float *p) { return *(const __m128 *)p; }
+__TCC_MM __m128 _mm_loadu_ps(const float *p) { return *(const __m128_u *)p; }
+__TCC_MM __m128 _mm_load1_ps(const float *p) { return _mm_set1_ps(*p); }
+#define _mm_load_ps1 _mm_load1_ps
+__TCC_MM __m128 _mm_load_ss(const float *p) { return _mm_set_ss(*p); }
+__TCC_MM void _mm_store_ps(float *p, __m128 a) { *(__m128 *)p = a; }
+__TCC_MM void _mm_storeu_ps(float *p, __m128 a) { *(__m128_u *)p = a; }
+__TCC_MM void _mm_store_ss(float *p, __m128 a) { *p = a[0]; }
+__TCC_MM float _mm_cvtss_f32(__m128 a) { return a[0]; }
+
+__TCC_MM __m128 _mm_add_ps(__m128 a, __m128 b) { return a + b; }
+__TCC_MM __m128 _mm_sub_ps(__m128 a, __m128 b) { return a - b; }
+__TCC_MM __m128 _mm_mul_ps(__m128 a, __m128 b) { return a * b; }
+__TCC_MM __m128 _mm_div_ps(__m128 a, __m128 b) { return a / b; }
+__TCC_MM __m128 _mm_add_ss(__m128 a, __m128 b) { a[0] += b[0]; return a; }
+__TCC_MM __m128 _mm_sub_ss(__m128 a, __m128 b) { a[0] -= b[0]; return a; }
+__TCC_MM __m128 _mm_mul_ss(__m128 a, __m128 b) { a[0] *= b[0]; return a; }
+__TCC_MM __m128 _mm_div_ss(__m128 a, __m128 b) { a[0] /= b[0]; return a; }
+
+__TCC_MM __m128 _mm_min_ps(__m128 a, __m128 b)
+{ int i; for (i = 0; i < 4; i++) if (b[i] < a[i]) a[i] = b[i]; return a; }
+__TCC_MM __m128 _mm_max_ps(__m128 a, __m128 b)
+{ int i; for (i = 0; i < 4; i++) if (b[i] > a[i]) a[i] = b[i]; return a; }
+
+__TCC_MM __m128 _mm_and_ps(__m128 a, __m128 b)
+{ return (__m128)((__v4si)a & (__v4si)b); }
+__TCC_MM __m128 _mm_andnot_ps(__m128 a, __m128 b)
+{ return (__m128)(~(__v4si)a & (__v4si)b); }
+__TCC_MM __m128 _mm_or_ps(__m128 a, __m128 b)
+{ return (__m128)((__v4si)a | (__v4si)b); }
+__TCC_MM __m128 _mm_xor_ps(__m128 a, __m128 b)
+{ return (__m128)((__v4si)a ^ (__v4si)b); }
+
+__TCC_MM __m128 _mm_cmpeq_ps(__m128 a, __m128 b) { return (__m128)(a == b); }
+__TCC_MM __m128 _mm_cmpneq_ps(__m128 a, __m128 b) { return (__m128)(a != b); }
+__TCC_MM __m128 _mm_cmplt_ps(__m128 a, __m128 b) { return (__m128)(a < b); }
+__TCC_MM __m128 _mm_cmple_ps(__m128 a, __m128 b) { return (__m128)(a <= b); }
+__TCC_MM __m128 _mm_cmpgt_ps(__m128 a, __m128 b) { return (__m128)(a > b); }
+__TCC_MM __m128 _mm_cmpge_ps(__m128 a, __m128 b) { return (__m128)(a >= b); }
+__TCC_MM int _mm_movemask_ps(__m128 a)
+{
+    __v4si v = (__v4si)a;
+    return (v[0] < 0) | (v[1] < 0) << 1 | (v[2] < 0) << 2 | (v[3] < 0) << 3;
+}
+
+__TCC_MM __m128 _mm_unpacklo_ps(__m128 a, __m128 b)
+{ __m128 r = { a[0], b[0], a[1], b[1] }; return r; }
+__TCC_MM __m128 _mm_unpackhi_ps(__m128 a, __m128 b)
+{ __m128 r = { a[2], b[2], a[3], b[3] }; return r; }
+__TCC_MM __m128 _mm_movehl_ps(__m128 a, __m128 b)
+{ __m128 r = { b[2], b[3], a[2], a[3] }; return r; }
+__TCC_MM __m128 _mm_movelh_ps(__m128 a, __m128 b)
+{ __m128 r = { a[0], a[1], b[0], b[1] }; return r; }
+__TCC_MM __m128 __tcc_mm_shuffle_ps(__m128 a, __m128 b, int m)
+{
+    __m128 r = { a[m & 3], a[(m >> 2) & 3], b[(m >> 4) & 3], b[(m >> 6) & 3] };
+    return r;
+}
+#define _mm_shuffle_ps(a, b, m) __tcc_mm_shuffle_ps(a, b, m)
+#define _MM_SHUFFLE(z, y, x, w) (((z) << 6) | ((y) << 4) | ((x) << 2) | (w))
+
+#define _MM_TRANSPOSE4_PS(r0, r1, r2, r3) do { \
+    __m128 __t0 = _mm_unpacklo_ps(r0, r1), __t1 = _mm_unpacklo_ps(r2, r3); \
+    __m128 __t2 = _mm_unpackhi_ps(r0, r1), __t3 = _mm_unpackhi_ps(r2, r3); \
+    (r0) = _mm_movelh_ps(__t0, __t1); (r1) = _mm_movehl_ps(__t1, __t0); \
+    (r2) = _mm_movelh_ps(__t2, __t3); (r3) = _mm_movehl_ps(__t3, __t2); \
+} while (0)
+
+__TCC_MM void _mm_prefetch(const void *p, int i) { (void)p; (void)i; }
+#define _MM_HINT_T0 3
+#define _MM_HINT_T1 2
+#define _MM_HINT_T2 1
+#define _MM_HINT_NTA 0
+#if defined __i386__ || defined __x86_64__
+__TCC_MM void _mm_sfence(void) { __asm__ __volatile__("sfence" ::: "memory"); }
+#endif
+
+#endif /* _XMMINTRIN_H */
@@ -67,11 +67,15 @@
 /* global variables */
 
 /* XXX: get rid of this ASAP (or maybe not) */
-ST_DATA struct TCCState *tcc_state;
+ST_DATA TCC_TLS struct TCCState *tcc_state;
+#if !CONFIG_TCC_TLS
 TCC_SEM(static tcc_compile_sem);
+#endif
 /* an array of pointers to memory to be free'd after errors */
-ST_DATA void** stk_data;
-ST_DATA int nb_stk_data;
+ST_DATA TCC_TLS void** stk_data;
+ST_DATA TCC_TLS int nb_stk_data;
+/* set while this thread runs a job of s1->parallel_func() */
+ST_DATA TCC_TLS JobError *job_error;
 
 /********************************************************/
 #ifdef _WIN32
@@ -127,7 +131,9 @@ PUB_FUNC void tcc_enter_state(TCCState *s1)
 {
     if (s1->error_set_jmp_enabled)
         return;
+#if !CONFIG_TCC_TLS
     WAIT_SEM(&tcc_compile_sem);
+#endif
     tcc_state = s1;
 }
 
@@ -136,7 +142,9 @@ PUB_FUNC void tcc_exit_state(TCCState *s1)
     if (s1->error_set_jmp_enabled)
         return;
     tcc_state = NULL;
+#if !CONFIG_TCC_TLS
     POST_SEM(&tcc_compile_sem);
+#endif
 }
 
 /********************************************************/
@@ -570,6 +578,13 @@ static void error1(int mode, const char *fmt, va_list ap)
 
     tcc_exit_state(s1);
 
+    if (job_error) {
+        /* not to race with the other jobs on s1 */
+        if (job_error->nb_errors++ == 0)
+            vsnprintf(job_error->msg, sizeof job_error->msg, fmt, ap);
+        return;
+    }
+
     if (mode == ERROR_WARN) {
         if (s1->warn_error)
             mode = ERROR_ERROR;
@@ -637,6 +652,58 @@ LIBTCCAPI void tcc_set_error_func(TCCState *s, void *error_opaque, TCCErrorFunc
     s->error_func = error_func;
 }
 
+LIBTCCAPI void tcc_set_codegen_report(TCCState *s, void *opaque, TCCReportFunc *report_func)
+{
+    s->report_opaque = opaque;
+    s->report_func = report_func;
+}
+
+LIBTCCAPI void tcc_set_snapshot_func(TCCState *s, void *opaque, TCCSnapshotFunc *snapshot_func)
+{
+    s->snapshot_opaque = opaque;
+    s->snapshot_func = snapshot_func;
+}
+
+LIBTCCAPI void tcc_set_resolve_func(TCCState *s, void *opaque, TCCResolveFunc *resolve_func)
+{
+    s->resolve_opaque = opaque;
+    s->resolve_func = resolve_func;
+}
+
+LIBTCCAPI void tcc_set_parallel_func(TCCState *s, void *opaque, TCCParallelFunc *parallel_func)
+{
+    s->parallel_opaque = opaque;
+    s->parallel_func = parallel_func;
+}
+
+LIBTCCAPI void tcc_set_layout_func(TCCState *s, void *opaque, TCCLayoutFunc *layout_func)
+{
+    s->layout_opaque = opaque;
+    s->layout_func = layout_func;
+}
+
+LIBTCCAPI void tcc_set_coverage_file(TCCState *s, const char *filename)
+{
+    tcc_free(s->tcov_file);
+    s->tcov_file = filename ? tcc_strdup(filename) : NULL;
+}
+
+/* monotonic time for the code generation report */
+ST_FUNC unsigned long long tcc_clock_ns(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER c, f;
+    QueryPerformanceCounter(&c);
+    QueryPerformanceFrequency(&f);
+    return (unsigned long long)(c.QuadPart / f.QuadPart * 1000000000
+        + c.QuadPart % f.QuadPart * 1000000000 / f.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
 /* error without aborting current compilation */
 PUB_FUNC int _tcc_error_noabort(const char *fmt, ...)
 {
@@ -735,10 +802,8 @@ static int tcc_compile(TCCState *s1, int filetype, const char *str, int fd)
 {
     /* Here we enter the code section where we use the global variables for
        parsing and code generation (tccpp.c, tccgen.c, <target>-gen.c).
-       Other threads need to wait until we're done.
-
-       Alternatively we could use thread local storage for those global
-       variables, which may or may not have advantages */
+       With CONFIG_TCC_TLS those are per thread, otherwise other threads
+       need to wait until we're done. */
 
     tcc_enter_state(s1);
     s1->error_set_jmp_enabled = 1;
@@ -860,11 +925,13 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
     tcc_free(s1->soname);
     tcc_free(s1->rpath);
     tcc_free(s1->elf_entryname);
+    tcc_free(s1->runtime_image);
     tcc_free(s1->init_symbol);
     tcc_free(s1->fini_symbol);
     tcc_free(s1->mapfile);
     tcc_free(s1->outfile);
     tcc_free(s1->deps_outfile);
+    tcc_free(s1->tcov_file);
 #if defined TCC_TARGET_MACHO
     tcc_free(s1->install_name);
 #endif
@@ -879,6 +946,7 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
 #ifdef TCC_IS_NATIVE
     /* free runtime memory */
     tcc_run_free(s1);
+    dynarray_reset(&s1->bind_data, &s1->nb_bind_data);
 #endif
     /* free loaded dlls array */
     dynarray_reset(&s1->loaded_dlls, &s1->nb_loaded_dlls);
@@ -936,6 +1004,48 @@ LIBTCCAPI int tcc_set_output_type(TCCState *s, int output_type)
     return 0;
 }
 
+LIBTCCAPI TCCState *tcc_new_unit(TCCState *s)
+{
+    TCCState *s1;
+    int i, nostdinc;
+
+    s1 = tcc_new();
+    /* the option flags come first in TCCState */
+    memcpy(s1, s, offsetof(TCCState, tcc_lib_path));
+    tcc_set_lib_path(s1, s->tcc_lib_path);
+    for (i = 0; i < s->nb_include_paths; i++)
+        dynarray_add(&s1->include_paths, &s1->nb_include_paths,
+                     tcc_strdup(s->include_paths[i]));
+    /* the default ones are already in the list of 's' */
+    for (i = 0; i < s->nb_sysinclude_paths; i++)
+        dynarray_add(&s1->sysinclude_paths, &s1->nb_sysinclude_paths,
+                     tcc_strdup(s->sysinclude_paths[i]));
+    nostdinc = s1->nostdinc;
+    s1->nostdinc = 1;
+    tcc_set_output_type(s1, TCC_OUTPUT_OBJ);
+    s1->nostdinc = nostdinc;
+
+    if (s->output_type == TCC_OUTPUT_MEMORY)
+        tcc_define_symbol(s1, "__TCC_RUN__", NULL);
+    if (s->cmdline_defs.size)
+        cstr_cat(&s1->cmdline_defs, s->cmdline_defs.data, s->cmdline_defs.size);
+    if (s->cmdline_incl.size)
+        cstr_cat(&s1->cmdline_incl, s->cmdline_incl.data, s->cmdline_incl.size);
+    s1->error_opaque = s->error_opaque;
+    s1->error_func = s->error_func;
+    s1->report_opaque = s->report_opaque;
+    s1->report_func = s->report_func;
+    return s1;
+}
+
+LIBTCCAPI void tcc_list_deps(TCCState *s, void *ctx,
+    void (*dep_cb)(void *ctx, const char *filename))
+{
+    int i;
+    for (i = 0; i < s->nb_target_deps; i++)
+        dep_cb(ctx, s->target_deps[i]);
+}
+
 LIBTCCAPI int tcc_add_include_path(TCCState *s, const char *pathname)
 {
     tcc_split_path(s, &s->include_paths, &s->nb_include_paths, pathname);
@@ -1233,6 +1343,32 @@ ST_FUNC void tcc_add_pragma_libs(TCCState *s1)
         tcc_add_library_err(s1, s1->pragma_libs[i]);
 }
 
+/* link 'libname' with the program, as a #pragma comment(lib,) would */
+LIBTCCAPI void tcc_add_pragma_lib(TCCState *s1, const char *libname)
+{
+    int i;
+    for (i = 0; i < s1->nb_pragma_libs; i++)
+        if (!strcmp(s1->pragma_libs[i], libname))
+            return;
+    dynarray_add(&s1->pragma_libs, &s1->nb_pragma_libs, tcc_strdup(libname));
+}
+
+LIBTCCAPI void tcc_list_pragma_libs(TCCState *s, void *ctx,
+    void (*lib_cb)(void *ctx, const char *libname))
+{
+    int i;
+    for (i = 0; i < s->nb_pragma_libs; i++)
+        lib_cb(ctx, s->pragma_libs[i]);
+}
+
+/* libraries of #pragma comment(lib,) in 'unit', to link with 's1' */
+ST_FUNC void tcc_merge_pragma_libs(TCCState *s1, TCCState *unit)
+{
+    int i;
+    for (i = 0; i < unit->nb_pragma_libs; i++)
+        tcc_add_pragma_lib(s1, unit->pragma_libs[i]);
+}
+
 LIBTCCAPI int tcc_add_symbol(TCCState *s1, const char *name, const void *val)
 {
 #ifdef TCC_TARGET_PE
@@ -1371,6 +1507,8 @@ static int tcc_set_linker(TCCState *s, const char *option)
         } else if (link_option(option, "e=", &p)
                ||  link_option(option, "entry=", &p)) {
             copy_linker_arg(&s->elf_entryname, p, 0);
+        } else if (link_option(option, "runtime-image=", &p)) {
+            copy_linker_arg(&s->runtime_image, p, 0);
         } else if (link_option(option, "fini=", &p)) {
             copy_linker_arg(&s->fini_symbol, p, 0);
             ignoring = 1;
@@ -1414,6 +1552,8 @@ static int tcc_set_linker(TCCState *s, const char *option)
             copy_linker_arg(&s->rpath, p, ':');
         } else if (link_option(option, "enable-new-dtags", &p)) {
             s->enable_new_dtags = 1;
+        } else if (ret = link_option(option, "?gc-sections", &p), ret) {
+            s->gc_sections = ret > 0;
         } else if (link_option(option, "section-alignment=", &p)) {
             s->section_align = strtoul(p, &end, 16);
         } else if (link_option(option, "soname=", &p)) {
@@ -1669,6 +1809,8 @@ static const FlagDef options_f[] = {
     { offsetof(TCCState, ms_extensions), 0, "ms-extensions" },
     { offsetof(TCCState, dollars_in_identifiers), 0, "dollars-in-identifiers" },
     { offsetof(TCCState, test_coverage), 0, "test-coverage" },
+    { offsetof(TCCState, tiered), 0, "tiered" },
+    { offsetof(TCCState, function_sections), 0, "function-sections" },
     { 0, 0, NULL }
 };
 
@@ -2208,8 +2350,13 @@ PUB_FUNC void tcc_print_stats(TCCState *s1, unsigned total_time)
         Section *s = s1->symtab;
         unsigned ms = s->data_offset + s->link->data_offset + s->hash->data_offset;
         unsigned rs = s1->run_size;
+#ifdef _WIN32
+        unsigned rm = rs; /* from tcc_malloc() */
+#else
+        unsigned rm = 0; /* mapped, see rt_mem() */
+#endif
         fprintf(stderr, ": %d to run, %d symbols, %d other,",
-            rs, ms, mem_cur_size - rs - ms);
+            rs, ms, mem_cur_size - rm - ms);
     }
 #endif
     fprintf(stderr, " %d max (bytes)\n", mem_max_size);
@@ -94,6 +94,21 @@ LIBTCCAPI int tcc_relocate(TCCState *s1);
 /* return symbol value or NULL if not found */
 LIBTCCAPI void *tcc_get_symbol(TCCState *s, const char *name);
 
+/* before tcc_relocate(s): bind 's' to the program 'prog', relocated
+   already.  Its undefined symbols resolve to definitions in 'prog', and
+   its writable data to the data of 'prog' with the same names, so that a
+   unit compiled again runs over the state of the program.  Returns -1
+   when some data is new or changed size.  Local data is found only in
+   programs compiled with -ftiered. */
+LIBTCCAPI int tcc_bind_program(TCCState *s, TCCState *prog);
+
+/* as tcc_bind_program(), for a program yet to run again with one of its
+   units replaced by 's': when 's' is relocated, the data of 'prog' it
+   binds to get their new initial values.  Its read-only data must be
+   unchanged, other units of 'prog' keep using their copy: tcc_relocate()
+   fails otherwise, with 'prog' unchanged. */
+LIBTCCAPI int tcc_relink_program(TCCState *s, TCCState *prog);
+
 /* list all (global) symbols and their values via 'symbol_cb()' */
 LIBTCCAPI void tcc_list_symbols(TCCState *s, void *ctx,
     void (*symbol_cb)(void *ctx, const char *name, const void *val));
@@ -109,6 +124,73 @@ LIBTCCAPI void *_tcc_setjmp(TCCState *s1, void *jmp_buf, void *top_func, void *l
 typedef int TCCBtFunc(void *udata, void *pc, const char *file, int line, const char* func, const char *msg);
 LIBTCCAPI void tcc_set_backtrace_func(TCCState *s1, void* userdata, TCCBtFunc*);
 
+/* code generation statistics, passed for each function once compiled */
+typedef struct TCCFuncReport {
+    const char *name;       /* function name */
+    const char *file;       /* source file where its body ends */
+    unsigned long size;     /* bytes emitted to its code section */
+    int spills;             /* registers saved to the stack */
+    int helper_calls;       /* calls to memmove/memset and libtcc1 helpers */
+    unsigned long long ns;  /* time spent parsing and generating it */
+} TCCFuncReport;
+typedef void TCCReportFunc(void *opaque, const TCCFuncReport *report);
+LIBTCCAPI void tcc_set_codegen_report(TCCState *s, void *opaque, TCCReportFunc *report_func);
+
+/* compile translation units on states of their own, for example one per
+   thread: tcc_new_unit() returns a TCC_OUTPUT_OBJ state with the compile
+   options of 's' (set its output type first), and once a unit compiled
+   tcc_add_object_state() merges its object into 's' like tcc_add_file()
+   would, with the libraries of its #pragma comment(lib,).  The unit must
+   still be deleted with tcc_delete(). */
+LIBTCCAPI TCCState *tcc_new_unit(TCCState *s);
+LIBTCCAPI int tcc_add_object_state(TCCState *s, TCCState *unit);
+
+/* list the files read by the compilations so far, when dependencies are
+   collected (options -MD or -MMD) */
+LIBTCCAPI void tcc_list_deps(TCCState *s, void *ctx,
+    void (*dep_cb)(void *ctx, const char *filename));
+
+/* list the libraries named by #pragma comment(lib,) so far */
+LIBTCCAPI void tcc_list_pragma_libs(TCCState *s, void *ctx,
+    void (*lib_cb)(void *ctx, const char *libname));
+/* link 'libname' with the program at tcc_relocate() / tcc_output_file()
+   time, like a #pragma comment(lib,) in its sources would */
+LIBTCCAPI void tcc_add_pragma_lib(TCCState *s, const char *libname);
+
+/* called on '#pragma snapshot' with everything before it parsed, so that
+   the host can fork the compiler there.  It may return source text to be
+   compiled in place of the rest of the file, read as file 'filename'. */
+typedef const char *TCCSnapshotFunc(void *opaque, const char **filename);
+LIBTCCAPI void tcc_set_snapshot_func(TCCState *s, void *opaque, TCCSnapshotFunc *snapshot_func);
+
+/* called once by tcc_relocate() with the (undecorated) names of all
+   undefined symbols, to fill in 'addrs' the addresses it knows.  Those
+   left NULL are looked up with dlsym() as usual. */
+typedef void TCCResolveFunc(void *opaque, int count, const char **names, void **addrs);
+LIBTCCAPI void tcc_set_resolve_func(TCCState *s, void *opaque, TCCResolveFunc *resolve_func);
+
+/* called by tcc_relocate() and when linking large images to run 'count'
+   calls of 'job(arg, index)' that are independent of each other, possibly
+   in parallel, returning once all of them are done */
+typedef void TCCJobFunc(void *arg, int index);
+typedef void TCCParallelFunc(void *opaque, int count, TCCJobFunc *job, void *arg);
+LIBTCCAPI void tcc_set_parallel_func(TCCState *s, void *opaque, TCCParallelFunc *parallel_func);
+
+/* called with the name of each function about to be compiled to place
+   its code: > 0 in ".text.hot", < 0 in ".text.unlikely", 0 in ".text"
+   as usual.  Functions with a section attribute stay where they are.
+   Linking lays out hot code first and cold code last. */
+typedef int TCCLayoutFunc(void *opaque, const char *name);
+LIBTCCAPI void tcc_set_layout_func(TCCState *s, void *opaque, TCCLayoutFunc *layout_func);
+
+/* with -ftest-coverage, the counters are written to 'filename'.tcov when
+   the program exits, also for programs run in memory and units merged by
+   tcc_add_object_state() (which write none otherwise).  Files output by
+   tcc_output_file() default to the output name.  The counters of each
+   unit are also listed between the symbols __start_tcov_units and
+   __stop_tcov_units, for hosts that do not run the destructors. */
+LIBTCCAPI void tcc_set_coverage_file(TCCState *s, const char *filename);
+
 #ifdef __cplusplus
 }
 #endif
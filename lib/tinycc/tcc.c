@@ -117,6 +117,7 @@ static const char help2[] =
     "  ms-extensions                 allow anonymous struct in struct\n"
     "  dollars-in-identifiers        allow '$' in C symbols\n"
     "  test-coverage                 create code coverage code\n"
+    "  function-sections             place each function in a section of its own\n"
     "-m... target specific options:\n"
     "  ms-bitfields                  use MSVC bitfield layout\n"
 #ifdef TCC_TARGET_ARM
@@ -130,6 +131,8 @@ static const char help2[] =
     "  -[no-]whole-archive           load lib(s) fully/only as needed\n"
     "  -export-all-symbols           same as -rdynamic\n"
     "  -export-dynamic               same as -rdynamic\n"
+    "  -[no-]gc-sections             drop code sections nothing refers to\n"
+    "  -runtime-image=               with -run, libtcc1 prelinked (make libtcc1.so)\n"
     "  -image-base= -Ttext=          set base address of executable\n"
     "  -section-alignment=           set section alignment in executable\n"
 #ifdef TCC_TARGET_PE
@@ -378,6 +378,24 @@ extern long double strtold (const char *__nptr, char **__endptr);
 # define CONFIG_TCC_SEMLOCK 1
 #endif
 
+/* keep the compiler globals (tccpp.c, tccgen.c, <target>-gen.c) in thread
+   local storage, so that threads can compile with different states at the
+   same time.  Without it, tcc_compile() serializes on a semaphore. */
+#ifndef CONFIG_TCC_TLS
+# if (defined __GNUC__ && !defined __TINYC__) || defined _MSC_VER
+#  define CONFIG_TCC_TLS 1
+# else
+#  define CONFIG_TCC_TLS 0
+# endif
+#endif
+#if !CONFIG_TCC_TLS
+# define TCC_TLS
+#elif defined _MSC_VER
+# define TCC_TLS __declspec(thread)
+#else
+# define TCC_TLS __thread
+#endif
+
 #if ONE_SOURCE
 #define ST_INLN static inline
 #define ST_FUNC static
@@ -537,7 +555,8 @@ struct SymAttr {
     dllimport   : 1,
     addrtaken   : 1,
     nodebug     : 1,
-    xxxx        : 2; /* not used */
+    vector      : 1, /* struct sym is a vector_size() type */
+    xxxx        : 1; /* not used */
 };
 
 /* function attributes or temporary attributes for parsing */
@@ -699,6 +718,7 @@ typedef struct AttributeDef {
     int alias_target; /* token */
     int asm_label; /* associated asm label */
     char attr_mode; /* __attribute__((__mode__(...))) */
+    int vector_size; /* __attribute__((vector_size(...))) */
 } AttributeDef;
 
 /* inline functions */
@@ -766,6 +786,7 @@ struct TCCState {
     unsigned char optimize; /* only to #define __OPTIMIZE__ */
     unsigned char option_pthread; /* -pthread option */
     unsigned char enable_new_dtags; /* -Wl,--enable-new-dtags */
+    unsigned char gc_sections; /* -Wl,--gc-sections: drop unreachable code */
     unsigned int  cversion; /* supported C ISO version, 199901 (the default), 201112, ... */
 
     /* C language options */
@@ -802,6 +823,8 @@ struct TCCState {
     unsigned char do_bounds_check;
 #endif
     unsigned char test_coverage;  /* generate test coverage code */
+    unsigned char tiered; /* -ftiered: patchable function entry slots */
+    unsigned char function_sections; /* -ffunction-sections */
 
     /* use GNU C extensions */
     unsigned char gnu_ext;
@@ -829,6 +852,7 @@ struct TCCState {
     char *soname; /* as specified on the command line (-soname) */
     char *rpath; /* as specified on the command line (-Wl,-rpath=) */
     char *elf_entryname; /* "_start" unless set */
+    char *runtime_image; /* -Wl,--runtime-image=: libtcc1 prelinked, for -run */
     char *init_symbol; /* symbols to call at load-time (not used currently) */
     char *fini_symbol; /* symbols to call at unload-time (not used currently) */
     char *mapfile; /* create a mapfile (not used currently) */
@@ -864,6 +888,28 @@ struct TCCState {
     /* -include options */
     CString cmdline_incl;
 
+    /* per-function code generation statistics */
+    void *report_opaque;
+    TCCReportFunc *report_func;
+
+    /* '#pragma snapshot' */
+    void *snapshot_opaque;
+    TCCSnapshotFunc *snapshot_func;
+
+    /* batch resolver of undefined symbols for tcc_relocate() */
+    void *resolve_opaque;
+    TCCResolveFunc *resolve_func;
+
+    /* runs the jobs relocating large images */
+    void *parallel_opaque;
+    TCCParallelFunc *parallel_func;
+
+    /* places the code of each function, see tcc_set_layout_func() */
+    void *layout_opaque;
+    TCCLayoutFunc *layout_func;
+    /* -ftest-coverage: where counters go, see tcc_set_coverage_file() */
+    char *tcov_file;
+
     /* error handling */
     void *error_opaque;
     void (*error_func)(void *opaque, const char *msg);
@@ -907,6 +953,9 @@ struct TCCState {
 
     Section **priv_sections;
     int nb_priv_sections; /* number of private sections */
+    /* load_object(): hash of the section names, by index in sections */
+    int *sec_hash;
+    int sec_hash_size, sec_hash_count; /* slots, sections hashed */
 
     /* predefined sections */
     Section *text_section, *data_section, *rodata_section, *bss_section;
@@ -989,6 +1038,10 @@ struct TCCState {
     const char *run_main; /* entry for tcc_run() */
     void *run_ptr; /* runtime_memory */
     unsigned run_size; /* size of runtime_memory  */
+    void *run_near; /* tcc_bind_program(): mapped within reach of this */
+    unsigned char relink; /* tcc_relink_program(): reset the data bound */
+    struct bind_data **bind_data; /* data of the program to reset or check */
+    int nb_bind_data;
 #ifdef _WIN64
     void *run_function_table; /* unwind data */
 #endif
@@ -1149,6 +1202,8 @@ struct filespec {
 #define TOK_SHL     '<' /* shift left */
 #define TOK_SAR     '>' /* signed shift right */
 #define TOK_SHR     0x8b /* unsigned shift right */
+#define TOK_UMULH   0x8c /* unsigned multiply, high half */
+#define TOK_SMULH   0x8d /* signed multiply, high half */
 #define TOK_NEG     TOK_MID /* unary minus operation (for floats) */
 
 #define TOK_ARROW   0xa0 /* -> */
@@ -1212,9 +1267,17 @@ enum tcc_token {
 
 /* ------------ libtcc.c ------------ */
 
-ST_DATA struct TCCState *tcc_state;
-ST_DATA void** stk_data;
-ST_DATA int nb_stk_data;
+ST_DATA TCC_TLS struct TCCState *tcc_state;
+ST_DATA TCC_TLS void** stk_data;
+ST_DATA TCC_TLS int nb_stk_data;
+
+/* the first error of a job run by s1->parallel_func(), which the thread
+   that started the jobs reports once they are done */
+typedef struct JobError {
+    int nb_errors;
+    char msg[256];
+} JobError;
+ST_DATA TCC_TLS JobError *job_error;
 
 /* public functions currently used by the tcc main function */
 ST_FUNC char *pstrcpy(char *buf, size_t buf_size, const char *s);
@@ -1311,6 +1374,7 @@ ST_FUNC void tcc_add_bcheck(TCCState *s1);
 ST_FUNC void tcc_add_btstub(TCCState *s1);
 #endif
 ST_FUNC void tcc_add_pragma_libs(TCCState *s1);
+ST_FUNC void tcc_merge_pragma_libs(TCCState *s1, TCCState *unit);
 PUB_FUNC int tcc_add_library_err(TCCState *s, const char *f);
 PUB_FUNC void tcc_print_stats(TCCState *s, unsigned total_time);
 PUB_FUNC int tcc_parse_args(TCCState *s, int *argc, char ***argv, int optind);
@@ -1319,6 +1383,7 @@ ST_FUNC char *normalize_slashes(char *path);
 #endif
 ST_FUNC DLLReference *tcc_add_dllref(TCCState *s1, const char *dllname, int level);
 ST_FUNC char *tcc_load_text(int fd);
+ST_FUNC unsigned long long tcc_clock_ns(void);
 /* for #pragma once */
 ST_FUNC int normalized_PATHCMP(const char *f1, const char *f2);
 
@@ -1334,18 +1399,18 @@ ST_FUNC int normalized_PATHCMP(const char *f1, const char *f2);
 
 /* ------------ tccpp.c ------------ */
 
-ST_DATA struct BufferedFile *file;
-ST_DATA int tok;
-ST_DATA CValue tokc;
-ST_DATA const int *macro_ptr;
-ST_DATA int parse_flags;
-ST_DATA int tok_flags;
-ST_DATA CString tokcstr; /* current parsed string, if any */
+ST_DATA TCC_TLS struct BufferedFile *file;
+ST_DATA TCC_TLS int tok;
+ST_DATA TCC_TLS CValue tokc;
+ST_DATA TCC_TLS const int *macro_ptr;
+ST_DATA TCC_TLS int parse_flags;
+ST_DATA TCC_TLS int tok_flags;
+ST_DATA TCC_TLS CString tokcstr; /* current parsed string, if any */
 
 /* display benchmark infos */
-ST_DATA int tok_ident;
-ST_DATA TokenSym **table_ident;
-ST_DATA int pp_expr;
+ST_DATA TCC_TLS int tok_ident;
+ST_DATA TCC_TLS TokenSym **table_ident;
+ST_DATA TCC_TLS int pp_expr;
 
 #define TOK_FLAG_BOL   0x0001 /* beginning of line before */
 #define TOK_FLAG_BOF   0x0002 /* beginning of file before */
@@ -1426,23 +1491,30 @@ static inline int toup(int c) {
 
 #define SYM_POOL_NB (8192 / sizeof(Sym))
 
-ST_DATA Sym *global_stack;
-ST_DATA Sym *local_stack;
-ST_DATA Sym *local_label_stack;
-ST_DATA Sym *global_label_stack;
-ST_DATA Sym *define_stack;
-ST_DATA CType int_type, func_old_type, char_pointer_type;
-ST_DATA SValue *vtop;
-ST_DATA int rsym, anon_sym, ind, loc;
-ST_DATA char debug_modes;
-
-ST_DATA int nocode_wanted; /* true if no code generation wanted for an expression */
-ST_DATA int global_expr;  /* true if compound literals must be allocated globally (used during initializers parsing */
-ST_DATA CType func_vt; /* current function return type (used by return instruction) */
-ST_DATA int func_var; /* true if current function is variadic */
-ST_DATA int func_vc;
-ST_DATA int func_ind;
-ST_DATA const char *funcname;
+/* -ftiered: one record per function with external linkage, in order
+   { void *target; addr_t count; const char *name; const char *file;
+     addr_t flags; }.  The function entry jumps through 'target' */
+#define TIER_SECTION "cjit_tier"
+#define TIER_RECORD_SIZE (5 * PTR_SIZE)
+#define TIER_ELIGIBLE 1
+
+ST_DATA TCC_TLS Sym *global_stack;
+ST_DATA TCC_TLS Sym *local_stack;
+ST_DATA TCC_TLS Sym *local_label_stack;
+ST_DATA TCC_TLS Sym *global_label_stack;
+ST_DATA TCC_TLS Sym *define_stack;
+ST_DATA TCC_TLS CType int_type, func_old_type, char_pointer_type;
+ST_DATA TCC_TLS SValue *vtop;
+ST_DATA TCC_TLS int rsym, anon_sym, ind, loc;
+ST_DATA TCC_TLS char debug_modes;
+
+ST_DATA TCC_TLS int nocode_wanted; /* true if no code generation wanted for an expression */
+ST_DATA TCC_TLS int global_expr;  /* true if compound literals must be allocated globally (used during initializers parsing */
+ST_DATA TCC_TLS CType func_vt; /* current function return type (used by return instruction) */
+ST_DATA TCC_TLS int func_var; /* true if current function is variadic */
+ST_DATA TCC_TLS int func_vc;
+ST_DATA TCC_TLS int func_ind;
+ST_DATA TCC_TLS const char *funcname;
 
 ST_FUNC void tccgen_init(TCCState *s1);
 ST_FUNC int tccgen_compile(TCCState *s1);
@@ -1520,7 +1592,7 @@ ST_FUNC int classify_x86_64_va_arg(CType *ty);
 #endif
 #ifdef CONFIG_TCC_BCHECK
 ST_FUNC void gbound_args(int nb_args);
-ST_DATA int func_bound_add_epilog;
+ST_DATA TCC_TLS int func_bound_add_epilog;
 #endif
 
 /* ------------ tccelf.c ------------ */
@@ -1549,6 +1621,12 @@ ST_FUNC void section_realloc(Section *sec, unsigned long new_size);
 ST_FUNC size_t section_add(Section *sec, addr_t size, int align);
 ST_FUNC void *section_ptr_add(Section *sec, addr_t size);
 ST_FUNC Section *find_section(TCCState *s1, const char *name);
+ST_FUNC int text_section_heat(Section *s);
+ST_FUNC const char *text_section_base(const char *name);
+ST_FUNC void gc_sections(TCCState *s1);
+/* st_shndx has 16 bits: past this many sections, the code of single
+   functions goes with the rest, leaving room for those the link adds */
+#define MAX_FUNCTION_SECTIONS (SHN_LORESERVE - 1024)
 ST_FUNC void free_section(Section *s);
 ST_FUNC Section *new_symtab(TCCState *s1, const char *symtab_name, int sh_type, int sh_flags, const char *strtab_name, const char *hash_name, int hash_sh_flags);
 ST_FUNC void init_symtab(Section *s);
@@ -1557,6 +1635,7 @@ ST_FUNC int put_elf_str(Section *s, const char *sym);
 ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size, int info, int other, int shndx, const char *name);
 ST_FUNC int set_elf_sym(Section *s, addr_t value, unsigned long size, int info, int other, int shndx, const char *name);
 ST_FUNC int find_elf_sym(Section *s, const char *name);
+ST_FUNC void reserve_elf_syms(Section *s, int nb);
 ST_FUNC void put_elf_reloc(Section *symtab, Section *s, unsigned long offset, int type, int symbol);
 ST_FUNC void put_elf_reloca(Section *symtab, Section *s, unsigned long offset, int type, int symbol, addr_t addend);
 
@@ -1592,6 +1671,7 @@ ST_FUNC void tccelf_add_crtend(TCCState *s1);
 #ifndef TCC_TARGET_PE
 ST_FUNC void tcc_add_runtime(TCCState *s1);
 #endif
+ST_FUNC void tcc_tcov_add_file(TCCState *s1, const char *filename);
 
 /* ------------ xxx-link.c ------------ */
 
@@ -1696,6 +1776,7 @@ ST_FUNC void gen_vla_result(int addr);
 #endif
 ST_FUNC void gen_cvt_sxtw(void);
 ST_FUNC void gen_cvt_csti(int t);
+ST_FUNC int gen_tier_entry(Sym *slot);
 #endif
 
 /* ------------ arm-gen.c ------------ */
@@ -1804,6 +1885,7 @@ ST_FUNC const char *dlerror(void);
 ST_FUNC void *dlsym(void *handle, const char *symbol);
 #endif
 ST_FUNC void tcc_run_free(TCCState *s1);
+ST_FUNC int tcc_add_runtime_image(TCCState *s1);
 #endif
 
 /* ------------ tcctools.c ----------------- */
@@ -19,6 +19,9 @@
  */
 
 #include "tcc.h"
+#ifndef _WIN32
+# include <sys/mman.h> /* mmap(), memfd_create() */
+#endif
 
 /* Define this to get some debug output during relocation processing.  */
 #undef DEBUG_RELOC
@@ -87,7 +90,7 @@ ST_FUNC void tccelf_new(TCCState *s)
     /* private symbol table for dynamic symbols */
     s->dynsymtab_section = new_symtab(s, ".dynsymtab", SHT_SYMTAB, SHF_PRIVATE|SHF_DYNSYM,
                                       ".dynstrtab",
-                                      ".dynhashtab", SHF_PRIVATE);
+                                      ".dynsym.hashtab", SHF_PRIVATE);
     get_sym_attr(s, 0, 1);
 
     if (s->do_debug) {
@@ -132,6 +135,7 @@ ST_FUNC void tccelf_delete(TCCState *s1)
     for(i = 1; i < s1->nb_sections; i++)
         free_section(s1->sections[i]);
     dynarray_reset(&s1->sections, &s1->nb_sections);
+    tcc_free(s1->sec_hash);
 
     for(i = 0; i < s1->nb_priv_sections; i++)
         free_section(s1->priv_sections[i]);
@@ -164,14 +168,26 @@ static void update_relocs(TCCState *s1, Section *s, int *old_to_new_syms, int fi
 ST_FUNC void tccelf_end_file(TCCState *s1)
 {
     Section *s = s1->symtab;
-    int first_sym, nb_syms, *tr, i;
+    int first_sym, nb_syms, nb_globals, *tr, i;
+    unsigned long str_start = s->link->sh_offset;
+    char *strtab;
 
     first_sym = s->sh_offset / sizeof (ElfSym);
     nb_syms = s->data_offset / sizeof (ElfSym) - first_sym;
+    /* names are rebuilt in place, read them from a copy: a name may
+       have been replaced by a longer one at the end (see tccgen_compile) */
+    strtab = tcc_malloc(s->link->data_offset - str_start + 1);
+    memcpy(strtab, s->link->data + str_start, s->link->data_offset - str_start);
     s->data_offset = s->sh_offset;
     s->link->data_offset = s->link->sh_offset;
     s->hash = s->reloc, s->reloc = NULL;
     tr = tcc_mallocz(nb_syms * sizeof *tr);
+    for (i = nb_globals = 0; i < nb_syms; ++i) {
+        ElfSym *sym = (ElfSym*)s->data + first_sym + i;
+        nb_globals += ELFW(ST_BIND)(sym->st_info) != STB_LOCAL
+                      || sym->st_shndx == SHN_UNDEF;
+    }
+    reserve_elf_syms(s, nb_globals);
 
     for (i = 0; i < nb_syms; ++i) {
         ElfSym *sym = (ElfSym*)s->data + first_sym + i;
@@ -190,11 +206,14 @@ ST_FUNC void tccelf_end_file(TCCState *s1)
             sym->st_info = ELFW(ST_INFO)(sym_bind, sym_type);
         }
         tr[i] = set_elf_sym(s, sym->st_value, sym->st_size, sym->st_info,
-            sym->st_other, sym->st_shndx, (char*)s->link->data + sym->st_name);
+            sym->st_other, sym->st_shndx, sym->st_name < str_start
+            ? (char*)s->link->data + sym->st_name
+            : strtab + (sym->st_name - str_start));
     }
     /* now update relocations */
     update_relocs(s1, s, tr, first_sym);
     tcc_free(tr);
+    tcc_free(strtab);
     /* record text/data/bss output for -bench info */
     for (i = 0; i < 4; ++i) {
         s = s1->sections[i + 1];
@@ -244,15 +263,74 @@ ST_FUNC Section *new_section(TCCState *s1, const char *name, int sh_type, int sh
     return sec;
 }
 
+/* Symbol tables find their global symbols through a private hash
+   section: a header, a bloom filter over the GNU hashes of the names
+   for the lookups that fail, the buckets, and for each symbol the next
+   one in its bucket and the hash of its name, kept so that the table
+   grows without hashing the names again.  The SysV and GNU hash
+   sections of output files are made apart, see update_gnu_hash(). */
+typedef struct SymHash {
+    int nb_buckets;     /* a power of two */
+    int nb_syms;        /* entries, one per symbol */
+    int nb_bloom;       /* words of the bloom filter, a power of two */
+    int nb_hashed;      /* global symbols in the buckets */
+} SymHash;
+
+typedef struct SymHashEntry {
+    int next;           /* next symbol in the bucket, 0 at the end */
+    unsigned hash;      /* elf_gnu_hash() of the name, 0 if local */
+} SymHashEntry;
+
+#define symhash_bloom(sh) ((unsigned *)((sh) + 1))
+#define symhash_buckets(sh) ((int *)symhash_bloom(sh) + (sh)->nb_bloom)
+#define symhash_entries(sh) ((SymHashEntry *)(symhash_buckets(sh) + (sh)->nb_buckets))
+
+static Elf32_Word elf_gnu_hash (const unsigned char *name)
+{
+    Elf32_Word h = 5381;
+    unsigned char c;
+
+    while ((c = *name++))
+        h = h * 33 + c;
+    return h;
+}
+
+static inline int symhash_bucket(SymHash *sh, unsigned h)
+{
+    return (h ^ (h >> 16)) & (sh->nb_buckets - 1);
+}
+
+static inline unsigned symhash_bloom_bits(unsigned h)
+{
+    return 1u << (h & 31) | 1u << (h >> 27);
+}
+
+static inline unsigned *symhash_bloom_word(SymHash *sh, unsigned h)
+{
+    return &symhash_bloom(sh)[(h >> 5) & (sh->nb_bloom - 1)];
+}
+
+/* empty the hash section of 's' for 'nb_buckets', without entries */
+static SymHash *symhash_reset(Section *s, int nb_buckets)
+{
+    Section *hs = s->hash;
+    int nb_bloom = nb_buckets > 1 ? nb_buckets / 2 : 1;
+    SymHash *sh;
+
+    hs->data_offset = 0;
+    sh = section_ptr_add(hs, sizeof *sh + (nb_bloom + nb_buckets) * sizeof(int));
+    memset(sh, 0, hs->data_offset);
+    sh->nb_buckets = nb_buckets;
+    sh->nb_bloom = nb_bloom;
+    return sh;
+}
+
 ST_FUNC void init_symtab(Section *s)
 {
-    int *ptr, nb_buckets = 1;
     put_elf_str(s->link, "");
     section_ptr_add(s, sizeof (ElfW(Sym)));
-    ptr = section_ptr_add(s->hash, (2 + nb_buckets + 1) * sizeof(int));
-    ptr[0] = nb_buckets;
-    ptr[1] = 1;
-    memset(ptr + 2, 0, (nb_buckets + 1) * sizeof(int));
+    symhash_reset(s, 1)->nb_syms = 1;
+    section_ptr_add(s->hash, sizeof(SymHashEntry));
 }
 
 ST_FUNC Section *new_symtab(TCCState *s1,
@@ -349,6 +427,135 @@ ST_FUNC Section *find_section(TCCState *s1, const char *name)
     return new_section(s1, name, SHT_PROGBITS, SHF_ALLOC);
 }
 
+/* whether section 'sname' is 'name' or one of its .<suffix> */
+static int section_in(const char *sname, const char *name, int len)
+{
+    return 0 == strncmp(sname, name, len)
+        && (sname[len] == 0 || sname[len] == '.');
+}
+
+/* where code sections go among the others: -1 for hot code, laid out
+   first, 1 for cold code, laid out last, see tcc_set_layout_func() */
+ST_FUNC int text_section_heat(Section *s)
+{
+    if (section_in(s->name, ".text.hot", 9))
+        return -1;
+    if (section_in(s->name, ".text.unlikely", 14))
+        return 1;
+    return 0;
+}
+
+/* the section the code of section 'name' goes with, when it is one of
+   a function: .text, or .text.hot and .text.unlikely for the code of
+   the layout.  NULL for these three and sections other than code */
+ST_FUNC const char *text_section_base(const char *name)
+{
+    if (section_in(name, ".text.hot", 9))
+        return name[9] ? ".text.hot" : NULL;
+    if (section_in(name, ".text.unlikely", 14))
+        return name[14] ? ".text.unlikely" : NULL;
+    if (section_in(name, ".text", 5))
+        return name[5] ? ".text" : NULL;
+    return NULL;
+}
+
+static void gc_mark(TCCState *s1, unsigned char *live, int *work, int *nb_work, int i)
+{
+    if (i > 0 && i < s1->nb_sections && !live[i])
+        live[i] = 1, work[(*nb_work)++] = i;
+}
+
+static void gc_mark_sym(TCCState *s1, unsigned char *live, int *work, int *nb_work,
+                        const char *name)
+{
+    int sym_index = name ? find_elf_sym(symtab_section, name) : 0;
+    if (sym_index)
+        gc_mark(s1, live, work, nb_work,
+                ((ElfW(Sym) *)symtab_section->data)[sym_index].st_shndx);
+}
+
+/* -Wl,--gc-sections: drop the code sections (.text and .text.*) which
+   nothing reachable refers to, walking relocations from the data
+   sections, kept whole, the entry point and the exported symbols.
+   Symbols of the dropped code become absolute zeroes, and those only
+   it referred to weak */
+ST_FUNC void gc_sections(TCCState *s1)
+{
+    int nb_sections = s1->nb_sections, nb_work = 0, i, dropped = 0;
+    unsigned char *live = tcc_mallocz(nb_sections);
+    int *work = tcc_malloc(nb_sections * sizeof(int));
+    int exported = s1->rdynamic || (s1->output_type & TCC_OUTPUT_DYN);
+    unsigned char *used;
+    ElfW(Sym) *sym;
+    ElfW_Rel *rel;
+    Section *s;
+
+    for (i = 1; i < nb_sections; i++) {
+        s = s1->sections[i];
+        if ((s->sh_flags & SHF_ALLOC) && !section_in(s->name, ".text", 5)
+            && strcmp(s->name, ".eh_frame"))
+            gc_mark(s1, live, work, &nb_work, i);
+    }
+    gc_mark_sym(s1, live, work, &nb_work, s1->elf_entryname);
+#ifdef TCC_IS_NATIVE
+    if (s1->output_type == TCC_OUTPUT_MEMORY) {
+        gc_mark_sym(s1, live, work, &nb_work, s1->run_main);
+        gc_mark_sym(s1, live, work, &nb_work, "main");
+    } else
+#endif
+    if (!s1->elf_entryname) {
+        gc_mark_sym(s1, live, work, &nb_work, "_start");
+    }
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (exported && ELFW(ST_BIND)(sym->st_info) != STB_LOCAL
+            && ELFW(ST_VISIBILITY)(sym->st_other) == STV_DEFAULT)
+            gc_mark(s1, live, work, &nb_work, sym->st_shndx);
+    }
+    while (nb_work) {
+        s = s1->sections[work[--nb_work]];
+        if (!s->reloc)
+            continue;
+        for_each_elem(s->reloc, 0, rel, ElfW_Rel) {
+            sym = &((ElfW(Sym) *)symtab_section->data)[ELFW(R_SYM)(rel->r_info)];
+            gc_mark(s1, live, work, &nb_work, sym->st_shndx);
+        }
+    }
+
+    for (i = 1; i < nb_sections; i++) {
+        s = s1->sections[i];
+        if (live[i] || !(s->sh_flags & SHF_ALLOC) || !section_in(s->name, ".text", 5))
+            continue;
+        live[i] = 2;
+        dropped += s->data_offset;
+        s->data_offset = 0;
+        s->sh_flags &= ~SHF_ALLOC;
+        if (s->reloc)
+            s->reloc->data_offset = 0;
+    }
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (sym->st_shndx < nb_sections && live[sym->st_shndx] == 2
+            && ELFW(ST_TYPE)(sym->st_info) != STT_SECTION)
+            sym->st_shndx = SHN_ABS, sym->st_value = 0;
+    }
+    /* what only the dropped code used may stay undefined */
+    used = tcc_mallocz(symtab_section->data_offset / sizeof(ElfW(Sym)));
+    for (i = 1; i < nb_sections; i++) {
+        s = s1->sections[i];
+        if (s->sh_type == SHT_RELX && s->link == symtab_section)
+            for_each_elem(s, 0, rel, ElfW_Rel)
+                used[ELFW(R_SYM)(rel->r_info)] = 1;
+    }
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (sym->st_shndx == SHN_UNDEF && !used[sym - (ElfW(Sym) *)symtab_section->data])
+            sym->st_info = ELFW(ST_INFO)(STB_WEAK, ELFW(ST_TYPE)(sym->st_info));
+    }
+    tcc_free(used);
+    if (s1->verbose)
+        printf("gc-sections: %d bytes of code dropped\n", dropped);
+    tcc_free(live);
+    tcc_free(work);
+}
+
 /* ------------------------------------------------------------------------- */
 
 ST_FUNC int put_elf_str(Section *s, const char *sym)
@@ -378,49 +585,69 @@ static ElfW(Word) elf_hash(const unsigned char *name)
     return h;
 }
 
-/* rebuild hash table of section s */
-/* NOTE: we do factorize the hash table code to go faster */
+/* rebuild hash table of section s, from the hashes kept for its
+   symbols */
 static void rebuild_hash(Section *s, unsigned int nb_buckets)
 {
     ElfW(Sym) *sym;
-    int *ptr, *hash, nb_syms, sym_index, h;
-    unsigned char *strtab;
+    SymHash *sh;
+    SymHashEntry *e;
+    unsigned *hashes, h;
+    int nb_syms, nb_known, sym_index, *buckets, b;
 
-    strtab = s->link->data;
     nb_syms = s->data_offset / sizeof(ElfW(Sym));
-
-    if (!nb_buckets)
-        nb_buckets = ((int*)s->hash->data)[0];
-
-    s->hash->data_offset = 0;
-    ptr = section_ptr_add(s->hash, (2 + nb_buckets + nb_syms) * sizeof(int));
-    ptr[0] = nb_buckets;
-    ptr[1] = nb_syms;
-    ptr += 2;
-    hash = ptr;
-    memset(hash, 0, (nb_buckets + 1) * sizeof(int));
-    ptr += nb_buckets + 1;
+    sh = (SymHash *)s->hash->data;
+    nb_known = sh->nb_syms < nb_syms ? sh->nb_syms : nb_syms;
+    hashes = tcc_malloc(nb_syms * sizeof *hashes);
+    e = symhash_entries(sh);
+    for (sym_index = 0; sym_index < nb_known; sym_index++)
+        hashes[sym_index] = e[sym_index].hash;
+
+    sh = symhash_reset(s, nb_buckets);
+    section_ptr_add(s->hash, nb_syms * sizeof(SymHashEntry));
+    sh = (SymHash *)s->hash->data;
+    sh->nb_syms = nb_syms;
+    buckets = symhash_buckets(sh);
+    e = symhash_entries(sh);
+    memset(e, 0, nb_syms * sizeof *e);
 
     sym = (ElfW(Sym) *)s->data + 1;
-    for(sym_index = 1; sym_index < nb_syms; sym_index++) {
+    for(sym_index = 1; sym_index < nb_syms; sym_index++, sym++) {
         if (ELFW(ST_BIND)(sym->st_info) != STB_LOCAL) {
-            h = elf_hash(strtab + sym->st_name) % nb_buckets;
-            *ptr = hash[h];
-            hash[h] = sym_index;
-        } else {
-            *ptr = 0;
+            h = sym_index < nb_known && hashes[sym_index] ? hashes[sym_index]
+                : elf_gnu_hash((unsigned char *)s->link->data + sym->st_name);
+            b = symhash_bucket(sh, h);
+            e[sym_index].next = buckets[b];
+            e[sym_index].hash = h;
+            buckets[b] = sym_index;
+            *symhash_bloom_word(sh, h) |= symhash_bloom_bits(h);
+            sh->nb_hashed++;
         }
-        ptr++;
-        sym++;
     }
+    tcc_free(hashes);
 }
 
-/* return the symbol number */
-ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size,
-    int info, int other, int shndx, const char *name)
+/* make room in the hash table of 's' for 'nb' more global symbols, so
+   that loading many symbols at once rebuilds it once at most */
+ST_FUNC void reserve_elf_syms(Section *s, int nb)
 {
-    int name_offset, sym_index;
-    int nbuckets, h;
+    SymHash *sh;
+    int nb_buckets;
+
+    if (!s->hash)
+        return;
+    sh = (SymHash *)s->hash->data;
+    nb_buckets = sh->nb_buckets;
+    while (sh->nb_hashed + nb > 2 * nb_buckets)
+        nb_buckets *= 2;
+    if (nb_buckets != sh->nb_buckets)
+        rebuild_hash(s, nb_buckets);
+}
+
+static int put_elf_sym_hash(Section *s, addr_t value, unsigned long size,
+    int info, int other, int shndx, const char *name, unsigned h)
+{
+    int name_offset, sym_index, b;
     ElfW(Sym) *sym;
     Section *hs;
 
@@ -439,53 +666,70 @@ ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size,
     sym_index = sym - (ElfW(Sym) *)s->data;
     hs = s->hash;
     if (hs) {
-        int *ptr, *base;
-        ptr = section_ptr_add(hs, sizeof(int));
-        base = (int *)hs->data;
+        SymHashEntry *e = section_ptr_add(hs, sizeof *e);
+        SymHash *sh = (SymHash *)hs->data;
+        sh->nb_syms++;
+        e->next = 0;
+        e->hash = 0;
         /* only add global or weak symbols. */
         if (ELFW(ST_BIND)(info) != STB_LOCAL) {
             /* add another hashing entry */
-            nbuckets = base[0];
-            h = elf_hash((unsigned char *)s->link->data + name_offset) % nbuckets;
-            *ptr = base[2 + h];
-            base[2 + h] = sym_index;
-            base[1]++;
+            b = symhash_bucket(sh, h);
+            e->next = symhash_buckets(sh)[b];
+            e->hash = h;
+            symhash_buckets(sh)[b] = sym_index;
+            *symhash_bloom_word(sh, h) |= symhash_bloom_bits(h);
             /* we resize the hash table */
-            hs->nb_hashed_syms++;
-            if (hs->nb_hashed_syms > 2 * nbuckets) {
-                rebuild_hash(s, 2 * nbuckets);
-            }
-        } else {
-            *ptr = 0;
-            base[1]++;
+            if (++sh->nb_hashed > 2 * sh->nb_buckets)
+                rebuild_hash(s, 2 * sh->nb_buckets);
         }
     }
     return sym_index;
 }
 
-ST_FUNC int find_elf_sym(Section *s, const char *name)
+/* return the symbol number */
+ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size,
+    int info, int other, int shndx, const char *name)
+{
+    unsigned h = 0;
+
+    if (s->hash && ELFW(ST_BIND)(info) != STB_LOCAL)
+        h = elf_gnu_hash((const unsigned char *)(name ? name : ""));
+    return put_elf_sym_hash(s, value, size, info, other, shndx, name, h);
+}
+
+static int find_elf_sym_hash(Section *s, const char *name, unsigned h)
 {
     ElfW(Sym) *sym;
-    Section *hs;
-    int nbuckets, sym_index, h;
-    const char *name1;
+    SymHash *sh;
+    SymHashEntry *e;
+    int sym_index;
 
-    hs = s->hash;
-    if (!hs)
+    if (!s->hash)
+        return 0;
+    sh = (SymHash *)s->hash->data;
+    if ((*symhash_bloom_word(sh, h) & symhash_bloom_bits(h)) != symhash_bloom_bits(h))
         return 0;
-    nbuckets = ((int *)hs->data)[0];
-    h = elf_hash((unsigned char *) name) % nbuckets;
-    sym_index = ((int *)hs->data)[2 + h];
+    e = symhash_entries(sh);
+    sym_index = symhash_buckets(sh)[symhash_bucket(sh, h)];
     while (sym_index != 0) {
-        sym = &((ElfW(Sym) *)s->data)[sym_index];
-        name1 = (char *) s->link->data + sym->st_name;
-        if (!strcmp(name, name1))
-            return sym_index;
-        sym_index = ((int *)hs->data)[2 + nbuckets + sym_index];
+        if (e[sym_index].hash == h) {
+            sym = &((ElfW(Sym) *)s->data)[sym_index];
+            if (!strcmp(name, (char *) s->link->data + sym->st_name))
+                return sym_index;
+        }
+        sym_index = e[sym_index].next;
     }
     return 0;
 }
 
+ST_FUNC int find_elf_sym(Section *s, const char *name)
+{
+    if (!s->hash)
+        return 0;
+    return find_elf_sym_hash(s, name, elf_gnu_hash((const unsigned char *)name));
+}
+
 /* return elf symbol value, signal error if 'err' is nonzero, decorate
    name if FORC */
 ST_FUNC addr_t get_sym_addr(TCCState *s1, const char *name, int err, int forc)
@@ -653,6 +897,7 @@ ST_FUNC int set_elf_sym(Section *s, addr_t value, unsigned long size,
     ElfW(Sym) *esym;
     int sym_bind, sym_index, sym_type, esym_bind;
     unsigned char sym_vis, esym_vis, new_vis;
+    unsigned h = 0;
 
     sym_bind = ELFW(ST_BIND)(info);
     sym_type = ELFW(ST_TYPE)(info);
@@ -660,7 +905,8 @@ ST_FUNC int set_elf_sym(Section *s, addr_t value, unsigned long size,
 
     if (sym_bind != STB_LOCAL) {
         /* we search global or weak symbols */
-        sym_index = find_elf_sym(s, name);
+        h = s->hash ? elf_gnu_hash((const unsigned char *)name) : 0;
+        sym_index = find_elf_sym_hash(s, name, h);
         if (!sym_index)
             goto do_def;
         esym = &((ElfW(Sym) *)s->data)[sym_index];
@@ -725,21 +971,19 @@ ST_FUNC int set_elf_sym(Section *s, addr_t value, unsigned long size,
         }
     } else {
     do_def:
-        sym_index = put_elf_sym(s, value, size,
-                                ELFW(ST_INFO)(sym_bind, sym_type), other,
-                                shndx, name);
+        sym_index = put_elf_sym_hash(s, value, size,
+                                     ELFW(ST_INFO)(sym_bind, sym_type), other,
+                                     shndx, name, h);
     }
     return sym_index;
 }
 
 /* put relocation */
-ST_FUNC void put_elf_reloca(Section *symtab, Section *s, unsigned long offset,
-                            int type, int symbol, addr_t addend)
+/* the relocation section of 's', created if it has none yet */
+static Section *reloc_section(Section *symtab, Section *s)
 {
-    TCCState *s1 = s->s1;
     char buf[256];
     Section *sr;
-    ElfW_Rel *rel;
 
     sr = s->reloc;
     if (!sr) {
@@ -753,7 +997,16 @@ ST_FUNC void put_elf_reloca(Section *symtab, Section *s, unsigned long offset,
         sr->sh_info = s->sh_num;
         s->reloc = sr;
     }
-    rel = section_ptr_add(sr, sizeof(ElfW_Rel));
+    return sr;
+}
+
+ST_FUNC void put_elf_reloca(Section *symtab, Section *s, unsigned long offset,
+                            int type, int symbol, addr_t addend)
+{
+    TCCState *s1 = s->s1;
+    ElfW_Rel *rel;
+
+    rel = section_ptr_add(reloc_section(symtab, s), sizeof(ElfW_Rel));
     rel->r_offset = offset;
     rel->r_info = ELFW(R_INFO)(symbol, type);
 #if SHT_RELX == SHT_RELA
@@ -862,6 +1115,45 @@ static void sort_syms(TCCState *s1, Section *s)
 /* See: https://flapenguin.me/elf-dt-gnu-hash */
 #define	ELFCLASS_BITS (PTR_SIZE * 8)
 
+/* the SysV hash section of the output, filled by update_gnu_hash() */
+static Section *create_sysv_hash(TCCState *s1)
+{
+    Section *dynsym = s1->dynsym;
+    Section *hash;
+    int nb_syms = dynsym->data_offset / sizeof(ElfW(Sym));
+    int nb_buckets = ((SymHash *)dynsym->hash->data)->nb_buckets;
+
+    hash = new_section(s1, ".hash", SHT_HASH, SHF_ALLOC);
+    hash->sh_entsize = sizeof(int);
+    hash->link = dynsym;
+    section_ptr_add(hash, (2 + nb_buckets + nb_syms) * sizeof(int));
+    return hash;
+}
+
+static void fill_sysv_hash(TCCState *s1, Section *dynsym, Section *hash)
+{
+    ElfW(Sym) *sym;
+    int *ptr, *buckets, *chain, nb_syms, nb_buckets, sym_index, h;
+    unsigned char *strtab = dynsym->link->data;
+
+    ptr = (int *)hash->data;
+    nb_buckets = ptr[0] = ((SymHash *)dynsym->hash->data)->nb_buckets;
+    nb_syms = ptr[1] = dynsym->data_offset / sizeof(ElfW(Sym));
+    if (hash->data_offset != (2 + nb_buckets + nb_syms) * sizeof(int))
+        tcc_error_noabort ("hash size incorrect");
+    buckets = ptr + 2;
+    chain = buckets + nb_buckets;
+    memset(buckets, 0, (nb_buckets + nb_syms) * sizeof(int));
+    sym = (ElfW(Sym) *)dynsym->data + 1;
+    for(sym_index = 1; sym_index < nb_syms; sym_index++, sym++) {
+        if (ELFW(ST_BIND)(sym->st_info) != STB_LOCAL) {
+            h = elf_hash(strtab + sym->st_name) % nb_buckets;
+            chain[sym_index] = buckets[h];
+            buckets[h] = sym_index;
+        }
+    }
+}
+
 static Section *create_gnu_hash(TCCState *s1)
 {
     int nb_syms, i, ndef, nbuckets, symoffset, bloom_size, bloom_shift;
@@ -871,7 +1163,7 @@ static Section *create_gnu_hash(TCCState *s1)
     Elf32_Word *ptr;
 
     gnu_hash = new_section(s1, ".gnu.hash", SHT_GNU_HASH, SHF_ALLOC);
-    gnu_hash->link = dynsym->hash->link;
+    gnu_hash->link = dynsym;
 
     nb_syms = dynsym->data_offset / sizeof(ElfW(Sym));
 
@@ -899,17 +1191,7 @@ static Section *create_gnu_hash(TCCState *s1)
     return gnu_hash;
 }
 
-static Elf32_Word elf_gnu_hash (const unsigned char *name)
-{
-    Elf32_Word h = 5381;
-    unsigned char c;
-
-    while ((c = *name++))
-        h = h * 33 + c;
-    return h;
-}
-
-static void update_gnu_hash(TCCState *s1, Section *gnu_hash)
+static void update_gnu_hash(TCCState *s1, Section *gnu_hash, Section *sysv_hash)
 {
     int *old_to_new_syms;
     ElfW(Sym) *new_syms;
@@ -1020,12 +1302,45 @@ static void update_gnu_hash(TCCState *s1, Section *gnu_hash)
 
     tcc_free(old_to_new_syms);
 
-    /* rebuild hash */
-    ptr = (Elf32_Word *) dynsym->hash->data;
-    rebuild_hash(dynsym, ptr[0]);
+    /* rebuild hash, the symbols moved */
+    ((SymHash *)dynsym->hash->data)->nb_syms = 0;
+    rebuild_hash(dynsym, ((SymHash *)dynsym->hash->data)->nb_buckets);
+    fill_sysv_hash(s1, dynsym, sysv_hash);
 }
 #endif /* ELF_OBJ_ONLY */
 
+#if defined TCC_IS_NATIVE && !defined TCC_TARGET_PE
+/* pass all undefined symbols to s1->resolve_func() at once, returning
+   their addresses by symbol index */
+static void **resolve_batch(TCCState *s1, Section *symtab)
+{
+    ElfW(Sym) *sym;
+    const char **names;
+    void **addrs, **by_index;
+    int *index, n = 0, nb_syms = symtab->data_offset / sizeof(ElfW(Sym));
+
+    names = tcc_malloc(nb_syms * sizeof *names);
+    index = tcc_malloc(nb_syms * sizeof *index);
+    for_each_elem(symtab, 1, sym, ElfW(Sym)) {
+        if (sym->st_shndx == SHN_UNDEF) {
+            names[n] = (char *) s1->symtab->link->data + sym->st_name
+                       + s1->leading_underscore;
+            index[n++] = sym - (ElfW(Sym) *)symtab->data;
+        }
+    }
+    addrs = tcc_mallocz((n + 1) * sizeof *addrs);
+    if (n)
+        s1->resolve_func(s1->resolve_opaque, n, (const char **)names, addrs);
+    by_index = tcc_mallocz(nb_syms * sizeof *by_index);
+    while (n--)
+        by_index[index[n]] = addrs[n];
+    tcc_free(addrs);
+    tcc_free(index);
+    tcc_free(names);
+    return by_index;
+}
+#endif
+
 /* relocate symbol table, resolve undefined symbols if do_resolve is
    true and output error if undefined symbol. */
 ST_FUNC void relocate_syms(TCCState *s1, Section *symtab, int do_resolve)
@@ -1033,6 +1348,12 @@ ST_FUNC void relocate_syms(TCCState *s1, Section *symtab, int do_resolve)
     ElfW(Sym) *sym;
     int sym_bind, sh_num;
     const char *name;
+#if defined TCC_IS_NATIVE && !defined TCC_TARGET_PE
+    void **resolved = NULL;
+
+    if (do_resolve == 1 && s1->resolve_func)
+        resolved = resolve_batch(s1, symtab);
+#endif
 
     for_each_elem(symtab, 1, sym, ElfW(Sym)) {
         sh_num = sym->st_shndx;
@@ -1043,8 +1364,10 @@ ST_FUNC void relocate_syms(TCCState *s1, Section *symtab, int do_resolve)
             /* Use ld.so to resolve symbol for us (for tcc -run) */
             if (do_resolve) {
 #if defined TCC_IS_NATIVE && !defined TCC_TARGET_PE
+                void *addr = resolved ? resolved[sym - (ElfW(Sym) *)symtab->data] : NULL;
                 /* dlsym() needs the undecorated name.  */
-                void *addr = dlsym(RTLD_DEFAULT, &name[s1->leading_underscore]);
+                if (addr == NULL)
+                    addr = dlsym(RTLD_DEFAULT, &name[s1->leading_underscore]);
 #if TARGETOS_OpenBSD || TARGETOS_FreeBSD || TARGETOS_NetBSD || TARGETOS_ANDROID
 		if (addr == NULL) {
 		    int i;
@@ -1082,21 +1405,23 @@ ST_FUNC void relocate_syms(TCCState *s1, Section *symtab, int do_resolve)
         }
     found: ;
     }
+#if defined TCC_IS_NATIVE && !defined TCC_TARGET_PE
+    tcc_free(resolved);
+#endif
 }
 
-/* relocate a given section (CPU dependent) by applying the relocations
-   in the associated relocation section */
-static void relocate_section(TCCState *s1, Section *s, Section *sr)
+/* apply the relocations 'rel' up to 'rel_end' of 'sr' to section 's'
+   (CPU dependent) */
+static void relocate_range(TCCState *s1, Section *s,
+                           ElfW_Rel *rel, ElfW_Rel *rel_end)
 {
-    ElfW_Rel *rel;
     ElfW(Sym) *sym;
     int type, sym_index;
     unsigned char *ptr;
     addr_t tgt, addr;
     int is_dwarf = s->sh_num >= s1->dwlo && s->sh_num < s1->dwhi;
 
-    qrel = (ElfW_Rel *)sr->data;
-    for_each_elem(sr, 0, rel, ElfW_Rel) {
+    for (; rel < rel_end; rel++) {
         ptr = s->data + rel->r_offset;
         sym_index = ELFW(R_SYM)(rel->r_info);
         sym = &((ElfW(Sym) *)symtab_section->data)[sym_index];
@@ -1114,6 +1439,12 @@ static void relocate_section(TCCState *s1, Section *s, Section *sr)
         addr = s->sh_addr + rel->r_offset;
         relocate(s1, rel, type, ptr, addr, tgt);
     }
+}
+
+/* finish relocating section 's' once relocate_range() was applied to all
+   of 'sr' */
+static void relocate_section_end(TCCState *s1, Section *s, Section *sr)
+{
 #ifndef ELF_OBJ_ONLY
     /* if the relocation is allocated, we change its symbol table */
     if (sr->sh_flags & SHF_ALLOC) {
@@ -1133,24 +1464,132 @@ static void relocate_section(TCCState *s1, Section *s, Section *sr)
 #endif
 }
 
+/* relocate a given section by applying the relocations in the
+   associated relocation section */
+static void relocate_section(TCCState *s1, Section *s, Section *sr)
+{
+    qrel = (ElfW_Rel *)sr->data;
+    relocate_range(s1, s, (ElfW_Rel *)sr->data,
+                   (ElfW_Rel *)(sr->data + sr->data_offset));
+    relocate_section_end(s1, s, sr);
+}
+
+static int relocate_this_section(TCCState *s1, Section *s)
+{
+#ifndef TCC_TARGET_MACHO
+    return s != s1->got
+        || s1->static_link
+        || s1->output_type == TCC_OUTPUT_MEMORY;
+#else
+    return 1;
+#endif
+}
+
+#ifdef RELOCATE_PARALLEL
+/* fewest relocations in an image for them to be applied in parallel,
+   and how many a job applies */
+#define RELOC_PARALLEL_MIN (64 * 1024)
+#define RELOC_JOB_SIZE (16 * 1024)
+
+typedef struct RelocJob {
+    Section *s;
+    ElfW_Rel *rel, *rel_end;
+    JobError error;
+} RelocJob;
+
+typedef struct RelocJobs {
+    TCCState *s1;
+    RelocJob *jobs;
+    int nb_jobs;
+} RelocJobs;
+
+static void relocate_job(void *arg, int index)
+{
+    RelocJobs *rj = arg;
+    RelocJob *job = &rj->jobs[index];
+    job_error = &job->error;
+    relocate_range(rj->s1, job->s, job->rel, job->rel_end);
+    job_error = NULL;
+}
+
+/* apply all relocations through s1->parallel_func() in jobs of about
+   RELOC_JOB_SIZE, when there are enough of them and none produces
+   dynamic relocations (those are appended to the output in order).
+   Errors of the jobs are reported here, in order, after all are done.
+   Returns 0 if the image is left to relocate one section after the
+   other, else relocate_section_end() remains to be done. */
+static int relocate_sections_parallel(TCCState *s1)
+{
+    RelocJobs rj;
+    ElfW_Rel *rel, *rel_end, *cut;
+    Section *s, *sr;
+    int i, nb_rels = 0;
+
+    if (!CONFIG_TCC_TLS || !s1->parallel_func
+        || (s1->output_type & TCC_OUTPUT_DYN))
+        return 0;
+    for (i = 1; i < s1->nb_sections; ++i) {
+        sr = s1->sections[i];
+        if (sr->sh_type == SHT_RELX)
+            nb_rels += sr->data_offset / sizeof(ElfW_Rel);
+    }
+    if (nb_rels < RELOC_PARALLEL_MIN)
+        return 0;
+
+    rj.s1 = s1;
+    rj.jobs = tcc_malloc((nb_rels / RELOC_JOB_SIZE + s1->nb_sections)
+                         * sizeof *rj.jobs);
+    rj.nb_jobs = 0;
+    for (i = 1; i < s1->nb_sections; ++i) {
+        sr = s1->sections[i];
+        if (sr->sh_type != SHT_RELX)
+            continue;
+        s = s1->sections[sr->sh_info];
+        if (!relocate_this_section(s1, s))
+            continue;
+        rel = (ElfW_Rel *)sr->data;
+        rel_end = (ElfW_Rel *)(sr->data + sr->data_offset);
+        while (rel < rel_end) {
+            cut = rel_end - rel > RELOC_JOB_SIZE ? rel + RELOC_JOB_SIZE : rel_end;
+            while (cut < rel_end
+                   && RELOC_WITH_NEXT(ELFW(R_TYPE)(cut[-1].r_info)))
+                cut++;
+            rj.jobs[rj.nb_jobs].s = s;
+            rj.jobs[rj.nb_jobs].rel = rel;
+            rj.jobs[rj.nb_jobs].rel_end = cut;
+            rj.jobs[rj.nb_jobs].error.nb_errors = 0;
+            rj.nb_jobs++;
+            rel = cut;
+        }
+    }
+    s1->parallel_func(s1->parallel_opaque, rj.nb_jobs, relocate_job, &rj);
+    for (i = 0; i < rj.nb_jobs; i++)
+        if (rj.jobs[i].error.nb_errors)
+            tcc_error_noabort("%s", rj.jobs[i].error.msg);
+    tcc_free(rj.jobs);
+    return 1;
+}
+#endif
+
 /* relocate all sections */
 ST_FUNC void relocate_sections(TCCState *s1)
 {
-    int i;
+    int i, done = 0;
     Section *s, *sr;
 
+#ifdef RELOCATE_PARALLEL
+    done = relocate_sections_parallel(s1);
+#endif
     for (i = 1; i < s1->nb_sections; ++i) {
         sr = s1->sections[i];
         if (sr->sh_type != SHT_RELX)
             continue;
         s = s1->sections[sr->sh_info];
-#ifndef TCC_TARGET_MACHO
-        if (s != s1->got
-            || s1->static_link
-            || s1->output_type == TCC_OUTPUT_MEMORY)
-#endif
-        {
-            relocate_section(s1, s, sr);
+        if (relocate_this_section(s1, s)) {
+            if (done)
+                relocate_section_end(s1, s, sr);
+            else
+                relocate_section(s1, s, sr);
         }
 #ifndef ELF_OBJ_ONLY
         if (sr->sh_flags & SHF_ALLOC) {
@@ -1639,7 +2078,7 @@ ST_FUNC void tcc_add_btstub(TCCState *s1)
 }
 #endif /* def CONFIG_TCC_BACKTRACE */
 
-static void tcc_tcov_add_file(TCCState *s1, const char *filename)
+ST_FUNC void tcc_tcov_add_file(TCCState *s1, const char *filename)
 {
     CString cstr;
     void *ptr;
@@ -1672,6 +2111,11 @@ static void tcc_tcov_add_file(TCCState *s1, const char *filename)
         "__attribute__((destructor)) static void __tcov_exit() {"
         "__store_test_coverage(__tcov_data);"
         "}");
+    if (s1->tcov_file)
+        /* for hosts running programs in memory without their destructors */
+        cstr_printf(&cstr,
+            "__attribute__((section(\"tcov_units\")))"
+            "static char **__tcov_unit = __tcov_data;");
     tcc_compile_string_no_debug(s1, cstr.data);
     cstr_free(&cstr);
     set_local_sym(s1, &"___tcov_data"[!s1->leading_underscore], tcov_section, 0);
@@ -1786,8 +2230,14 @@ ST_FUNC void tcc_add_runtime(TCCState *s1)
 #if defined TCC_TARGET_ARM && TARGETOS_FreeBSD
         tcc_add_library_err(s1, "gcc_s"); // unwind code
 #endif
-        if (TCC_LIBTCC1[0])
+        if (TCC_LIBTCC1[0]) {
+#ifdef TCC_IS_NATIVE
+            /* libtcc1.a still defines what the image has not, such as
+               __dso_handle, which is per program */
+            tcc_add_runtime_image(s1);
+#endif
             tcc_add_support(s1, TCC_LIBTCC1);
+        }
 #ifndef TCC_TARGET_MACHO
         if (s1->output_type != TCC_OUTPUT_MEMORY)
             tccelf_add_crtend(s1);
@@ -2127,6 +2577,7 @@ struct dyn_inf {
     int phnum;
     Section *interp;
     Section *note;
+    Section *hash;
     Section *gnu_hash;
 
     /* read only segment mapping for GNU_RELRO */
@@ -2190,7 +2641,7 @@ static int sort_sections(TCCState *s1, int *sec_order, Section *interp)
             if (s->sh_type == SHT_NOTE)
                 k = 0x60;
             if (s->sh_flags & SHF_EXECINSTR)
-                k = 0x70;
+                k = 0x70 + text_section_heat(s);
             if (s->sh_type == SHT_NOBITS)
                 k = 0x80;
             if (s == interp)
@@ -2414,7 +2865,7 @@ static void fill_dynamic(TCCState *s1, struct dyn_inf *dyninf)
     Section *s;
 
     /* put dynamic section entries */
-    put_dt(dynamic, DT_HASH, s1->dynsym->hash->sh_addr);
+    put_dt(dynamic, DT_HASH, dyninf->hash->sh_addr);
     put_dt(dynamic, DT_GNU_HASH, dyninf->gnu_hash->sh_addr);
     put_dt(dynamic, DT_STRTAB, dyninf->dynstr->sh_addr);
     put_dt(dynamic, DT_SYMTAB, s1->dynsym->sh_addr);
@@ -2793,6 +3244,52 @@ static Section *create_bsd_note_section(TCCState *s1,
 }
 #endif
 
+/* put the code of sections of single functions, as -ffunction-sections
+   makes, back with the rest of its kind once -Wl,--gc-sections had them:
+   files get one .text rather than a section for each function */
+static void merge_text_sections(TCCState *s1)
+{
+    int nb_sections = s1->nb_sections, i, *to;
+    addr_t *offset;
+    const char *base;
+    ElfW(Sym) *sym;
+    ElfW_Rel *rel, *r;
+    Section *s, *t;
+
+    to = tcc_mallocz(nb_sections * sizeof(int));
+    offset = tcc_malloc(nb_sections * sizeof(addr_t));
+    for (i = 1; i < nb_sections; i++) {
+        s = s1->sections[i];
+        if (s->sh_type != SHT_PROGBITS || !(s->sh_flags & SHF_ALLOC)
+            || !(s->sh_flags & SHF_EXECINSTR)
+            || !(base = text_section_base(s->name)))
+            continue;
+        t = find_section(s1, base);
+        t->sh_flags |= SHF_EXECINSTR;
+        offset[i] = section_add(t, s->data_offset, s->sh_addralign);
+        memcpy(t->data + offset[i], s->data, s->data_offset);
+        to[i] = t->sh_num;
+        if (s->reloc) {
+            for_each_elem(s->reloc, 0, rel, ElfW_Rel) {
+                r = section_ptr_add(reloc_section(symtab_section, t), sizeof *r);
+                *r = *rel;
+                r->r_offset += offset[i];
+            }
+            s->reloc->data_offset = 0;
+        }
+        s->data_offset = 0;
+        s->sh_flags &= ~SHF_ALLOC;
+    }
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (sym->st_shndx < nb_sections && to[sym->st_shndx]) {
+            sym->st_value += offset[sym->st_shndx];
+            sym->st_shndx = to[sym->st_shndx];
+        }
+    }
+    tcc_free(to);
+    tcc_free(offset);
+}
+
 static void alloc_sec_names(TCCState *s1, int is_obj);
 
 /* Output an elf, coff or binary file */
@@ -2829,6 +3326,9 @@ static int elf_output_file(TCCState *s1, const char *filename)
         /* if linking, also link in runtime libraries (libc, libgcc, etc.) */
         tcc_add_runtime(s1);
 	resolve_common_syms(s1);
+        if (s1->gc_sections)
+            gc_sections(s1);
+        merge_text_sections(s1);
 
         if (!s1->static_link) {
             if (file_type & TCC_OUTPUT_EXE) {
@@ -2848,7 +3348,7 @@ static int elf_output_file(TCCState *s1, const char *filename)
             /* add dynamic symbol table */
             s1->dynsym = new_symtab(s1, ".dynsym", SHT_DYNSYM, SHF_ALLOC,
                                     ".dynstr",
-                                    ".hash", SHF_ALLOC);
+                                    ".dynsym.hashtab", SHF_PRIVATE);
 	    /* Number of local symbols (readelf complains if not set) */
 	    s1->dynsym->sh_info = 1;
             dynstr = s1->dynsym->link;
@@ -2871,6 +3371,7 @@ static int elf_output_file(TCCState *s1, const char *filename)
                 /* shared library case: simply export all global symbols */
                 export_global_syms(s1);
             }
+	    dyninf.hash = create_sysv_hash(s1);
 	    dyninf.gnu_hash = create_gnu_hash(s1);
         } else {
             build_got_entries(s1, 0);
@@ -2950,7 +3451,7 @@ static int elf_output_file(TCCState *s1, const char *filename)
             fill_local_got_entries(s1);
 
     if (dyninf.gnu_hash)
-        update_gnu_hash(s1, dyninf.gnu_hash);
+        update_gnu_hash(s1, dyninf.gnu_hash, dyninf.hash);
 
     /* Create the ELF file with name 'filename' */
     ret = tcc_write_elf_file(s1, filename, dyninf.phnum, dyninf.phdr, file_offset, sec_order);
@@ -2979,8 +3480,8 @@ static void alloc_sec_names(TCCState *s1, int is_obj)
     strsec->sh_size = strsec->data_offset;
 }
 
-/* Output an elf .o file */
-static int elf_output_obj(TCCState *s1, const char *filename)
+/* Output an elf .o file, to 'f' if not NULL */
+static int elf_output_obj(TCCState *s1, const char *filename, FILE *f)
 {
     Section *s;
     int i, ret, file_offset;
@@ -2995,6 +3496,8 @@ static int elf_output_obj(TCCState *s1, const char *filename)
         if (s->sh_type != SHT_NOBITS)
             file_offset += s->sh_size;
     }
+    if (f)
+        return tcc_output_elf(s1, f, 0, NULL, file_offset, NULL);
     /* Create the ELF file with name 'filename' */
     ret = tcc_write_elf_file(s1, filename, 0, NULL, file_offset, NULL);
     return ret;
@@ -3003,9 +3506,9 @@ static int elf_output_obj(TCCState *s1, const char *filename)
 LIBTCCAPI int tcc_output_file(TCCState *s, const char *filename)
 {
     if (s->test_coverage)
-        tcc_tcov_add_file(s, filename);
+        tcc_tcov_add_file(s, s->tcov_file ? s->tcov_file : filename);
     if (s->output_type == TCC_OUTPUT_OBJ)
-        return elf_output_obj(s, filename);
+        return elf_output_obj(s, filename, NULL);
 #ifdef TCC_TARGET_PE
     return  pe_output_file(s, filename);
 #elif TCC_TARGET_MACHO
@@ -3015,6 +3518,36 @@ LIBTCCAPI int tcc_output_file(TCCState *s, const char *filename)
 #endif
 }
 
+LIBTCCAPI int tcc_add_object_state(TCCState *s1, TCCState *unit)
+{
+    FILE *f = NULL;
+    int ret;
+
+    if (unit->output_type != TCC_OUTPUT_OBJ || unit->nb_errors)
+        return -1;
+    if (unit->test_coverage && unit->tcov_file)
+        tcc_tcov_add_file(unit, unit->tcov_file);
+    /* pass the object through memory rather than a named file */
+#if defined __linux__ && defined MFD_CLOEXEC
+    {
+        int fd = memfd_create("tcc-unit", MFD_CLOEXEC);
+        if (fd >= 0 && (f = fdopen(fd, "w+b")) == NULL)
+            close(fd);
+    }
+#endif
+    if (!f)
+        f = tmpfile();
+    if (!f)
+        return tcc_error_noabort("could not create object buffer: %s", strerror(errno));
+    ret = elf_output_obj(unit, NULL, f);
+    if (ret == 0 && fflush(f) == 0)
+        ret = tcc_load_object_file(s1, fileno(f), 0);
+    fclose(f);
+    if (ret == 0)
+        tcc_merge_pragma_libs(s1, unit);
+    return ret;
+}
+
 ST_FUNC ssize_t full_read(int fd, void *buf, size_t count) {
     char *cbuf = buf;
     size_t rnum = 0;
@@ -3037,6 +3570,76 @@ ST_FUNC void *load_data(int fd, unsigned long file_offset, unsigned long size)
     return data;
 }
 
+/* an input file, mapped read-only (or read in once when small or where
+   mmap is missing) so that its headers, symbols and strings are parsed
+   in place */
+typedef struct MappedFile {
+    const uint8_t *data;
+    unsigned long size;
+    int mapped;
+} MappedFile;
+
+static int map_file(int fd, MappedFile *f)
+{
+    off_t size = lseek(fd, 0, SEEK_END);
+    if (size < 0)
+        return -1;
+    f->size = size;
+    f->mapped = 0;
+#ifndef _WIN32
+    /* below that, a read costs less than mapping and faulting pages in */
+    if (size >= 64 * 1024) {
+        void *p = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            f->data = p;
+            f->mapped = 1;
+            return 0;
+        }
+    }
+#endif
+    f->data = load_data(fd, 0, size);
+    return 0;
+}
+
+static void unmap_file(MappedFile *f)
+{
+#ifndef _WIN32
+    if (f->mapped) {
+        munmap((void *)f->data, f->size);
+        return;
+    }
+#endif
+    tcc_free((void *)f->data);
+}
+
+/* an ELF file or archive member being loaded from a MappedFile, with the
+   copies made of its structures that were not aligned in place */
+typedef struct ElfImage {
+    const uint8_t *data;
+    unsigned long size;
+    void **copies;
+    int nb_copies;
+} ElfImage;
+
+/* 'size' bytes at 'offset' of 'img', in place when aligned for 'align',
+   otherwise copied (tcc itself only aligns its section headers to 4 and
+   ar its members to 2); NULL if out of bounds */
+static const void *image_data(ElfImage *img, unsigned long offset,
+                              unsigned long size, unsigned align)
+{
+    const uint8_t *p;
+    void *copy;
+
+    if (offset > img->size || size > img->size - offset)
+        return NULL;
+    p = img->data + offset;
+    if (0 == ((uintptr_t)p & (align - 1)))
+        return p;
+    copy = tcc_malloc(size);
+    dynarray_add(&img->copies, &img->nb_copies, copy);
+    return memcpy(copy, p, size);
+}
+
 typedef struct SectionMergeInfo {
     Section *s;            /* corresponding existing section */
     unsigned long offset;  /* offset of the new section in the existing section */
@@ -3063,26 +3666,63 @@ ST_FUNC int tcc_object_type(int fd, ElfW(Ehdr) *h)
     return 0;
 }
 
-/* load an object file and merge it with current files */
+static int sec_hash_slot(TCCState *s1, const char *name)
+{
+    int i, j, mask = s1->sec_hash_size - 1;
+
+    for (i = elf_hash((const unsigned char *)name) & mask;
+         (j = s1->sec_hash[i]) != 0; i = (i + 1) & mask)
+        if (!strcmp(s1->sections[j]->name, name))
+            break;
+    return i;
+}
+
+/* the first section of 's1' named 'name', through a hash of their
+   names brought up to date with the sections added since the last
+   call: objects built with -ffunction-sections have a section for each
+   function, too many to compare every name of every object with */
+static Section *find_merge_section(TCCState *s1, const char *name)
+{
+    int i, j, n = s1->nb_sections;
+
+    if (n < s1->sec_hash_count || 2 * n > s1->sec_hash_size) {
+        for (s1->sec_hash_size = 64; s1->sec_hash_size < 4 * n; )
+            s1->sec_hash_size *= 2;
+        tcc_free(s1->sec_hash);
+        s1->sec_hash = tcc_mallocz(s1->sec_hash_size * sizeof(int));
+        s1->sec_hash_count = 1;
+    }
+    for (; s1->sec_hash_count < n; s1->sec_hash_count++) {
+        i = sec_hash_slot(s1, s1->sections[s1->sec_hash_count]->name);
+        if (!s1->sec_hash[i])
+            s1->sec_hash[i] = s1->sec_hash_count;
+    }
+    j = s1->sec_hash[sec_hash_slot(s1, name)];
+    return j ? s1->sections[j] : NULL;
+}
+
+/* merge the object file image 'img' with current files, reading its
+   headers, symbols and strings in place */
 /* XXX: handle correctly stab (debug) info */
-ST_FUNC int tcc_load_object_file(TCCState *s1,
-                                int fd, unsigned long file_offset)
+static int load_object(TCCState *s1, ElfImage *img)
 {
     ElfW(Ehdr) ehdr;
-    ElfW(Shdr) *shdr, *sh;
-    unsigned long size, offset, offseti;
+    const ElfW(Shdr) *shdr, *sh;
+    unsigned long size, offset, offseti, align;
     int i, j, nb_syms, sym_index, ret, seencompressed;
-    char *strsec, *strtab;
+    const char *strsec, *strtab;
     int stab_index, stabstr_index;
     int *old_to_new_syms;
-    char *sh_name, *name;
+    const char *sh_name, *name;
     SectionMergeInfo *sm_table, *sm;
-    ElfW(Sym) *sym, *symtab;
+    const ElfW(Sym) *sym, *symtab;
     ElfW_Rel *rel;
     Section *s;
 
-    lseek(fd, file_offset, SEEK_SET);
-    if (tcc_object_type(fd, &ehdr) != AFF_BINTYPE_REL)
+    if (img->size < sizeof ehdr)
+        goto invalid;
+    memcpy(&ehdr, img->data, sizeof ehdr);
+    if (memcmp(&ehdr, ELFMAG, 4) || ehdr.e_type != ET_REL)
         goto invalid;
     /* test CPU specific stuff */
     if (ehdr.e_ident[5] != ELFDATA2LSB ||
@@ -3090,16 +3730,20 @@ ST_FUNC int tcc_load_object_file(TCCState *s1,
 invalid:
         return tcc_error_noabort("invalid object file");
     }
-    /* read sections */
-    shdr = load_data(fd, file_offset + ehdr.e_shoff,
-                     sizeof(ElfW(Shdr)) * ehdr.e_shnum);
-    sm_table = tcc_mallocz(sizeof(SectionMergeInfo) * ehdr.e_shnum);
+    /* sections */
+    shdr = image_data(img, ehdr.e_shoff,
+                      sizeof(ElfW(Shdr)) * ehdr.e_shnum, sizeof(ElfW(Addr)));
+    if (!shdr || ehdr.e_shstrndx >= ehdr.e_shnum)
+        goto invalid;
 
-    /* load section names */
+    /* section names */
     sh = &shdr[ehdr.e_shstrndx];
-    strsec = load_data(fd, file_offset + sh->sh_offset, sh->sh_size);
+    strsec = image_data(img, sh->sh_offset, sh->sh_size, 1);
+    if (!strsec)
+        goto invalid;
+    sm_table = tcc_mallocz(sizeof(SectionMergeInfo) * ehdr.e_shnum);
 
-    /* load symtab and strtab */
+    /* symtab and strtab */
     old_to_new_syms = NULL;
     symtab = NULL;
     strtab = NULL;
@@ -3116,12 +3760,17 @@ invalid:
                 goto the_end;
             }
             nb_syms = sh->sh_size / sizeof(ElfW(Sym));
-            symtab = load_data(fd, file_offset + sh->sh_offset, sh->sh_size);
+            symtab = image_data(img, sh->sh_offset, sh->sh_size,
+                                sizeof(ElfW(Addr)));
             sm_table[i].s = symtab_section;
 
-            /* now load strtab */
+            /* now strtab */
             sh = &shdr[sh->sh_link];
-            strtab = load_data(fd, file_offset + sh->sh_offset, sh->sh_size);
+            strtab = image_data(img, sh->sh_offset, sh->sh_size, 1);
+            if (!symtab || !strtab) {
+                tcc_error_noabort("invalid object file");
+                goto the_end;
+            }
         }
 	if (sh->sh_flags & SHF_COMPRESSED)
 	    seencompressed = 1;
@@ -3157,35 +3806,37 @@ invalid:
 
 	sh = &shdr[i];
         sh_name = strsec + sh->sh_name;
-        if (sh->sh_addralign < 1)
-            sh->sh_addralign = 1;
+        align = sh->sh_addralign < 1 ? 1 : sh->sh_addralign;
         /* find corresponding section, if any */
-        for(j = 1; j < s1->nb_sections;j++) {
-            s = s1->sections[j];
-            if (!strcmp(s->name, sh_name)) {
-                if (!strncmp(sh_name, ".gnu.linkonce",
-                             sizeof(".gnu.linkonce") - 1)) {
-                    /* if a 'linkonce' section is already present, we
-                       do not add it again. It is a little tricky as
-                       symbols can still be defined in
-                       it. */
-                    sm_table[i].link_once = 1;
-                    goto next;
-                }
-                if (stab_section) {
-                    if (s == stab_section)
-                        stab_index = i;
-                    if (s == stab_section->link)
-                        stabstr_index = i;
-                }
-                goto found;
+        s = find_merge_section(s1, sh_name);
+        if (!s && s1->nb_sections >= MAX_FUNCTION_SECTIONS
+            && (sh->sh_flags & SHF_EXECINSTR) && text_section_base(sh_name)) {
+            s = find_section(s1, text_section_base(sh_name));
+            s->sh_flags |= SHF_EXECINSTR;
+        }
+        if (s) {
+            if (!strncmp(sh_name, ".gnu.linkonce",
+                         sizeof(".gnu.linkonce") - 1)) {
+                /* if a 'linkonce' section is already present, we
+                   do not add it again. It is a little tricky as
+                   symbols can still be defined in
+                   it. */
+                sm_table[i].link_once = 1;
+                goto next;
             }
+            if (stab_section) {
+                if (s == stab_section)
+                    stab_index = i;
+                if (s == stab_section->link)
+                    stabstr_index = i;
+            }
+            goto found;
         }
         /* not found: create new section */
         s = new_section(s1, sh_name, sh->sh_type, sh->sh_flags & ~SHF_GROUP);
         /* take as much info as possible from the section. sh_link and
            sh_info will be updated later */
-        s->sh_addralign = sh->sh_addralign;
+        s->sh_addralign = align;
         s->sh_entsize = sh->sh_entsize;
         sm_table[i].new_section = 1;
     found:
@@ -3198,18 +3849,20 @@ invalid:
             goto the_end;
         }
         /* align start of section */
-        s->data_offset += -s->data_offset & (sh->sh_addralign - 1);
-        if (sh->sh_addralign > s->sh_addralign)
-            s->sh_addralign = sh->sh_addralign;
+        s->data_offset += -s->data_offset & (align - 1);
+        if (align > s->sh_addralign)
+            s->sh_addralign = align;
         sm_table[i].offset = s->data_offset;
         sm_table[i].s = s;
-        /* concatenate sections */
+        /* concatenate sections: only their contents are copied */
         size = sh->sh_size;
         if (sh->sh_type != SHT_NOBITS) {
-            unsigned char *ptr;
-            lseek(fd, file_offset + sh->sh_offset, SEEK_SET);
-            ptr = section_ptr_add(s, size);
-            full_read(fd, ptr, size);
+            const void *data = image_data(img, sh->sh_offset, size, 1);
+            if (!data) {
+                tcc_error_noabort("invalid object file");
+                goto the_end;
+            }
+            memcpy(section_ptr_add(s, size), data, size);
         } else {
             s->data_offset += size;
         }
@@ -3250,11 +3903,16 @@ invalid:
     /* resolve symbols */
     old_to_new_syms = tcc_mallocz(nb_syms * sizeof(int));
 
+    for(i = 1, j = 0, sym = symtab + 1; i < nb_syms; i++, sym++)
+        j += ELFW(ST_BIND)(sym->st_info) != STB_LOCAL;
+    reserve_elf_syms(symtab_section, j);
+
     sym = symtab + 1;
     for(i = 1; i < nb_syms; i++, sym++) {
-        if (sym->st_shndx != SHN_UNDEF &&
-            sym->st_shndx < SHN_LORESERVE) {
-            sm = &sm_table[sym->st_shndx];
+        int shndx = sym->st_shndx;
+        addr_t value = sym->st_value;
+        if (shndx != SHN_UNDEF && shndx < SHN_LORESERVE) {
+            sm = &sm_table[shndx];
             if (sm->link_once) {
                 /* if a symbol is in a link once section, we use the
                    already defined symbol. It is very important to get
@@ -3271,15 +3929,14 @@ invalid:
             if (!sm->s)
                 continue;
             /* convert section number */
-            sym->st_shndx = sm->s->sh_num;
+            shndx = sm->s->sh_num;
             /* offset value */
-            sym->st_value += sm->offset;
+            value += sm->offset;
         }
         /* add symbol */
         name = strtab + sym->st_name;
-        sym_index = set_elf_sym(symtab_section, sym->st_value, sym->st_size,
-                                sym->st_info, sym->st_other,
-                                sym->st_shndx, name);
+        sym_index = set_elf_sym(symtab_section, value, sym->st_size,
+                                sym->st_info, sym->st_other, shndx, name);
         old_to_new_syms[i] = sym_index;
     }
 
@@ -3345,12 +4002,31 @@ invalid:
 
     ret = 0;
  the_end:
-    tcc_free(symtab);
-    tcc_free(strtab);
     tcc_free(old_to_new_syms);
     tcc_free(sm_table);
-    tcc_free(strsec);
-    tcc_free(shdr);
+    return ret;
+}
+
+/* load an object file and merge it with current files */
+ST_FUNC int tcc_load_object_file(TCCState *s1,
+                                int fd, unsigned long file_offset)
+{
+    MappedFile f;
+    ElfImage img;
+    int ret;
+
+    if (map_file(fd, &f) < 0)
+        return tcc_error_noabort("invalid object file");
+    if (file_offset > f.size) {
+        ret = tcc_error_noabort("invalid object file");
+    } else {
+        memset(&img, 0, sizeof img);
+        img.data = f.data + file_offset;
+        img.size = f.size - file_offset;
+        ret = load_object(s1, &img);
+        dynarray_reset(&img.copies, &img.nb_copies);
+    }
+    unmap_file(&f);
     return ret;
 }
 
@@ -3374,67 +4050,150 @@ static unsigned long long get_be(const uint8_t *b, int n)
     return ret;
 }
 
-static int read_ar_header(int fd, int offset, ArchiveHeader *hdr)
+static int read_ar_header(MappedFile *ar, unsigned long offset, ArchiveHeader *hdr)
 {
     char *p, *e;
-    int len;
-    lseek(fd, offset, SEEK_SET);
-    len = full_read(fd, hdr, sizeof(ArchiveHeader));
-    if (len != sizeof(ArchiveHeader))
-        return len ? -1 : 0;
+    if (offset >= ar->size)
+        return 0;
+    if (ar->size - offset < sizeof(ArchiveHeader))
+        return -1;
+    memcpy(hdr, ar->data + offset, sizeof(ArchiveHeader));
     p = hdr->ar_name;
     for (e = p + sizeof hdr->ar_name; e > p && e[-1] == ' ';)
         --e;
     *e = '\0';
     hdr->ar_size[sizeof hdr->ar_size-1] = 0;
-    return len;
+    return sizeof(ArchiveHeader);
 }
 
-/* load only the objects which resolve undefined symbols */
-static int tcc_load_alacarte(TCCState *s1, int fd, int size, int entrysize)
+/* load the archive member of 'size' bytes at 'offset' */
+static int load_ar_object(TCCState *s1, MappedFile *ar,
+                          unsigned long offset, unsigned long size)
+{
+    ElfImage img;
+    int ret;
+
+    if (offset > ar->size || size > ar->size - offset)
+        return tcc_error_noabort("invalid archive");
+    memset(&img, 0, sizeof img);
+    img.data = ar->data + offset;
+    img.size = size;
+    ret = load_object(s1, &img);
+    dynarray_reset(&img.copies, &img.nb_copies);
+    return ret;
+}
+
+/* the archive symbol index, hashed by name, and the worklist of
+   symbols left undefined by the members loaded from it */
+typedef struct ArchiveIndex {
+    const char **names;
+    const uint8_t *offsets;
+    int entrysize;
+    int nb_slots;       /* power of 2 */
+    int *slots;         /* entry + 1, 0 if empty */
+    int *work;
+    int nb_work, max_work;
+} ArchiveIndex;
+
+static int ar_index_find(ArchiveIndex *ai, const char *name)
+{
+    int i, e;
+    unsigned h = elf_gnu_hash((const unsigned char *)name);
+    for (i = h & (ai->nb_slots - 1); (e = ai->slots[i]) != 0;
+         i = (i + 1) & (ai->nb_slots - 1))
+        if (!strcmp(ai->names[e - 1], name))
+            return e - 1;
+    return ~i;
+}
+
+/* load the member of index entry 'e' if 'sym_index' is still undefined,
+   queueing the symbols it leaves undefined */
+static int ar_resolve(TCCState *s1, MappedFile *ar,
+                      ArchiveIndex *ai, int e, int sym_index)
 {
-    int i, bound, nsyms, sym_index, len, ret = -1;
-    unsigned long long off;
-    uint8_t *data;
-    const char *ar_names, *p;
-    const uint8_t *ar_index;
-    ElfW(Sym) *sym;
     ArchiveHeader hdr;
+    Section *s = symtab_section;
+    ElfW(Sym) *sym = &((ElfW(Sym) *)s->data)[sym_index];
+    unsigned long long off;
+    int len, nb_syms;
 
-    data = tcc_malloc(size);
-    if (full_read(fd, data, size) != size)
-        goto the_end;
-    nsyms = get_be(data, entrysize);
-    ar_index = data + entrysize;
-    ar_names = (char *) ar_index + nsyms * entrysize;
-
-    do {
-        bound = 0;
-        for (p = ar_names, i = 0; i < nsyms; i++, p += strlen(p)+1) {
-            Section *s = symtab_section;
-            sym_index = find_elf_sym(s, p);
-            if (!sym_index)
-                continue;
-            sym = &((ElfW(Sym) *)s->data)[sym_index];
-            if(sym->st_shndx != SHN_UNDEF)
-                continue;
-            off = get_be(ar_index + i * entrysize, entrysize);
-            len = read_ar_header(fd, off, &hdr);
-            if (len <= 0 || memcmp(hdr.ar_fmag, ARFMAG, 2)) {
-                tcc_error_noabort("invalid archive");
-                goto the_end;
-            }
-            off += len;
-            if (s1->verbose == 2)
-                printf("   -> %s\n", hdr.ar_name);
-            if (tcc_load_object_file(s1, fd, off) < 0)
-                goto the_end;
-            ++bound;
+    if (sym->st_shndx != SHN_UNDEF)
+        return 0;
+    off = get_be(ai->offsets + e * ai->entrysize, ai->entrysize);
+    len = read_ar_header(ar, off, &hdr);
+    if (len <= 0 || memcmp(hdr.ar_fmag, ARFMAG, 2))
+        return tcc_error_noabort("invalid archive");
+    if (s1->verbose == 2)
+        printf("   -> %s\n", hdr.ar_name);
+    nb_syms = s->data_offset / sizeof(ElfW(Sym));
+    if (load_ar_object(s1, ar, off + len, strtoul(hdr.ar_size, NULL, 10)) < 0)
+        return -1;
+    for (; nb_syms < s->data_offset / sizeof(ElfW(Sym)); nb_syms++) {
+        sym = &((ElfW(Sym) *)s->data)[nb_syms];
+        if (sym->st_shndx != SHN_UNDEF
+            || ELFW(ST_BIND)(sym->st_info) == STB_LOCAL)
+            continue;
+        if (ai->nb_work == ai->max_work) {
+            ai->max_work = ai->max_work ? 2 * ai->max_work : 64;
+            ai->work = tcc_realloc(ai->work, ai->max_work * sizeof *ai->work);
         }
-    } while(bound);
+        ai->work[ai->nb_work++] = nb_syms;
+    }
+    return 0;
+}
+
+/* load only the objects which resolve undefined symbols: one pass over
+   the archive index, then over the symbols each loaded member left
+   undefined, so that chains of members cost a lookup per new symbol
+   instead of another pass over the whole index */
+static int tcc_load_alacarte(TCCState *s1, MappedFile *ar,
+                             unsigned long offset, int size, int entrysize)
+{
+    int i, e, nsyms, sym_index, ret = -1;
+    const uint8_t *data;
+    const char *p;
+    Section *s = symtab_section;
+    ArchiveIndex ai;
+
+    if (size < entrysize || offset + size > ar->size)
+        return tcc_error_noabort("invalid archive");
+    data = ar->data + offset;
+    nsyms = get_be(data, entrysize);
+    if (nsyms < 0 || (unsigned long long)(nsyms + 1) * entrysize > size)
+        return tcc_error_noabort("invalid archive");
+    memset(&ai, 0, sizeof ai);
+    ai.entrysize = entrysize;
+    ai.offsets = data + entrysize;
+    ai.names = tcc_malloc(nsyms * sizeof *ai.names);
+    for (ai.nb_slots = 1; ai.nb_slots < 2 * nsyms; ai.nb_slots *= 2)
+        ;
+    ai.slots = tcc_mallocz(ai.nb_slots * sizeof *ai.slots);
+    p = (const char *)ai.offsets + nsyms * entrysize;
+    for (i = 0; i < nsyms; i++, p += strlen(p) + 1) {
+        ai.names[i] = p;
+        /* the first member defining a name is the one loaded for it */
+        e = ar_index_find(&ai, p);
+        if (e < 0)
+            ai.slots[~e] = i + 1;
+    }
+
+    for (i = 0; i < nsyms; i++) {
+        sym_index = find_elf_sym(s, ai.names[i]);
+        if (sym_index && ar_resolve(s1, ar, &ai, i, sym_index) < 0)
+            goto the_end;
+    }
+    for (i = 0; i < ai.nb_work; i++) {
+        sym_index = ai.work[i];
+        e = ar_index_find(&ai, (char *)s->link->data
+                          + ((ElfW(Sym) *)s->data)[sym_index].st_name);
+        if (e >= 0 && ar_resolve(s1, ar, &ai, e, sym_index) < 0)
+            goto the_end;
+    }
     ret = 0;
  the_end:
-    tcc_free(data);
+    tcc_free(ai.work);
+    tcc_free(ai.slots);
+    tcc_free(ai.names);
     return ret;
 }
 
@@ -3442,45 +4201,60 @@ static int tcc_load_alacarte(TCCState *s1, int fd, int size, int entrysize)
 ST_FUNC int tcc_load_archive(TCCState *s1, int fd, int alacarte)
 {
     ArchiveHeader hdr;
-    /* char magic[8]; */
-    int size, len;
+    MappedFile ar;
+    int size, len, ret;
     unsigned long file_offset;
-    ElfW(Ehdr) ehdr;
+    const ElfW(Ehdr) *ehdr;
 
+    if (map_file(fd, &ar) < 0)
+        return tcc_error_noabort("invalid archive");
     /* skip magic which was already checked */
-    /* full_read(fd, magic, sizeof(magic)); */
     file_offset = sizeof ARMAG - 1;
 
     for(;;) {
-        len = read_ar_header(fd, file_offset, &hdr);
-        if (len == 0)
-            return 0;
-        if (len < 0)
-            return tcc_error_noabort("invalid archive");
+        len = read_ar_header(&ar, file_offset, &hdr);
+        if (len == 0) {
+            ret = 0;
+            break;
+        }
+        if (len < 0) {
+            ret = tcc_error_noabort("invalid archive");
+            break;
+        }
         file_offset += len;
         size = strtol(hdr.ar_size, NULL, 0);
-        /* align to even */
-        size = (size + 1) & ~1;
         if (alacarte) {
             /* coff symbol table : we handle it */
-            if (!strcmp(hdr.ar_name, "/"))
-                return tcc_load_alacarte(s1, fd, size, 4);
-            if (!strcmp(hdr.ar_name, "/SYM64/"))
-                return tcc_load_alacarte(s1, fd, size, 8);
-        } else if (tcc_object_type(fd, &ehdr) == AFF_BINTYPE_REL) {
+            if (!strcmp(hdr.ar_name, "/")) {
+                ret = tcc_load_alacarte(s1, &ar, file_offset, size, 4);
+                break;
+            }
+            if (!strcmp(hdr.ar_name, "/SYM64/")) {
+                ret = tcc_load_alacarte(s1, &ar, file_offset, size, 8);
+                break;
+            }
+        } else if (ar.size - file_offset >= sizeof *ehdr
+                   && (ehdr = (const void *)(ar.data + file_offset),
+                       0 == memcmp(ehdr, ELFMAG, 4))
+                   && ehdr->e_type == ET_REL) {
             if (s1->verbose == 2)
                 printf("   -> %s\n", hdr.ar_name);
-            if (tcc_load_object_file(s1, fd, file_offset) < 0)
-                return -1;
+            if (load_ar_object(s1, &ar, file_offset, size) < 0) {
+                ret = -1;
+                break;
+            }
         }
-        file_offset += size;
+        /* align to even */
+        file_offset += (size + 1) & ~1;
     }
+    unmap_file(&ar);
+    return ret;
 }
 
 #ifndef ELF_OBJ_ONLY
 /* Set LV[I] to the global index of sym-version (LIB,VERSION).  Maybe resizes
    LV, maybe create a new entry for (LIB,VERSION).  */
-static void set_ver_to_ver(TCCState *s1, int *n, int **lv, int i, char *lib, char *version)
+static void set_ver_to_ver(TCCState *s1, int *n, int **lv, int i, const char *lib, const char *version)
 {
     while (i >= *n) {
         *lv = tcc_realloc(*lv, (*n + 1) * sizeof(**lv));
@@ -3527,27 +4301,27 @@ set_sym_version(TCCState *s1, int sym_index, int verndx)
 
 struct versym_info {
     int nb_versyms;
-    ElfW(Verdef) *verdef;
-    ElfW(Verneed) *verneed;
-    ElfW(Half) *versym;
+    const const ElfW(Verdef) *verdef;
+    const const ElfW(Verneed) *verneed;
+    const ElfW(Half) *versym;
     int nb_local_ver, *local_ver;
 };
 
 
-static void store_version(TCCState *s1, struct versym_info *v, char *dynstr)
+static void store_version(TCCState *s1, struct versym_info *v, const char *dynstr)
 {
-    char *lib, *version;
+    const char *lib, *version;
     uint32_t next;
     int i;
 
 #define	DEBUG_VERSION 0
 
     if (v->versym && v->verdef) {
-      ElfW(Verdef) *vdef = v->verdef;
+      const ElfW(Verdef) *vdef = v->verdef;
       lib = NULL;
       do {
-        ElfW(Verdaux) *verdaux =
-	  (ElfW(Verdaux) *) (((char *) vdef) + vdef->vd_aux);
+        const ElfW(Verdaux) *verdaux =
+	  (const ElfW(Verdaux) *) (((const char *) vdef) + vdef->vd_aux);
 
 #if DEBUG_VERSION
 	printf ("verdef: version:%u flags:%u index:%u, hash:%u\n",
@@ -3567,14 +4341,14 @@ static void store_version(TCCState *s1, struct versym_info *v, char *dynstr)
 #endif
 	}
         next = vdef->vd_next;
-        vdef = (ElfW(Verdef) *) (((char *) vdef) + next);
+        vdef = (const ElfW(Verdef) *) (((const char *) vdef) + next);
       } while (next);
     }
     if (v->versym && v->verneed) {
-      ElfW(Verneed) *vneed = v->verneed;
+      const ElfW(Verneed) *vneed = v->verneed;
       do {
-        ElfW(Vernaux) *vernaux =
-	  (ElfW(Vernaux) *) (((char *) vneed) + vneed->vn_aux);
+        const ElfW(Vernaux) *vernaux =
+	  (const ElfW(Vernaux) *) (((const char *) vneed) + vneed->vn_aux);
 
         lib = dynstr + vneed->vn_file;
 #if DEBUG_VERSION
@@ -3591,10 +4365,10 @@ static void store_version(TCCState *s1, struct versym_info *v, char *dynstr)
 		    vernaux->vna_flags, version);
 #endif
 	  }
-	  vernaux = (ElfW(Vernaux) *) (((char *) vernaux) + vernaux->vna_next);
+	  vernaux = (const ElfW(Vernaux) *) (((const char *) vernaux) + vernaux->vna_next);
 	}
         next = vneed->vn_next;
-        vneed = (ElfW(Verneed) *) (((char *) vneed) + next);
+        vneed = (const ElfW(Verneed) *) (((const char *) vneed) + next);
       } while (next);
     }
 
@@ -3615,56 +4389,71 @@ static void store_version(TCCState *s1, struct versym_info *v, char *dynstr)
 ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
 {
     ElfW(Ehdr) ehdr;
-    ElfW(Shdr) *shdr, *sh, *sh1;
+    const ElfW(Shdr) *shdr, *sh, *sh1;
     int i, nb_syms, nb_dts, sym_bind, ret = -1;
-    ElfW(Sym) *sym, *dynsym;
-    ElfW(Dyn) *dt, *dynamic;
+    const ElfW(Sym) *sym, *dynsym;
+    const ElfW(Dyn) *dt, *dynamic;
 
-    char *dynstr;
+    const char *dynstr;
     int sym_index;
     const char *name, *soname;
     struct versym_info v;
-
-    full_read(fd, &ehdr, sizeof(ehdr));
+    MappedFile f;
+    ElfImage img;
+
+    if (map_file(fd, &f) < 0)
+        return tcc_error_noabort("invalid shared library");
+    memset(&img, 0, sizeof img);
+    img.data = f.data;
+    img.size = f.size;
+    memset(&v, 0, sizeof v);
+    if (f.size < sizeof ehdr) {
+        ret = tcc_error_noabort("invalid shared library");
+        goto the_end;
+    }
+    memcpy(&ehdr, f.data, sizeof ehdr);
 
     /* test CPU specific stuff */
     if (ehdr.e_ident[5] != ELFDATA2LSB ||
         ehdr.e_machine != EM_TCC_TARGET) {
-        return tcc_error_noabort("bad architecture");
+        ret = tcc_error_noabort("bad architecture");
+        goto the_end;
     }
 
-    /* read sections */
-    shdr = load_data(fd, ehdr.e_shoff, sizeof(ElfW(Shdr)) * ehdr.e_shnum);
+    /* sections, symbols and strings are all read in place */
+    shdr = image_data(&img, ehdr.e_shoff,
+                      sizeof(ElfW(Shdr)) * ehdr.e_shnum, sizeof(ElfW(Addr)));
 
-    /* load dynamic section and dynamic symbols */
+    /* dynamic section and dynamic symbols */
     nb_syms = 0;
     nb_dts = 0;
     dynamic = NULL;
     dynsym = NULL; /* avoid warning */
     dynstr = NULL; /* avoid warning */
-    memset(&v, 0, sizeof v);
 
-    for(i = 0, sh = shdr; i < ehdr.e_shnum; i++, sh++) {
+    for(i = 0, sh = shdr; shdr && i < ehdr.e_shnum; i++, sh++) {
         switch(sh->sh_type) {
         case SHT_DYNAMIC:
             nb_dts = sh->sh_size / sizeof(ElfW(Dyn));
-            dynamic = load_data(fd, sh->sh_offset, sh->sh_size);
+            dynamic = image_data(&img, sh->sh_offset, sh->sh_size,
+                                 sizeof(ElfW(Addr)));
             break;
         case SHT_DYNSYM:
             nb_syms = sh->sh_size / sizeof(ElfW(Sym));
-            dynsym = load_data(fd, sh->sh_offset, sh->sh_size);
+            dynsym = image_data(&img, sh->sh_offset, sh->sh_size,
+                                sizeof(ElfW(Addr)));
             sh1 = &shdr[sh->sh_link];
-            dynstr = load_data(fd, sh1->sh_offset, sh1->sh_size);
+            dynstr = image_data(&img, sh1->sh_offset, sh1->sh_size, 1);
             break;
         case SHT_GNU_verdef:
-	    v.verdef = load_data(fd, sh->sh_offset, sh->sh_size);
+	    v.verdef = image_data(&img, sh->sh_offset, sh->sh_size, 4);
 	    break;
         case SHT_GNU_verneed:
-	    v.verneed = load_data(fd, sh->sh_offset, sh->sh_size);
+	    v.verneed = image_data(&img, sh->sh_offset, sh->sh_size, 4);
 	    break;
         case SHT_GNU_versym:
             v.nb_versyms = sh->sh_size / sizeof(ElfW(Half));
-	    v.versym = load_data(fd, sh->sh_offset, sh->sh_size);
+	    v.versym = image_data(&img, sh->sh_offset, sh->sh_size, 2);
 	    break;
         default:
             break;
@@ -3673,6 +4462,10 @@ ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
 
     if (!dynamic)
         goto the_end;
+    if (!dynsym || !dynstr) {
+        ret = tcc_error_noabort("invalid shared library");
+        goto the_end;
+    }
 
     /* compute the real library name */
     soname = tcc_basename(filename);
@@ -3685,11 +4478,14 @@ ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
         goto ret_success;
 
     if (v.nb_versyms != nb_syms)
-        tcc_free (v.versym), v.versym = NULL;
+        v.versym = NULL;
     else
         store_version(s1, &v, dynstr);
 
     /* add dynamic symbols in dynsym_section */
+    for(i = 1, sym_index = 0, sym = dynsym + 1; i < nb_syms; i++, sym++)
+        sym_index += ELFW(ST_BIND)(sym->st_info) != STB_LOCAL;
+    reserve_elf_syms(s1->dynsymtab_section, sym_index);
     for(i = 1, sym = dynsym + 1; i < nb_syms; i++, sym++) {
         sym_bind = ELFW(ST_BIND)(sym->st_info);
         if (sym_bind == STB_LOCAL)
@@ -3734,14 +4530,9 @@ ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
  ret_success:
     ret = 0;
  the_end:
-    tcc_free(dynstr);
-    tcc_free(dynsym);
-    tcc_free(dynamic);
-    tcc_free(shdr);
     tcc_free(v.local_ver);
-    tcc_free(v.verdef);
-    tcc_free(v.verneed);
-    tcc_free(v.versym);
+    dynarray_reset(&img.copies, &img.nb_copies);
+    unmap_file(&f);
     return ret;
 }
 
@@ -29,27 +29,28 @@
    rsym: return symbol
    anon_sym: anonymous symbol index
 */
-ST_DATA int rsym, anon_sym, ind, loc;
+ST_DATA TCC_TLS int rsym, anon_sym, ind, loc;
 
-ST_DATA Sym *global_stack;
-ST_DATA Sym *local_stack;
-ST_DATA Sym *define_stack;
-ST_DATA Sym *global_label_stack;
-ST_DATA Sym *local_label_stack;
+ST_DATA TCC_TLS Sym *global_stack;
+ST_DATA TCC_TLS Sym *local_stack;
+ST_DATA TCC_TLS Sym *define_stack;
+ST_DATA TCC_TLS Sym *global_label_stack;
+ST_DATA TCC_TLS Sym *local_label_stack;
 
-static Sym *sym_free_first;
-static void **sym_pools;
-static int nb_sym_pools;
+static TCC_TLS Sym *sym_free_first;
+static TCC_TLS void **sym_pools;
+static TCC_TLS int nb_sym_pools;
 
-static Sym *all_cleanups, *pending_gotos;
-static int local_scope;
-ST_DATA char debug_modes;
+static TCC_TLS Sym *all_cleanups, *pending_gotos;
+static TCC_TLS int local_scope;
+static TCC_TLS int func_spills, func_helper_calls; /* for the codegen report */
+ST_DATA TCC_TLS char debug_modes;
 
-ST_DATA SValue *vtop;
-static SValue _vstack[1 + VSTACK_SIZE];
+ST_DATA TCC_TLS SValue *vtop;
+static TCC_TLS SValue *_vstack; /* 1 + VSTACK_SIZE entries, per compilation */
 #define vstack (_vstack + 1)
 
-ST_DATA int nocode_wanted; /* no code generation wanted */
+ST_DATA TCC_TLS int nocode_wanted; /* no code generation wanted */
 #define NODATA_WANTED (nocode_wanted > 0) /* no static data output wanted either */
 #define DATA_ONLY_WANTED 0x80000000 /* ON outside of functions and for static initializers */
 
@@ -67,14 +68,14 @@ ST_DATA int nocode_wanted; /* no code generation wanted */
 #define CONST_WANTED_MASK 0x0FFF0000
 #define CONST_WANTED  (nocode_wanted & CONST_WANTED_MASK)
 
-ST_DATA int global_expr;  /* true if compound literals must be allocated globally (used during initializers parsing */
-ST_DATA CType func_vt; /* current function return type (used by return instruction) */
-ST_DATA int func_var; /* true if current function is variadic (used by return instruction) */
-ST_DATA int func_vc;
-ST_DATA int func_ind;
-ST_DATA const char *funcname;
-ST_DATA CType int_type, func_old_type, char_type, char_pointer_type;
-static CString initstr;
+ST_DATA TCC_TLS int global_expr;  /* true if compound literals must be allocated globally (used during initializers parsing */
+ST_DATA TCC_TLS CType func_vt; /* current function return type (used by return instruction) */
+ST_DATA TCC_TLS int func_var; /* true if current function is variadic (used by return instruction) */
+ST_DATA TCC_TLS int func_vc;
+ST_DATA TCC_TLS int func_ind;
+ST_DATA TCC_TLS const char *funcname;
+ST_DATA TCC_TLS CType int_type, func_old_type, char_type, char_pointer_type;
+static TCC_TLS CString initstr;
 
 #if PTR_SIZE == 4
 #define VT_SIZE_T (VT_INT | VT_UNSIGNED)
@@ -87,7 +88,7 @@ static CString initstr;
 #define VT_PTRDIFF_T (VT_LONG | VT_LLONG)
 #endif
 
-static struct switch_t {
+static TCC_TLS struct switch_t {
     struct case_t {
         int64_t v1, v2;
 	int sym;
@@ -102,14 +103,27 @@ static struct switch_t {
 
 #define MAX_TEMP_LOCAL_VARIABLE_NUMBER 8
 /*list of temporary local variables on the stack in current function. */
-static struct temp_local_variable {
+static TCC_TLS struct temp_local_variable {
 	int location; //offset on stack. Svalue.c.i
 	short size;
 	short align;
 } arr_temp_local_vars[MAX_TEMP_LOCAL_VARIABLE_NUMBER];
-static int nb_temp_local_vars;
+static TCC_TLS int nb_temp_local_vars;
+
+#ifdef TCC_TARGET_NATIVE_TIER
+/* -ftiered bookkeeping, one entry per function defined in the unit */
+typedef struct tier_func {
+    int c; /* elf symbol index of the function */
+    int slot; /* offset of its record in the tier section or -1 */
+    int impure; /* touches data defined in this unit */
+    int nb_refs;
+    Sym **refs; /* globals it references */
+} tier_func;
+static TCC_TLS tier_func **tier_funcs, *tier_cur;
+static TCC_TLS int nb_tier_funcs, tier_unit_impure;
+#endif
 
-static struct scope {
+static TCC_TLS struct scope {
     struct scope *prev;
     struct { int loc, locorig, num; } vla;
     struct { Sym *s; int n; } cl;
@@ -134,6 +148,7 @@ static void block(int flags);
 
 static void gen_cast(CType *type);
 static void gen_cast_s(int t);
+static void vector_type(CType *type, int size);
 static inline CType *pointed_type(CType *type);
 static int is_compatible_types(CType *type1, CType *type2);
 static int parse_btype(CType *type, AttributeDef *ad, int ignore_label);
@@ -158,6 +173,11 @@ static int get_temp_local_var(int size,int align);
 static void clear_temp_local_var_list();
 static void cast_error(CType *st, CType *dt);
 static void end_switch(void);
+#ifdef TCC_TARGET_NATIVE_TIER
+static void tier_reference(Sym *s);
+static void tier_end(TCCState *s1);
+static void tier_free(void);
+#endif
 
 /* ------------------------------------------------------------------------- */
 /* Automagical code suppression */
@@ -219,6 +239,17 @@ static inline int is_integer_btype(int bt)
         || bt == VT_LLONG;
 }
 
+static inline int is_vector_type(CType *type)
+{
+    return (type->t & VT_BTYPE) == VT_STRUCT && type->ref->a.vector;
+}
+
+/* element type of a vector type */
+static inline CType *vector_elem_type(CType *type)
+{
+    return pointed_type(&type->ref->next->type);
+}
+
 static int btype_size(int bt)
 {
     return bt == VT_BYTE || bt == VT_BOOL ? 1 :
@@ -358,6 +389,7 @@ void pv (const char *lbl, int a, int b)
 /* initialize vstack and types.  This must be done also for tcc -E */
 ST_FUNC void tccgen_init(TCCState *s1)
 {
+    _vstack = tcc_malloc((1 + VSTACK_SIZE) * sizeof *_vstack);
     vtop = vstack - 1;
     memset(vtop, 0, sizeof *vtop);
 
@@ -382,6 +414,9 @@ ST_FUNC void tccgen_init(TCCState *s1)
 
 ST_FUNC int tccgen_compile(TCCState *s1)
 {
+    int file_sym = symtab_section->data_offset / sizeof(ElfSym);
+    ElfSym *esym;
+
     funcname = "";
     func_ind = -1;
     anon_sym = SYM_FIRST_ANOM;
@@ -401,6 +436,17 @@ ST_FUNC int tccgen_compile(TCCState *s1)
     decl(VT_CONST);
     gen_inline_functions(s1);
     check_vstack();
+    /* a string compiled with '#line 1 "file"' in front stands for that
+       file, which names the unit in the symbol table then */
+    esym = (ElfSym *)symtab_section->data + file_sym;
+    if (ELFW(ST_TYPE)(esym->st_info) == STT_FILE
+        && !strcmp((char *)symtab_section->link->data + esym->st_name, "<string>")
+        && strcmp(file->filename, "<string>"))
+        esym->st_name = put_elf_str(symtab_section->link, file->filename);
+#ifdef TCC_TARGET_NATIVE_TIER
+    if (s1->tiered)
+        tier_end(s1);
+#endif
     /* end of translation unit info */
     tcc_debug_end(s1);
     tcc_tcov_end(s1);
@@ -411,6 +457,9 @@ ST_FUNC void tccgen_finish(TCCState *s1)
 {
     tcc_debug_end(s1); /* just in case of errors: free memory */
     free_inline_functions(s1);
+#ifdef TCC_TARGET_NATIVE_TIER
+    tier_free();
+#endif
     sym_pop(&global_stack, NULL, 0);
     sym_pop(&local_stack, NULL, 0);
     /* free preprocessor macros */
@@ -430,6 +479,8 @@ ST_FUNC void tccgen_finish(TCCState *s1)
     local_label_stack = NULL;
     cur_text_section = NULL;
     sym_free_first = NULL;
+    tcc_free(_vstack);
+    _vstack = vtop = NULL;
 }
 
 /* ------------------------------------------------------------------------- */
@@ -1141,6 +1192,8 @@ ST_FUNC Sym *external_helper_sym(int v)
 /* push a reference to an helper function (such as memmove) */
 ST_FUNC void vpush_helper_func(int v)
 {
+    if (!nocode_wanted)
+        func_helper_calls++;
     vpushsym(&func_old_type, external_helper_sym(v));
 }
 
@@ -1195,6 +1248,8 @@ static void merge_attr(AttributeDef *ad, AttributeDef *ad1)
       ad->asm_label = ad1->asm_label;
     if (ad1->attr_mode)
       ad->attr_mode = ad1->attr_mode;
+    if (ad1->vector_size)
+      ad->vector_size = ad1->vector_size;
 }
 
 /* Merge some type attributes.  */
@@ -1376,6 +1431,7 @@ ST_FUNC void save_reg_upstack(int r, int n)
                 sv.r = VT_LOCAL | VT_LVAL;
                 sv.c.i = l;
                 store(p->r & VT_VALMASK, &sv);
+                func_spills++;
 #if defined(TCC_TARGET_I386) || defined(TCC_TARGET_X86_64)
                 /* x86 specific: need to pop fp register ST0 if saved */
                 if (r == TREG_ST0) {
@@ -2295,6 +2351,156 @@ static int gen_opic_lt(uint64_t a, uint64_t b)
     return (a ^ (uint64_t)1 << 63) < (b ^ (uint64_t)1 << 63);
 }
 
+#ifdef TCC_TARGET_NATIVE_MULH
+static void gen_opic(int op);
+
+/* Magic numbers to divide an N-bit value by the constant d with a
+   multiply-high and shifts (Hacker's Delight, chapter 10).  Values
+   are computed modulo 2^N.  */
+static int gen_divc_magicu(uint64_t d, int n, uint64_t *m)
+{
+    uint64_t mask = n == 64 ? ~(uint64_t)0 : ((uint64_t)1 << n) - 1;
+    uint64_t top = (uint64_t)1 << (n - 1);
+    uint64_t nc = (mask - ((-d & mask) % d)) & mask;
+    uint64_t q1 = top / nc, r1 = top - q1 * nc;
+    uint64_t q2 = (top - 1) / d, r2 = (top - 1) - q2 * d;
+    uint64_t delta;
+    int p = n - 1, a = 0;
+
+    do {
+        p++;
+        if (r1 >= nc - r1)
+            q1 = (2 * q1 + 1) & mask, r1 = (2 * r1 - nc) & mask;
+        else
+            q1 = (2 * q1) & mask, r1 = (2 * r1) & mask;
+        if (r2 + 1 >= d - r2) {
+            if (q2 >= top - 1)
+                a = 1;
+            q2 = (2 * q2 + 1) & mask, r2 = (2 * r2 + 1 - d) & mask;
+        } else {
+            if (q2 >= top)
+                a = 1;
+            q2 = (2 * q2) & mask, r2 = (2 * r2 + 1) & mask;
+        }
+        delta = (d - 1 - r2) & mask;
+    } while (p < 2 * n && (q1 < delta || (q1 == delta && r1 == 0)));
+    *m = (q2 + 1) & mask;
+    /* shift in bits 0..7, 'add' indicator in bit 8 */
+    return (p - n) | a << 8;
+}
+
+static int gen_divc_magic(int64_t d, int n, uint64_t *m)
+{
+    uint64_t mask = n == 64 ? ~(uint64_t)0 : ((uint64_t)1 << n) - 1;
+    uint64_t top = (uint64_t)1 << (n - 1);
+    uint64_t ad = d < 0 ? -(uint64_t)d & mask : (uint64_t)d;
+    uint64_t t = top + (d < 0);
+    uint64_t anc = t - 1 - t % ad;
+    uint64_t q1 = top / anc, r1 = top - q1 * anc;
+    uint64_t q2 = top / ad, r2 = top - q2 * ad;
+    uint64_t delta;
+    int p = n - 1;
+
+    do {
+        p++;
+        q1 = (2 * q1) & mask, r1 = (2 * r1) & mask;
+        if (r1 >= anc)
+            q1++, r1 -= anc;
+        q2 = (2 * q2) & mask, r2 = (2 * r2) & mask;
+        if (r2 >= ad)
+            q2++, r2 -= ad;
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+    *m = q2 + 1;
+    if (d < 0)
+        *m = -*m;
+    *m &= mask;
+    return p - n;
+}
+
+static void gen_divc_push(int t, uint64_t v, int n)
+{
+    if (n == 32 && !(t & VT_UNSIGNED))
+        v = (uint64_t)(int64_t)(int32_t)v;
+    vpush64(t, v);
+}
+
+/* replace x / d and x % d, with x on vtop and the constant d removed
+   from the stack, by a multiply-high sequence.  Returns 0 when the
+   division is left to the target.  */
+static int gen_opic_divc(int op, uint64_t d, int n)
+{
+    int t = vtop[-1].type.t & (VT_BTYPE | VT_UNSIGNED | VT_LONG);
+    int mod = op == '%' || op == TOK_UMOD;
+    uint64_t m, top = (uint64_t)1 << (n - 1);
+    int s;
+
+    if (op == TOK_UDIV || op == TOK_UMOD) {
+        if (d == 0)
+            return 0;
+        if ((d & (d - 1)) == 0) {
+            if (op == TOK_UDIV)
+                return 0; /* shifts */
+            vtop->c.i = d - 1;
+            gen_opic('&');
+            return 1;
+        }
+        s = gen_divc_magicu(d, n, &m);
+        vpop();
+        if (mod)
+            gv_dup();
+        if (s & 256)
+            gv_dup();
+        gen_divc_push(t, m, n);
+        gen_opic(TOK_UMULH);
+        if (s & 256) {
+            /* q = (((x - t) >> 1) + t) >> (s - 1) */
+            gv_dup();
+            vrott(3);
+            gen_opic('-');
+            vpushi(1);
+            gen_opic(TOK_SHR);
+            gen_opic('+');
+            s = (s & 255) - 1;
+        }
+        vpushi(s);
+        gen_opic(TOK_SHR);
+    } else {
+        if ((int64_t)d >= -1 && (int64_t)d <= 1)
+            return 0;
+        if (n == 32)
+            d = (uint64_t)(int64_t)(int32_t)d;
+        if (d == (n == 64 ? top : -top))
+            return 0;
+        s = gen_divc_magic(d, n, &m);
+        vpop();
+        if (mod)
+            gv_dup();
+        if (((int64_t)d < 0) != !!(m & top))
+            gv_dup();
+        gen_divc_push(t, m, n);
+        gen_opic(TOK_SMULH);
+        if (((int64_t)d < 0) != !!(m & top)) {
+            /* correct for the sign of the magic number */
+            vswap();
+            gen_opic((int64_t)d < 0 ? '-' : '+');
+        }
+        vpushi(s);
+        gen_opic(TOK_SAR);
+        gv_dup();
+        vpushi(n - 1);
+        gen_opic(TOK_SHR);
+        gen_opic('+');
+    }
+    if (mod) {
+        gen_divc_push(t, d, n);
+        gen_opic('*');
+        gen_opic('-');
+    }
+    return 1;
+}
+#endif
+
 /* handle integer constant optimizations and various machine
    independent opt */
 static void gen_opic(int op)
@@ -2404,6 +2610,12 @@ static void gen_opic(int op)
                             (l2 == -1 || (l2 == 0xFFFFFFFF && t2 != VT_LLONG))))) {
             /* filter out NOP operations like x*1, x-0, x&-1... */
             vtop--;
+#ifdef TCC_TARGET_NATIVE_MULH
+        } else if (c2 && (op == '/' || op == '%' ||
+                          op == TOK_UDIV || op == TOK_UMOD) &&
+                   gen_opic_divc(op, l2, shm + 1)) {
+            /* division by a constant without div instruction */
+#endif
         } else if (c2 && (op == '*' || op == TOK_PDIV || op == TOK_UDIV)) {
             /* try to use shifts instead of muls or divs */
             if (l2 > 0 && (l2 & (l2 - 1)) == 0) {
@@ -2665,6 +2877,16 @@ static void type_to_str(char *buf, int buf_size,
         pstrcat(buf, buf_size, tstr);
         break;
     case VT_STRUCT:
+        if (type->ref->a.vector) {
+            /* named as gcc does */
+            int align, n = type_size(type, &align)
+                / type_size(vector_elem_type(type), &align);
+            snprintf(buf1, sizeof(buf1), "__vector(%d) ", n);
+            pstrcat(buf, buf_size, buf1);
+            type_to_str(buf1, sizeof(buf1), vector_elem_type(type), NULL);
+            pstrcat(buf, buf_size, buf1);
+            break;
+        }
         tstr = "struct ";
         if (IS_UNION(t))
             tstr = "union ";
@@ -2825,6 +3047,12 @@ static int compare_types(CType *type1, CType *type2, int unqualified)
         type2 = pointed_type(type2);
         return is_compatible_types(type1, type2);
     } else if (bt1 == VT_STRUCT) {
+        if (type1->ref != type2->ref
+            && is_vector_type(type1) && is_vector_type(type2))
+            /* vectors of the same shape are the same type */
+            return type1->ref->c == type2->ref->c
+                && compare_types(vector_elem_type(type1),
+                                 vector_elem_type(type2), 1);
         return (type1->ref == type2->ref);
     } else if (bt1 == VT_FUNC) {
         return is_compatible_func(type1, type2);
@@ -2969,6 +3197,130 @@ static int combine_types(CType *dest, SValue *op1, SValue *op2, int op)
     return ret;
 }
 
+/* Put the vector operand on vtop where gen_vector_op() can reach its
+   elements: a stack local is used in place, anything else has its
+   address saved in a pointer temporary ('*indirect' is set).  Scalars
+   are converted to the element type and broadcast first. */
+static int vector_operand(CType *vt, CType *pt, int *indirect)
+{
+    CType *et = vector_elem_type(vt);
+    int size, esize, align, i, c;
+
+    if (!is_vector_type(&vtop->type)) {
+        if (!is_float(vtop->type.t) && !is_integer_btype(vtop->type.t & VT_BTYPE))
+            tcc_error("invalid operand types for vector operation");
+        gen_cast(et);
+        esize = type_size(et, &align);
+        size = type_size(vt, &align);
+        loc = (loc - size) & -align;
+        c = loc;
+        for (i = 0; i < size; i += esize) {
+            vset(et, VT_LOCAL | VT_LVAL, c + i);
+            vswap();
+            vstore();
+        }
+        vpop();
+        vset(vt, VT_LOCAL | VT_LVAL, c);
+    }
+    if (vtop->r == (VT_LOCAL | VT_LVAL)) {
+        c = vtop->c.i;
+        *indirect = 0;
+    } else {
+        test_lvalue();
+        gaddrof();
+        vtop->type = *pt;
+        loc = (loc - PTR_SIZE) & -PTR_SIZE;
+        c = loc;
+        vset(pt, VT_LOCAL | VT_LVAL, c);
+        vswap();
+        vstore();
+        *indirect = 1;
+    }
+    vpop();
+    return c;
+}
+
+/* push element 'i' of a vector operand from vector_operand() */
+static void vector_elem(CType *et, CType *pt, int c, int indirect, int i)
+{
+    int align;
+
+    if (indirect) {
+        vset(pt, VT_LOCAL | VT_LVAL, c);
+        vpushi(i);
+        gen_op('+');
+        indir();
+    } else {
+        vset(et, VT_LOCAL | VT_LVAL, c + i * type_size(et, &align));
+    }
+}
+
+/* binary operation on vector_size() types, at least one of vtop[-1]
+   and vtop[0] is a vector.  The result is a vector in a new stack
+   local; comparisons give -1 (true) or 0 in signed integer elements. */
+static void gen_vector_op(int op)
+{
+    CType vt, rt, pt, *et;
+    int size, esize, align, n, i, res, ca, cb, ia, ib;
+
+    if (is_vector_type(&vtop[-1].type) && is_vector_type(&vtop->type)
+        && !compare_types(&vtop[-1].type, &vtop->type, 1))
+        tcc_error("invalid operand types for vector operation");
+    vt = is_vector_type(&vtop[-1].type) ? vtop[-1].type : vtop->type;
+    vt.t &= ~(VT_CONSTANT | VT_VOLATILE);
+    et = vector_elem_type(&vt);
+    if (is_float(et->t) && op != '+' && op != '-' && op != '*' && op != '/'
+        && !TOK_ISCOND(op))
+        tcc_error("invalid operand types for vector operation");
+    size = type_size(&vt, &align);
+    esize = type_size(et, &align);
+    n = size / esize;
+    rt = vt;
+    if (TOK_ISCOND(op)) {
+        rt.t = esize == 8 ? VT_LLONG : esize == 4 ? VT_INT
+            : esize == 2 ? VT_SHORT : VT_BYTE | VT_DEFSIGN;
+        rt.ref = NULL;
+        vector_type(&rt, size);
+    }
+    if (nocode_wanted) {
+        /* only the type matters */
+        vpop();
+        vpop();
+        vset(&rt, VT_LOCAL | VT_LVAL, 0);
+        return;
+    }
+    pt = *et;
+    mk_pointer(&pt);
+    cb = vector_operand(&vt, &pt, &ib);
+    ca = vector_operand(&vt, &pt, &ia);
+    loc = (loc - size) & -align;
+    res = loc;
+#ifdef TCC_TARGET_NATIVE_VECTOR_OP
+    vset(&pt, ia ? VT_LOCAL | VT_LVAL : VT_LOCAL, ca);
+    vset(&pt, ib ? VT_LOCAL | VT_LVAL : VT_LOCAL, cb);
+    if (gen_vector_opi(op, et->t, size, res)) {
+        vset(&rt, VT_LOCAL | VT_LVAL, res);
+        return;
+    }
+    vpop();
+    vpop();
+#endif
+    for (i = 0; i < n; i++) {
+        vset(vector_elem_type(&rt), VT_LOCAL | VT_LVAL, res + i * esize);
+        vector_elem(et, &pt, ca, ia, i);
+        vector_elem(et, &pt, cb, ib, i);
+        gen_op(op);
+        if (TOK_ISCOND(op)) {
+            vpushi(0);
+            vswap();
+            gen_op('-');
+        }
+        vstore();
+        vpop();
+    }
+    vset(&rt, VT_LOCAL | VT_LVAL, res);
+}
+
 /* generic gen_op: handles types problems */
 ST_FUNC void gen_op(int op)
 {
@@ -2976,6 +3328,10 @@ ST_FUNC void gen_op(int op)
     CType type1, combtype;
     int op_class = op;
 
+    if (is_vector_type(&vtop[-1].type) || is_vector_type(&vtop->type)) {
+        gen_vector_op(op);
+        return;
+    }
     if (op == TOK_SHR || op == TOK_SAR || op == TOK_SHL)
         op_class = SHIFT_OP;
     else if (TOK_ISCOND(op)) /* == != > ... */
@@ -3181,6 +3537,41 @@ static void gen_cast_s(int t)
     gen_cast(&type);
 }
 
+/* cast between a vector_size() type and a vector or integer of the
+   same size, which keeps the bits of the value */
+static void gen_cast_vector(CType *type)
+{
+    CType *st = &vtop->type;
+    int ds, ss, align, addr;
+
+    if (!is_vector_type(is_vector_type(type) ? st : type)
+        && !is_integer_btype((is_vector_type(type) ? st : type)->t & VT_BTYPE))
+        cast_error(st, type);
+    ds = type_size(type, &align);
+    ss = type_size(st, &align);
+    if (ds != ss)
+        type_incompatibility_error(st, type,
+            "cannot convert '%s' to '%s' of different size");
+    if (is_vector_type(st)) {
+        /* a vector value is an lvalue in memory: read it as 'type' */
+        vtop->type = *type;
+        if (!is_vector_type(type))
+            gv(RC_INT);
+    } else if (nocode_wanted) {
+        vpop();
+        vset(type, VT_LOCAL | VT_LVAL, 0);
+    } else {
+        loc = (loc - ds) & -align;
+        addr = loc;
+        vset(st, VT_LOCAL | VT_LVAL, addr);
+        vswap();
+        vstore();
+        vpop();
+        vset(type, VT_LOCAL | VT_LVAL, addr);
+    }
+    vtop->type.t &= ~(VT_CONSTANT | VT_VOLATILE | VT_ARRAY);
+}
+
 /* cast 'vtop' to 'type'. Casting to bitfields is forbidden. */
 static void gen_cast(CType *type)
 {
@@ -3195,6 +3586,12 @@ static void gen_cast(CType *type)
     if (vtop->type.t & VT_BITFIELD)
         gv(RC_INT);
 
+    if ((is_vector_type(type) || is_vector_type(&vtop->type))
+        && (type->t & VT_BTYPE) != VT_VOID) {
+        gen_cast_vector(type);
+        return;
+    }
+
     dbt = type->t & (VT_BTYPE | VT_UNSIGNED);
     sbt = vtop->type.t & (VT_BTYPE | VT_UNSIGNED);
     if (sbt == VT_FUNC)
@@ -3984,6 +4381,15 @@ redo:
             ad->f.func_call = FUNC_THISCALL;
             break;
 #endif
+        case TOK_VECTOR_SIZE1:
+        case TOK_VECTOR_SIZE2:
+            skip('(');
+            n = expr_const();
+            if (n <= 0 || (n & (n - 1)) != 0)
+                tcc_error("vector size must be a positive power of two");
+            ad->vector_size = n;
+            skip(')');
+            break;
         case TOK_MODE:
             skip('(');
             switch(tok) {
@@ -4566,6 +4972,43 @@ do_decl:
     }
 }
 
+/* __attribute__((vector_size(size))): a vector is represented as an
+   anonymous struct holding one array of elements, with 'a.vector' set
+   on the struct symbol so that gen_op() can work on it element-wise */
+static void vector_type(CType *type, int size)
+{
+    int esize, align, bt, qualifiers;
+    Sym *s, *f;
+    CType et, st;
+
+    bt = type->t & VT_BTYPE;
+    if ((type->t & (VT_ARRAY | VT_VLA | VT_BITFIELD))
+        || bt == VT_BOOL
+        || (!is_integer_btype(bt) && bt != VT_FLOAT && bt != VT_DOUBLE))
+        tcc_error("invalid vector element type");
+    esize = type_size(type, &align);
+    if (size < esize || size % esize)
+        tcc_error("vector size %d is not a multiple of the element size", size);
+    qualifiers = type->t & (VT_CONSTANT | VT_VOLATILE | VT_STORAGE);
+    et = *type;
+    et.t &= ~(VT_CONSTANT | VT_VOLATILE | VT_STORAGE);
+    /* element array */
+    f = sym_push(SYM_FIELD, &et, 0, size / esize);
+    et.t = VT_ARRAY | VT_PTR;
+    et.ref = f;
+    /* the struct itself */
+    st.t = VT_STRUCT;
+    st.ref = NULL;
+    s = sym_push(anon_sym++ | SYM_STRUCT, &st, 0, size);
+    s->r = size < MAX_ALIGN ? size : MAX_ALIGN;
+    s->a.vector = 1;
+    f = sym_push(anon_sym++ | SYM_FIELD, &et, 0, 0);
+    f->r = 0;
+    s->next = f;
+    type->t = VT_STRUCT | qualifiers;
+    type->ref = s;
+}
+
 static void sym_to_attr(AttributeDef *ad, Sym *s)
 {
     merge_symattr(&ad->a, &s->a);
@@ -4849,6 +5292,10 @@ the_end:
         t = (t & ~(VT_BTYPE|VT_LONG)) | (VT_DOUBLE|VT_LONG);
 #endif
     type->t = t;
+    if (ad->vector_size && type_found) {
+        vector_type(type, ad->vector_size);
+        ad->vector_size = 0;
+    }
     return type_found;
 }
 
@@ -5173,6 +5620,10 @@ static CType *type_decl(CType *type, AttributeDef *ad, int *v, int td)
     post_type(post, ad, post != ret ? 0 : storage,
               td & ~(TYPE_DIRECT|TYPE_ABSTRACT));
     parse_attribute(ad);
+    if (ad->vector_size) {
+        vector_type(type, ad->vector_size);
+        ad->vector_size = 0;
+    }
     type->t |= storage;
     return ret;
 }
@@ -5450,6 +5901,56 @@ static void parse_atomic(int atok)
     }
 }
 
+#ifdef TCC_TARGET_NATIVE_STRUCT_COPY
+/* expand memcpy() and memset() with a small constant size inline.
+   The function and its arguments are on the value stack, the result
+   replaces them. */
+static int gen_inline_memop(int nb_args)
+{
+    SValue *f = vtop - nb_args;
+    int v, size, c = 0;
+
+    if (nb_args != 3
+        || (f->r & (VT_VALMASK | VT_LVAL | VT_SYM)) != (VT_CONST | VT_SYM)
+        || (vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) != VT_CONST
+        || vtop->c.i > STRUCT_INLINE_MAX)
+        return 0;
+#ifdef CONFIG_TCC_BCHECK
+    if (tcc_state->do_bounds_check)
+        return 0;
+#endif
+    v = f->sym->v;
+    if (v == TOK_memset) {
+        if ((vtop[-1].r & (VT_VALMASK | VT_LVAL | VT_SYM)) != VT_CONST)
+            return 0;
+        c = vtop[-1].c.i;
+    } else if (v != TOK_memcpy) {
+        return 0;
+    }
+    size = vtop->c.i;
+    vpop();
+    if (v == TOK_memset)
+        vpop();
+    else
+        vswap();
+    /* keep the destination as the result */
+    if ((vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) == VT_LOCAL)
+        vdup();
+    else
+        gv_dup();
+    if (v == TOK_memset) {
+        gen_struct_fill(size, c);
+    } else {
+        vrotb(3);
+        gen_struct_copy(size);
+    }
+    vswap();
+    vpop();
+    return 1;
+}
+
+#endif
+
 ST_FUNC void unary(void)
 {
     int n, t, align, size, r;
@@ -5988,6 +6489,10 @@ special_math_val:
 	   Will be used by at least the x86 inline asm parser for
 	   regvars.  */
 	vtop->sym = s;
+#ifdef TCC_TARGET_NATIVE_TIER
+        if (tier_cur && (r & VT_SYM) && !nocode_wanted)
+            tier_reference(s);
+#endif
 
         if (r & VT_SYM) {
             vtop->c.i = 0;
@@ -6032,6 +6537,14 @@ special_math_val:
             next();
         } else if (tok == '[') {
             next();
+            if (is_vector_type(&vtop->type)) {
+                /* v[i] reads the element array */
+                int qualifiers = vtop->type.t & (VT_CONSTANT | VT_VOLATILE);
+                test_lvalue();
+                gaddrof();
+                vtop->type = vtop->type.ref->next->type;
+                parse_btype_qualify(&vtop->type, qualifiers);
+            }
             gexpr();
             gen_op('+');
             indir();
@@ -6119,6 +6632,10 @@ special_math_val:
             if (sa)
                 tcc_error("too few arguments to function");
             skip(')');
+#ifdef TCC_TARGET_NATIVE_STRUCT_COPY
+            if (gen_inline_memop(nb_args))
+                continue;
+#endif
             gfunc_call(nb_args);
 
             if (ret_nregs < 0) {
@@ -6326,7 +6843,7 @@ static int precedence(int tok)
 	    return 0;
     }
 }
-static unsigned char prec[256];
+static TCC_TLS unsigned char prec[256];
 static void init_prec(void)
 {
     int i;
@@ -7396,6 +7913,15 @@ static void init_putz(init_params *p, unsigned long c, int size)
     init_assert(p, c + size);
     if (p->sec) {
         /* nothing to do because globals are already set to zero */
+#ifdef TCC_TARGET_NATIVE_STRUCT_COPY
+    } else if (size <= STRUCT_INLINE_MAX
+#ifdef CONFIG_TCC_BCHECK
+               && !tcc_state->do_bounds_check
+#endif
+               ) {
+        vseti(VT_LOCAL, c);
+        gen_struct_fill(size, 0);
+#endif
     } else {
         vpush_helper_func(TOK_memset);
         vseti(VT_LOCAL, c);
@@ -8297,11 +8823,194 @@ static void func_vla_arg(Sym *sym)
 
 /* parse a function defined by symbol 'sym' and generate its code in
    'cur_text_section' */
+#ifdef TCC_TARGET_NATIVE_TIER
+/* -ftiered: every function with external linkage starts with an
+   indirect jump through a writable slot and an entry counter, see the
+   record layout in tcc.h.  The runtime may repoint the slot to a
+   version of the function built by another compiler, which is only
+   safe when the function (and everything it calls from this unit)
+   does not touch data defined in this unit: those get TIER_ELIGIBLE. */
+
+static TCC_TLS Sym *tier_file_sym;
+
+static Sym *tier_put_string(const char *str)
+{
+    int len = strlen(str) + 1;
+    unsigned long offset = rodata_section->data_offset;
+
+    memcpy(section_ptr_add(rodata_section, len), str, len);
+    return get_sym_ref(&char_pointer_type, rodata_section, offset, len);
+}
+
+static void tier_function_start(Sym *sym)
+{
+    TCCState *s1 = tcc_state;
+    Section *sec;
+    BufferedFile *f;
+    tier_func *tf;
+    Sym *slot;
+    int entry;
+
+    tf = tcc_mallocz(sizeof *tf);
+    tf->c = sym->c;
+    tf->slot = -1;
+    dynarray_add(&tier_funcs, &nb_tier_funcs, tf);
+    tier_cur = tf;
+    /* constructors would run again when the unit is loaded twice */
+    if (sym->type.ref->f.func_ctor || sym->type.ref->f.func_dtor)
+        tier_unit_impure = 1;
+    if (sym->type.t & VT_STATIC)
+        return;
+
+    sec = find_section(s1, TIER_SECTION);
+    sec->sh_flags = SHF_ALLOC | SHF_WRITE;
+    tf->slot = sec->data_offset;
+    section_ptr_add(sec, TIER_RECORD_SIZE);
+    slot = get_sym_ref(&char_pointer_type, sec, tf->slot, TIER_RECORD_SIZE);
+    entry = gen_tier_entry(slot);
+    greloca(sec, sym, tf->slot, R_DATA_PTR, entry);
+    greloca(sec, tier_put_string((char *)symtab_section->link->data
+                                 + elfsym(sym)->st_name),
+            tf->slot + 2 * PTR_SIZE, R_DATA_PTR, 0);
+    if (!tier_file_sym) {
+        for (f = file; f->prev; f = f->prev)
+            ;
+        tier_file_sym = tier_put_string(f->filename);
+    }
+    greloca(sec, tier_file_sym, tf->slot + 3 * PTR_SIZE, R_DATA_PTR, 0);
+}
+
+static void tier_reference(Sym *s)
+{
+    tier_func *tf = tier_cur;
+
+    if (s->sym_scope) {
+        /* static variable local to the function */
+        if (!(s->type.t & VT_CONSTANT))
+            tf->impure = 1;
+        return;
+    }
+    if (tf->nb_refs && tf->refs[tf->nb_refs - 1] == s)
+        return;
+    dynarray_add(&tf->refs, &tf->nb_refs, s);
+}
+
+static int tier_ref_impure(TCCState *s1, Sym *s)
+{
+    ElfSym *esym;
+    Section *sec;
+    int i;
+
+    if (!s->c)
+        return 0;
+    esym = elfsym(s);
+    if (esym->st_shndx == SHN_UNDEF)
+        return 0;
+    if (esym->st_shndx >= s1->nb_sections)
+        return 1;
+    sec = s1->sections[esym->st_shndx];
+    if (sec == rodata_section)
+        return 0;
+    if (sec->sh_flags & SHF_EXECINSTR)
+        for (i = 0; i < nb_tier_funcs; i++)
+            if (tier_funcs[i]->c == s->c)
+                return tier_funcs[i]->impure;
+    return 1;
+}
+
+static void tier_end(TCCState *s1)
+{
+    Section *sec;
+    tier_func *tf;
+    int i, j, changed;
+
+    do {
+        changed = 0;
+        for (i = 0; i < nb_tier_funcs; i++) {
+            tf = tier_funcs[i];
+            for (j = 0; j < tf->nb_refs && !tf->impure; j++)
+                if (tier_ref_impure(s1, tf->refs[j]))
+                    tf->impure = changed = 1;
+        }
+    } while (changed);
+
+    for (i = 0; i < nb_tier_funcs && !tier_unit_impure; i++) {
+        tf = tier_funcs[i];
+        if (tf->slot >= 0 && !tf->impure) {
+            sec = find_section(s1, TIER_SECTION);
+            write64le(sec->data + tf->slot + 4 * PTR_SIZE, TIER_ELIGIBLE);
+        }
+    }
+    tier_free();
+}
+
+static void tier_free(void)
+{
+    int i;
+
+    for (i = 0; i < nb_tier_funcs; i++)
+        tcc_free(tier_funcs[i]->refs);
+    dynarray_reset(&tier_funcs, &nb_tier_funcs);
+    tier_cur = NULL;
+    tier_file_sym = NULL;
+    tier_unit_impure = 0;
+}
+#endif
+
+/* statistics for tcc_set_codegen_report() */
+static void gen_function_report(unsigned long size, unsigned long long t0)
+{
+    TCCFuncReport r;
+
+    r.name = funcname;
+    r.file = file ? file->filename : "";
+    r.size = size;
+    r.spills = func_spills;
+    r.helper_calls = func_helper_calls;
+    r.ns = tcc_clock_ns() - t0;
+    tcc_state->report_func(tcc_state->report_opaque, &r);
+}
+
+/* the section for the code of 'sym': .text.hot or .text.unlikely as
+   told by the layout callback, and with -ffunction-sections one of its
+   own, for -Wl,--gc-sections to drop.  Line tables of debug info only
+   cover .text */
+static Section *function_text_section(TCCState *s1, Sym *sym)
+{
+    const char *name = get_tok_str(sym->v, NULL);
+    const char *base = ".text";
+    int heat = s1->layout_func ? s1->layout_func(s1->layout_opaque, name) : 0;
+    Section *sec;
+    char *buf;
+
+    if (heat)
+        base = heat > 0 ? ".text.hot" : ".text.unlikely";
+    if (!s1->function_sections || s1->do_debug
+        || s1->nb_sections >= MAX_FUNCTION_SECTIONS)
+        return heat ? find_section(s1, base) : text_section;
+    buf = tcc_malloc(strlen(base) + strlen(name) + 2);
+    sprintf(buf, "%s.%s", base, name);
+    /* a name is defined once in a unit, no need to look it up */
+    sec = new_section(s1, buf, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR);
+    /* packed as in .text once merged, but for aligned() */
+    sec->sh_addralign = 1;
+    tcc_free(buf);
+    return sec;
+}
+
 static void gen_function(Sym *sym)
 {
     struct scope f = { 0 };
+    unsigned long long t0 = 0;
     cur_scope = root_scope = &f;
     nocode_wanted = 0;
+    if (tcc_state->report_func) {
+        t0 = tcc_clock_ns();
+        func_spills = func_helper_calls = 0;
+    }
+    if ((tcc_state->layout_func || tcc_state->function_sections)
+        && cur_text_section == text_section)
+        cur_text_section = function_text_section(tcc_state, sym);
 
     cur_text_section->sh_flags |= SHF_EXECINSTR;
     ind = cur_text_section->data_offset;
@@ -8326,6 +9035,10 @@ static void gen_function(Sym *sym)
 
     /* put debug symbol */
     tcc_debug_funcstart(tcc_state, sym);
+#ifdef TCC_TARGET_NATIVE_TIER
+    if (tcc_state->tiered)
+        tier_function_start(sym);
+#endif
 
     /* push a dummy symbol to enable local sym storage */
     sym_push2(&local_stack, SYM_FIELD, 0, 0);
@@ -8351,12 +9064,17 @@ static void gen_function(Sym *sym)
 
     /* patch symbol size */
     elfsym(sym)->st_size = ind - func_ind;
+    if (tcc_state->report_func)
+        gen_function_report(ind - func_ind, t0);
 
     cur_text_section->data_offset = ind;
     local_scope = 0;
     label_pop(&global_label_stack, NULL, 0);
     sym_pop(&all_cleanups, NULL, 0);
 
+#ifdef TCC_TARGET_NATIVE_TIER
+    tier_cur = NULL;
+#endif
     /* It's better to crash than to generate wrong code */
     cur_text_section = NULL;
     funcname = ""; /* for safety */
@@ -27,39 +27,39 @@
 /********************************************************/
 /* global variables */
 
-ST_DATA int tok_flags;
-ST_DATA int parse_flags;
+ST_DATA TCC_TLS int tok_flags;
+ST_DATA TCC_TLS int parse_flags;
 
-ST_DATA struct BufferedFile *file;
-ST_DATA int tok;
-ST_DATA CValue tokc;
-ST_DATA const int *macro_ptr;
-ST_DATA CString tokcstr; /* current parsed string, if any */
+ST_DATA TCC_TLS struct BufferedFile *file;
+ST_DATA TCC_TLS int tok;
+ST_DATA TCC_TLS CValue tokc;
+ST_DATA TCC_TLS const int *macro_ptr;
+ST_DATA TCC_TLS CString tokcstr; /* current parsed string, if any */
 
 /* display benchmark infos */
-ST_DATA int tok_ident;
-ST_DATA TokenSym **table_ident;
-ST_DATA int pp_expr;
+ST_DATA TCC_TLS int tok_ident;
+ST_DATA TCC_TLS TokenSym **table_ident;
+ST_DATA TCC_TLS int pp_expr;
 
 /* ------------------------------------------------------------------------- */
 
-static TokenSym *hash_ident[TOK_HASH_SIZE];
-static char token_buf[STRING_MAX_SIZE + 1];
-static CString cstr_buf;
-static TokenString tokstr_buf;
-static TokenString unget_buf;
-static unsigned char isidnum_table[256 - CH_EOF];
-static int pp_debug_tok, pp_debug_symv;
-static int pp_counter;
+static TCC_TLS TokenSym **hash_ident; /* TOK_HASH_SIZE entries, per compilation */
+static TCC_TLS char token_buf[STRING_MAX_SIZE + 1];
+static TCC_TLS CString cstr_buf;
+static TCC_TLS TokenString tokstr_buf;
+static TCC_TLS TokenString unget_buf;
+static TCC_TLS unsigned char isidnum_table[256 - CH_EOF];
+static TCC_TLS int pp_debug_tok, pp_debug_symv;
+static TCC_TLS int pp_counter;
 static void tok_print(const int *str, const char *msg, ...);
 static void next_nomacro(void);
 static void parse_number(const char *p);
 static void parse_string(const char *p, int len);
 
-static struct TinyAlloc *toksym_alloc;
-static struct TinyAlloc *tokstr_alloc;
+static TCC_TLS struct TinyAlloc *toksym_alloc;
+static TCC_TLS struct TinyAlloc *tokstr_alloc;
 
-static TokenString *macro_stack;
+static TCC_TLS TokenString *macro_stack;
 
 static const char tcc_keywords[] = 
 #define DEF(id, str) str "\0"
@@ -1345,6 +1345,16 @@ ST_FUNC void skip_to_eol(int warn)
 static CachedInclude *
 search_cached_include(TCCState *s1, const char *filename, int add);
 
+/* true if 'bf' was found in a system include directory, or included
+   with "" from a file that was */
+static int in_sysinclude(TCCState *s1, BufferedFile *bf)
+{
+    int i = bf->include_next_index;
+    while (i == 1 && (bf = bf->prev))
+        i = bf->include_next_index;
+    return i - 2 >= s1->nb_include_paths;
+}
+
 static int parse_include(TCCState *s1, int do_next, int test)
 {
     int c, i;
@@ -1438,11 +1448,8 @@ static int parse_include(TCCState *s1, int do_next, int test)
 #endif
         /* update target deps */
         if (s1->gen_deps) {
-            BufferedFile *bf = file;
-            while (i == 1 && (bf = bf->prev))
-                i = bf->include_next_index;
             /* skip system include files */
-            if (s1->include_sys_deps || i - 2 < s1->nb_include_paths)
+            if (s1->include_sys_deps || !in_sysinclude(s1, file))
                 dynarray_add(&s1->target_deps, &s1->nb_target_deps,
                     tcc_strdup(buf));
         }
@@ -1776,6 +1783,22 @@ static int pragma_parse(TCCState *s1)
             tcc_free(p);
         }
 
+    } else if (tok == TOK_snapshot) {
+        const char *filename = "<snapshot>", *str = NULL;
+        int len;
+        next_nomacro();
+        skip_to_eol(1);
+        if (s1->snapshot_func)
+            str = s1->snapshot_func(s1->snapshot_opaque, &filename);
+        if (!str)
+            return 2;
+        /* continue with 'str': not being on the include stack, its end
+           is the end of the compilation */
+        len = strlen(str);
+        tcc_open_bf(s1, filename, len);
+        memcpy(file->buffer, str, len);
+        return 2;
+
     } else {
         tcc_warning_c(warn_all)("#pragma %s ignored", get_tok_str(tok, &tokc));
         return 0;
@@ -1832,6 +1855,12 @@ ST_FUNC void preprocess(int is_bof)
         pp_debug_tok = tok;
         next_nomacro();
         pp_debug_symv = tok;
+        if (tok == TOK_ATTRIBUTE2 && in_sysinclude(s1, file)) {
+            /* <sys/cdefs.h> defines it away for compilers other than
+               gcc and clang, but tcc knows attributes */
+            skip_to_eol(0);
+            break;
+        }
         parse_define();
         break;
     case TOK_UNDEF:
@@ -1970,8 +1999,11 @@ ST_FUNC void preprocess(int is_bof)
         break;
     }
     case TOK_PRAGMA:
-        if (!pragma_parse(s1))
+        c = pragma_parse(s1);
+        if (!c)
             goto ignore;
+        if (c == 2) /* the line is consumed already */
+            goto the_end;
         break;
     case TOK_LINEFEED:
         goto the_end;
@@ -3701,7 +3733,7 @@ ST_FUNC void tccpp_new(TCCState *s)
     tal_new(&toksym_alloc, TOKSYM_TAL_LIMIT, TOKSYM_TAL_SIZE);
     tal_new(&tokstr_alloc, TOKSTR_TAL_LIMIT, TOKSTR_TAL_SIZE);
 
-    memset(hash_ident, 0, TOK_HASH_SIZE * sizeof(TokenSym *));
+    hash_ident = tcc_mallocz(TOK_HASH_SIZE * sizeof(TokenSym *));
     memset(s->cached_includes_hash, 0, sizeof s->cached_includes_hash);
 
     cstr_new(&tokcstr);
@@ -3747,6 +3779,8 @@ ST_FUNC void tccpp_delete(TCCState *s)
         tal_free(toksym_alloc, table_ident[i]);
     tcc_free(table_ident);
     table_ident = NULL;
+    tcc_free(hash_ident);
+    hash_ident = NULL;
 
     /* free static buffers */
     cstr_free(&tokcstr);
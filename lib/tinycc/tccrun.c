@@ -108,29 +108,130 @@ static void win64_del_function_table(void *);
 //#define HAVE_SELINUX 1
 #endif
 
+#ifndef _WIN32
+/* images from this size on are aligned to huge pages and the kernel is
+   asked to back them with some (MADV_HUGEPAGE), sparing iTLB misses */
+#define RUN_HUGE_SIZE (2 << 20)
+
+/* anonymous read-write memory aligned to 'align' */
+static void *rt_map_aligned(void *hint, size_t size, size_t align)
+{
+    char *p, *q;
+    size_t extra = align > PAGESIZE ? align : 0;
+
+    p = mmap(hint, size + extra, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+        return NULL;
+    if (extra) {
+        q = (char *)(((addr_t)p + align - 1) & ~(addr_t)(align - 1));
+        if (q != p)
+            munmap(p, q - p);
+        if (q + size != p + size + extra)
+            munmap(q + size, p + extra - q);
+        p = q;
+    }
+    return p;
+}
+
+/* whether anonymous memory can be made executable, which SELinux may
+   deny (execmem) */
+static int rt_can_exec(void)
+{
+#ifdef HAVE_SELINUX
+    return 0;
+#else
+    static int can_exec = -1;
+    if (can_exec < 0) {
+        void *p = rt_map_aligned(NULL, PAGESIZE, PAGESIZE);
+        can_exec = p && 0 == mprotect(p, PAGESIZE, PROT_READ | PROT_EXEC);
+        if (p)
+            munmap(p, PAGESIZE);
+    }
+    return can_exec;
+#endif
+}
+
+/* the image mapped twice from a memory file: code runs from the first
+   mapping, read-only and executable, and everything is written (and data
+   used) through the second, right after it */
+static void *rt_map_dual(size_t size)
+{
+    void *ptr, *prw;
+    int fd = -1;
+
+#if defined __linux__ && defined MFD_CLOEXEC
+    fd = memfd_create("tccrun", MFD_CLOEXEC);
+#endif
+    if (fd < 0) {
+        char tmpfname[] = "/tmp/.tccrunXXXXXX";
+        fd = mkstemp(tmpfname);
+        if (fd >= 0)
+            unlink(tmpfname);
+    }
+    if (fd < 0)
+        return NULL;
+    ptr = prw = MAP_FAILED;
+    if (0 == ftruncate(fd, size)) {
+        ptr = mmap(NULL, size * 2, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+        if (ptr != MAP_FAILED)
+            prw = mmap((char *)ptr + size, size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_FIXED, fd, 0);
+    }
+    close(fd);
+    if (prw == MAP_FAILED) {
+        if (ptr != MAP_FAILED)
+            munmap(ptr, size * 2);
+        return NULL;
+    }
+    return ptr;
+}
+#endif
+
+/* allocate the memory the image runs in: its own mapping, from which
+   tcc_relocate_ex() makes code read-only and executable, or two views
+   of a memory file where writable memory cannot be made executable.
+   Returns the distance from code to where it is written, or -1. */
 static int rt_mem(TCCState *s1, int size)
 {
     void *ptr;
     int ptr_diff = 0;
-#ifdef HAVE_SELINUX
-    /* Using mmap instead of malloc */
-    void *prw;
-    char tmpfname[] = "/tmp/.tccrunXXXXXX";
-    int fd = mkstemp(tmpfname);
-    unlink(tmpfname);
-    ftruncate(fd, size);
-
-    ptr = mmap(NULL, size * 2, PROT_READ|PROT_EXEC, MAP_SHARED, fd, 0);
-    /* mmap RW memory at fixed distance */
-    prw = mmap((char*)ptr + size, size, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_FIXED, fd, 0);
-    close(fd);
-    if (ptr == MAP_FAILED || prw == MAP_FAILED)
-	return tcc_error_noabort("tccrun: could not map memory");
-    ptr_diff = (char*)prw - (char*)ptr; /* = size; */
-    //printf("map %p %p %p\n", ptr, prw, (void*)ptr_diff);
-    size *= 2;
-#else
+#ifdef _WIN32
     ptr = tcc_malloc(size += PAGESIZE); /* one extra page to align malloc memory */
+#else
+    size = PAGEALIGN(size);
+    if (s1->run_near) {
+        /* code bound to another program reaches its data with 32-bit
+           pc-relative offsets: look for free pages in range */
+        addr_t hint = PAGEALIGN((addr_t)s1->run_near);
+        int tries;
+        for (tries = 0; tries < 64; tries++, hint += size + (1 << 20)) {
+            ptr = rt_map_aligned((void *)hint, size, PAGESIZE);
+            if (!ptr)
+                break;
+            if ((addr_t)ptr - (addr_t)s1->run_near < 0x40000000
+                || (addr_t)s1->run_near - (addr_t)ptr < 0x40000000)
+                goto mapped;
+            munmap(ptr, size);
+        }
+        return tcc_error_noabort("tccrun: could not map memory near the program");
+    }
+    if (!rt_can_exec()) {
+        ptr = rt_map_dual(size);
+        ptr_diff = size;
+        size *= 2;
+    } else if (size >= RUN_HUGE_SIZE) {
+        ptr = rt_map_aligned(NULL, size, RUN_HUGE_SIZE);
+# ifdef MADV_HUGEPAGE
+        if (ptr)
+            madvise(ptr, size, MADV_HUGEPAGE);
+# endif
+    } else {
+        ptr = rt_map_aligned(NULL, size, PAGESIZE);
+    }
+    if (!ptr)
+        return tcc_error_noabort("tccrun: could not map memory");
+mapped:
 #endif
     s1->run_ptr = ptr;
     s1->run_size = size;
@@ -163,6 +264,440 @@ LIBTCCAPI int tcc_relocate(TCCState *s1)
     return ret;
 }
 
+/* find the local symbol 'name' of the unit 'file' in 'prog', the same
+   'nth' of that name */
+static ElfSym *find_unit_local(TCCState *prog, const char *file,
+                               const char *name, int nth)
+{
+    Section *symtab = prog->symtab;
+    ElfSym *sym, *end = (ElfSym *)(symtab->data + symtab->data_offset);
+    const char *cur = NULL, *sname;
+
+    for (sym = (ElfSym *)symtab->data + 1; sym < end; sym++) {
+        sname = (char *)symtab->link->data + sym->st_name;
+        if (ELFW(ST_TYPE)(sym->st_info) == STT_FILE)
+            cur = sname;
+        else if (ELFW(ST_BIND)(sym->st_info) == STB_LOCAL
+                 && cur && !strcmp(cur, file) && !strcmp(sname, name)
+                 && nth-- == 0)
+            return sym;
+    }
+    return NULL;
+}
+
+/* data of the program bound by tcc_relink_program(), found at 'offset'
+   of 'sec' in the unit, or zero for common symbols */
+struct bind_data {
+    Section *sec;
+    addr_t offset;
+    addr_t addr;
+    unsigned size;
+    int readonly;
+    int sym_index;
+};
+
+static void bind_data_add(TCCState *s1, ElfSym *sym, ElfSym *psym, int readonly)
+{
+    struct bind_data *b = tcc_mallocz(sizeof *b);
+
+    if (sym->st_shndx != SHN_COMMON) {
+        b->sec = s1->sections[sym->st_shndx];
+        b->offset = sym->st_value;
+    }
+    b->addr = psym->st_value;
+    b->size = sym->st_size;
+    b->readonly = readonly;
+    b->sym_index = sym - (ElfSym *)s1->symtab->data;
+    dynarray_add(&s1->bind_data, &s1->nb_bind_data, b);
+}
+
+/* after relocate_sections(): give the data of the program the initial
+   values of the unit, once its read-only data is known unchanged */
+static void relink_program_data(TCCState *s1)
+{
+    struct bind_data *b;
+    ElfSym *sym;
+    int i;
+
+    for (i = 0; i < s1->nb_bind_data; i++) {
+        b = s1->bind_data[i];
+        if (b->readonly && memcmp((void *)b->addr, b->sec->data + b->offset, b->size)) {
+            sym = (ElfSym *)s1->symtab->data + b->sym_index;
+            tcc_error_noabort("read-only '%s' changed",
+                              (char *)s1->symtab->link->data + sym->st_name);
+        }
+    }
+    for (i = 0; i < s1->nb_bind_data && !s1->nb_errors; i++) {
+        b = s1->bind_data[i];
+        if (b->readonly)
+            continue;
+        if (!b->sec || !b->sec->data || b->sec->sh_type == SHT_NOBITS)
+            memset((void *)b->addr, 0, b->size);
+        else
+            memcpy((void *)b->addr, b->sec->data + b->offset, b->size);
+    }
+    dynarray_reset(&s1->bind_data, &s1->nb_bind_data);
+}
+
+LIBTCCAPI int tcc_bind_program(TCCState *s1, TCCState *prog)
+{
+    Section *symtab = s1->symtab, *sec;
+    ElfSym *sym, *psym, *end = (ElfSym *)(symtab->data + symtab->data_offset);
+    ElfSym *s2;
+    const char *name, *file = "";
+    int nth, ret = 0;
+
+    if (!prog->run_ptr)
+        return tcc_error_noabort("program is not relocated");
+    s1->run_near = (char *)prog->run_ptr + prog->run_size;
+    for (sym = (ElfSym *)symtab->data + 1; sym < end; sym++) {
+        name = (char *)symtab->link->data + sym->st_name;
+        if (ELFW(ST_TYPE)(sym->st_info) == STT_FILE) {
+            file = name;
+            continue;
+        }
+        if (!*name || ELFW(ST_TYPE)(sym->st_info) == STT_SECTION)
+            continue;
+        if (sym->st_shndx == SHN_UNDEF) {
+            psym = (ElfSym *)prog->symtab->data + find_elf_sym(prog->symtab, name);
+            /* left to the dynamic linker, unless it did for the program */
+            if (psym->st_shndx == SHN_UNDEF && !psym->st_value)
+                continue;
+        } else if (ELFW(ST_TYPE)(sym->st_info) == STT_OBJECT
+                   && (sym->st_shndx == SHN_COMMON
+                       || (sym->st_shndx < SHN_LORESERVE
+                           && (sec = s1->sections[sym->st_shndx],
+                               (sec->sh_flags & (SHF_WRITE | SHF_TLS)) == SHF_WRITE)
+                           && strcmp(sec->name, TIER_SECTION)))) {
+            if (!strncmp(name, "L.", 2))
+                continue; /* anonymous data is private to the code */
+            if (ELFW(ST_BIND)(sym->st_info) == STB_LOCAL) {
+                for (nth = 0, s2 = sym - 1; s2 > (ElfSym *)symtab->data
+                     && ELFW(ST_TYPE)(s2->st_info) != STT_FILE; s2--)
+                    if (ELFW(ST_BIND)(s2->st_info) == STB_LOCAL
+                        && !strcmp((char *)symtab->link->data + s2->st_name, name))
+                        nth++;
+                psym = find_unit_local(prog, file, name, nth);
+            } else {
+                psym = (ElfSym *)prog->symtab->data + find_elf_sym(prog->symtab, name);
+            }
+            if (!psym || psym->st_shndx == SHN_UNDEF) {
+                ret = tcc_error_noabort("'%s' is new data, not in the program", name);
+                continue;
+            }
+            if (psym->st_size != sym->st_size) {
+                ret = tcc_error_noabort("size of '%s' changed from %d to %d", name,
+                                        (int)psym->st_size, (int)sym->st_size);
+                continue;
+            }
+            if (s1->relink)
+                bind_data_add(s1, sym, psym, 0);
+        } else if (s1->relink && ELFW(ST_TYPE)(sym->st_info) == STT_OBJECT
+                   && ELFW(ST_BIND)(sym->st_info) != STB_LOCAL
+                   && sym->st_shndx < SHN_LORESERVE
+                   && !(s1->sections[sym->st_shndx]->sh_flags & (SHF_WRITE | SHF_TLS))) {
+            /* read-only data stays the one of the unit, but the other
+               units of the program keep theirs */
+            psym = (ElfSym *)prog->symtab->data + find_elf_sym(prog->symtab, name);
+            if (psym->st_shndx == SHN_UNDEF)
+                continue;
+            if (psym->st_size != sym->st_size)
+                ret = tcc_error_noabort("size of read-only '%s' changed", name);
+            else
+                bind_data_add(s1, sym, psym, 1);
+            continue;
+        } else {
+            continue;
+        }
+        sym->st_shndx = SHN_ABS;
+        sym->st_value = psym->st_value;
+    }
+    return ret;
+}
+
+LIBTCCAPI int tcc_relink_program(TCCState *s1, TCCState *prog)
+{
+    s1->relink = 1;
+    return tcc_bind_program(s1, prog);
+}
+
+/* ------------------------------------------------------------- */
+/* -Wl,--runtime-image=: libtcc1 linked once with -shared when tcc is
+   built (make libtcc1.so). The first program relocated maps it from its
+   file and resolves its few imports from the process; the others find
+   it mapped. Its symbols are then given to each program at once, in
+   place of the members of libtcc1.a it would load one by one. */
+
+#if !defined _WIN32 && !defined TCC_TARGET_MACHO
+
+#if SHT_RELX == SHT_RELA
+# define DT_RELX DT_RELA
+# define DT_RELXSZ DT_RELASZ
+#else
+# define DT_RELX DT_REL
+# define DT_RELXSZ DT_RELSZ
+#endif
+
+typedef struct rt_image {
+    char file[1024];
+    char *base; /* where its address 0 is mapped */
+    ElfW(Sym) *syms;
+    int nb_syms;
+    const char *strtab;
+} rt_image;
+
+/* kept for the life of the process, as the libraries of dlopen() */
+static rt_image rt_images[4];
+static int nb_rt_images;
+TCC_SEM(static rt_image_sem);
+
+/* symbols tcc_add_linker_symbols() added to the image, which each
+   program has its own of */
+static int rt_linker_sym(const char *name)
+{
+    static const char *const names[] = {
+        "_etext", "_edata", "_end", "_GLOBAL_OFFSET_TABLE_", "_DYNAMIC",
+        "__preinit_array_start", "__preinit_array_end",
+        "__init_array_start", "__init_array_end",
+        "__fini_array_start", "__fini_array_end",
+        "__executable_start", "__global_pointer$", NULL
+    };
+    const char *const *p;
+
+    if (!strncmp(name, "__start_", 8) || !strncmp(name, "__stop_", 7))
+        return 1;
+    for (p = names; *p; p++)
+        if (!strcmp(name, *p))
+            return 1;
+    return 0;
+}
+
+/* apply the dynamic relocations of the image, all in its data between
+   'wlo' and 'whi' */
+static int rt_image_reloc(rt_image *im, ElfW_Rel *rel, addr_t size,
+                          addr_t wlo, addr_t whi, char *err, int err_size)
+{
+    ElfW_Rel *end = (ElfW_Rel *)((char *)rel + size);
+    ElfW(Sym) *sym;
+    addr_t *ptr, val, addend;
+    const char *name;
+    int type;
+
+    for (; rel < end; rel++) {
+        type = ELFW(R_TYPE)(rel->r_info);
+        sym = &im->syms[ELFW(R_SYM)(rel->r_info)];
+        name = im->strtab + sym->st_name;
+        ptr = (addr_t *)(im->base + rel->r_offset);
+        if (rel->r_offset < wlo || rel->r_offset + sizeof *ptr > whi) {
+            snprintf(err, err_size, "relocation out of its data");
+            return -1;
+        }
+#if SHT_RELX == SHT_RELA
+        addend = rel->r_addend;
+#else
+        addend = *ptr;
+#endif
+        if (type == R_RELATIVE) {
+            *ptr = (addr_t)im->base + addend;
+            continue;
+        }
+        if (type != R_JMP_SLOT && type != R_GLOB_DAT && type != R_DATA_PTR) {
+            snprintf(err, err_size, "unsupported relocation %d", type);
+            return -1;
+        }
+        if (sym->st_shndx != SHN_UNDEF)
+            val = (addr_t)im->base + sym->st_value;
+        else if (!(val = (addr_t)dlsym(RTLD_DEFAULT, name))
+                 && ELFW(ST_BIND)(sym->st_info) != STB_WEAK) {
+            snprintf(err, err_size, "undefined symbol '%s'", name);
+            return -1;
+        }
+        *ptr = type == R_DATA_PTR ? val + addend : val;
+    }
+    return 0;
+}
+
+/* map the segments of the image in 'fd' over a range reserved for all
+   of them, as they were linked, then relocate it */
+static int rt_image_map(rt_image *im, int fd, char *err, int err_size)
+{
+    ElfW(Ehdr) eh;
+    ElfW(Phdr) *ph = NULL, *p;
+    ElfW(Dyn) *d = NULL;
+    ElfW_Rel *rel = NULL, *jmprel = NULL;
+    addr_t size = 0, relsz = 0, jmprelsz = 0, wlo = -1, whi = 0, off, end;
+    int prot, ret = -1;
+
+    if (full_read(fd, &eh, sizeof eh) != sizeof eh
+        || memcmp(eh.e_ident, ELFMAG, SELFMAG) || eh.e_type != ET_DYN
+        || eh.e_machine != EM_TCC_TARGET || eh.e_phentsize != sizeof *ph) {
+        snprintf(err, err_size, "not a shared object for this target");
+        return -1;
+    }
+    ph = tcc_malloc(eh.e_phnum * sizeof *ph);
+    if (lseek(fd, eh.e_phoff, SEEK_SET) != (off_t)eh.e_phoff
+        || full_read(fd, ph, eh.e_phnum * sizeof *ph) != eh.e_phnum * sizeof *ph) {
+        snprintf(err, err_size, "truncated");
+        goto done;
+    }
+    for (p = ph; p < ph + eh.e_phnum; p++)
+        if (p->p_type == PT_LOAD && p->p_vaddr + p->p_memsz > size)
+            size = p->p_vaddr + p->p_memsz;
+    size = PAGEALIGN(size);
+    im->base = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (im->base == MAP_FAILED) {
+        im->base = NULL;
+        snprintf(err, err_size, "%s", strerror(errno));
+        goto done;
+    }
+    for (p = ph; p < ph + eh.e_phnum; p++) {
+        if (p->p_type == PT_DYNAMIC)
+            d = (ElfW(Dyn) *)(im->base + p->p_vaddr);
+        if (p->p_type != PT_LOAD)
+            continue;
+        prot = (p->p_flags & PF_R ? PROT_READ : 0)
+            | (p->p_flags & PF_W ? PROT_WRITE : 0)
+            | (p->p_flags & PF_X ? PROT_EXEC : 0);
+        off = p->p_vaddr & (PAGESIZE - 1);
+        /* fails where the file system is mounted noexec */
+        if (p->p_filesz
+            && mmap(im->base + p->p_vaddr - off, off + p->p_filesz, prot,
+                    MAP_PRIVATE | MAP_FIXED, fd, p->p_offset - off) == MAP_FAILED) {
+            snprintf(err, err_size, "%s", strerror(errno));
+            goto done;
+        }
+        if (p->p_memsz > p->p_filesz) {
+            /* .bss: the rest of the last page of the file, then pages
+               of its own */
+            end = p->p_filesz ? PAGEALIGN(p->p_vaddr + p->p_filesz) : p->p_vaddr - off;
+            if (!(p->p_flags & PF_W)) {
+                snprintf(err, err_size, "read-only .bss");
+                goto done;
+            }
+            if (p->p_filesz)
+                memset(im->base + p->p_vaddr + p->p_filesz, 0,
+                       end - (p->p_vaddr + p->p_filesz));
+            if (p->p_vaddr + p->p_memsz > end
+                && mmap(im->base + end, PAGEALIGN(p->p_vaddr + p->p_memsz) - end,
+                        prot, MAP_PRIVATE | MAP_FIXED | MAP_ANONYMOUS,
+                        -1, 0) == MAP_FAILED) {
+                snprintf(err, err_size, "%s", strerror(errno));
+                goto done;
+            }
+        }
+        if (p->p_flags & PF_W) {
+            if (p->p_vaddr < wlo)
+                wlo = p->p_vaddr;
+            if (p->p_vaddr + p->p_memsz > whi)
+                whi = p->p_vaddr + p->p_memsz;
+        }
+    }
+    for (; d && d->d_tag != DT_NULL; d++) {
+        switch (d->d_tag) {
+        case DT_SYMTAB: im->syms = (ElfW(Sym) *)(im->base + d->d_un.d_ptr); break;
+        case DT_STRTAB: im->strtab = im->base + d->d_un.d_ptr; break;
+        /* nchain, the number of symbols */
+        case DT_HASH: im->nb_syms = ((Elf32_Word *)(im->base + d->d_un.d_ptr))[1]; break;
+        case DT_RELX: rel = (ElfW_Rel *)(im->base + d->d_un.d_ptr); break;
+        case DT_RELXSZ: relsz = d->d_un.d_val; break;
+        case DT_JMPREL: jmprel = (ElfW_Rel *)(im->base + d->d_un.d_ptr); break;
+        case DT_PLTRELSZ: jmprelsz = d->d_un.d_val; break;
+        }
+    }
+    if (!im->syms || !im->strtab || !im->nb_syms) {
+        snprintf(err, err_size, "no symbols");
+        goto done;
+    }
+    if ((rel && rt_image_reloc(im, rel, relsz, wlo, whi, err, err_size) < 0)
+        || (jmprel && rt_image_reloc(im, jmprel, jmprelsz, wlo, whi, err, err_size) < 0))
+        goto done;
+    ret = 0;
+done:
+    if (ret < 0 && im->base)
+        munmap(im->base, size);
+    tcc_free(ph);
+    return ret;
+}
+
+/* find the image of s1->runtime_image, mapping it the first time */
+static rt_image *rt_image_get(TCCState *s1)
+{
+    rt_image *im;
+    char err[256];
+    int fd, ret;
+
+    for (im = rt_images; im < rt_images + nb_rt_images; im++)
+        if (!strcmp(im->file, s1->runtime_image))
+            return im;
+    if (nb_rt_images == countof(rt_images)
+        || strlen(s1->runtime_image) >= sizeof im->file)
+        return NULL;
+    memset(im, 0, sizeof *im);
+    fd = open(s1->runtime_image, O_RDONLY | O_BINARY);
+    if (fd < 0) {
+        snprintf(err, sizeof err, "%s", strerror(errno));
+        ret = -1;
+    } else {
+        ret = rt_image_map(im, fd, err, sizeof err);
+        close(fd);
+    }
+    if (ret < 0) {
+        if (s1->verbose)
+            printf("%s: %s, linking %s\n", s1->runtime_image, err, TCC_LIBTCC1);
+        return NULL;
+    }
+    strcpy(im->file, s1->runtime_image);
+    nb_rt_images++;
+    return im;
+}
+
+/* define the symbols of the runtime image in s1, but those of its own,
+   before libtcc1.a is linked. Returns -1 when there is no image. */
+ST_FUNC int tcc_add_runtime_image(TCCState *s1)
+{
+    rt_image *im;
+    ElfW(Sym) *sym, *esym;
+    const char *name;
+    int i;
+
+    if (!s1->runtime_image || s1->output_type != TCC_OUTPUT_MEMORY)
+        return -1;
+#ifdef CONFIG_TCC_BCHECK
+    /* alloca-bt.o calls bcheck.o, linked in the program */
+    if (s1->do_bounds_check)
+        return -1;
+#endif
+    WAIT_SEM(&rt_image_sem);
+    im = rt_image_get(s1);
+    POST_SEM(&rt_image_sem);
+    if (!im)
+        return -1;
+    for (i = 1; i < im->nb_syms; i++) {
+        sym = &im->syms[i];
+        name = im->strtab + sym->st_name;
+        if (sym->st_shndx == SHN_UNDEF || ELFW(ST_BIND)(sym->st_info) == STB_LOCAL
+            || rt_linker_sym(name))
+            continue;
+        esym = (ElfW(Sym) *)symtab_section->data + find_elf_sym(symtab_section, name);
+        if (esym->st_shndx != SHN_UNDEF)
+            continue; /* the program's own, as with libtcc1.a */
+        set_elf_sym(symtab_section, (addr_t)im->base + sym->st_value, sym->st_size,
+                    sym->st_info, 0, SHN_ABS, name);
+    }
+    if (s1->verbose == 2)
+        printf("-> %s\n", s1->runtime_image);
+    return 0;
+}
+
+#else
+
+ST_FUNC int tcc_add_runtime_image(TCCState *s1)
+{
+    return -1;
+}
+
+#endif
+
 ST_FUNC void tcc_run_free(TCCState *s1)
 {
     unsigned size;
@@ -185,7 +720,7 @@ ST_FUNC void tcc_run_free(TCCState *s1)
         return;
     st_unlink(s1);
     size = s1->run_size;
-#ifdef HAVE_SELINUX
+#ifndef _WIN32
     munmap(ptr, size);
 #else
     /* unprotect memory to make it usable for malloc again */
@@ -251,15 +786,22 @@ LIBTCCAPI int tcc_run(TCCState *s1, int argc, char **argv)
 static void cleanup_symbols(TCCState *s1)
 {
     Section *s = s1->symtab;
-    int sym_index, end_sym = s->data_offset / sizeof (ElfSym);
+    int sym_index, nb_globals, end_sym = s->data_offset / sizeof (ElfSym);
+    for (sym_index = 1, nb_globals = 0; sym_index < end_sym; ++sym_index)
+        nb_globals += ELFW(ST_BIND)(((ElfW(Sym) *)s->data)[sym_index].st_info) != STB_LOCAL;
     /* reset symtab */
     s->data_offset = s->link->data_offset = s->hash->data_offset = 0;
     init_symtab(s);
+    reserve_elf_syms(s, nb_globals);
     /* add global symbols again */
     for (sym_index = 1; sym_index < end_sym; ++sym_index) {
         ElfW(Sym) *sym = &((ElfW(Sym) *)s->data)[sym_index];
         const char *name = (char *)s->link->data + sym->st_name;
-        if (ELFW(ST_BIND)(sym->st_info) == STB_LOCAL)
+        /* -ftiered code may be compiled again over this data, see
+           tcc_bind_program() */
+        if (ELFW(ST_BIND)(sym->st_info) == STB_LOCAL
+            && !(s1->tiered && (ELFW(ST_TYPE)(sym->st_info) == STT_FILE
+                                || ELFW(ST_TYPE)(sym->st_info) == STT_OBJECT)))
             continue;
         //printf("sym %s\n", name);
         put_elf_sym(s, sym->st_value, sym->st_size, sym->st_info, sym->st_other, sym->st_shndx, name);
@@ -293,7 +835,7 @@ static void cleanup_sections(TCCState *s1)
    The disadvantage of this is that it requires a little bit more memory. */
 
 #ifndef CONFIG_RUNMEM_RO
-# ifdef __APPLE__
+# ifndef _WIN32 /* code has its own mapping, see rt_mem() */
 #   define CONFIG_RUNMEM_RO 1
 # else
 #   define CONFIG_RUNMEM_RO 0
@@ -305,7 +847,7 @@ static void cleanup_sections(TCCState *s1)
 static int tcc_relocate_ex(TCCState *s1, void *ptr, unsigned ptr_diff)
 {
     Section *s;
-    unsigned offset, length, align, i, k, f;
+    unsigned offset, length, align, i, j, k, f;
     unsigned n, copy;
     addr_t mem, addr;
 
@@ -313,8 +855,12 @@ static int tcc_relocate_ex(TCCState *s1, void *ptr, unsigned ptr_diff)
 #ifdef TCC_TARGET_PE
         pe_output_file(s1, NULL);
 #else
+        if (s1->test_coverage && s1->tcov_file)
+            tcc_tcov_add_file(s1, s1->tcov_file);
         tcc_add_runtime(s1);
 	resolve_common_syms(s1);
+        if (s1->gc_sections)
+            gc_sections(s1);
         build_got_entries(s1, 0);
 #endif
     }
@@ -331,11 +877,17 @@ redo:
 
     for (k = 0; k < 3; ++k) { /* 0:rx, 1:ro, 2:rw sections */
         n = 0; addr = 0;
-        for(i = 1; i < s1->nb_sections; i++) {
+        /* three rounds, for hot code, everything else and cold code */
+        for(j = 0; j < 3 * s1->nb_sections; j++) {
             static const char shf[] = {
                 SHF_ALLOC|SHF_EXECINSTR, SHF_ALLOC, SHF_ALLOC|SHF_WRITE
                 };
+            i = j % s1->nb_sections;
+            if (i == 0)
+                continue;
             s = s1->sections[i];
+            if (text_section_heat(s) != (int)(j / s1->nb_sections) - 1)
+                continue;
             if (shf[k] != (s->sh_flags & (SHF_ALLOC|SHF_WRITE|SHF_EXECINSTR)))
                 continue;
             length = s->data_offset;
@@ -381,10 +933,8 @@ redo:
         if (copy == 2) { /* set permissions */
             if (n == 0) /* no data  */
                 continue;
-#ifdef HAVE_SELINUX
-            if (k == 0) /* SHF_EXECINSTR has its own mapping */
+            if (k == 0 && ptr_diff) /* SHF_EXECINSTR has its own mapping */
                 continue;
-#endif
             f = k;
             if (f >= CONFIG_RUNMEM_RO) {
                 if (f != 0)
@@ -427,6 +977,8 @@ redo:
     relocate_plt(s1);
 #endif
     relocate_sections(s1);
+    if (s1->nb_bind_data)
+        relink_program_data(s1);
     goto redo;
 }
 
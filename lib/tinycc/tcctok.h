@@ -148,6 +148,8 @@
      DEF(TOK_DESTRUCTOR2, "__destructor__")
      DEF(TOK_ALWAYS_INLINE1, "always_inline")
      DEF(TOK_ALWAYS_INLINE2, "__always_inline__")
+     DEF(TOK_VECTOR_SIZE1, "vector_size")
+     DEF(TOK_VECTOR_SIZE2, "__vector_size__")
 
      DEF(TOK_MODE, "__mode__")
      DEF(TOK_MODE_QI, "__QI__")
@@ -217,6 +219,7 @@
      DEF(TOK_pop_macro, "pop_macro")
      DEF(TOK_once, "once")
      DEF(TOK_option, "option")
+     DEF(TOK_snapshot, "snapshot")
 
 /* builtin functions or variables */
 #ifndef TCC_ARM_EABI
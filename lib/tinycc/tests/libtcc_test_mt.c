@@ -283,6 +283,40 @@ static unsigned getclock_ms(void)
 #endif
 }
 
+/* compile tcc.c with 1, 2, 4 ... threads at once, to see how it scales */
+#define SCALE_RUNS 2 /* compilations per thread */
+
+TF_TYPE(thread_test_scale, vn)
+{
+    int i;
+    for (i = 0; i < SCALE_RUNS; ++i) {
+        TCCState *s = new_state(1);
+        int ret = tcc_add_file(s, g_argv[1]);
+        tcc_delete(s);
+        if (ret < 0)
+            exit(1);
+    }
+    return 0;
+}
+
+void scale_test(int max)
+{
+    unsigned t, t1 = 0;
+    int n, i;
+    for (n = 1; n <= max && n <= M; n *= 2) {
+        t = getclock_ms();
+        for (i = 0; i < n; ++i)
+            create_thread(thread_test_scale, i);
+        wait_threads(n);
+        t = getclock_ms() - t;
+        if (t == 0)
+            t = 1;
+        if (n == 1)
+            t1 = t;
+        printf(" %d: %u ms (%.1fx)", n, t, (double)t1 * n / t), fflush(stdout);
+    }
+}
+
 int main(int argc, char **argv)
 {
     int n;
@@ -331,6 +365,13 @@ int main(int argc, char **argv)
     t = getclock_ms();
     time_tcc(10, argv[1]);
     printf("\n (%u ms)\n", getclock_ms() - t), fflush(stdout);
+#endif
+#if 1
+    printf("compiling tcc.c %d times per thread, speedup over 1 thread\n ",
+        SCALE_RUNS), fflush(stdout);
+    t = getclock_ms();
+    scale_test(8);
+    printf("\n (%u ms)\n", getclock_ms() - t), fflush(stdout);
 #endif
     return 0;
 }
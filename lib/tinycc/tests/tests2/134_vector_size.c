@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <immintrin.h>
+
+typedef float v4sf __attribute__((vector_size(16)));
+typedef int v4si __attribute__((vector_size(16)));
+typedef double v2df __attribute__((vector_size(16)));
+typedef unsigned char v16qu __attribute__((vector_size(16)));
+typedef short v8hi __attribute__((vector_size(16)));
+typedef int v8si __attribute__((vector_size(32)));
+typedef short v4hi __attribute__((vector_size(8)));
+struct S { int pad; v4sf v; };
+v4sf g = { 1, 2, 3, 4 };
+static v4sf add(v4sf a, v4sf b) { return a + b; }
+
+static void intrinsics(void)
+{
+    float in[8] = { 1, 2, 3, 4, 5, 6, 7, 8 }, out[8];
+    int iv[4];
+    __m128 a = _mm_loadu_ps(in), b = _mm_set1_ps(2.0f), c;
+    __m128i x = _mm_set_epi32(4, 3, 2, 1), y;
+    __m256 w;
+
+    c = _mm_add_ps(_mm_mul_ps(a, b), _mm_set_ss(100));
+    _mm_storeu_ps(out, c);
+    printf("%g %g %g %g\n", out[0], out[1], out[2], out[3]);
+    c = _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3));
+    printf("%g %g %g %g %d\n", c[0], c[1], c[2], c[3],
+           _mm_movemask_ps(_mm_cmpgt_ps(a, b)));
+    y = _mm_slli_epi32(_mm_add_epi32(x, x), 3);
+    _mm_storeu_si128((__m128i *)iv, y);
+    printf("%d %d %d %d\n", iv[0], iv[1], iv[2], iv[3]);
+    printf("%x\n", _mm_movemask_epi8(_mm_cmpeq_epi32(x, _mm_set1_epi32(3))));
+    w = _mm256_fmadd_ps(_mm256_loadu_ps(in), _mm256_set1_ps(10), _mm256_set1_ps(0.5f));
+    _mm256_storeu_ps(out, w);
+    printf("%g %g\n", out[0], out[7]);
+}
+
+int main(void)
+{
+    v4sf a = { 1.5f, 2.5f, -3.0f, 4.0f }, b = { 2, 4, 8, 16 }, c;
+    v4si i = { 1, 2, 3, 4 }, j = { 10, 20, 30, 40 }, k;
+    v2df d = { 1.0, 2.0 };
+    v16qu q = { 250, 251, 252, 253, 254, 255, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    v8hi h = { 1, -2, 3, -4, 5, -6, 7, -8 };
+    v8si w = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    v4hi p = (v4hi)0x0004000300020001LL;
+    struct S s, *ps = &s;
+    int n;
+    c = a + b; printf("%g %g %g %g\n", c[0], c[1], c[2], c[3]);
+    c = a * b - g; printf("%g %g %g %g\n", c[0], c[1], c[2], c[3]);
+    c = b / 2; printf("%g %g %g %g\n", c[0], c[1], c[2], c[3]);
+    c = -a; printf("%g %g %g %g\n", c[0], c[1], c[2], c[3]);
+    k = i * j + 1; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = (j - i) ^ i; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = j / i % 7; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = i << 2; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = a > b; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = ~i; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    d = d * 3.0; printf("%g %g\n", d[0], d[1]);
+    q += 10; for (n = 0; n < 16; n++) printf("%d ", q[n]); printf("\n");
+    h = h * h; for (n = 0; n < 8; n++) printf("%d ", h[n]); printf("\n");
+    w = w + w; for (n = 0; n < 8; n++) printf("%d ", w[n]); printf("\n");
+    ps->v = add(a, g); ps->v += ps->v; printf("%g %g %g %g\n", s.v[0], s.v[1], s.v[2], s.v[3]);
+    s.v[2] = 42; printf("%g %d %d\n", s.v[2], (int)sizeof(v8si), (int)_Alignof(v4sf));
+    k = (v4si)a; printf("%x\n", k[0]);
+    p += p; printf("%d %d %llx\n", p[0], p[3], (long long)p);
+    a += 1; printf("%g\n", a[0]);
+    intrinsics();
+    return 0;
+}
@@ -0,0 +1,51 @@
+/* -ftiered: entry slots, counters and eligibility */
+#include <stdio.h>
+#include <string.h>
+
+struct slot {
+    void *target;
+    unsigned long count;
+    const char *name;
+    const char *file;
+    unsigned long flags;
+};
+extern struct slot __start_cjit_tier[], __stop_cjit_tier[];
+
+int counter;
+const int k = 3;
+static int sq(int x) { return x * x * k; }
+int pure(int x) { return sq(x) + 1; }
+int bump(void) { return ++counter; }
+int calls_bump(void) { return bump(); }
+int uses_printf(int x) { printf("printf %d\n", x); return x; }
+static int replacement(int x) { return -x; }
+
+static struct slot *find(const char *name)
+{
+    struct slot *s;
+    for (s = __start_cjit_tier; s < __stop_cjit_tier; s++)
+        if (!strcmp(s->name, name))
+            return s;
+    return NULL;
+}
+
+int main(void)
+{
+    struct slot *s;
+    int i;
+
+    for (i = 0; i < 5; i++)
+        pure(i), calls_bump();
+    uses_printf(7);
+    for (s = __start_cjit_tier; s < __stop_cjit_tier; s++)
+        printf("%s count=%lu flags=%lu file=%d\n", s->name, s->count, s->flags,
+               strstr(s->file, "135_tiered.c") != NULL);
+    printf("static sq has a slot: %d\n", find("sq") != NULL);
+
+    /* repoint a slot like the tiered runtime does */
+    s = find("pure");
+    printf("pure(4)=%d\n", pure(4));
+    s->target = (void *)replacement;
+    printf("pure(4)=%d count=%lu\n", pure(4), s->count);
+    return 0;
+}
@@ -0,0 +1,83 @@
+/* division and modulo by constants, lowered to multiply-high
+   sequences, checked against the div instruction */
+#include <stdio.h>
+#include <limits.h>
+
+static int i32[] = {
+    0, 1, -1, 2, -2, 3, -3, 6, 7, -7, 9, 10, -10, 99, 100, -101, 255, 256,
+    1000, -1000, 65535, 65536, 123456789, -123456789, 0x3fffffff,
+    INT_MAX, INT_MAX - 1, INT_MIN, INT_MIN + 1,
+};
+static unsigned u32[] = {
+    0, 1, 2, 3, 6, 7, 9, 10, 99, 100, 255, 256, 1000, 65535, 65536,
+    123456789, 0x7fffffff, 0x80000000, 0x80000001, 0xfffffffe, UINT_MAX,
+};
+static long long i64[] = {
+    0, 1, -1, 2, -2, 3, -3, 7, -7, 10, -10, 1000, -1000, 0xffffffffLL,
+    0x100000000LL, -0x100000000LL, 1234567890123456789LL,
+    -1234567890123456789LL, LLONG_MAX, LLONG_MAX - 1, LLONG_MIN,
+    LLONG_MIN + 1,
+};
+static unsigned long long u64[] = {
+    0, 1, 2, 3, 7, 10, 1000, 0xffffffffULL, 0x100000000ULL,
+    12345678901234567890ULL, 0x7fffffffffffffffULL, 0x8000000000000000ULL,
+    0x8000000000000001ULL, ULLONG_MAX - 1, ULLONG_MAX,
+};
+
+#define N(a) (sizeof(a) / sizeof((a)[0]))
+
+#define CHECK(T, tab, D) do { \
+    volatile T d = D; \
+    unsigned i; \
+    for (i = 0; i < N(tab); i++) { \
+        T x = tab[i]; \
+        if (x / D != x / d || x % D != x % d) { \
+            printf("%s: %lld / %s wrong\n", #T, (long long)x, #D); \
+            errors++; \
+        } \
+    } \
+    count++; \
+} while (0)
+
+#define SIGNED(T, tab) \
+    CHECK(T, tab, 3); CHECK(T, tab, -3); CHECK(T, tab, 5); \
+    CHECK(T, tab, 6); CHECK(T, tab, 7); CHECK(T, tab, -7); \
+    CHECK(T, tab, 10); CHECK(T, tab, 12); CHECK(T, tab, 25); \
+    CHECK(T, tab, 100); CHECK(T, tab, 125); CHECK(T, tab, 641); \
+    CHECK(T, tab, 1000); CHECK(T, tab, -1000); CHECK(T, tab, 2); \
+    CHECK(T, tab, -2); CHECK(T, tab, 16); \
+    CHECK(T, tab, 0x7fffffff)
+
+#define UNSIGNED(T, tab) \
+    CHECK(T, tab, 3); CHECK(T, tab, 5); CHECK(T, tab, 6); \
+    CHECK(T, tab, 7); CHECK(T, tab, 10); CHECK(T, tab, 12); \
+    CHECK(T, tab, 25); CHECK(T, tab, 100); CHECK(T, tab, 125); \
+    CHECK(T, tab, 641); CHECK(T, tab, 1000); CHECK(T, tab, 2); \
+    CHECK(T, tab, 16); CHECK(T, tab, 0x7fffffff); \
+    CHECK(T, tab, 0x80000001); CHECK(T, tab, 0xfffffffe)
+
+int errors, count;
+
+int main(void)
+{
+    int x = 1234;
+    long long y = -98765432109876LL;
+
+    SIGNED(int, i32);
+    UNSIGNED(unsigned, u32);
+    SIGNED(long long, i64);
+    CHECK(long long, i64, 1000000007LL);
+    CHECK(long long, i64, -3000000000LL);
+    CHECK(long long, i64, 0x7fffffffffffffffLL);
+    UNSIGNED(unsigned long long, u64);
+    CHECK(unsigned long long, u64, 10000000000000000000ULL);
+    CHECK(unsigned long long, u64, 0x8000000000000001ULL);
+    CHECK(unsigned long long, u64, 0xffffffffffffffffULL);
+    printf("%d divisors, %d errors\n", count, errors);
+
+    /* in expressions and assignments */
+    x = x / 10 + x % 10 * 100;
+    y /= 7;
+    printf("%d %lld %lld\n", x, y, y % -13);
+    return 0;
+}
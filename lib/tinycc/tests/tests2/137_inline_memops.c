@@ -0,0 +1,30 @@
+/* small struct copies, zero-initialization and memcpy/memset with a
+   constant size are expanded inline */
+#include <stdio.h>
+#include <string.h>
+struct v3 { float x, y, z; };
+struct ev { int type; char pad[3]; long long t; short s[7]; };
+struct big { char b[200]; };
+struct odd { char c[31]; };
+static void dump(const void *p, int n) { const unsigned char *c = p; int i; for (i = 0; i < n; i++) printf("%02x", c[i]); printf("\n"); }
+int main(void)
+{
+    struct v3 a = { 1, 2, 3 }, b;
+    struct ev e = { 0 }, f;
+    struct odd o, q;
+    char buf[64], *p = buf;
+    int i;
+    for (i = 0; i < 31; i++) o.c[i] = i * 7;
+    b = a; dump(&b, sizeof b);
+    e.type = 5; e.t = -1; e.s[6] = 0x1234; f = e; dump(&f, sizeof f);
+    q = o; dump(&q, sizeof q);
+    memset(buf, 0xab, sizeof buf); dump(buf, 64);
+    memset(p + 3, 0, 13); dump(buf, 20);
+    printf("%d\n", (char *)memcpy(p + 1, &a, 12) - buf);
+    dump(buf, 16);
+    printf("%d\n", (char *)memset(p, 'x', 7) - buf);
+    { struct big g = { { 1 } }; struct big h = g; dump(&h.b[190], 10); }
+    { struct odd z = { { 0 } }; dump(&z, 31); }
+    memcpy(&q, &o, 0);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include <stdio.h>
+
+/* defined nowhere: only code that nothing reaches calls it */
+void not_linked(void);
+
+static void unused(void)
+{
+    not_linked();
+}
+
+void unused_global(void)
+{
+    unused();
+}
+
+static int twice(int x)
+{
+    return 2 * x;
+}
+
+static int used(int x)
+{
+    return twice(x) + 1;
+}
+
+/* data is kept whole, with the code it refers to */
+int (*table[])(int) = { used };
+
+int main(void)
+{
+    printf("%d\n", table[0](20));
+    printf("%d\n", twice(21));
+    return 0;
+}
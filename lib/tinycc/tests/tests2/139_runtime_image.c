@@ -0,0 +1,35 @@
+#include <stdio.h>
+#include <string.h>
+
+/* from libtcc1, which -Wl,--runtime-image= maps from libtcc1.so */
+extern unsigned long long __fixunsdfdi(double);
+
+static const char *mapped_from(void *p)
+{
+    static char line[512];
+    const char *file = "nowhere";
+    unsigned long lo, hi;
+    char *s;
+    FILE *f = fopen("/proc/self/maps", "r");
+
+    while (f && fgets(line, sizeof line, f)) {
+        if (sscanf(line, "%lx-%lx", &lo, &hi) == 2
+            && (unsigned long)p >= lo && (unsigned long)p < hi) {
+            s = strrchr(line, '/');
+            file = s ? s + 1 : "anonymous memory\n";
+            break;
+        }
+    }
+    if (f)
+        fclose(f);
+    return file;
+}
+
+int main(void)
+{
+    volatile double d = 1e19;
+
+    printf("%llu\n", __fixunsdfdi(d));
+    printf("%s", mapped_from((void *)__fixunsdfdi));
+    return 0;
+}
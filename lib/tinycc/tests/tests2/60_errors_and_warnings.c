@@ -490,4 +490,21 @@ int *invalid_operation(int *p, double d)
     return p + d;
 }
 
+#elif defined test_vector_cast_size
+typedef int v4si __attribute__((vector_size(16)));
+typedef short v4hi __attribute__((vector_size(8)));
+
+v4hi narrow(v4si v)
+{
+    return (v4hi)v;
+}
+
+#elif defined test_scalar_vector_cast_size
+typedef int v4si __attribute__((vector_size(16)));
+
+int first(v4si v)
+{
+    return (int)v;
+}
+
 #endif
@@ -110,6 +110,17 @@ enum {
 
 #define TCC_TARGET_NATIVE_STRUCT_COPY
 ST_FUNC void gen_struct_copy(int size);
+ST_FUNC void gen_struct_fill(int size, int c);
+/* copies and fills up to this size are expanded inline */
+#define STRUCT_INLINE_MAX 64
+
+#define TCC_TARGET_NATIVE_VECTOR_OP
+ST_FUNC int gen_vector_opi(int op, int t, int size, int res);
+
+#define TCC_TARGET_NATIVE_TIER
+
+/* gen_opi() implements TOK_UMULH and TOK_SMULH */
+#define TCC_TARGET_NATIVE_MULH
 
 /******************************************************/
 #else /* ! TARGET_DEFS_ONLY */
@@ -154,17 +165,17 @@ ST_DATA const int reg_classes[NB_REGS] = {
     /* st0 */ RC_ST0
 };
 
-static unsigned long func_sub_sp_offset;
-static int func_ret_sub;
+static TCC_TLS unsigned long func_sub_sp_offset;
+static TCC_TLS int func_ret_sub;
 
 #if defined(CONFIG_TCC_BCHECK)
-static addr_t func_bound_offset;
-static unsigned long func_bound_ind;
-ST_DATA int func_bound_add_epilog;
+static TCC_TLS addr_t func_bound_offset;
+static TCC_TLS unsigned long func_bound_ind;
+ST_DATA TCC_TLS int func_bound_add_epilog;
 #endif
 
 #ifdef TCC_TARGET_PE
-static int func_scratch, func_alloca;
+static TCC_TLS int func_scratch, func_alloca;
 #endif
 
 /* XXX: make it faster ? */
@@ -1821,6 +1832,16 @@ void gen_opi(int op)
             r = TREG_RAX;
         vtop->r = r;
         break;
+    case TOK_UMULH:
+    case TOK_SMULH:
+        gv2(RC_RAX, RC_RCX);
+        fr = vtop[0].r;
+        vtop--;
+        save_reg(TREG_RDX);
+        orex(ll, fr, 0, 0xf7); /* mul/imul fr, %eax */
+        o((op == TOK_UMULH ? 0xe0 : 0xe8) + REG_VALUE(fr));
+        vtop->r = TREG_RDX;
+        break;
     default:
         opc = 7;
         goto gen_op8;
@@ -2220,6 +2241,22 @@ ST_FUNC void gen_cvt_csti(int t)
         );
 }
 
+/* -ftiered function entry: jump through the slot, whose initial
+   target is the counter increment right after the jump */
+ST_FUNC int gen_tier_entry(Sym *slot)
+{
+    int entry;
+
+    o(0x25ff); /* jmp *slot(%rip) */
+    greloca(cur_text_section, slot, ind, R_X86_64_PC32, -4);
+    gen_le32(0);
+    entry = ind - func_ind;
+    o(0x05ff48); /* incq slot+8(%rip) */
+    greloca(cur_text_section, slot, ind, R_X86_64_PC32, PTR_SIZE - 4);
+    gen_le32(0);
+    return entry;
+}
+
 /* increment tcov counter */
 ST_FUNC void gen_increment_tcov (SValue *sv)
 {
@@ -2284,6 +2321,27 @@ ST_FUNC void gen_vla_alloc(CType *type, int align) {
     }
 }
 
+/* base of a memory operand at the address on vtop: %rbp for the
+   address of a stack local, a register otherwise */
+static int gen_addr_base(int *c)
+{
+    if ((vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) == VT_LOCAL) {
+        *c = vtop->c.i;
+        return VT_LOCAL;
+    }
+    *c = 0;
+    return gv(RC_INT) | TREG_MEM;
+}
+
+/* mov of 'l' bytes between register 'r' and c(base), a store if 'st' */
+static void gen_mov_mem(int st, int l, int r, int base, int c)
+{
+    if (l == 2)
+        o(0x66);
+    orex(l == 8, base, r, (l == 1 ? 0x8a : 0x8b) - 2 * st);
+    gen_modrm(r, base, NULL, c);
+}
+
 /*
  * Assmuing the top part of the stack looks like below,
  *  src dest src
@@ -2291,6 +2349,35 @@ ST_FUNC void gen_vla_alloc(CType *type, int align) {
 ST_FUNC void gen_struct_copy(int size)
 {
     int n = size / PTR_SIZE;
+
+    if (size <= STRUCT_INLINE_MAX) {
+        /* 16 byte blocks through %xmm0, the tail through a register */
+        int bs, bd, cs, cd, i, l, r;
+
+        bs = gen_addr_base(&cs);
+        vswap();
+        bd = gen_addr_base(&cd);
+        vswap();
+        save_reg(TREG_XMM0);
+        for (i = 0; i + 16 <= size; i += 16) {
+            orex(0, bs, 0, 0x100f); /* movups i(src), %xmm0 */
+            gen_modrm(TREG_XMM0, bs, NULL, cs + i);
+            orex(0, bd, 0, 0x110f); /* movups %xmm0, i(dest) */
+            gen_modrm(TREG_XMM0, bd, NULL, cd + i);
+        }
+        if (i < size) {
+            r = get_reg(RC_INT);
+            for (l = 8; l; l >>= 1) {
+                for (; i + l <= size; i += l) {
+                    gen_mov_mem(0, l, r, bs, cs + i);
+                    gen_mov_mem(1, l, r, bd, cd + i);
+                }
+            }
+        }
+        vpop();
+        vpop();
+        return;
+    }
 #ifdef TCC_TARGET_PE
     o(0x5756); /* push rsi, rdi */
 #endif
@@ -2317,6 +2404,112 @@ ST_FUNC void gen_struct_copy(int size)
     vpop();
 }
 
+/*
+ * Set 'size' bytes (at most STRUCT_INLINE_MAX) at the address on
+ * vtop to the byte 'c', and pop the address.
+ */
+ST_FUNC void gen_struct_fill(int size, int c)
+{
+    int b, cb, i = 0, l, r;
+
+    b = gen_addr_base(&cb);
+    c &= 0xff;
+    if (c == 0 && size >= 16) {
+        save_reg(TREG_XMM0);
+        o(0xc0570f); /* xorps %xmm0, %xmm0 */
+        for (; i + 16 <= size; i += 16) {
+            orex(0, b, 0, 0x110f); /* movups %xmm0, i(dest) */
+            gen_modrm(TREG_XMM0, b, NULL, cb + i);
+        }
+    }
+    if (i < size) {
+        r = get_reg(RC_INT);
+        if (c == 0) {
+            o(0x31); /* xor %r, %r */
+            o(0xc0 + REG_VALUE(r) * 9);
+        } else {
+            orex(1, r, 0, 0xb8 + REG_VALUE(r)); /* movabs $c..c, %r */
+            gen_le64(c * 0x0101010101010101ULL);
+        }
+        for (l = 8; l; l >>= 1)
+            for (; i + l <= size; i += l)
+                gen_mov_mem(1, l, r, b, cb + i);
+    }
+    vpop();
+}
+
+/* SSE2 opcode (prefix in the high byte) for an element-wise vector
+   operation on elements of type 't', 0 if there is none */
+static int vector_sse_opcode(int op, int t)
+{
+    int bt = t & VT_BTYPE;
+
+    if (bt == VT_FLOAT || bt == VT_DOUBLE) {
+        int p = bt == VT_DOUBLE ? 0x6600 : 0;
+        switch (op) {
+        case '+': return p | 0x58; /* addps/addpd */
+        case '-': return p | 0x5c; /* subps/subpd */
+        case '*': return p | 0x59; /* mulps/mulpd */
+        case '/': return p | 0x5e; /* divps/divpd */
+        }
+        return 0;
+    }
+    switch (op) {
+    case '&': return 0x66db; /* pand */
+    case '|': return 0x66eb; /* por */
+    case '^': return 0x66ef; /* pxor */
+    case '+':
+        return bt == VT_BYTE ? 0x66fc : bt == VT_SHORT ? 0x66fd
+            : bt == VT_INT ? 0x66fe : 0x66d4; /* padd[bwdq] */
+    case '-':
+        return bt == VT_BYTE ? 0x66f8 : bt == VT_SHORT ? 0x66f9
+            : bt == VT_INT ? 0x66fa : 0x66fb; /* psub[bwdq] */
+    case '*':
+        return bt == VT_SHORT ? 0x66d5 : 0; /* pmullw */
+    }
+    return 0;
+}
+
+/*
+ * Element-wise vector operation with SSE2.  The addresses of both
+ * operands are on the value stack, the result of 'size' bytes goes
+ * to the stack local at 'res'.  Returns 0 without touching the value
+ * stack when the operation has no SSE2 equivalent.
+ */
+ST_FUNC int gen_vector_opi(int op, int t, int size, int res)
+{
+    int opc, ra, rb, i;
+
+    opc = vector_sse_opcode(op, t);
+    if (!opc || (size & 15))
+        return 0;
+    save_reg(TREG_XMM0);
+    save_reg(TREG_XMM1);
+    gv2(RC_INT, RC_INT);
+    ra = vtop[-1].r;
+    rb = vtop[0].r;
+    for (i = 0; i < size; i += 16) {
+        /* movups i(%ra), %xmm0 */
+        orex(0, ra, 0, 0x100f);
+        gen_modrm(TREG_XMM0, ra | TREG_MEM, NULL, i);
+        /* movups i(%rb), %xmm1 */
+        orex(0, rb, 0, 0x100f);
+        gen_modrm(TREG_XMM1, rb | TREG_MEM, NULL, i);
+        /* op %xmm1, %xmm0 */
+        if (opc & 0xff00)
+            o(opc >> 8);
+        o(0x0f);
+        o(opc & 0xff);
+        o(0xc1);
+        /* movups %xmm0, res+i(%rbp) */
+        o(0x110f);
+        gen_modrm(TREG_XMM0, VT_LOCAL, NULL, res + i);
+    }
+    vpop();
+    vpop();
+    return 1;
+}
+
 /* end of x86-64 code generator */
 /*************************************************************/
 #endif /* ! TARGET_DEFS_ONLY */
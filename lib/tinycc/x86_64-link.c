@@ -18,6 +18,11 @@
 #define PCRELATIVE_DLLPLT 1
 #define RELOCATE_DLLPLT 1
 
+/* relocations may be applied in parallel, except those rewriting the
+   code of the next one, which must stay with it */
+#define RELOCATE_PARALLEL 1
+#define RELOC_WITH_NEXT(t) ((t) == R_X86_64_TLSGD || (t) == R_X86_64_TLSLD)
+
 #else /* !TARGET_DEFS_ONLY */
 
 #include "tcc.h"
@@ -0,0 +1,178 @@
+#include "adapters/compiler/codegen_report.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libtcc.h"
+
+/**
+ * Statistics of one compiled function, copied out of the compiler.
+ */
+typedef struct ReportRow {
+    char *name;
+    char *file;
+    unsigned long size;
+    int spills;
+    int helper_calls;
+    unsigned long long ns;
+} ReportRow;
+
+typedef struct Report {
+    ReportRow *rows;
+    size_t count;
+    size_t capacity;
+} Report;
+
+int cjit_codegen_report_format(const char *arg)
+{
+    if (!arg || !*arg || strcmp(arg, "table") == 0) {
+        return CJIT_REPORT_TABLE;
+    }
+    if (strcmp(arg, "json") == 0) {
+        return CJIT_REPORT_JSON;
+    }
+    return 0;
+}
+
+static char *copy_string(const char *s)
+{
+    size_t len = strlen(s ? s : "");
+    char *copy = malloc(len + 1);
+    if (copy) {
+        memcpy(copy, s ? s : "", len + 1);
+    }
+    return copy;
+}
+
+#if !defined(SHAREDTCC)
+static void collect(void *opaque, const TCCFuncReport *report)
+{
+    Report *r = (Report *)opaque;
+    ReportRow *row;
+
+    if (r->count == r->capacity) {
+        size_t capacity = r->capacity ? r->capacity * 2 : 64;
+        ReportRow *rows = realloc(r->rows, capacity * sizeof(ReportRow));
+        if (!rows) {
+            return;
+        }
+        r->rows = rows;
+        r->capacity = capacity;
+    }
+    row = &r->rows[r->count++];
+    row->name = copy_string(report->name);
+    row->file = copy_string(report->file);
+    row->size = report->size;
+    row->spills = report->spills;
+    row->helper_calls = report->helper_calls;
+    row->ns = report->ns;
+}
+#endif
+
+void cjit_codegen_report_begin(CJITState *cjit)
+{
+#if !defined(SHAREDTCC)
+    if (!cjit->report) {
+        cjit->report = calloc(1, sizeof(Report));
+    }
+    tcc_set_codegen_report((TCCState *)cjit->TCC, cjit->report, collect);
+#else
+    _err("Codegen report: not supported with a shared libtcc");
+    cjit->codegen_report = 0;
+#endif
+}
+
+static int by_size(const void *a, const void *b)
+{
+    const ReportRow *ra = (const ReportRow *)a;
+    const ReportRow *rb = (const ReportRow *)b;
+    if (ra->size != rb->size) {
+        return ra->size < rb->size ? 1 : -1;
+    }
+    return strcmp(ra->name, rb->name);
+}
+
+/**
+ * Copies `s` into `out` as the body of a JSON string.
+ */
+static const char *json_escape(const char *s, char *out, size_t len)
+{
+    size_t n = 0;
+    for (; *s && n + 7 < len; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            out[n++] = '\\';
+            out[n++] = (char)c;
+        } else if (c < 0x20) {
+            n += (size_t)snprintf(out + n, len - n, "\\u%04x", c);
+        } else {
+            out[n++] = (char)c;
+        }
+    }
+    out[n] = 0;
+    return out;
+}
+
+void cjit_codegen_report_print(CJITState *cjit)
+{
+    Report *r = (Report *)cjit->report;
+    unsigned long total_size = 0;
+    unsigned long long total_ns = 0;
+    size_t i;
+
+    if (!cjit->codegen_report || !r) {
+        return;
+    }
+    qsort(r->rows, r->count, sizeof(ReportRow), by_size);
+    for (i = 0; i < r->count; i++) {
+        total_size += r->rows[i].size;
+        total_ns += r->rows[i].ns;
+    }
+    if (cjit->codegen_report == CJIT_REPORT_JSON) {
+        char name[256];
+        char file[PATH_MAX];
+        _err("{\"functions\": %lu, \"size\": %lu, \"ns\": %llu, \"report\": [",
+             (unsigned long)r->count, total_size, total_ns);
+        for (i = 0; i < r->count; i++) {
+            ReportRow *row = &r->rows[i];
+            _err("  {\"name\": \"%s\", \"file\": \"%s\", \"size\": %lu,"
+                 " \"spills\": %d, \"helper_calls\": %d, \"ns\": %llu}%s",
+                 json_escape(row->name, name, sizeof(name)),
+                 json_escape(row->file, file, sizeof(file)),
+                 row->size, row->spills, row->helper_calls, row->ns,
+                 i + 1 < r->count ? "," : "");
+        }
+        _err("]}");
+    } else {
+        _err("Codegen report: %lu functions, %lu bytes, %.3f ms",
+             (unsigned long)r->count, total_size, total_ns / 1e6);
+        _err("%8s %7s %8s %10s  %s", "size", "spills", "helpers", "time(us)", "function");
+        for (i = 0; i < r->count; i++) {
+            ReportRow *row = &r->rows[i];
+            _err("%8lu %7d %8d %10.1f  %s (%s)", row->size, row->spills,
+                 row->helper_calls, row->ns / 1e3, row->name, row->file);
+        }
+    }
+    cjit_codegen_report_free(cjit);
+}
+
+void cjit_codegen_report_free(CJITState *cjit)
+{
+    Report *r = (Report *)cjit->report;
+    size_t i;
+
+    if (!r) {
+        return;
+    }
+#if !defined(SHAREDTCC)
+    tcc_set_codegen_report((TCCState *)cjit->TCC, NULL, NULL);
+#endif
+    for (i = 0; i < r->count; i++) {
+        free(r->rows[i].name);
+        free(r->rows[i].file);
+    }
+    free(r->rows);
+    free(r);
+    cjit->report = NULL;
+}
@@ -0,0 +1,31 @@
+#ifndef CJIT_ADAPTERS_COMPILER_CODEGEN_REPORT_H
+#define CJIT_ADAPTERS_COMPILER_CODEGEN_REPORT_H
+
+#include "cjit.h"
+
+/** Output formats of `--codegen-report`. */
+#define CJIT_REPORT_TABLE 1
+#define CJIT_REPORT_JSON 2
+
+/**
+ * Maps the optional `--codegen-report` argument to a format, 0 when
+ * the format is unknown.
+ */
+int cjit_codegen_report_format(const char *arg);
+
+/**
+ * Starts collecting per-function statistics from the compiler.
+ */
+void cjit_codegen_report_begin(CJITState *cjit);
+
+/**
+ * Prints the statistics collected so far to stderr and stops collecting.
+ */
+void cjit_codegen_report_print(CJITState *cjit);
+
+/**
+ * Stops collecting and releases the statistics not printed.
+ */
+void cjit_codegen_report_free(CJITState *cjit);
+
+#endif
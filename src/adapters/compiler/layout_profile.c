@@ -0,0 +1,373 @@
+#include "adapters/compiler/layout_profile.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adapters/compiler/object_cache.h"
+#include "adapters/compiler/unit_pool.h"
+#include "adapters/platform/watch.h"
+#include "libtcc.h"
+
+#if !defined(WINDOWS) && !defined(SHAREDTCC)
+#include <errno.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define PROFILE_HEADER "cjit-profile 1\n"
+
+/**
+ * One function of a profile with the number of blocks it ran, and
+ * where it goes: 1 hot, -1 cold, 0 among the others.
+ */
+typedef struct LayoutFunc {
+    char *name;
+    unsigned long long count;
+    int heat;
+} LayoutFunc;
+
+struct CJITLayout {
+    char base[PATH_MAX + 40]; /* the profile, less its .tcov suffix */
+    LayoutFunc *funcs;      /* sorted by name */
+    size_t count;
+    bool recorded;          /* false while the profile is to record */
+    char signature[24];
+};
+
+static int func_by_name(const void *a, const void *b)
+{
+    return strcmp(((const LayoutFunc *)a)->name, ((const LayoutFunc *)b)->name);
+}
+
+static int func_hotter(const void *a, const void *b)
+{
+    unsigned long long ca = ((const LayoutFunc *)a)->count;
+    unsigned long long cb = ((const LayoutFunc *)b)->count;
+    return (ca < cb) - (ca > cb);
+}
+
+static int profile_dir(CJITState *cjit, char *dir, size_t size)
+{
+    if ((size_t)snprintf(dir, size, "%s/profile", cjit->tmpdir) >= size) {
+        return 0;
+    }
+    return mkdir(dir, 0755) == 0 || errno == EEXIST;
+}
+
+bool cjit_layout_enabled(CJITState *cjit)
+{
+    return cjit->layout && cjit->tcc_output == TCC_OUTPUT_MEMORY && cjit->tmpdir;
+}
+
+/**
+ * Reads the functions of the profile in `f`, hottest first as written
+ * by layout_store(), and marks as hot those running the first
+ * CJIT_LAYOUT_HOT_SHARE percent of the blocks.
+ */
+static void read_profile(CJITLayout *layout, FILE *f)
+{
+    char line[1024];
+    size_t alloc = 0;
+    unsigned long long total = 0;
+    unsigned long long sum = 0;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    size_t i;
+
+    if (!fgets(line, sizeof(line), f) || strcmp(line, PROFILE_HEADER) != 0) {
+        return;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        char *name;
+        unsigned long long count = strtoull(line, &name, 10);
+        const char *c;
+        if (*name++ != ' ') {
+            continue;
+        }
+        name[strcspn(name, "\n")] = 0;
+        for (c = line; *c; c++) {
+            h = (h ^ (unsigned char)*c) * 0x100000001b3ULL;
+        }
+        if (layout->count == alloc) {
+            alloc = alloc ? alloc * 2 : 64;
+            layout->funcs = realloc(layout->funcs, alloc * sizeof(LayoutFunc));
+        }
+        layout->funcs[layout->count].name = strdup(name);
+        layout->funcs[layout->count].count = count;
+        layout->funcs[layout->count].heat = 0;
+        layout->count++;
+        total += count;
+    }
+    for (i = 0; i < layout->count; i++) {
+        LayoutFunc *fn = &layout->funcs[i];
+        if (fn->count == 0) {
+            fn->heat = -1;
+        } else if ((double)sum * 100 < (double)total * CJIT_LAYOUT_HOT_SHARE) {
+            fn->heat = 1;
+        }
+        sum += fn->count;
+    }
+    if (layout->count) {
+        qsort(layout->funcs, layout->count, sizeof(LayoutFunc), func_by_name);
+    }
+    layout->recorded = true;
+    snprintf(layout->signature, sizeof(layout->signature), "layout-%016llx",
+             (unsigned long long)h);
+}
+
+CJITLayout *cjit_layout_new(CJITState *cjit, const char *contents)
+{
+    char dir[PATH_MAX];
+    char key[33];
+    char path[PATH_MAX + 48];
+    CJITLayout *layout;
+    FILE *f;
+
+    if (!cjit_layout_enabled(cjit) || !profile_dir(cjit, dir, sizeof(dir))) {
+        return NULL;
+    }
+    cjit_object_cache_source_key(contents, key);
+    layout = calloc(1, sizeof(CJITLayout));
+    snprintf(layout->base, sizeof(layout->base), "%s/%s", dir, key);
+    snprintf(path, sizeof(path), "%s.tcov", layout->base);
+    f = fopen(path, "r");
+    if (f) {
+        read_profile(layout, f);
+        fclose(f);
+    }
+    if (!layout->recorded) {
+        strcpy(layout->signature, "layout-record");
+        if (cjit->verbose) {
+            _err("Recording layout profile %s", key);
+        }
+    } else if (cjit->verbose) {
+        size_t i;
+        int hot = 0;
+        int cold = 0;
+        for (i = 0; i < layout->count; i++) {
+            hot += layout->funcs[i].heat > 0;
+            cold += layout->funcs[i].heat < 0;
+        }
+        _err("Layout profile %s: %d hot and %d cold functions", key, hot, cold);
+    }
+    return layout;
+}
+
+static int layout_heat(void *opaque, const char *name)
+{
+    CJITLayout *layout = (CJITLayout *)opaque;
+    LayoutFunc key;
+    LayoutFunc *fn;
+
+    if (!layout->count) {
+        return 0;
+    }
+    key.name = (char *)name;
+    fn = bsearch(&key, layout->funcs, layout->count, sizeof(LayoutFunc), func_by_name);
+    return fn ? fn->heat : 0;
+}
+
+void cjit_layout_apply(CJITLayout *layout, struct TCCState *tcc)
+{
+    if (!layout) {
+        return;
+    }
+    if (layout->recorded) {
+        tcc_set_layout_func(tcc, layout, layout_heat);
+    } else {
+        tcc_set_options(tcc, "-ftest-coverage");
+        tcc_set_coverage_file(tcc, layout->base);
+    }
+}
+
+const char *cjit_layout_signature(const CJITLayout *layout)
+{
+    return layout ? layout->signature : "";
+}
+
+void cjit_layout_free(CJITLayout *layout)
+{
+    size_t i;
+
+    if (!layout) {
+        return;
+    }
+    for (i = 0; i < layout->count; i++) {
+        free(layout->funcs[i].name);
+    }
+    free(layout->funcs);
+    free(layout);
+}
+
+int cjit_layout_add_source(CJITState *cjit, const char *path,
+                           const char *contents)
+{
+    TCCState *unit = cjit_unit_new(cjit, path);
+    CJITLayout *layout = cjit_layout_new(cjit, contents);
+    int res;
+
+    cjit_layout_apply(layout, unit);
+    res = tcc_compile_string(unit, contents);
+    cjit_watch_note_deps(cjit, unit);
+    if (res >= 0) {
+        res = tcc_add_object_state((TCCState *)cjit->TCC, unit);
+    }
+    tcc_delete(unit);
+    cjit_layout_free(layout);
+    return res;
+}
+
+static unsigned long long read_le(const unsigned char *p, int size)
+{
+    unsigned long long value = 0;
+
+    while (size--) {
+        value = (value << 8) | p[size];
+    }
+    return value;
+}
+
+/**
+ * Called at exit in place of __store_test_coverage() from lib/tcov.c
+ * with the counters of one unit, laid out as described there. Writes
+ * the blocks each function ran to the file named in their header.
+ */
+static void layout_store(unsigned char *p)
+{
+    const unsigned char *start = p;
+    const char *path = (const char *)p + read_le(p, 4);
+    char tmp[PATH_MAX + 32];
+    LayoutFunc *funcs = NULL;
+    size_t count = 0;
+    size_t alloc = 0;
+    size_t i, n;
+    FILE *f;
+
+    for (p += 4; *p; p++) {
+        for (p += strlen((char *)p) + 1; *p; p++) {
+            if (count == alloc) {
+                alloc = alloc ? alloc * 2 : 64;
+                funcs = realloc(funcs, alloc * sizeof(LayoutFunc));
+            }
+            funcs[count].name = (char *)p;
+            funcs[count].count = 0;
+            p += strlen((char *)p) + 1;
+            p += -(p - start) & 7;
+            for (p += 8; *p; p += 16) {
+                funcs[count].count += read_le(p + 8, 8);
+            }
+            count++;
+        }
+    }
+    /* a function split over several places of the unit comes once */
+    qsort(funcs, count, sizeof(LayoutFunc), func_by_name);
+    for (i = n = 0; i < count; i++) {
+        if (n && strcmp(funcs[n - 1].name, funcs[i].name) == 0) {
+            funcs[n - 1].count += funcs[i].count;
+        } else {
+            funcs[n++] = funcs[i];
+        }
+    }
+    qsort(funcs, n, sizeof(LayoutFunc), func_hotter);
+
+    snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", path, (long)getpid());
+    f = fopen(tmp, "w");
+    if (f) {
+        fputs(PROFILE_HEADER, f);
+        for (i = 0; i < n; i++) {
+            fprintf(f, "%llu %s\n", funcs[i].count, funcs[i].name);
+        }
+        if (fclose(f) != 0 || rename(tmp, path) != 0) {
+            unlink(tmp);
+        }
+    }
+    free(funcs);
+}
+
+void cjit_layout_attach(CJITState *cjit, struct TCCState *tcc)
+{
+    if (cjit_layout_enabled(cjit)) {
+        tcc_add_symbol(tcc, "__store_test_coverage", layout_store);
+    }
+}
+
+static unsigned char **layout_units;
+static unsigned char **layout_units_end;
+
+static void layout_store_units(void)
+{
+    unsigned char **unit;
+
+    for (unit = layout_units; unit < layout_units_end; unit++) {
+        layout_store(*unit);
+    }
+}
+
+void cjit_layout_start(CJITState *cjit)
+{
+    TCCState *tcc = (TCCState *)cjit->TCC;
+
+    if (!cjit_layout_enabled(cjit)) {
+        return;
+    }
+    layout_units = tcc_get_symbol(tcc, "__start_tcov_units");
+    layout_units_end = tcc_get_symbol(tcc, "__stop_tcov_units");
+    if (layout_units && layout_units_end) {
+        atexit(layout_store_units);
+    }
+}
+
+#else
+
+bool cjit_layout_enabled(CJITState *cjit)
+{
+    (void)cjit;
+    return false;
+}
+
+CJITLayout *cjit_layout_new(CJITState *cjit, const char *contents)
+{
+    (void)cjit;
+    (void)contents;
+    return NULL;
+}
+
+void cjit_layout_apply(CJITLayout *layout, struct TCCState *tcc)
+{
+    (void)layout;
+    (void)tcc;
+}
+
+const char *cjit_layout_signature(const CJITLayout *layout)
+{
+    (void)layout;
+    return "";
+}
+
+void cjit_layout_free(CJITLayout *layout)
+{
+    (void)layout;
+}
+
+int cjit_layout_add_source(CJITState *cjit, const char *path,
+                           const char *contents)
+{
+    (void)cjit;
+    (void)path;
+    (void)contents;
+    return -1;
+}
+
+void cjit_layout_attach(CJITState *cjit, struct TCCState *tcc)
+{
+    (void)cjit;
+    (void)tcc;
+}
+
+void cjit_layout_start(CJITState *cjit)
+{
+    (void)cjit;
+}
+
+#endif
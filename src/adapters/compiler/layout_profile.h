@@ -0,0 +1,69 @@
+#ifndef CJIT_ADAPTERS_COMPILER_LAYOUT_PROFILE_H
+#define CJIT_ADAPTERS_COMPILER_LAYOUT_PROFILE_H
+
+#include "cjit.h"
+
+struct TCCState;
+
+/**
+ * Share of the block executions a profile recorded that its hot
+ * functions account for, in percent.
+ */
+#define CJIT_LAYOUT_HOT_SHARE 99
+
+/**
+ * How the code of one source is laid out, decided from the profile
+ * recorded for it under `$TMPDIR/cjit/<VERSION>/profile`, keyed by the
+ * hash of the source.
+ */
+typedef struct CJITLayout CJITLayout;
+
+/**
+ * True when sources run in memory are laid out by profile (`--layout`).
+ */
+bool cjit_layout_enabled(CJITState *cjit);
+
+/**
+ * Looks up the profile of `contents`. With one, the layout places the
+ * functions that ran most in `.text.hot` and those that never ran in
+ * `.text.unlikely`; without, it compiles the source with -ftest-coverage
+ * so the program records one when it exits. Returns NULL when layout is
+ * not enabled.
+ */
+CJITLayout *cjit_layout_new(CJITState *cjit, const char *contents);
+
+/**
+ * Applies `layout` to `tcc`, a state from cjit_unit_new() that compiles
+ * nothing but its source. Does nothing when `layout` is NULL.
+ */
+void cjit_layout_apply(CJITLayout *layout, struct TCCState *tcc);
+
+/**
+ * A short text telling apart the code `layout` produces, for the keys
+ * of the object cache: empty when `layout` is NULL.
+ */
+const char *cjit_layout_signature(const CJITLayout *layout);
+
+void cjit_layout_free(CJITLayout *layout);
+
+/**
+ * Compiles `contents`, read from `path`, on a unit of its own laid out
+ * by its profile, and merges it into the program.
+ */
+int cjit_layout_add_source(CJITState *cjit, const char *path,
+                           const char *contents);
+
+/**
+ * Makes the programs linked by `tcc` store the profiles they record,
+ * in place of the coverage reports of -ftest-coverage.
+ */
+void cjit_layout_attach(CJITState *cjit, struct TCCState *tcc);
+
+/**
+ * In the process about to run the program: stores the profiles of its
+ * units when it exits, which does not run the destructors of programs
+ * linked in memory.
+ */
+void cjit_layout_start(CJITState *cjit);
+
+#endif
@@ -0,0 +1,189 @@
+#include "adapters/compiler/make_deps.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libtcc.h"
+#include "support/cwalk.h"
+#include "support/string_list.h"
+
+/**
+ * The value of `-MF file` or `-MFfile` at `argv[i]`, NULL when the
+ * option is not `name`.
+ */
+static const char *option_value(int argc, char **argv, int i,
+                                const char *name, int *taken)
+{
+    size_t len = strlen(name);
+
+    if (strncmp(argv[i], name, len) != 0) {
+        return NULL;
+    }
+    if (argv[i][len]) {
+        *taken = 1;
+        return argv[i] + len;
+    }
+    if (i + 1 < argc) {
+        *taken = 2;
+        return argv[i + 1];
+    }
+    return NULL;
+}
+
+/**
+ * Copy of `name` quoted for make: spaces, '#' and '$'.
+ */
+static char *make_quote(const char *name)
+{
+    char *quoted = malloc(2 * strlen(name) + 1);
+    char *q = quoted;
+
+    for (; *name; name++) {
+        if (*name == ' ' || *name == '\t' || *name == '#') {
+            *q++ = '\\';
+        } else if (*name == '$') {
+            *q++ = '$';
+        }
+        *q++ = *name;
+    }
+    *q = 0;
+    return quoted;
+}
+
+static void add_target(CJITState *cjit, const char *target)
+{
+    if (!cjit->deps_targets) {
+        cjit->deps_targets = string_list_new();
+    }
+    string_list_add(cjit->deps_targets, target);
+}
+
+/**
+ * Writes `name` quoted to `f`.
+ */
+static void put_quoted(FILE *f, const char *name)
+{
+    char *quoted = make_quote(name);
+
+    fputs(quoted, f);
+    free(quoted);
+}
+
+int cjit_make_deps_option(CJITState *cjit, int argc, char **argv, int i)
+{
+    const char *value;
+    int taken = 0;
+
+    if (strcmp(argv[i], "-MD") == 0) {
+        cjit->make_deps |= CJIT_MAKE_DEPS | CJIT_MAKE_DEPS_SYSTEM;
+        return 1;
+    }
+    if (strcmp(argv[i], "-MMD") == 0) {
+        cjit->make_deps |= CJIT_MAKE_DEPS;
+        return 1;
+    }
+    if (strcmp(argv[i], "-MP") == 0) {
+        cjit->make_deps |= CJIT_MAKE_DEPS_PHONY;
+        return 1;
+    }
+    if ((value = option_value(argc, argv, i, "-MF", &taken))) {
+        free(cjit->deps_file);
+        cjit->deps_file = strdup(value);
+        return taken;
+    }
+    if ((value = option_value(argc, argv, i, "-MT", &taken))) {
+        add_target(cjit, value);
+        return taken;
+    }
+    if ((value = option_value(argc, argv, i, "-MQ", &taken))) {
+        char *quoted = make_quote(value);
+        add_target(cjit, quoted);
+        free(quoted);
+        return taken;
+    }
+    return 0;
+}
+
+typedef struct DepList {
+    StringList *deps;
+    const char *runtime; /* headers of cjit's runtime, left out by -MMD */
+} DepList;
+
+static void add_dep(void *opaque, const char *filename)
+{
+    DepList *list = (DepList *)opaque;
+    StringList *deps = list->deps;
+    size_t count = string_list_count(deps);
+    size_t i;
+
+    if (list->runtime && strncmp(filename, list->runtime, strlen(list->runtime)) == 0) {
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        if (strcmp(string_list_get(deps, i), filename) == 0) {
+            return;
+        }
+    }
+    string_list_add(deps, filename);
+}
+
+int cjit_make_deps_write(CJITState *cjit, struct TCCState *tcc,
+                         const char *source, const char *target)
+{
+    StringList *deps;
+    DepList list;
+    char path[PATH_MAX];
+    size_t count;
+    size_t i;
+    FILE *f;
+
+    if (!(cjit->make_deps & CJIT_MAKE_DEPS)) {
+        return 0;
+    }
+    if (cjit->deps_file) {
+        snprintf(path, sizeof(path), "%s", cjit->deps_file);
+    } else {
+        /* dir/file.o -> dir/file.d, as gcc does */
+        cwk_path_change_extension(target, "d", path, sizeof(path));
+    }
+    f = fopen(path, "w");
+    if (!f) {
+        fail(path);
+        return -1;
+    }
+    deps = string_list_new();
+    string_list_add(deps, source);
+    list.deps = deps;
+    list.runtime = cjit->make_deps & CJIT_MAKE_DEPS_SYSTEM ? NULL : cjit->tmpdir;
+    tcc_list_deps(tcc, &list, add_dep);
+
+    count = cjit->deps_targets ? string_list_count(cjit->deps_targets) : 0;
+    for (i = 0; i < count; i++) {
+        fprintf(f, "%s%s", i ? " " : "", string_list_get(cjit->deps_targets, i));
+    }
+    if (!count) {
+        put_quoted(f, target);
+    }
+    fputc(':', f);
+    count = string_list_count(deps);
+    for (i = 0; i < count; i++) {
+        fputs(" \\\n  ", f);
+        put_quoted(f, string_list_get(deps, i));
+    }
+    fputc('\n', f);
+    /* headers removed later do not break the build */
+    for (i = 1; (cjit->make_deps & CJIT_MAKE_DEPS_PHONY) && i < count; i++) {
+        fputc('\n', f);
+        put_quoted(f, string_list_get(deps, i));
+        fputs(":\n", f);
+    }
+    string_list_free(&deps);
+    if (fclose(f) != 0) {
+        fail(path);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef CJIT_ADAPTERS_COMPILER_MAKE_DEPS_H
+#define CJIT_ADAPTERS_COMPILER_MAKE_DEPS_H
+
+#include "cjit.h"
+
+struct TCCState;
+
+/** Flags of the make dependency options. */
+#define CJIT_MAKE_DEPS 1        /* -MMD: write a .d file when compiling */
+#define CJIT_MAKE_DEPS_SYSTEM 2 /* -MD: list system headers too */
+#define CJIT_MAKE_DEPS_PHONY 4  /* -MP: a phony target per header */
+
+/**
+ * Reads the make dependency option at `argv[i]` (-MD, -MMD, -MP, -MF,
+ * -MT or -MQ) into `cjit`. Returns the number of arguments it takes,
+ * 0 when it is not one of them.
+ */
+int cjit_make_deps_option(CJITState *cjit, int argc, char **argv, int i);
+
+/**
+ * Writes the dependencies of `target`, compiled from `source` on `tcc`,
+ * as a make rule to the -MF file or next to `target`. Returns -1 on
+ * errors.
+ */
+int cjit_make_deps_write(CJITState *cjit, struct TCCState *tcc,
+                         const char *source, const char *target);
+
+#endif
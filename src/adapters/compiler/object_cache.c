@@ -0,0 +1,485 @@
+#include "adapters/compiler/object_cache.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adapters/compiler/layout_profile.h"
+#include "adapters/compiler/unit_pool.h"
+#include "adapters/platform/build_platform.h"
+#include "adapters/platform/watch.h"
+#include "libtcc.h"
+
+#if !defined(WINDOWS) && !defined(SHAREDTCC)
+#include <dirent.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#define MANIFEST_HEADER "cjit-objcache 2\n"
+/* manifest lines naming a library of #pragma comment(lib,), not a file */
+#define MANIFEST_LIB "-l"
+
+/* room for the cache directory plus the longest file name in it */
+#define CACHE_PATH (PATH_MAX + 320)
+
+/**
+ * Two independent 64 bit hashes, FNV-1a and a multiply-rotate, kept
+ * side by side so keys are 128 bits wide.
+ */
+typedef struct CacheHash {
+    uint64_t a;
+    uint64_t b;
+} CacheHash;
+
+static void hash_init(CacheHash *h)
+{
+    h->a = 0xcbf29ce484222325ULL;
+    h->b = 0x84222325cbf29ce4ULL;
+}
+
+static void hash_bytes(CacheHash *h, const void *data, size_t len)
+{
+    const unsigned char *p = (const unsigned char *)data;
+
+    while (len--) {
+        h->a = (h->a ^ *p) * 0x100000001b3ULL;
+        h->b = (h->b + *p++) * 0x9e3779b97f4a7c15ULL;
+        h->b = (h->b << 23) | (h->b >> 41);
+    }
+}
+
+static void hash_string(CacheHash *h, const char *s)
+{
+    hash_bytes(h, s, strlen(s) + 1);
+}
+
+static void hash_list(CacheHash *h, const StringList *list)
+{
+    size_t count = string_list_count(list);
+    size_t i;
+
+    hash_bytes(h, &count, sizeof(count));
+    for (i = 0; i < count; i++) {
+        hash_string(h, string_list_get(list, i));
+    }
+}
+
+/**
+ * Adds the identity of the file at `path` to `h`. Fails when the file
+ * is gone, or when it was touched at or after `started` so an edit made
+ * during the compilation could go unnoticed.
+ */
+static int hash_dep(CacheHash *h, const char *path, time_t started)
+{
+    struct stat st;
+    int64_t id[3];
+
+    if (stat(path, &st) != 0 || (started && st.st_mtime >= started)) {
+        return 0;
+    }
+    id[0] = (int64_t)st.st_mtime;
+    id[1] = (int64_t)st.st_size;
+    id[2] = (int64_t)st.st_ino;
+    hash_string(h, path);
+    hash_bytes(h, id, sizeof(id));
+    return 1;
+}
+
+static long cache_limit(void)
+{
+    const char *env = getenv("CJIT_CACHE_SIZE");
+    long mb = (env && *env) ? atol(env) : CJIT_CACHE_SIZE;
+    return mb > 0 ? mb * 1024 * 1024 : 0;
+}
+
+static int cache_dir(CJITState *cjit, char *dir, size_t size)
+{
+    if (!cjit->tmpdir
+        || (size_t)snprintf(dir, size, "%s/objcache", cjit->tmpdir) >= size) {
+        return 0;
+    }
+    return mkdir(dir, 0755) == 0 || errno == EEXIST;
+}
+
+/**
+ * Names a file in `dir` no other thread or process uses.
+ */
+static void cache_private(const char *dir, const char *key, char *path, size_t size)
+{
+    static int serial;
+
+    snprintf(path, size, "%s/%s-%ld-%d.tmp", dir, key, (long)getpid(),
+             __atomic_fetch_add(&serial, 1, __ATOMIC_RELAXED));
+}
+
+void cjit_object_cache_source_key(const char *contents, char key[33])
+{
+    CacheHash h;
+
+    hash_init(&h);
+    hash_string(&h, contents);
+    snprintf(key, 33, "%016llx%016llx",
+             (unsigned long long)h.a, (unsigned long long)h.b);
+}
+
+bool cjit_object_cache_enabled(CJITState *cjit)
+{
+    return cjit->objcache && cjit->tcc_output == TCC_OUTPUT_MEMORY
+        && !cjit->codegen_report && cjit->tmpdir && cache_limit() > 0;
+}
+
+int cjit_object_cache_find(CJITState *cjit, const char *contents,
+                           CJITCachedObject *entry)
+{
+    char dir[PATH_MAX];
+    char manifest[CACHE_PATH];
+    char object[CACHE_PATH];
+    char line[CACHE_PATH];
+    CacheHash h;
+    FILE *f;
+    int ok;
+
+    memset(entry, 0, sizeof(*entry));
+    hash_init(&h);
+    hash_string(&h, VERSION);
+    hash_string(&h, PLATFORM);
+    if (getcwd(dir, sizeof(dir))) {
+        hash_string(&h, dir);
+    }
+    hash_list(&h, cjit->ccflags);
+    hash_list(&h, cjit->tccopts);
+    hash_string(&h, contents);
+    entry->layout = cjit_layout_new(cjit, contents);
+    hash_string(&h, cjit_layout_signature(entry->layout));
+    snprintf(entry->key, sizeof(entry->key), "%016llx%016llx",
+             (unsigned long long)h.a, (unsigned long long)h.b);
+
+    if (!cache_dir(cjit, dir, sizeof(dir))) {
+        return 0;
+    }
+    snprintf(manifest, sizeof(manifest), "%s/%s.d", dir, entry->key);
+    f = fopen(manifest, "r");
+    if (!f) {
+        return 0;
+    }
+    ok = fgets(line, sizeof(line), f) && strcmp(line, MANIFEST_HEADER) == 0;
+    hash_init(&h);
+    entry->libs = string_list_new();
+    while (ok && fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\n")] = 0;
+        if (strncmp(line, MANIFEST_LIB, strlen(MANIFEST_LIB)) == 0) {
+            string_list_add(entry->libs, line + strlen(MANIFEST_LIB));
+            continue;
+        }
+        ok = hash_dep(&h, line, 0);
+        cjit_watch_note(cjit, line);
+    }
+    fclose(f);
+    if (!ok) {
+        string_list_free(&entry->libs);
+        return 0;
+    }
+    snprintf(object, sizeof(object), "%s/%s-%016llx.o", dir, entry->key,
+             (unsigned long long)h.a);
+    /* a link of our own stays readable even if the entry is evicted */
+    cache_private(dir, entry->key, line, sizeof(line));
+    if (link(object, line) != 0) {
+        string_list_free(&entry->libs);
+        return 0;
+    }
+    utime(object, NULL);
+    utime(manifest, NULL);
+    entry->object = strdup(line);
+    entry->hit = 1;
+    return 1;
+}
+
+static void cache_diagnostic(void *opaque, const char *msg)
+{
+    CJITCachedObject *entry = (CJITCachedObject *)opaque;
+
+    entry->diagnostics++;
+    _err("%s", msg);
+}
+
+static void cache_dep(void *opaque, const char *filename)
+{
+    string_list_add((StringList *)opaque, filename);
+}
+
+static void cache_lib(void *opaque, const char *libname)
+{
+    string_list_add((StringList *)opaque, libname);
+}
+
+int cjit_object_cache_build(CJITState *cjit, struct TCCState *unit,
+                            const char *contents, CJITCachedObject *entry)
+{
+    char dir[PATH_MAX];
+    char object[CACHE_PATH];
+
+    if (!cache_dir(cjit, dir, sizeof(dir))) {
+        return -1;
+    }
+    entry->deps = string_list_new();
+    entry->libs = string_list_new();
+    cjit_layout_apply(entry->layout, unit);
+    tcc_set_error_func(unit, entry, cache_diagnostic);
+    tcc_set_options(unit, "-MD");
+    entry->started = time(NULL);
+    if (tcc_compile_string(unit, contents) < 0) {
+        cjit_watch_note_deps(cjit, unit);
+        return -1;
+    }
+    tcc_list_deps(unit, entry->deps, cache_dep);
+    tcc_list_pragma_libs(unit, entry->libs, cache_lib);
+    cjit_watch_note_deps(cjit, unit);
+    cache_private(dir, entry->key, object, sizeof(object));
+    if (tcc_output_file(unit, object) < 0) {
+        unlink(object);
+        return -1;
+    }
+    entry->object = strdup(object);
+    return 0;
+}
+
+/**
+ * Moves the object just loaded into the cache and records the headers
+ * it was compiled with. Returns 0 when it cannot be reused later.
+ */
+static int cache_store(CJITState *cjit, CJITCachedObject *entry)
+{
+    char dir[PATH_MAX];
+    char path[CACHE_PATH];
+    char tmp[CACHE_PATH];
+    size_t count = string_list_count(entry->deps);
+    size_t i;
+    CacheHash h;
+    FILE *f;
+
+    if (entry->diagnostics || !cache_dir(cjit, dir, sizeof(dir))) {
+        return 0;
+    }
+    hash_init(&h);
+    for (i = 0; i < count; i++) {
+        if (!hash_dep(&h, string_list_get(entry->deps, i), entry->started)) {
+            return 0;
+        }
+    }
+    snprintf(path, sizeof(path), "%s/%s-%016llx.o", dir, entry->key,
+             (unsigned long long)h.a);
+    if (rename(entry->object, path) != 0) {
+        return 0;
+    }
+    cache_private(dir, entry->key, tmp, sizeof(tmp));
+    f = fopen(tmp, "w");
+    if (!f) {
+        return 1;
+    }
+    fputs(MANIFEST_HEADER, f);
+    for (i = 0; i < string_list_count(entry->libs); i++) {
+        fprintf(f, MANIFEST_LIB "%s\n", string_list_get(entry->libs, i));
+    }
+    for (i = 0; i < count; i++) {
+        fprintf(f, "%s\n", string_list_get(entry->deps, i));
+    }
+    snprintf(path, sizeof(path), "%s/%s.d", dir, entry->key);
+    if (fclose(f) != 0 || rename(tmp, path) != 0) {
+        unlink(tmp);
+    }
+    return 1;
+}
+
+void cjit_object_cache_discard(CJITCachedObject *entry)
+{
+    if (entry->object) {
+        unlink(entry->object);
+        free(entry->object);
+        entry->object = NULL;
+    }
+    if (entry->deps) {
+        string_list_free(&entry->deps);
+    }
+    if (entry->libs) {
+        string_list_free(&entry->libs);
+    }
+    cjit_layout_free(entry->layout);
+    entry->layout = NULL;
+}
+
+int cjit_object_cache_load(CJITState *cjit, CJITCachedObject *entry)
+{
+    int res = -1;
+
+    size_t i;
+
+    if (entry->object) {
+        res = tcc_add_file((TCCState *)cjit->TCC, entry->object);
+    }
+    /* linked with the program as when its source is compiled there */
+    for (i = 0; res >= 0 && i < string_list_count(entry->libs); i++) {
+        tcc_add_pragma_lib((TCCState *)cjit->TCC,
+                           string_list_get(entry->libs, i));
+    }
+    if (res >= 0 && !entry->hit && cache_store(cjit, entry)) {
+        free(entry->object);
+        entry->object = NULL;
+    }
+    cjit_object_cache_discard(entry);
+    return res;
+}
+
+typedef struct CacheFile {
+    char *name;
+    time_t mtime;
+    off_t size;
+} CacheFile;
+
+static int cache_file_older(const void *a, const void *b)
+{
+    time_t ta = ((const CacheFile *)a)->mtime;
+    time_t tb = ((const CacheFile *)b)->mtime;
+    return (ta > tb) - (ta < tb);
+}
+
+void cjit_object_cache_trim(CJITState *cjit)
+{
+    char dir[PATH_MAX];
+    char path[CACHE_PATH];
+    long limit = cache_limit();
+    CacheFile *files = NULL;
+    size_t count = 0;
+    size_t alloc = 0;
+    size_t i;
+    long long total = 0;
+    struct dirent *de;
+    DIR *d;
+
+    if (!cache_dir(cjit, dir, sizeof(dir)) || !(d = opendir(dir))) {
+        return;
+    }
+    while ((de = readdir(d))) {
+        const char *ext = strrchr(de->d_name, '.');
+        struct stat st;
+        if (!ext || (strcmp(ext, ".o") && strcmp(ext, ".d"))) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+        if (stat(path, &st) != 0) {
+            continue;
+        }
+        if (count == alloc) {
+            alloc = alloc ? alloc * 2 : 64;
+            files = realloc(files, alloc * sizeof(CacheFile));
+        }
+        files[count].name = strdup(de->d_name);
+        files[count].mtime = st.st_mtime;
+        files[count].size = st.st_size;
+        total += st.st_size;
+        count++;
+    }
+    closedir(d);
+    if (total > limit) {
+        qsort(files, count, sizeof(CacheFile), cache_file_older);
+        for (i = 0; i < count && total > limit / 4 * 3; i++) {
+            snprintf(path, sizeof(path), "%s/%s", dir, files[i].name);
+            if (unlink(path) == 0) {
+                total -= files[i].size;
+            }
+        }
+        if (cjit->verbose) {
+            _err("Object cache trimmed to %lld bytes", total);
+        }
+    }
+    for (i = 0; i < count; i++) {
+        free(files[i].name);
+    }
+    free(files);
+}
+
+int cjit_object_cache_add_source(CJITState *cjit, const char *path,
+                                 const char *contents)
+{
+    CJITCachedObject entry;
+    TCCState *unit;
+    int res;
+
+    if (cjit_object_cache_find(cjit, contents, &entry)) {
+        return cjit_object_cache_load(cjit, &entry) < 0 ? -1 : 1;
+    }
+    unit = cjit_unit_new(cjit, path);
+    res = cjit_object_cache_build(cjit, unit, contents, &entry);
+    tcc_delete(unit);
+    if (res < 0) {
+        cjit_object_cache_discard(&entry);
+        return -1;
+    }
+    res = cjit_object_cache_load(cjit, &entry);
+    cjit_object_cache_trim(cjit);
+    return res < 0 ? -1 : 0;
+}
+
+#else
+
+void cjit_object_cache_source_key(const char *contents, char key[33])
+{
+    (void)contents;
+    key[0] = 0;
+}
+
+bool cjit_object_cache_enabled(CJITState *cjit)
+{
+    (void)cjit;
+    return false;
+}
+
+int cjit_object_cache_find(CJITState *cjit, const char *contents,
+                           CJITCachedObject *entry)
+{
+    (void)cjit;
+    (void)contents;
+    memset(entry, 0, sizeof(*entry));
+    return 0;
+}
+
+int cjit_object_cache_build(CJITState *cjit, struct TCCState *unit,
+                            const char *contents, CJITCachedObject *entry)
+{
+    (void)cjit;
+    (void)unit;
+    (void)contents;
+    (void)entry;
+    return -1;
+}
+
+int cjit_object_cache_load(CJITState *cjit, CJITCachedObject *entry)
+{
+    (void)cjit;
+    (void)entry;
+    return -1;
+}
+
+void cjit_object_cache_discard(CJITCachedObject *entry)
+{
+    (void)entry;
+}
+
+void cjit_object_cache_trim(CJITState *cjit)
+{
+    (void)cjit;
+}
+
+int cjit_object_cache_add_source(CJITState *cjit, const char *path,
+                                 const char *contents)
+{
+    (void)cjit;
+    (void)path;
+    (void)contents;
+    return -1;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef CJIT_ADAPTERS_COMPILER_OBJECT_CACHE_H
+#define CJIT_ADAPTERS_COMPILER_OBJECT_CACHE_H
+
+#include <time.h>
+
+#include "cjit.h"
+#include "support/string_list.h"
+
+struct TCCState;
+struct CJITLayout;
+
+/**
+ * Default bound of the object cache in megabytes, overridden by the
+ * CJIT_CACHE_SIZE environment variable (0 turns the cache off).
+ */
+#define CJIT_CACHE_SIZE 256
+
+/**
+ * One translation unit looked up in, or about to be stored into, the
+ * object cache kept under `$TMPDIR/cjit/<VERSION>/objcache`.
+ */
+typedef struct CJITCachedObject {
+    char key[33];       /* hash of the source, flags and compiler */
+    char *object;       /* private object file to load, NULL when none */
+    StringList *deps;   /* files read by the compiler on a miss */
+    StringList *libs;   /* libraries named by #pragma comment(lib,) */
+    time_t started;     /* when the compilation started */
+    int diagnostics;    /* errors and warnings printed by the compiler */
+    int hit;
+    struct CJITLayout *layout; /* with --layout, how its code is laid out */
+} CJITCachedObject;
+
+/**
+ * True when sources compiled for in-memory execution go through the
+ * cache: not turned off with `--no-cache` or CJIT_CACHE_SIZE=0.
+ */
+bool cjit_object_cache_enabled(CJITState *cjit);
+
+/**
+ * Writes to `key` the hash of `contents` alone, naming what is kept
+ * about a source whatever the options it is compiled with.
+ */
+void cjit_object_cache_source_key(const char *contents, char key[33]);
+
+/**
+ * Computes the key of `contents` and looks for an object compiled
+ * from it whose headers did not change since. Returns 1 on a hit, with
+ * `entry->object` naming a private link that the caller loads.
+ * Safe to call from several threads and processes at once.
+ */
+int cjit_object_cache_find(CJITState *cjit, const char *contents,
+                           CJITCachedObject *entry);
+
+/**
+ * Compiles `contents` on `unit`, a state from cjit_unit_new(), to an
+ * object file named in `entry->object`. Returns -1 on errors.
+ */
+int cjit_object_cache_build(CJITState *cjit, struct TCCState *unit,
+                            const char *contents, CJITCachedObject *entry);
+
+/**
+ * Loads the object of `entry` and its pragma libraries into the
+ * program, stores it in the cache when it was just built without
+ * diagnostics, then releases `entry`.
+ * Returns -1 when the object could not be loaded.
+ */
+int cjit_object_cache_load(CJITState *cjit, CJITCachedObject *entry);
+
+/**
+ * Removes the object file of `entry` and releases it.
+ */
+void cjit_object_cache_discard(CJITCachedObject *entry);
+
+/**
+ * Evicts the least recently used objects once the cache grew past its
+ * bound.
+ */
+void cjit_object_cache_trim(CJITState *cjit);
+
+/**
+ * Adds the source at `path`, already read into `contents`, loading its
+ * object from the cache or compiling and storing it.
+ */
+int cjit_object_cache_add_source(CJITState *cjit, const char *path,
+                                 const char *contents);
+
+#endif
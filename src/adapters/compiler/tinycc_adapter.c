@@ -3,9 +3,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "adapters/compiler/codegen_report.h"
+#include "adapters/compiler/make_deps.h"
+#include "adapters/compiler/unit_pool.h"
+#include "adapters/platform/hot_reload.h"
 #include "adapters/platform/library_resolver_posix.h"
 #include "adapters/platform/library_resolver_windows.h"
+#include "adapters/platform/relink.h"
 #include "adapters/platform/runtime_platform.h"
+#include "adapters/platform/symbol_map.h"
+#include "adapters/platform/tier_runtime.h"
 #include "cjit.h"
 #include "support/cwalk.h"
 #include "libtcc.h"
@@ -18,6 +25,8 @@ static CJITState *state_from_context(void *context)
 }
 
 static CJITResult relocate(void *context, RuntimeSession *session);
+static CJITResult run_program(void *context, RuntimeSession *session, int in_process,
+                              int argc, char **argv, int *exit_status);
 static CJITResult resolve_symbol(void *context, RuntimeSession *session,
                                  const char *symbol_name, void **symbol);
 
@@ -84,6 +93,13 @@ static CJITResult add_source_buffer(void *context, RuntimeSession *session, cons
     return cjit_add_buffer_result(state_from_context(context), buffer);
 }
 
+static CJITResult add_source_files(void *context, RuntimeSession *session,
+                                   const char **paths, int count)
+{
+    (void)session;
+    return cjit_unit_pool_add_files(state_from_context(context), paths, count);
+}
+
 static CJITResult add_binary_input(void *context, RuntimeSession *session, const char *path)
 {
     return add_source_file(context, session, path);
@@ -149,8 +165,10 @@ static CJITResult compile_object(void *context, RuntimeSession *session, const c
     if (!cjit_add_file_result(cjit, path).ok) {
         return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1, "Compile to object failed");
     }
+    cjit_codegen_report_print(cjit);
     if (cjit->output_filename) {
-        if (tcc_output_file(compiler_handle, cjit->output_filename) < 0) {
+        if (tcc_output_file(compiler_handle, cjit->output_filename) < 0
+            || cjit_make_deps_write(cjit, compiler_handle, path, cjit->output_filename) < 0) {
             return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1, "Compile to object failed");
         }
     } else {
@@ -165,7 +183,8 @@ static CJITResult compile_object(void *context, RuntimeSession *session, const c
         strncpy(tmp, basename, len + 1);
         cwk_path_get_extension(tmp, (const char **)&ext, &extlen);
         strcpy(ext, ".o");
-        if (tcc_output_file(compiler_handle, tmp) < 0) {
+        if (tcc_output_file(compiler_handle, tmp) < 0
+            || cjit_make_deps_write(cjit, compiler_handle, path, tmp) < 0) {
             free(tmp);
             return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1, "Compile to object failed");
         }
@@ -186,6 +205,7 @@ static CJITResult link_executable(void *context, RuntimeSession *session)
     if (!cjit->output_filename) {
         return cjit_result_error(CJIT_RESULT_LINK_ERROR, 1, "No output file configured");
     }
+    cjit_codegen_report_print(cjit);
     found = resolve_libraries(cjit);
     for (int i = 0; i < found; ++i) {
         char *resolved_path = string_list_get(cjit->reallibs, i);
@@ -203,9 +223,6 @@ static CJITResult execute_program(void *context, RuntimeSession *session,
                                   int argc, char **argv, int *exit_status)
 {
     CJITState *cjit = state_from_context(context);
-    int found;
-    int (*entrypoint)(int, char **);
-    CJITResult result;
 
     if (!cjit->done_setup) {
         return cjit_result_error(CJIT_RESULT_INVALID_REQUEST, 1, "No source code found");
@@ -213,14 +230,15 @@ static CJITResult execute_program(void *context, RuntimeSession *session,
     if (cjit->done_exec) {
         return cjit_result_error(CJIT_RESULT_EXEC_ERROR, 1, "CJIT already executed once");
     }
+    return run_program(context, session, 0, argc, argv, exit_status);
+}
 
-    found = resolve_libraries(cjit);
-    for (int i = 0; i < found; ++i) {
-        char *resolved_path = string_list_get(cjit->reallibs, i);
-        if (resolved_path) {
-            tcc_add_file((TCCState *)session->compiler_handle, resolved_path);
-        }
-    }
+static CJITResult run_program(void *context, RuntimeSession *session, int in_process,
+                              int argc, char **argv, int *exit_status)
+{
+    CJITState *cjit = state_from_context(context);
+    int (*entrypoint)(int, char **);
+    CJITResult result;
 
     result = relocate(context, session);
     if (!result.ok) {
@@ -232,17 +250,36 @@ static CJITResult execute_program(void *context, RuntimeSession *session,
         return result;
     }
 
-    *exit_status = cjit_platform_exec(cjit, entrypoint, argc, argv);
+    *exit_status = in_process ? entrypoint(argc, argv)
+                              : cjit_platform_exec(cjit, entrypoint, argc, argv);
     return cjit_result_make((*exit_status == 0) ? CJIT_RESULT_OK : CJIT_RESULT_EXEC_ERROR,
                             *exit_status, (*exit_status == 0), NULL);
 }
 
+/* links the program in memory, once: later calls find it ready */
 static CJITResult relocate(void *context, RuntimeSession *session)
 {
+    CJITState *cjit = state_from_context(context);
     TCCState *compiler_handle;
+    int found;
 
-    (void)context;
+    if (cjit->done_relocate) {
+        return cjit_result_ok();
+    }
+    if (!cjit->done_setup) {
+        return cjit_result_error(CJIT_RESULT_INVALID_REQUEST, 1, "No source code found");
+    }
     compiler_handle = (TCCState *)session->compiler_handle;
+    found = resolve_libraries(cjit);
+    for (int i = 0; i < found; ++i) {
+        char *resolved_path = string_list_get(cjit->reallibs, i);
+        if (resolved_path) {
+            tcc_add_file(compiler_handle, resolved_path);
+        }
+    }
+
+    cjit_codegen_report_print(cjit);
+    cjit_symbol_map_attach(cjit, compiler_handle);
 #if defined(TCC_RELOCATE_AUTO)
     if (tcc_relocate(compiler_handle, TCC_RELOCATE_AUTO) < 0) {
 #else
@@ -250,6 +287,16 @@ static CJITResult relocate(void *context, RuntimeSession *session)
 #endif
         return cjit_result_error(CJIT_RESULT_LINK_ERROR, -1, "TCC linker error");
     }
+    cjit->done_relocate = true;
+    if (cjit->tiered) {
+        cjit_tier_prepare(cjit);
+    }
+    if (cjit->hot_reload) {
+        cjit_hot_reload_prepare(cjit);
+    }
+    if (cjit->relink_fd >= 0) {
+        cjit_relink_prepare(cjit);
+    }
     return cjit_result_ok();
 }
 
@@ -284,6 +331,7 @@ const CompilerPort tinycc_compiler_port = {
     .set_output_mode = set_output_mode,
     .add_source_file = add_source_file,
     .add_source_buffer = add_source_buffer,
+    .add_source_files = add_source_files,
     .add_binary_input = add_binary_input,
     .define_symbol = define_symbol,
     .add_include_path = add_include_path,
@@ -293,6 +341,7 @@ const CompilerPort tinycc_compiler_port = {
     .compile_object = compile_object,
     .link_executable = link_executable,
     .execute_program = execute_program,
+    .run_program = run_program,
     .relocate = relocate,
     .resolve_symbol = resolve_symbol,
     .end_session = end_session
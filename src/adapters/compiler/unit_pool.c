@@ -0,0 +1,189 @@
+#include "adapters/compiler/unit_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "adapters/compiler/layout_profile.h"
+#include "adapters/compiler/object_cache.h"
+#include "adapters/platform/job_pool.h"
+#include "adapters/platform/watch.h"
+#include "libtcc.h"
+#include "support/cwalk.h"
+#include "support/source_files.h"
+
+#if !defined(WINDOWS) && !defined(SHAREDTCC)
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * One C source compiled on a state of its own.
+ */
+typedef struct Unit {
+    const char *path;
+    TCCState *tcc;
+    CJITCachedObject cached;
+    int failed;
+} Unit;
+
+typedef struct UnitPool {
+    CJITState *cjit;
+    int cache;
+    Unit *units;
+    int count;
+    int next;
+} UnitPool;
+
+static void *unit_worker(void *arg)
+{
+    UnitPool *pool = (UnitPool *)arg;
+    int i;
+
+    while ((i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < pool->count) {
+        Unit *unit = &pool->units[i];
+        char *contents = NULL;
+        if (!cjit_read_source(pool->cjit, unit->path, &contents).ok) {
+            unit->failed = 1;
+        } else if (pool->cache) {
+            unit->failed = !cjit_object_cache_find(pool->cjit, contents, &unit->cached)
+                && cjit_object_cache_build(pool->cjit, unit->tcc, contents,
+                                           &unit->cached) < 0;
+        } else {
+            CJITLayout *layout = cjit_layout_new(pool->cjit, contents);
+            cjit_layout_apply(layout, unit->tcc);
+            unit->failed = tcc_compile_string(unit->tcc, contents) < 0;
+            cjit_watch_note_deps(pool->cjit, unit->tcc);
+            cjit_layout_free(layout);
+        }
+        free(contents);
+    }
+    return NULL;
+}
+
+static void unit_pool_run(UnitPool *pool, int jobs)
+{
+    pthread_t *threads = calloc((size_t)jobs, sizeof(pthread_t));
+    int started = 0;
+
+    while (started < jobs - 1
+           && pthread_create(&threads[started], NULL, unit_worker, pool) == 0) {
+        started++;
+    }
+    unit_worker(pool);
+    while (started) {
+        pthread_join(threads[--started], NULL);
+    }
+    free(threads);
+}
+
+CJITResult cjit_unit_pool_add_files(CJITState *cjit, const char **paths, int count)
+{
+    CJITResult result = cjit_prepare(cjit);
+    UnitPool pool;
+    int sources = 0;
+    int jobs;
+    int i;
+    int u;
+
+    if (!result.ok) {
+        return result;
+    }
+    for (i = 0; i < count; i++) {
+        if (cjit_classify_source_path(paths[i]) > 0) {
+            sources++;
+        }
+    }
+    jobs = cjit_job_count();
+    if (jobs > sources) {
+        jobs = sources;
+    }
+    /* the codegen report collects rows from a single compiler */
+    if (jobs < 2 || cjit->codegen_report) {
+        for (i = 0; i < count && result.ok; i++) {
+            result = cjit_add_file_result(cjit, paths[i]);
+        }
+        return result;
+    }
+
+    pool.cjit = cjit;
+    pool.cache = cjit_object_cache_enabled(cjit);
+    pool.units = calloc((size_t)sources, sizeof(Unit));
+    pool.count = sources;
+    pool.next = 0;
+    for (i = 0, u = 0; i < count; i++) {
+        if (cjit_classify_source_path(paths[i]) > 0) {
+            pool.units[u].path = paths[i];
+            pool.units[u].tcc = cjit_unit_new(cjit, paths[i]);
+            u++;
+        }
+    }
+    if (cjit->verbose) {
+        _err("Compiling %d sources on %d threads", sources, jobs);
+    }
+    unit_pool_run(&pool, jobs);
+
+    /* merge in command line order, so archives see the same undefined symbols */
+    for (i = 0, u = 0; i < count && result.ok; i++) {
+        if (cjit_classify_source_path(paths[i]) <= 0) {
+            result = cjit_add_file_result(cjit, paths[i]);
+            continue;
+        }
+        Unit *unit = &pool.units[u++];
+        int hit = unit->cached.hit;
+        if (unit->failed
+            || (pool.cache ? cjit_object_cache_load(cjit, &unit->cached)
+                : tcc_add_object_state((TCCState *)cjit->TCC, unit->tcc)) < 0) {
+            _err("%s: error: %s", __func__, paths[i]);
+            result = cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
+                                       "Error loading source input");
+        } else if (cjit->verbose) {
+            _err(hit ? "+C %s" : "+S %s", paths[i]);
+        }
+    }
+    for (u = 0; u < sources; u++) {
+        cjit_object_cache_discard(&pool.units[u].cached);
+        tcc_delete(pool.units[u].tcc);
+    }
+    if (pool.cache) {
+        cjit_object_cache_trim(cjit);
+    }
+    free(pool.units);
+    return result;
+}
+
+TCCState *cjit_unit_new(CJITState *cjit, const char *path)
+{
+    TCCState *tcc = tcc_new_unit((TCCState *)cjit->TCC);
+    size_t dirname;
+
+    cwk_path_get_dirname(path, &dirname);
+    if (dirname) {
+        char *dir = malloc(dirname + 1);
+        memcpy(dir, path, dirname);
+        dir[dirname] = 0;
+        tcc_add_include_path(tcc, dir);
+        free(dir);
+    }
+    return tcc;
+}
+
+#else
+
+CJITResult cjit_unit_pool_add_files(CJITState *cjit, const char **paths, int count)
+{
+    CJITResult result = cjit_result_ok();
+    int i;
+
+    for (i = 0; i < count && result.ok; i++) {
+        result = cjit_add_file_result(cjit, paths[i]);
+    }
+    return result;
+}
+
+TCCState *cjit_unit_new(CJITState *cjit, const char *path)
+{
+    (void)cjit;
+    (void)path;
+    return NULL;
+}
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef CJIT_ADAPTERS_COMPILER_UNIT_POOL_H
+#define CJIT_ADAPTERS_COMPILER_UNIT_POOL_H
+
+#include "cjit.h"
+
+struct TCCState;
+
+/**
+ * Adds `paths` to the program in order. The C sources among them are
+ * compiled to in-memory objects on a pool of worker threads, one per
+ * core unless CJIT_JOBS says otherwise, and merged before linking.
+ */
+CJITResult cjit_unit_pool_add_files(CJITState *cjit, const char **paths, int count);
+
+/**
+ * Creates a state compiling `path` to an object with the options of the
+ * program, which also searches the directory of the source for includes.
+ */
+struct TCCState *cjit_unit_new(CJITState *cjit, const char *path);
+
+#endif
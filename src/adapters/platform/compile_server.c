@@ -0,0 +1,696 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* struct ucred */
+#endif
+
+#include "adapters/platform/compile_server.h"
+
+#include "libtcc.h"
+#include "support/source_files.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(WINDOWS)
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+
+/* runs asking for more are refused */
+#define SERVER_MAX_REQUEST (16 * 1024 * 1024)
+
+/* passed to the zygote: the client connection, a pipe with the request
+   and the standard streams */
+#define ZYGOTE_FDS 5
+
+/*
+ * A request is a 32 bit length followed by as many bytes of NUL
+ * terminated strings: the working directory, the number of arguments,
+ * the arguments and then the environment. The standard streams travel
+ * with the length as SCM_RIGHTS. The reply is the 32 bit exit status.
+ */
+
+static int write_all(int fd, const void *buf, size_t len)
+{
+    const char *p = (const char *)buf;
+
+    while (len) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int read_all(int fd, void *buf, size_t len)
+{
+    char *p = (char *)buf;
+
+    while (len) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int socket_address(struct sockaddr_un *addr, const char *path)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr->sun_path)) {
+        return 0;
+    }
+    strcpy(addr->sun_path, path);
+    return 1;
+}
+
+static int socket_connect(const char *path)
+{
+    struct sockaddr_un addr;
+    int fd;
+
+    if (!socket_address(&addr, path) || (fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void append(char **buf, size_t *len, size_t *size, const char *s)
+{
+    size_t n = strlen(s) + 1;
+
+    while (*len + n > *size) {
+        *size = *size ? *size * 2 : 4096;
+        *buf = realloc(*buf, *size);
+    }
+    memcpy(*buf + *len, s, n);
+    *len += n;
+}
+
+/**
+ * Sends the 32 bit `size` with the descriptors in `fds` attached.
+ */
+static int send_fds(int fd, uint32_t size, const int *fds, int nfds)
+{
+    union {
+        struct cmsghdr align;
+        char space[CMSG_SPACE(ZYGOTE_FDS * sizeof(int))];
+    } control;
+    struct iovec iov = { &size, sizeof(size) };
+    struct msghdr msg;
+    struct cmsghdr *cmsg;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(&control, 0, sizeof(control));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.space;
+    msg.msg_controllen = CMSG_SPACE(nfds * sizeof(int));
+    cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(nfds * sizeof(int));
+    memcpy(CMSG_DATA(cmsg), fds, nfds * sizeof(int));
+    return sendmsg(fd, &msg, 0) == (ssize_t)sizeof(size) ? 0 : -1;
+}
+
+static int send_request(int fd, const char *buf, size_t len)
+{
+    int fds[3] = { 0, 1, 2 };
+
+    if (send_fds(fd, (uint32_t)len, fds, 3) < 0) {
+        return -1;
+    }
+    return write_all(fd, buf, len);
+}
+
+int cjit_client_run(const char *socket_path, int argc, char **argv)
+{
+    char cwd[PATH_MAX];
+    char count[16];
+    char *buf = NULL;
+    size_t len = 0;
+    size_t size = 0;
+    int32_t status;
+    int fd;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--server") == 0) {
+            return -1;
+        }
+    }
+    if (!getcwd(cwd, sizeof(cwd)) || (fd = socket_connect(socket_path)) < 0) {
+        return -1;
+    }
+    append(&buf, &len, &size, cwd);
+    snprintf(count, sizeof(count), "%d", argc);
+    append(&buf, &len, &size, count);
+    for (i = 0; i < argc; i++) {
+        append(&buf, &len, &size, argv[i]);
+    }
+    for (i = 0; environ[i]; i++) {
+        append(&buf, &len, &size, environ[i]);
+    }
+    if (send_request(fd, buf, len) < 0) {
+        free(buf);
+        close(fd);
+        return -1;
+    }
+    free(buf);
+    if (read_all(fd, &status, sizeof(status)) < 0) {
+        _err("Compile server on %s did not answer", socket_path);
+        status = 1;
+    }
+    close(fd);
+    return (int)status;
+}
+
+/**
+ * Receives a 32 bit size with exactly `nfds` descriptors attached.
+ */
+static int recv_fds(int conn, uint32_t *size, int *fds, int nfds)
+{
+    union {
+        struct cmsghdr align;
+        char space[CMSG_SPACE(ZYGOTE_FDS * sizeof(int))];
+    } control;
+    struct iovec iov = { size, sizeof(*size) };
+    struct msghdr msg;
+    struct cmsghdr *cmsg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.space;
+    msg.msg_controllen = sizeof(control.space);
+    if (recvmsg(conn, &msg, 0) != (ssize_t)sizeof(*size)) {
+        return -1;
+    }
+    cmsg = CMSG_FIRSTHDR(&msg);
+    if (!cmsg || cmsg->cmsg_type != SCM_RIGHTS) {
+        return -1;
+    }
+    if (cmsg->cmsg_len != CMSG_LEN(nfds * sizeof(int))) {
+        int i, got = (int)((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+        for (i = 0; i < got; i++) {
+            close(((int *)CMSG_DATA(cmsg))[i]);
+        }
+        return -1;
+    }
+    memcpy(fds, CMSG_DATA(cmsg), nfds * sizeof(int));
+    return 0;
+}
+
+static int same_user(int conn)
+{
+#if defined(SO_PEERCRED)
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+
+    return getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0
+        && cred.uid == getuid();
+#else
+    uid_t uid;
+    gid_t gid;
+
+    return getpeereid(conn, &uid, &gid) == 0 && uid == getuid();
+#endif
+}
+
+static const char *next_string(char **p, const char *end)
+{
+    const char *s = *p;
+
+    if (*p >= end) {
+        return NULL;
+    }
+    *p += strlen(*p) + 1;
+    return s;
+}
+
+static int child_pipe[2];
+
+static void on_child(int sig)
+{
+    ssize_t n = write(child_pipe[1], "", 1);
+    (void)sig;
+    (void)n;
+}
+
+/**
+ * Waits for the run in `pid`, killing it when the client goes away.
+ */
+static int wait_run(int conn, pid_t pid)
+{
+    struct pollfd pfd[2];
+    int status;
+
+    pfd[0].fd = conn;
+    pfd[0].events = POLLIN;
+    pfd[1].fd = child_pipe[0];
+    pfd[1].events = POLLIN;
+    for (;;) {
+        pid_t ret = waitpid(pid, &status, WNOHANG);
+        if (ret == pid) {
+            break;
+        }
+        if (ret < 0 && errno != EINTR) {
+            return 1;
+        }
+        if (poll(pfd, 2, -1) < 0 && errno != EINTR) {
+            return 1;
+        }
+        if (pfd[0].revents) { /* the client sends nothing more: it left */
+            kill(-pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            return 1;
+        }
+        if (pfd[1].revents) {
+            char c;
+            ssize_t n = read(child_pipe[0], &c, 1);
+            (void)n;
+        }
+    }
+    if (WIFSIGNALED(status)) {
+        return 128 + WTERMSIG(status);
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+
+/**
+ * A run sent by a client: its standard streams and the strings of the
+ * request, unpacked in place.
+ */
+typedef struct ServerRequest {
+    int fds[3];
+    char *buf;
+    uint32_t size;
+    const char *cwd;
+    int argc;
+    char **argv;
+    char **envp;
+} ServerRequest;
+
+static int read_request(int fd, ServerRequest *req)
+{
+    const char *count;
+    const char *s;
+    char *p;
+    int envc = 0;
+    int i;
+
+    if (req->size > SERVER_MAX_REQUEST || !(req->buf = malloc(req->size + 1))
+        || read_all(fd, req->buf, req->size) < 0) {
+        return -1;
+    }
+    req->buf[req->size] = 0;
+    p = req->buf;
+    req->cwd = next_string(&p, req->buf + req->size);
+    count = next_string(&p, req->buf + req->size);
+    req->argc = count ? atoi(count) : 0;
+    if (!req->cwd || req->argc < 1 || req->argc > (int)req->size) {
+        return -1;
+    }
+    req->argv = calloc((size_t)req->argc + 1, sizeof(char *));
+    req->envp = calloc(req->size / 2 + 1, sizeof(char *));
+    for (i = 0; i < req->argc; i++) {
+        if (!(req->argv[i] = (char *)next_string(&p, req->buf + req->size))) {
+            return -1;
+        }
+    }
+    while ((s = next_string(&p, req->buf + req->size))) {
+        req->envp[envc++] = (char *)s;
+    }
+    return 0;
+}
+
+/**
+ * Forks the process that runs `req` and returns in it, set up with the
+ * streams, directory and environment of the client. The calling
+ * process waits for the run, answers the client and exits.
+ */
+static void fork_run(CJITState *cjit, int conn, ServerRequest *req)
+{
+    struct sigaction sa;
+    int32_t status;
+    pid_t pid;
+    int i;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_child;
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    if (pipe(child_pipe) != 0 || sigaction(SIGCHLD, &sa, NULL) != 0) {
+        _exit(1);
+    }
+    pid = fork();
+    if (pid == 0) {
+        /* a session of its own: no job control from the client tty, and
+           one process group to kill with the program it runs */
+        setsid();
+        signal(SIGCHLD, SIG_DFL);
+        signal(SIGPIPE, SIG_DFL);
+        for (i = 0; i < 3; i++) {
+            dup2(req->fds[i], i);
+        }
+        for (i = 0; i < 3; i++) {
+            if (req->fds[i] > 2) {
+                close(req->fds[i]);
+            }
+        }
+        close(conn);
+        close(child_pipe[0]);
+        close(child_pipe[1]);
+        if (chdir(req->cwd) != 0) {
+            fail(req->cwd);
+            exit(1);
+        }
+        environ = req->envp;
+        cjit->quiet = isatty(fileno(stdout)) ? false : true;
+        return;
+    }
+    for (i = 0; i < 3; i++) {
+        close(req->fds[i]);
+    }
+    status = pid < 0 ? 1 : wait_run(conn, pid);
+    write_all(conn, &status, sizeof(status));
+    _exit(0);
+}
+
+/*
+ * With a prelude the server forks a zygote: a process that compiles
+ * the prelude header up to '#pragma snapshot' and waits there, inside
+ * the compiler, for runs of a single source. Each one is forked from
+ * that point and only compiles its own source.
+ */
+
+typedef struct Zygote {
+    CJITState *cjit;
+    int chan;
+    pid_t server;
+    ServerRequest req;
+    const char *source;
+    char *contents;
+} Zygote;
+
+/**
+ * Returns the source of `req` when the zygote can run it: one C source
+ * and no options but -q and --verb, with arguments after "--", and no
+ * CFLAGS in the environment. Returns NULL for anything else.
+ */
+static const char *zygote_source(const ServerRequest *req)
+{
+    const char *source = NULL;
+    int i;
+
+    for (i = 1; i < req->argc; i++) {
+        const char *arg = req->argv[i];
+        if (strcmp(arg, "--") == 0) {
+            break;
+        }
+        if (strcmp(arg, "-q") == 0 || strcmp(arg, "--verb") == 0) {
+            continue;
+        }
+        /* conftest.c takes the compiler probing path of run_cli */
+        if (*arg == '-' || source || cjit_classify_source_path(arg) <= 0
+            || strcmp(arg, "conftest.c") == 0) {
+            return NULL;
+        }
+        source = arg;
+    }
+    for (i = 0; req->envp[i]; i++) {
+        if (strncmp(req->envp[i], "CFLAGS=", 7) == 0) {
+            return NULL;
+        }
+    }
+    return source;
+}
+
+/**
+ * Hands the connection and the request read from it to the zygote.
+ * Returns -1 when the zygote is gone.
+ */
+static int zygote_forward(int chan, int conn, const ServerRequest *req)
+{
+    int fds[ZYGOTE_FDS];
+    int pfd[2];
+
+    if (pipe(pfd) != 0) {
+        return -1;
+    }
+    fds[0] = conn;
+    fds[1] = pfd[0];
+    memcpy(fds + 2, req->fds, sizeof(req->fds));
+    if (send_fds(chan, req->size, fds, ZYGOTE_FDS) < 0) {
+        close(pfd[0]);
+        close(pfd[1]);
+        return -1;
+    }
+    close(pfd[0]);
+    write_all(pfd[1], req->buf, req->size);
+    close(pfd[1]);
+    return 0;
+}
+
+/**
+ * The '#pragma snapshot' hook of the zygote: forks a process for each
+ * request and returns the source of the run in it, to be compiled in
+ * place of the rest of the prelude.
+ */
+static const char *zygote_snapshot(void *opaque, const char **filename)
+{
+    Zygote *z = (Zygote *)opaque;
+    int fds[ZYGOTE_FDS];
+    int i;
+
+    if (z->source) { /* a run reaching another snapshot in the prelude */
+        return NULL;
+    }
+    for (;;) {
+        struct pollfd pfd;
+        pid_t pid;
+        if (getppid() != z->server) {
+            _exit(0);
+        }
+        pfd.fd = z->chan;
+        pfd.events = POLLIN;
+        if (poll(&pfd, 1, 1000) <= 0
+            || recv_fds(z->chan, &z->req.size, fds, ZYGOTE_FDS) < 0) {
+            continue;
+        }
+        pid = fork();
+        if (pid == 0) {
+            break;
+        }
+        for (i = 0; i < ZYGOTE_FDS; i++) {
+            close(fds[i]);
+        }
+    }
+    close(z->chan);
+    memcpy(z->req.fds, fds + 2, sizeof(z->req.fds));
+    if (read_request(fds[1], &z->req) < 0 || !(z->source = zygote_source(&z->req))) {
+        _exit(1);
+    }
+    close(fds[1]);
+    fork_run(z->cjit, fds[0], &z->req);
+    if (!cjit_read_source(z->cjit, z->source, &z->contents).ok) {
+        return NULL;
+    }
+    *filename = z->source;
+    return z->contents;
+}
+
+/**
+ * Forks the zygote parsing `prelude` and returns the socket to forward
+ * requests to it, or -1.
+ */
+static int zygote_start(CJITState *warm, const char *prelude, CJITServerRun run)
+{
+    char path[PATH_MAX];
+    char text[PATH_MAX + 32];
+    int chan[2];
+    Zygote z;
+    pid_t pid;
+    int res;
+
+    if (!realpath(prelude, path)) {
+        fail(prelude);
+        return -1;
+    }
+    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, chan) != 0) {
+        fail(prelude);
+        return -1;
+    }
+    memset(&z, 0, sizeof(z));
+    z.server = getpid();
+    pid = fork();
+    if (pid != 0) {
+        close(chan[1]);
+        if (pid < 0) {
+            fail(prelude);
+            close(chan[0]);
+            return -1;
+        }
+        return chan[0];
+    }
+    close(chan[0]);
+    z.cjit = warm;
+    z.chan = chan[1];
+    /* runs with CFLAGS of their own skip the zygote */
+    unsetenv("CFLAGS");
+    if (!cjit_prepare(warm).ok) {
+        _exit(1);
+    }
+    tcc_set_snapshot_func((TCCState *)warm->TCC, &z, zygote_snapshot);
+    snprintf(text, sizeof(text), "#include \"%s\"\n#pragma snapshot\n", path);
+    res = tcc_compile_string((TCCState *)warm->TCC, text);
+    if (!z.source) {
+        _err("Prelude %s stops before '#pragma snapshot' can be reached", prelude);
+        _exit(1);
+    }
+    /* in the run forked for a request, with its source compiled */
+    free(z.contents);
+    warm->snapshot_source = z.source;
+    warm->snapshot_result = z.contents ? res : -1;
+    exit(run(warm, z.req.argc, z.req.argv));
+}
+
+static void serve_request(CJITState *warm, int conn, int zygote, CJITServerRun run)
+{
+    ServerRequest req;
+
+    memset(&req, 0, sizeof(req));
+    if (recv_fds(conn, &req.size, req.fds, 3) < 0 || read_request(conn, &req) < 0) {
+        _exit(1);
+    }
+    if (zygote >= 0 && zygote_source(&req) && zygote_forward(zygote, conn, &req) == 0) {
+        _exit(0);
+    }
+    if (zygote >= 0) {
+        close(zygote);
+    }
+    fork_run(warm, conn, &req);
+    exit(run(warm, req.argc, req.argv));
+}
+
+int cjit_server_run(CJITState *cjit, const char *socket_path, const char *prelude,
+                    CJITServerRun run)
+{
+    struct sockaddr_un addr;
+    struct stat st;
+    CJITState *warm;
+    mode_t mask;
+    int zygote = -1;
+    int fd;
+
+    if (!socket_address(&addr, socket_path)) {
+        _err("Socket path is too long: %s", socket_path);
+        return 1;
+    }
+    if ((fd = socket_connect(socket_path)) >= 0) {
+        close(fd);
+        _err("A compile server is already listening on %s", socket_path);
+        return 1;
+    }
+    if (lstat(socket_path, &st) == 0 && S_ISSOCK(st.st_mode)) {
+        unlink(socket_path); /* left behind by a server that is gone */
+    }
+    warm = cjit_new();
+    if (!warm || !cjit_prepare_assets(warm).ok) {
+        return 1;
+    }
+    signal(SIGCHLD, SIG_IGN);
+    signal(SIGPIPE, SIG_IGN);
+    if (prelude && (zygote = zygote_start(warm, prelude, run)) < 0) {
+        cjit_free(warm);
+        return 1;
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    mask = umask(077);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+        || listen(fd, SOMAXCONN) != 0) {
+        umask(mask);
+        fail(socket_path);
+        cjit_free(warm);
+        return 1;
+    }
+    umask(mask);
+    if (!cjit->quiet) {
+        _err("Compile server listening on %s", socket_path);
+    }
+    for (;;) {
+        pid_t pid;
+        int conn = accept(fd, NULL, NULL);
+        if (conn < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            fail(socket_path);
+            break;
+        }
+        if (!same_user(conn)) {
+            close(conn);
+            continue;
+        }
+        pid = fork();
+        if (pid == 0) {
+            close(fd);
+            serve_request(warm, conn, zygote, run);
+        }
+        if (pid < 0) {
+            fail(socket_path);
+        }
+        close(conn);
+    }
+    close(fd);
+    unlink(socket_path);
+    cjit_free(warm);
+    return 1;
+}
+
+#else
+
+int cjit_server_run(CJITState *cjit, const char *socket_path, const char *prelude,
+                    CJITServerRun run)
+{
+    (void)cjit;
+    (void)prelude;
+    (void)run;
+    _err("Compile server is not supported on this platform: %s", socket_path);
+    return 1;
+}
+
+int cjit_client_run(const char *socket_path, int argc, char **argv)
+{
+    (void)socket_path;
+    (void)argc;
+    (void)argv;
+    return -1;
+}
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef CJIT_ADAPTERS_PLATFORM_COMPILE_SERVER_H
+#define CJIT_ADAPTERS_PLATFORM_COMPILE_SERVER_H
+
+#include "cjit.h"
+
+/**
+ * Runs one cjit command line on `cjit` and returns its exit status.
+ */
+typedef int (*CJITServerRun)(CJITState *cjit, int argc, char **argv);
+
+/**
+ * Listens on the unix socket at `socket_path` and serves runs sent by
+ * clients of the same user. The runtime assets are extracted once;
+ * each run is forked from this warm process, with the arguments,
+ * working directory, environment and standard streams of its client.
+ * With a `prelude` header, runs of a single source are forked from a
+ * compiler that parsed the prelude already, up to its
+ * '#pragma snapshot'. Returns only on errors.
+ */
+int cjit_server_run(CJITState *cjit, const char *socket_path, const char *prelude,
+                    CJITServerRun run);
+
+/**
+ * Hands the command line to the server listening at `socket_path`,
+ * together with the working directory, environment and standard
+ * streams of this process. Returns the exit status of the run, or -1
+ * when no server answered and the run should happen locally.
+ */
+int cjit_client_run(const char *socket_path, int argc, char **argv);
+
+#endif
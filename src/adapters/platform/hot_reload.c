@@ -0,0 +1,179 @@
+#include "adapters/platform/hot_reload.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "adapters/compiler/unit_pool.h"
+#include "adapters/platform/tier_runtime.h"
+#include "libtcc.h"
+
+#if !defined(WINDOWS) && !defined(SHAREDTCC)
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+
+/**
+ * A source of the program and the last version of it seen on disk.
+ */
+typedef struct Watched {
+    const char *file;
+    struct timespec mtime;
+    off_t size;
+    int changed;
+} Watched;
+
+static TierSlot *reload_slots;
+static TierSlot *reload_slots_end;
+static Watched *watched;
+static int watched_count;
+static CJITState *reload_cjit;
+
+static int same_stat(const Watched *w, const struct stat *st)
+{
+    return w->size == st->st_size
+        && w->mtime.tv_sec == st->st_mtim.tv_sec
+        && w->mtime.tv_nsec == st->st_mtim.tv_nsec;
+}
+
+int cjit_hot_reload_prepare(CJITState *cjit)
+{
+    TCCState *tcc = (TCCState *)cjit->TCC;
+    TierSlot *slot;
+    struct stat st;
+    int i;
+
+    reload_slots = tcc_get_symbol(tcc, "__start_cjit_tier");
+    reload_slots_end = tcc_get_symbol(tcc, "__stop_cjit_tier");
+    if (!reload_slots || !reload_slots_end) {
+        reload_slots = reload_slots_end = NULL;
+        _err("Hot reload: no entry slots, compiler lacks -ftiered");
+        return 0;
+    }
+    watched = calloc((size_t)(reload_slots_end - reload_slots), sizeof(Watched));
+    watched_count = 0;
+    for (slot = reload_slots; slot < reload_slots_end; slot++) {
+        for (i = 0; i < watched_count; i++) {
+            if (strcmp(watched[i].file, slot->file) == 0) {
+                break;
+            }
+        }
+        if (i < watched_count || stat(slot->file, &st) != 0) {
+            continue;
+        }
+        watched[watched_count].file = slot->file;
+        watched[watched_count].mtime = st.st_mtim;
+        watched[watched_count].size = st.st_size;
+        watched_count++;
+    }
+    reload_cjit = cjit;
+    return watched_count;
+}
+
+/**
+ * Compiles `file` again and links it in fresh memory, its data and
+ * calls to the rest of the program bound to the running one, then
+ * repoints the slots of its functions. Old code is left in place, as
+ * other threads may still be running it.
+ */
+static void reload(const char *file)
+{
+    CJITState *cjit = reload_cjit;
+    TCCState *prog = (TCCState *)cjit->TCC;
+    TCCState *unit = cjit_unit_new(cjit, file);
+    TCCState *image = tcc_new();
+    TierSlot *slots, *slots_end, *fresh, *slot;
+    char *contents = NULL;
+    int swapped = 0;
+
+    if (!cjit_read_source(cjit, file, &contents).ok
+        || tcc_compile_string(unit, contents) < 0) {
+        goto failed;
+    }
+    tcc_set_output_type(image, TCC_OUTPUT_MEMORY);
+    /* the runtime library is linked in the program already */
+    tcc_set_options(image, "-nostdlib");
+    if (tcc_add_object_state(image, unit) < 0
+        || tcc_bind_program(image, prog) < 0
+        || tcc_relocate(image) < 0) {
+        goto failed;
+    }
+    slots = tcc_get_symbol(image, "__start_cjit_tier");
+    slots_end = tcc_get_symbol(image, "__stop_cjit_tier");
+    for (fresh = slots; slots && fresh < slots_end; fresh++) {
+        for (slot = reload_slots; slot < reload_slots_end; slot++) {
+            if (strcmp(slot->file, file) == 0 && strcmp(slot->name, fresh->name) == 0) {
+                __atomic_store_n(&slot->target, fresh->target, __ATOMIC_RELEASE);
+                swapped++;
+            }
+        }
+    }
+    free(contents);
+    tcc_delete(unit);
+    if (!cjit->quiet) {
+        _err("Hot reload: %s, %d functions swapped", file, swapped);
+    }
+    return;
+
+failed:
+    free(contents);
+    tcc_delete(unit);
+    tcc_delete(image);
+    _err("Hot reload: %s not reloaded, the program runs the old code", file);
+}
+
+static void *reload_thread(void *arg)
+{
+    struct timespec pause = { 0, CJIT_HOT_RELOAD_POLL * 1000 * 1000 };
+    struct stat st;
+    int i;
+
+    (void)arg;
+    for (;;) {
+        nanosleep(&pause, NULL);
+        for (i = 0; i < watched_count; i++) {
+            Watched *w = &watched[i];
+            if (stat(w->file, &st) != 0) {
+                continue;
+            }
+            if (!same_stat(w, &st)) {
+                /* wait for the file to settle, editors write in steps */
+                w->mtime = st.st_mtim;
+                w->size = st.st_size;
+                w->changed = 1;
+            } else if (w->changed) {
+                w->changed = 0;
+                reload(w->file);
+            }
+        }
+    }
+    return NULL;
+}
+
+void cjit_hot_reload_start(CJITState *cjit)
+{
+    pthread_t thread;
+
+    if (!watched_count || reload_cjit != cjit) {
+        return;
+    }
+    if (pthread_create(&thread, NULL, reload_thread, NULL) == 0) {
+        pthread_detach(thread);
+    } else {
+        _err("Hot reload: cannot start the watcher thread");
+    }
+}
+
+#else
+
+int cjit_hot_reload_prepare(CJITState *cjit)
+{
+    (void)cjit;
+    return 0;
+}
+
+void cjit_hot_reload_start(CJITState *cjit)
+{
+    (void)cjit;
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef CJIT_ADAPTERS_PLATFORM_HOT_RELOAD_H
+#define CJIT_ADAPTERS_PLATFORM_HOT_RELOAD_H
+
+#include "cjit.h"
+
+/**
+ * Milliseconds between two looks at the sources of a hot-reloaded
+ * program.
+ */
+#define CJIT_HOT_RELOAD_POLL 200
+
+/**
+ * Records the sources of the relocated program, found through the entry
+ * slots emitted by `-ftiered`. Returns the number of sources watched.
+ */
+int cjit_hot_reload_prepare(CJITState *cjit);
+
+/**
+ * Starts the background thread that recompiles a source when it
+ * changes, links it over the data of the running program and repoints
+ * the slots of its functions. Must be called in the process that runs
+ * the program.
+ */
+void cjit_hot_reload_start(CJITState *cjit);
+
+#endif
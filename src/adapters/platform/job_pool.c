@@ -0,0 +1,87 @@
+#include "adapters/platform/job_pool.h"
+
+#include <stdlib.h>
+
+#include "libtcc.h"
+
+#if !defined(WINDOWS) && !defined(SHAREDTCC)
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * The jobs of one call from tinycc, taken in turn by the threads.
+ */
+typedef struct JobPool {
+    int count;
+    int next;
+    TCCJobFunc *job;
+    void *arg;
+} JobPool;
+
+int cjit_job_count(void)
+{
+    const char *env = getenv("CJIT_JOBS");
+    long jobs = (env && *env) ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+    return jobs > 0 ? (int)jobs : 1;
+}
+
+static void *job_worker(void *arg)
+{
+    JobPool *pool = (JobPool *)arg;
+    int i;
+
+    while ((i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < pool->count) {
+        pool->job(pool->arg, i);
+    }
+    return NULL;
+}
+
+static void run_jobs(void *opaque, int count, TCCJobFunc *job, void *arg)
+{
+    CJITState *cjit = (CJITState *)opaque;
+    JobPool pool = { count, 0, job, arg };
+    int threads = cjit_job_count();
+    pthread_t *ids;
+    int started = 0;
+
+    if (threads > count) {
+        threads = count;
+    }
+    if (threads < 2) {
+        job_worker(&pool);
+        return;
+    }
+    if (cjit->verbose) {
+        _err("Running %d linker jobs on %d threads", count, threads);
+    }
+    ids = calloc((size_t)threads, sizeof(pthread_t));
+    while (ids && started < threads - 1
+           && pthread_create(&ids[started], NULL, job_worker, &pool) == 0) {
+        started++;
+    }
+    job_worker(&pool);
+    while (started) {
+        pthread_join(ids[--started], NULL);
+    }
+    free(ids);
+}
+
+void cjit_job_pool_attach(CJITState *cjit, struct TCCState *tcc)
+{
+    tcc_set_parallel_func(tcc, cjit, run_jobs);
+}
+
+#else
+
+int cjit_job_count(void)
+{
+    return 1;
+}
+
+void cjit_job_pool_attach(CJITState *cjit, struct TCCState *tcc)
+{
+    (void)cjit;
+    (void)tcc;
+}
+
+#endif
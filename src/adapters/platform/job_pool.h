@@ -0,0 +1,21 @@
+#ifndef CJIT_ADAPTERS_PLATFORM_JOB_POOL_H
+#define CJIT_ADAPTERS_PLATFORM_JOB_POOL_H
+
+#include "cjit.h"
+
+struct TCCState;
+
+/**
+ * Threads to run parallel work on: one per core unless CJIT_JOBS says
+ * otherwise.
+ */
+int cjit_job_count(void);
+
+/**
+ * Lets `tcc` run the jobs it can split its work into (applying the
+ * relocations of large images) on up to cjit_job_count() threads.
+ * Does nothing where threads are not supported.
+ */
+void cjit_job_pool_attach(CJITState *cjit, struct TCCState *tcc);
+
+#endif
@@ -0,0 +1,251 @@
+#include "adapters/platform/relink.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adapters/compiler/unit_pool.h"
+#include "adapters/platform/tier_runtime.h"
+#include "adapters/platform/watch.h"
+#include "libtcc.h"
+#include "support/string_list.h"
+
+#if defined(LINUX) && !defined(SHAREDTCC)
+#include <poll.h>
+#include <signal.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * A source of the program, with the image it was last linked in over
+ * the program, if it was.
+ */
+typedef struct Source {
+    const char *file;      /* as compiled, named by the slots */
+    char real[PATH_MAX];   /* as the watcher reports it */
+    TCCState *image;
+} Source;
+
+static TierSlot *relink_slots;
+static TierSlot *relink_slots_end;
+static Source *sources;
+static int source_count;
+
+int cjit_relink_prepare(CJITState *cjit)
+{
+    TCCState *tcc = (TCCState *)cjit->TCC;
+    TierSlot *slot;
+    int i;
+
+    relink_slots = tcc_get_symbol(tcc, "__start_cjit_tier");
+    relink_slots_end = tcc_get_symbol(tcc, "__stop_cjit_tier");
+    if (!relink_slots || !relink_slots_end) {
+        relink_slots = relink_slots_end = NULL;
+        return 0;
+    }
+    sources = calloc((size_t)(relink_slots_end - relink_slots), sizeof(Source));
+    source_count = 0;
+    for (slot = relink_slots; slot < relink_slots_end; slot++) {
+        for (i = 0; i < source_count; i++) {
+            if (strcmp(sources[i].file, slot->file) == 0) {
+                break;
+            }
+        }
+        if (i < source_count || !realpath(slot->file, sources[source_count].real)) {
+            continue;
+        }
+        sources[source_count].file = slot->file;
+        source_count++;
+    }
+    return source_count;
+}
+
+void cjit_relink_child(CJITState *cjit)
+{
+    close(cjit->relink_fd);
+    cjit->relink_fd = -1;
+    close(cjit->watch_fd);
+    cjit->watch_fd = -1;
+    prctl(PR_SET_PDEATHSIG, SIGTERM);
+}
+
+/**
+ * Compiles `src` again and links it in fresh memory over the program,
+ * then repoints the slots of its functions. Code of the program calling
+ * them or taking their address goes through the slots, so no other
+ * relocation of the program is applied again.
+ */
+static int relink(CJITState *cjit, Source *src)
+{
+    TCCState *prog = (TCCState *)cjit->TCC;
+    TCCState *unit = cjit_unit_new(cjit, src->file);
+    TCCState *image = tcc_new();
+    TierSlot *slots, *slots_end, *fresh, *slot;
+    char *contents = NULL;
+    int expected = 0;
+    int swapped = 0;
+
+    if (!cjit_read_source(cjit, src->file, &contents).ok
+        || tcc_compile_string(unit, contents) < 0) {
+        goto failed;
+    }
+    cjit_watch_note_deps(cjit, unit);
+    tcc_set_output_type(image, TCC_OUTPUT_MEMORY);
+    /* the runtime library is linked in the program already */
+    tcc_set_options(image, "-nostdlib");
+    if (tcc_add_object_state(image, unit) < 0
+        || tcc_relink_program(image, prog) < 0
+        || tcc_relocate(image) < 0) {
+        goto failed;
+    }
+    slots = tcc_get_symbol(image, "__start_cjit_tier");
+    slots_end = tcc_get_symbol(image, "__stop_cjit_tier");
+    for (slot = relink_slots; slot < relink_slots_end; slot++) {
+        if (strcmp(slot->file, src->file) != 0) {
+            continue;
+        }
+        expected++;
+        for (fresh = slots; slots && fresh < slots_end; fresh++) {
+            if (strcmp(slot->name, fresh->name) == 0) {
+                slot->target = fresh->target;
+                swapped++;
+                break;
+            }
+        }
+    }
+    if (swapped < expected) {
+        _err("Relink: %s lost functions the program may call", src->file);
+        goto failed;
+    }
+    free(contents);
+    tcc_delete(unit);
+    /* nothing runs in the build, the image linked last is unused */
+    if (src->image) {
+        tcc_delete(src->image);
+    }
+    src->image = image;
+    if (!cjit->quiet) {
+        _err("Relink: %s, %d functions repointed", src->file, swapped);
+    }
+    return 0;
+
+failed:
+    free(contents);
+    tcc_delete(unit);
+    tcc_delete(image);
+    _err("Relink: %s not relinked, building the program again", src->file);
+    return -1;
+}
+
+/**
+ * Links the sources listed in `changed` over the program, stopping at
+ * the first one that cannot be.
+ */
+static int relink_changes(CJITState *cjit, StringList *changed)
+{
+    size_t count = string_list_count(changed);
+    size_t c;
+    int i;
+
+    for (c = 0; c < count; c++) {
+        const char *path = string_list_get(changed, c);
+        for (i = 0; i < source_count && strcmp(sources[i].real, path) != 0; i++)
+            ;
+        if (i == source_count) {
+            if (!cjit->quiet) {
+                _err("Relink: %s is not a source with functions, "
+                     "building the program again", path);
+            }
+            return -1;
+        }
+        if (relink(cjit, &sources[i]) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int cjit_relink_wait(CJITState *cjit, int pid)
+{
+    StringList *changed = string_list_new();
+    char line[PATH_MAX];
+    size_t line_len = 0;
+    int running = 1;
+    int res = CJIT_WATCH_REBUILD;
+    int status;
+
+    for (;;) {
+        struct pollfd fd;
+        char buf[4096];
+        ssize_t n;
+        ssize_t i;
+
+        fd.fd = cjit->relink_fd;
+        fd.events = POLLIN;
+        if (poll(&fd, 1, running ? 100 : -1) < 0 && errno != EINTR) {
+            break;
+        }
+        if (running && waitpid(pid, &status, WNOHANG) == pid) {
+            running = 0;
+            cjit_watch_report(cjit, status);
+        }
+        if (!(fd.revents & (POLLIN | POLLHUP))) {
+            continue;
+        }
+        n = read(cjit->relink_fd, buf, sizeof(buf));
+        if (n == 0 || (n < 0 && errno != EINTR)) {
+            break; /* the watcher is gone */
+        }
+        for (i = 0; i < n; i++) {
+            if (buf[i] != '\n') {
+                if (line_len < sizeof(line) - 1) {
+                    line[line_len++] = buf[i];
+                }
+                continue;
+            }
+            line[line_len] = 0;
+            if (line_len) {
+                string_list_add(changed, line);
+                line_len = 0;
+                continue;
+            }
+            /* an empty line ends the changes of one save */
+            if (running) {
+                cjit_watch_stop(pid);
+            }
+            res = relink_changes(cjit, changed) < 0 ? CJIT_WATCH_REBUILD : 0;
+            string_list_free(&changed);
+            return res;
+        }
+    }
+    if (running) {
+        cjit_watch_stop(pid);
+    }
+    string_list_free(&changed);
+    return res;
+}
+
+#else
+
+int cjit_relink_prepare(CJITState *cjit)
+{
+    (void)cjit;
+    return 0;
+}
+
+void cjit_relink_child(CJITState *cjit)
+{
+    (void)cjit;
+}
+
+int cjit_relink_wait(CJITState *cjit, int pid)
+{
+    (void)cjit;
+    (void)pid;
+    _err("Relink: not supported on this platform");
+    return CJIT_WATCH_REBUILD;
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef CJIT_ADAPTERS_PLATFORM_RELINK_H
+#define CJIT_ADAPTERS_PLATFORM_RELINK_H
+
+#include "cjit.h"
+
+/**
+ * Records the sources of the relocated program, found through the entry
+ * slots emitted by `-ftiered`, so that `--watch --relink` can link them
+ * again one by one. Returns the number of sources recorded.
+ */
+int cjit_relink_prepare(CJITState *cjit);
+
+/**
+ * In the process forked to run the program: lets it go away with the
+ * build, which keeps the pipe from the watcher.
+ */
+void cjit_relink_child(CJITState *cjit);
+
+/**
+ * Waits for the program run in `pid` and for the watcher to send the
+ * sources changed. Then stops the program, compiles each of them again
+ * and links it over the program: its data get their new initial values
+ * and the slots of its functions point to the new code, while the rest
+ * of the program is left as it was linked. Returns 0 to run the program
+ * again, or CJIT_WATCH_REBUILD when some change needs a full build: a
+ * header, new or resized data, or a function gone.
+ */
+int cjit_relink_wait(CJITState *cjit, int pid);
+
+#endif
@@ -13,6 +13,10 @@
 #include "support/string_list.h"
 #include "adapters/platform/library_resolver_posix.h"
 #include "adapters/platform/library_resolver_windows.h"
+#include "adapters/compiler/layout_profile.h"
+#include "adapters/platform/hot_reload.h"
+#include "adapters/platform/relink.h"
+#include "adapters/platform/tier_runtime.h"
 
 #if defined(WINDOWS)
 extern void win_compat_usleep(unsigned int microseconds);
@@ -93,11 +97,49 @@ int cjit_platform_exec(CJITState *cjit, int (*entrypoint)(int, char **),
     return entrypoint(argc, argv);
 #else
     int res = 1;
-    pid_t pid;
+    pid_t pid = -1;
 
     cjit->done_exec = true;
-    pid = fork();
+    /* a --relink build stays to link the sources changed over the
+       program, and runs it in a child of its own each time */
+    while (cjit->relink_fd >= 0) {
+        fflush(NULL);
+        pid = fork();
+        if (pid == 0) {
+            cjit_relink_child(cjit);
+            write_pid_file(cjit, (long)getpid());
+            break;
+        }
+        if (pid < 0) {
+            _err("Cannot fork the program: %s", strerror(errno));
+            return 1;
+        }
+        res = cjit_relink_wait(cjit, (int)pid);
+        if (res != 0) {
+            return res;
+        }
+    }
+    if (pid != 0) {
+        /* or the child flushes output buffered here once more on exit */
+        fflush(NULL);
+        /* a --watch build is a child of the watcher already, run in it */
+        pid = cjit->watch_fd >= 0 ? 0 : fork();
+    }
     if (pid == 0) {
+        if (cjit->watch_fd >= 0) {
+            close(cjit->watch_fd);
+            cjit->watch_fd = -1;
+            write_pid_file(cjit, (long)getpid());
+        }
+        if (cjit->tiered) {
+            cjit_tier_start(cjit);
+        }
+        if (cjit->hot_reload) {
+            cjit_hot_reload_start(cjit);
+        }
+        if (cjit->layout) {
+            cjit_layout_start(cjit);
+        }
         res = entrypoint(argc, argv);
         exit(res);
     }
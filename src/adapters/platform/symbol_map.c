@@ -0,0 +1,533 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* dl_iterate_phdr */
+#endif
+#include "adapters/platform/symbol_map.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libtcc.h"
+
+#if defined(LINUX) && !defined(SHAREDTCC)
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MAP_MAGIC "cjit-symmap 1\n"
+
+/* most libraries a program may have loaded */
+#define MAP_OBJECTS 512
+
+/**
+ * A map file holds its header, the text naming the libraries it was
+ * built from, an open addressing hash table of MapSlot and the entries
+ * the slots point to. Slots are small so the table stays in cache.
+ */
+typedef struct MapHeader {
+    char magic[16];
+    uint32_t objects;       /* libraries, in the order dlsym() searches */
+    uint32_t slots;         /* entries of the table, a power of two */
+    uint32_t key_size;      /* bytes of the text naming the libraries */
+    uint32_t entries_size;  /* bytes of the entries */
+} MapHeader;
+
+typedef struct MapSlot {
+    uint32_t hash;          /* 0 when the slot is free */
+    uint32_t entry;         /* offset of its MapEntry */
+} MapSlot;
+
+typedef struct MapEntry {
+    uint64_t value;         /* address from the load base of the library */
+    uint32_t object;        /* index of the library defining it */
+    char name[];
+} MapEntry;
+
+typedef struct LoadedObject {
+    const char *path;
+    ElfW(Addr) base;
+    const ElfW(Phdr) *phdr;
+    ElfW(Half) phnum;
+} LoadedObject;
+
+typedef struct ObjectList {
+    LoadedObject obj[MAP_OBJECTS];
+    int count;
+    char exe[PATH_MAX];
+} ObjectList;
+
+typedef struct Buffer {
+    char *data;
+    size_t size;
+    size_t allocated;
+} Buffer;
+
+static int buffer_add(Buffer *b, const void *data, size_t len)
+{
+    if (b->size + len > b->allocated) {
+        size_t allocated = b->allocated ? b->allocated : 4096;
+        char *grown;
+
+        while (b->size + len > allocated) {
+            allocated *= 2;
+        }
+        grown = realloc(b->data, allocated);
+        if (!grown) {
+            return 0;
+        }
+        b->data = grown;
+        b->allocated = allocated;
+    }
+    memcpy(b->data + b->size, data, len);
+    b->size += len;
+    return 1;
+}
+
+/* the hash of ELF GNU_HASH sections, never 0 */
+static uint32_t name_hash(const char *name)
+{
+    uint32_t h = 5381;
+
+    while (*name) {
+        h = h * 33 + (unsigned char)*name++;
+    }
+    return h ? h : 1;
+}
+
+static int add_object(struct dl_phdr_info *info, size_t size, void *opaque)
+{
+    ObjectList *list = (ObjectList *)opaque;
+    LoadedObject *o;
+    const char *path = info->dlpi_name;
+
+    (void)size;
+    if (list->count == 0 && (!path || !*path)) {
+        /* the executable, searched first */
+        ssize_t len = readlink("/proc/self/exe", list->exe, sizeof(list->exe) - 1);
+        if (len <= 0) {
+            return 1;
+        }
+        list->exe[len] = 0;
+        path = list->exe;
+    } else if (!path || !*path || access(path, R_OK) != 0) {
+        return 0; /* the vdso */
+    }
+    if (list->count == MAP_OBJECTS) {
+        list->count = -1;
+        return 1;
+    }
+    o = &list->obj[list->count++];
+    o->path = path;
+    o->base = info->dlpi_addr;
+    o->phdr = info->dlpi_phdr;
+    o->phnum = info->dlpi_phnum;
+    return 0;
+}
+
+/**
+ * Names the libraries in `list`, one line each with their modification
+ * time and size. Returns 0 when one is gone.
+ */
+static int objects_key(const ObjectList *list, Buffer *key)
+{
+    char line[PATH_MAX + 64];
+    struct stat st;
+    int i, len;
+
+    for (i = 0; i < list->count; i++) {
+        if (stat(list->obj[i].path, &st) != 0) {
+            return 0;
+        }
+        len = snprintf(line, sizeof(line), "%s\t%lld\t%lld\n", list->obj[i].path,
+                       (long long)st.st_mtime, (long long)st.st_size);
+        if (len <= 0 || len >= (int)sizeof(line) || !buffer_add(key, line, (size_t)len)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+typedef struct DynamicSymbols {
+    const ElfW(Sym) *syms;
+    const char *strtab;
+    const ElfW(Versym) *versym;
+    size_t count;
+} DynamicSymbols;
+
+/* glibc relocates the pointers of the dynamic section, musl does not */
+static const void *dynamic_pointer(const LoadedObject *o, ElfW(Addr) ptr)
+{
+    return (const void *)(ptr < o->base ? o->base + ptr : ptr);
+}
+
+static size_t gnu_hash_count(const uint32_t *gnu_hash)
+{
+    uint32_t nbuckets = gnu_hash[0];
+    uint32_t symoffset = gnu_hash[1];
+    const ElfW(Addr) *bloom = (const ElfW(Addr) *)(gnu_hash + 4);
+    const uint32_t *buckets = (const uint32_t *)(bloom + gnu_hash[2]);
+    const uint32_t *chain = buckets + nbuckets;
+    uint32_t last = 0;
+    uint32_t i;
+
+    for (i = 0; i < nbuckets; i++) {
+        if (buckets[i] > last) {
+            last = buckets[i];
+        }
+    }
+    if (last < symoffset) {
+        return symoffset;
+    }
+    while (!(chain[last - symoffset] & 1)) {
+        last++;
+    }
+    return (size_t)last + 1;
+}
+
+static int dynamic_symbols(const LoadedObject *o, DynamicSymbols *ds)
+{
+    const ElfW(Dyn) *dyn = NULL;
+    int i;
+
+    memset(ds, 0, sizeof(*ds));
+    for (i = 0; i < o->phnum; i++) {
+        if (o->phdr[i].p_type == PT_DYNAMIC) {
+            dyn = (const ElfW(Dyn) *)(o->base + o->phdr[i].p_vaddr);
+        }
+    }
+    for (; dyn && dyn->d_tag != DT_NULL; dyn++) {
+        switch (dyn->d_tag) {
+        case DT_SYMTAB:
+            ds->syms = dynamic_pointer(o, dyn->d_un.d_ptr);
+            break;
+        case DT_STRTAB:
+            ds->strtab = dynamic_pointer(o, dyn->d_un.d_ptr);
+            break;
+        case DT_VERSYM:
+            ds->versym = dynamic_pointer(o, dyn->d_un.d_ptr);
+            break;
+        case DT_HASH:
+            ds->count = ((const uint32_t *)dynamic_pointer(o, dyn->d_un.d_ptr))[1];
+            break;
+        case DT_GNU_HASH:
+            if (!ds->count) {
+                ds->count = gnu_hash_count(dynamic_pointer(o, dyn->d_un.d_ptr));
+            }
+            break;
+        }
+    }
+    return ds->syms && ds->strtab;
+}
+
+/**
+ * True for the symbols dlsym() would return as the load base plus their
+ * value: defined, global, of the default version and neither TLS nor
+ * IFUNC, which need the dynamic linker.
+ */
+static int plain_symbol(const DynamicSymbols *ds, size_t i)
+{
+    const ElfW(Sym) *sym = &ds->syms[i];
+    /* st_info reads the same in both ELF classes */
+    int bind = ELF32_ST_BIND(sym->st_info);
+    int type = ELF32_ST_TYPE(sym->st_info);
+
+    if (sym->st_shndx == SHN_UNDEF || sym->st_shndx == SHN_ABS || !sym->st_name) {
+        return 0;
+    }
+    if (bind != STB_GLOBAL && bind != STB_WEAK && bind != STB_GNU_UNIQUE) {
+        return 0;
+    }
+    if (type != STT_FUNC && type != STT_OBJECT && type != STT_NOTYPE && type != STT_COMMON) {
+        return 0;
+    }
+    return !ds->versym || ((ds->versym[i] & 0x8000) == 0 && ds->versym[i] != 0);
+}
+
+static const MapEntry *map_entry(const char *entries, uint32_t offset)
+{
+    return (const MapEntry *)(entries + offset);
+}
+
+static int map_insert(MapSlot *slots, uint32_t mask, Buffer *entries,
+                      const char *name, uint32_t object, uint64_t value)
+{
+    static const char pad[8];
+    uint32_t hash = name_hash(name);
+    uint32_t i = hash & mask;
+    MapEntry entry;
+    size_t head = offsetof(MapEntry, name);
+    size_t len = strlen(name) + 1;
+
+    for (; slots[i].hash; i = (i + 1) & mask) {
+        if (slots[i].hash == hash
+            && strcmp(map_entry(entries->data, slots[i].entry)->name, name) == 0) {
+            return 1; /* an earlier library defines it */
+        }
+    }
+    slots[i].hash = hash;
+    slots[i].entry = (uint32_t)entries->size;
+    memset(&entry, 0, sizeof(entry));
+    entry.value = value;
+    entry.object = object;
+    return buffer_add(entries, &entry, head)
+        && buffer_add(entries, name, len)
+        && buffer_add(entries, pad, -(head + len) & 7);
+}
+
+static size_t slots_offset(uint32_t key_size)
+{
+    return (sizeof(MapHeader) + key_size + 7) & ~(size_t)7;
+}
+
+/**
+ * Builds the map of the dynamic symbols of `list`, laid out as the
+ * file that caches it. Returns NULL on failure.
+ */
+static char *map_build(const ObjectList *list, const Buffer *key, size_t *size)
+{
+    DynamicSymbols ds[MAP_OBJECTS];
+    Buffer entries = {0};
+    MapHeader header;
+    MapSlot *slots;
+    size_t total = 0, at, i;
+    uint32_t nslots = 16;
+    char *map = NULL;
+    int o;
+
+    for (o = 0; o < list->count; o++) {
+        if (!dynamic_symbols(&list->obj[o], &ds[o])) {
+            ds[o].count = 0;
+        }
+        total += ds[o].count;
+    }
+    while (nslots < 2 * total) {
+        nslots *= 2;
+    }
+    slots = calloc(nslots, sizeof(MapSlot));
+    if (!slots) {
+        goto done;
+    }
+    for (o = 0; o < list->count; o++) {
+        for (i = 0; i < ds[o].count; i++) {
+            if (plain_symbol(&ds[o], i)
+                && !map_insert(slots, nslots - 1, &entries, ds[o].strtab + ds[o].syms[i].st_name,
+                               (uint32_t)o, ds[o].syms[i].st_value)) {
+                goto done;
+            }
+        }
+    }
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAP_MAGIC, sizeof(MAP_MAGIC) - 1);
+    header.objects = (uint32_t)list->count;
+    header.slots = nslots;
+    header.key_size = (uint32_t)key->size;
+    header.entries_size = (uint32_t)entries.size;
+    at = slots_offset(header.key_size);
+    *size = at + nslots * sizeof(MapSlot) + entries.size;
+    map = calloc(1, *size);
+    if (map) {
+        memcpy(map, &header, sizeof(header));
+        memcpy(map + sizeof(header), key->data, key->size);
+        memcpy(map + at, slots, nslots * sizeof(MapSlot));
+        memcpy(map + at + nslots * sizeof(MapSlot), entries.data, entries.size);
+    }
+done:
+    free(slots);
+    free(entries.data);
+    return map;
+}
+
+/* true when `map` of `size` bytes was built from the libraries in `key` */
+static int map_valid(const char *map, size_t size, const Buffer *key)
+{
+    const MapHeader *header = (const MapHeader *)map;
+
+    return size >= sizeof(MapHeader)
+        && memcmp(header->magic, MAP_MAGIC, sizeof(MAP_MAGIC) - 1) == 0
+        && header->key_size == key->size
+        && size == slots_offset(header->key_size)
+                   + (size_t)header->slots * sizeof(MapSlot) + header->entries_size
+        && memcmp(map + sizeof(MapHeader), key->data, key->size) == 0;
+}
+
+static int map_path(CJITState *cjit, const Buffer *key, char *path, size_t size)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+    size_t i;
+    int len;
+
+    for (i = 0; i < key->size; i++) {
+        h = (h ^ (unsigned char)key->data[i]) * 0x100000001b3ULL;
+    }
+    len = snprintf(path, size, "%s/symbols", cjit->tmpdir);
+    if (len <= 0 || (size_t)len >= size || (mkdir(path, 0755) != 0 && errno != EEXIST)) {
+        return 0;
+    }
+    len = snprintf(path, size, "%s/symbols/%016llx.map", cjit->tmpdir, (unsigned long long)h);
+    return len > 0 && (size_t)len < size;
+}
+
+static char *map_open(const char *path, const Buffer *key, size_t *size)
+{
+    struct stat st;
+    char *map;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(MapHeader)) {
+        close(fd);
+        return NULL;
+    }
+    *size = (size_t)st.st_size;
+    map = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+    if (!map_valid(map, *size, key)) {
+        munmap(map, *size);
+        return NULL;
+    }
+    return map;
+}
+
+static void map_store(const char *path, const char *map, size_t size)
+{
+    char tmp[PATH_MAX + 64];
+    FILE *f;
+
+    snprintf(tmp, sizeof(tmp), "%s-%ld.tmp", path, (long)getpid());
+    f = fopen(tmp, "wb");
+    if (!f) {
+        return;
+    }
+    if (fwrite(map, 1, size, f) != size) {
+        fclose(f);
+        unlink(tmp);
+    } else if (fclose(f) != 0 || rename(tmp, path) != 0) {
+        unlink(tmp);
+    }
+}
+
+/**
+ * Looks up all `names` at once, in passes that first prefetch the slots
+ * and then the entries of every name, so that the cache misses of the
+ * lookups overlap instead of coming one after the other.
+ */
+static int map_lookup(const char *map, const ObjectList *list,
+                      int count, const char **names, void **addrs)
+{
+    const MapHeader *header = (const MapHeader *)map;
+    const MapSlot *slots = (const MapSlot *)(map + slots_offset(header->key_size));
+    const char *entries = (const char *)(slots + header->slots);
+    uint32_t mask = header->slots - 1;
+    uint32_t *hash = malloc((size_t)count * sizeof(uint32_t));
+    uint32_t *at = malloc((size_t)count * sizeof(uint32_t));
+    int found = 0, i;
+
+    if (!hash || !at) {
+        free(hash);
+        free(at);
+        return 0;
+    }
+    for (i = 0; i < count; i++) {
+        hash[i] = name_hash(names[i]);
+        __builtin_prefetch(&slots[hash[i] & mask]);
+    }
+    for (i = 0; i < count; i++) {
+        uint32_t j = hash[i] & mask;
+
+        while (slots[j].hash && slots[j].hash != hash[i]) {
+            j = (j + 1) & mask;
+        }
+        at[i] = j;
+        if (slots[j].hash) {
+            __builtin_prefetch(map_entry(entries, slots[j].entry));
+        }
+    }
+    for (i = 0; i < count; i++) {
+        uint32_t j = at[i];
+        const MapEntry *entry;
+
+        for (; slots[j].hash; j = (j + 1) & mask) {
+            entry = map_entry(entries, slots[j].entry);
+            if (slots[j].hash == hash[i] && strcmp(entry->name, names[i]) == 0) {
+                addrs[i] = (void *)(list->obj[entry->object].base + entry->value);
+                found++;
+                break;
+            }
+        }
+    }
+    free(hash);
+    free(at);
+    return found;
+}
+
+static void resolve(void *opaque, int count, const char **names, void **addrs)
+{
+    CJITState *cjit = (CJITState *)opaque;
+    ObjectList *list;
+    Buffer key = {0};
+    char path[PATH_MAX + 32];
+    char *map = NULL;
+    size_t size = 0;
+    int cached = 0, found;
+
+    if (count < CJIT_SYMBOL_MAP_MIN || !(list = calloc(1, sizeof(ObjectList)))) {
+        return;
+    }
+    dl_iterate_phdr(add_object, list);
+    if (list->count <= 0 || !objects_key(list, &key)) {
+        goto done;
+    }
+    if (cjit->tmpdir && map_path(cjit, &key, path, sizeof(path))) {
+        map = map_open(path, &key, &size);
+        cached = map != NULL;
+    }
+    if (!map) {
+        map = map_build(list, &key, &size);
+        if (map && cjit->tmpdir && map_path(cjit, &key, path, sizeof(path))) {
+            map_store(path, map, size);
+        }
+    }
+    if (!map) {
+        goto done;
+    }
+    found = map_lookup(map, list, count, names, addrs);
+    if (cjit->verbose) {
+        _err("Resolved %d of %d symbols from the %s symbol map of %d libraries",
+             found, count, cached ? "cached" : "new", list->count);
+    }
+    if (cached) {
+        munmap(map, size);
+    } else {
+        free(map);
+    }
+done:
+    free(key.data);
+    free(list);
+}
+
+void cjit_symbol_map_attach(CJITState *cjit, struct TCCState *tcc)
+{
+    tcc_set_resolve_func(tcc, cjit, resolve);
+}
+
+#else
+
+void cjit_symbol_map_attach(CJITState *cjit, struct TCCState *tcc)
+{
+    (void)cjit;
+    (void)tcc;
+}
+
+#endif
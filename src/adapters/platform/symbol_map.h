@@ -0,0 +1,28 @@
+#ifndef CJIT_ADAPTERS_PLATFORM_SYMBOL_MAP_H
+#define CJIT_ADAPTERS_PLATFORM_SYMBOL_MAP_H
+
+#include "cjit.h"
+
+struct TCCState;
+
+/**
+ * Fewest undefined symbols a program needs for the symbol map to be
+ * used: below that, looking each up with dlsym() costs less than
+ * finding the map.
+ */
+#define CJIT_SYMBOL_MAP_MIN 256
+
+/**
+ * Makes `tcc` resolve the undefined symbols of the program in one batch
+ * when relocating it in memory, from a single hash map of the dynamic
+ * symbols exported by cjit, libc and the libraries loaded for the
+ * program. The map is kept under `$TMPDIR/cjit/<VERSION>/symbols`,
+ * keyed by the path and modification time of each library, so later
+ * runs over the same libraries only map it in. Symbols it does not hold
+ * (TLS, IFUNC, versions other than the default) go to dlsym() as before,
+ * as do all symbols of programs needing fewer than CJIT_SYMBOL_MAP_MIN.
+ * Does nothing where the map is not supported.
+ */
+void cjit_symbol_map_attach(CJITState *cjit, struct TCCState *tcc);
+
+#endif
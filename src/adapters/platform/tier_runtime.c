@@ -0,0 +1,193 @@
+#include "adapters/platform/tier_runtime.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libtcc.h"
+#include "support/string_list.h"
+
+#if !defined(WINDOWS)
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+extern char **environ;
+
+static TierSlot *tier_slots;
+static TierSlot *tier_slots_end;
+static CJITState *tier_cjit;
+
+int cjit_tier_prepare(CJITState *cjit)
+{
+    TCCState *tcc = (TCCState *)cjit->TCC;
+
+    tier_slots = tcc_get_symbol(tcc, "__start_cjit_tier");
+    tier_slots_end = tcc_get_symbol(tcc, "__stop_cjit_tier");
+    if (!tier_slots || !tier_slots_end) {
+        tier_slots = tier_slots_end = NULL;
+        if (cjit->verbose) {
+            _err("Tiered execution: no entry slots, compiler lacks -ftiered");
+        }
+        return 0;
+    }
+    tier_cjit = cjit;
+    return (int)(tier_slots_end - tier_slots);
+}
+
+/**
+ * Builds `file` into a shared object with the host compiler.
+ */
+static int tier_build(const char *file, const char *out)
+{
+    const char *cc = getenv("CC");
+    StringList *args = string_list_new();
+    posix_spawn_file_actions_t actions;
+    pid_t pid;
+    int status = -1;
+    size_t i;
+    size_t count;
+    char **argv;
+
+    if (!cc || !*cc) {
+        cc = "cc";
+    }
+    string_list_add(args, cc);
+    string_list_add(args, "-O2");
+    string_list_add(args, "-shared");
+    string_list_add(args, "-fPIC");
+    string_list_add(args, "-w");
+    count = string_list_count(tier_cjit->ccflags);
+    for (i = 0; i < count; i++) {
+        string_list_add(args, string_list_get(tier_cjit->ccflags, i));
+    }
+    string_list_add(args, "-o");
+    string_list_add(args, out);
+    string_list_add(args, file);
+
+    count = string_list_count(args);
+    argv = calloc(count + 1, sizeof(char *));
+    for (i = 0; i < count; i++) {
+        argv[i] = string_list_get(args, i);
+    }
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+    if (posix_spawnp(&pid, cc, &actions, NULL, argv, environ) == 0) {
+        while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+            ;
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    free(argv);
+    string_list_free(&args);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * Recompiles the unit `file` and repoints the slots of its eligible
+ * functions to the native code.
+ */
+static void tier_up(const char *file)
+{
+    static int serial;
+    char out[PATH_MAX];
+    void *handle = NULL;
+    TierSlot *slot;
+
+    for (slot = tier_slots; slot < tier_slots_end; slot++) {
+        if (strcmp(slot->file, file) == 0) {
+            slot->flags |= TIER_ATTEMPTED;
+        }
+    }
+    if (access(file, R_OK) != 0) {
+        return;
+    }
+    snprintf(out, sizeof(out), "%s/tier-%ld-%d.so",
+             tier_cjit->tmpdir ? tier_cjit->tmpdir : "/tmp", (long)getpid(), serial++);
+    if (tier_build(file, out)) {
+        handle = dlopen(out, RTLD_NOW | RTLD_LOCAL);
+    }
+    unlink(out);
+    if (!handle) {
+        if (tier_cjit->verbose) {
+            _err("Tiered execution: could not build %s with the host compiler", file);
+        }
+        return;
+    }
+    for (slot = tier_slots; slot < tier_slots_end; slot++) {
+        void *native;
+        if (!(slot->flags & TIER_ELIGIBLE) || strcmp(slot->file, file) != 0) {
+            continue;
+        }
+        native = dlsym(handle, slot->name);
+        if (native) {
+            __atomic_store_n(&slot->target, native, __ATOMIC_RELEASE);
+            if (tier_cjit->verbose) {
+                _err("Tiered execution: %s now runs native code", slot->name);
+            }
+        }
+    }
+}
+
+static void *tier_thread(void *arg)
+{
+    struct timespec pause = { 0, 20 * 1000 * 1000 };
+    uintptr_t threshold = CJIT_TIER_THRESHOLD;
+    const char *env = getenv("CJIT_TIER_THRESHOLD");
+    TierSlot *slot;
+    int pending;
+
+    (void)arg;
+    if (env && atol(env) > 0) {
+        threshold = (uintptr_t)atol(env);
+    }
+    do {
+        nanosleep(&pause, NULL);
+        pending = 0;
+        for (slot = tier_slots; slot < tier_slots_end; slot++) {
+            if ((slot->flags & (TIER_ELIGIBLE | TIER_ATTEMPTED)) != TIER_ELIGIBLE) {
+                continue;
+            }
+            if (__atomic_load_n(&slot->count, __ATOMIC_RELAXED) >= threshold) {
+                tier_up(slot->file);
+            } else {
+                pending = 1;
+            }
+        }
+    } while (pending);
+    return NULL;
+}
+
+void cjit_tier_start(CJITState *cjit)
+{
+    pthread_t thread;
+
+    if (!tier_slots || tier_cjit != cjit) {
+        return;
+    }
+    if (pthread_create(&thread, NULL, tier_thread, NULL) == 0) {
+        pthread_detach(thread);
+    } else if (cjit->verbose) {
+        _err("Tiered execution: cannot start the compiler thread");
+    }
+}
+
+#else
+
+int cjit_tier_prepare(CJITState *cjit)
+{
+    (void)cjit;
+    return 0;
+}
+
+void cjit_tier_start(CJITState *cjit)
+{
+    (void)cjit;
+}
+
+#endif
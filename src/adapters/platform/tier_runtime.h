@@ -0,0 +1,43 @@
+#ifndef CJIT_ADAPTERS_PLATFORM_TIER_RUNTIME_H
+#define CJIT_ADAPTERS_PLATFORM_TIER_RUNTIME_H
+
+#include <stdint.h>
+
+#include "cjit.h"
+
+/**
+ * One record per function with external linkage, laid out by tinycc's
+ * `-ftiered` code generator (TIER_RECORD_SIZE in lib/tinycc/tcc.h).
+ * Calls go through `target`, which the runtime may repoint at any time.
+ */
+typedef struct TierSlot {
+    void *target;
+    uintptr_t count;
+    const char *name;
+    const char *file;
+    uintptr_t flags;
+} TierSlot;
+
+#define TIER_ELIGIBLE 1 /* set by the compiler */
+#define TIER_ATTEMPTED 2 /* set by the runtime once its unit was handed to cc */
+
+/**
+ * Default number of calls after which a function is considered hot,
+ * overridden by the CJIT_TIER_THRESHOLD environment variable.
+ */
+#define CJIT_TIER_THRESHOLD 1000
+
+/**
+ * Looks up the entry slots emitted by `-ftiered` in the relocated
+ * program. Returns the number of slots found.
+ */
+int cjit_tier_prepare(CJITState *cjit);
+
+/**
+ * Starts the background thread that recompiles hot translation units
+ * with the host C compiler and repoints their slots. Must be called in
+ * the process that runs the program.
+ */
+void cjit_tier_start(CJITState *cjit);
+
+#endif
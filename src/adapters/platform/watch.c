@@ -0,0 +1,435 @@
+#include "adapters/platform/watch.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libtcc.h"
+#include "support/cwalk.h"
+#include "support/string_list.h"
+
+#if !defined(WINDOWS)
+#include <unistd.h>
+
+void cjit_watch_note(CJITState *cjit, const char *path)
+{
+    char line[PATH_MAX + 1];
+    int len;
+
+    if (cjit->watch_fd < 0) {
+        return;
+    }
+    len = snprintf(line, sizeof(line), "%s\n", path);
+    /* one write per line, notes come from several compiler threads */
+    if (len > 0 && len < (int)sizeof(line)) {
+        (void)!write(cjit->watch_fd, line, (size_t)len);
+    }
+}
+
+static void note_dep(void *opaque, const char *filename)
+{
+    cjit_watch_note((CJITState *)opaque, filename);
+}
+
+void cjit_watch_note_deps(CJITState *cjit, struct TCCState *tcc)
+{
+    if (cjit->watch_fd >= 0) {
+        tcc_list_deps(tcc, cjit, note_dep);
+    }
+}
+
+#else
+
+void cjit_watch_note(CJITState *cjit, const char *path)
+{
+    (void)cjit;
+    (void)path;
+}
+
+void cjit_watch_note_deps(CJITState *cjit, struct TCCState *tcc)
+{
+    (void)cjit;
+    (void)tcc;
+}
+
+#endif
+
+#if defined(LINUX)
+#include <poll.h>
+#include <signal.h>
+#include <sys/inotify.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <time.h>
+
+#define WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_ATTRIB)
+
+/**
+ * Files of the last build, watched through their directories so that
+ * editors replacing a file on save are seen too.
+ */
+typedef struct Watcher {
+    int inotify;
+    int notes;             /* read end of the pipe from the build */
+    StringList *files;     /* real paths reported by the build */
+    StringList *dirs;      /* directories watched, by index of wds */
+    int *wds;
+    char line[PATH_MAX];   /* note read in part */
+    size_t line_len;
+    char changed[PATH_MAX];
+    StringList *changes;   /* files changed since the last build or relink */
+    int relink;            /* --relink: write end of the pipe to the build */
+} Watcher;
+
+static int list_index(const StringList *list, const char *value)
+{
+    size_t count = string_list_count(list);
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        if (strcmp(string_list_get(list, i), value) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void watch_file(Watcher *w, const char *path)
+{
+    char real[PATH_MAX];
+    char dir[PATH_MAX];
+    size_t length;
+    int wd;
+
+    if (!realpath(path, real) || list_index(w->files, real) >= 0) {
+        return;
+    }
+    string_list_add(w->files, real);
+    cwk_path_get_dirname(real, &length);
+    if (!length || length >= sizeof(dir)) {
+        return;
+    }
+    memcpy(dir, real, length);
+    dir[length > 1 ? length - 1 : length] = 0; /* without the separator */
+    if (list_index(w->dirs, dir) >= 0) {
+        return;
+    }
+    wd = inotify_add_watch(w->inotify, dir, WATCH_EVENTS);
+    if (wd < 0) {
+        return;
+    }
+    w->wds = realloc(w->wds, (string_list_count(w->dirs) + 1) * sizeof(int));
+    w->wds[string_list_count(w->dirs)] = wd;
+    string_list_add(w->dirs, dir);
+}
+
+/**
+ * Reads the files noted by the build. Closes the pipe at its end.
+ */
+static void watch_read_notes(Watcher *w)
+{
+    char buf[4096];
+    ssize_t n = read(w->notes, buf, sizeof(buf));
+    ssize_t i;
+
+    if (n <= 0) {
+        if (n == 0 || errno != EINTR) {
+            close(w->notes);
+            w->notes = -1;
+        }
+        return;
+    }
+    for (i = 0; i < n; i++) {
+        if (buf[i] == '\n') {
+            w->line[w->line_len] = 0;
+            watch_file(w, w->line);
+            w->line_len = 0;
+        } else if (w->line_len < sizeof(w->line) - 1) {
+            w->line[w->line_len++] = buf[i];
+        }
+    }
+}
+
+/**
+ * Returns 1 when some inotify event concerns a file of the build.
+ */
+static int watch_read_events(Watcher *w)
+{
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    char path[PATH_MAX];
+    ssize_t n = read(w->inotify, buf, sizeof(buf));
+    size_t count = string_list_count(w->dirs);
+    const struct inotify_event *ev;
+    char *p;
+    size_t d;
+    int hit = 0;
+
+    for (p = buf; n > 0 && p < buf + n; p += sizeof(struct inotify_event) + ev->len) {
+        ev = (const struct inotify_event *)p;
+        if (!ev->len) {
+            continue;
+        }
+        for (d = 0; d < count && w->wds[d] != ev->wd; d++)
+            ;
+        if (d == count) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", string_list_get(w->dirs, d), ev->name);
+        if (list_index(w->files, path) >= 0) {
+            snprintf(w->changed, sizeof(w->changed), "%s", path);
+            if (list_index(w->changes, path) < 0) {
+                string_list_add(w->changes, path);
+            }
+            hit = 1;
+        }
+    }
+    return hit;
+}
+
+/**
+ * Sends the files changed to the build, one per line and an empty line
+ * after the last. Returns 0 when the build cannot be reached.
+ */
+static int watch_send_changes(Watcher *w)
+{
+    size_t count = string_list_count(w->changes);
+    size_t len = 0;
+    size_t i;
+    char *batch;
+    int ok;
+
+    for (i = 0; i < count; i++) {
+        len += strlen(string_list_get(w->changes, i)) + 1;
+    }
+    batch = malloc(len + 1);
+    for (i = len = 0; i < count; i++) {
+        len += (size_t)sprintf(batch + len, "%s\n", string_list_get(w->changes, i));
+    }
+    batch[len++] = '\n';
+    ok = write(w->relink, batch, len) == (ssize_t)len;
+    free(batch);
+    return ok;
+}
+
+static pid_t watch_build(CJITState *cjit, Watcher *w, int argc, char **argv,
+                         CJITWatchRun run)
+{
+    int fds[2];
+    int relink[2] = { -1, -1 };
+    pid_t pid;
+
+    if (pipe(fds) != 0) {
+        return -1;
+    }
+    if (cjit->relink && pipe(relink) != 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    fflush(NULL);
+    pid = fork();
+    if (pid == 0) {
+        CJITState *child;
+        close(fds[0]);
+        close(w->inotify);
+        if (relink[1] >= 0) {
+            close(relink[1]);
+        }
+        /* the program goes away with the watcher */
+        prctl(PR_SET_PDEATHSIG, SIGTERM);
+        signal(SIGPIPE, SIG_DFL);
+        child = cjit_new();
+        if (!child) {
+            _exit(1);
+        }
+        child->watch_fd = fds[1];
+        child->relink_fd = relink[0];
+        exit(run(child, argc, argv));
+    }
+    close(fds[1]);
+    if (relink[0] >= 0) {
+        close(relink[0]);
+    }
+    if (pid < 0) {
+        close(fds[0]);
+        if (relink[1] >= 0) {
+            close(relink[1]);
+        }
+        return -1;
+    }
+    w->notes = fds[0];
+    w->relink = relink[1];
+    w->line_len = 0;
+    string_list_free(&w->files);
+    w->files = string_list_new();
+    return pid;
+}
+
+void cjit_watch_stop(int pid)
+{
+    struct timespec pause = { 0, 10 * 1000 * 1000 };
+    int status;
+    int i;
+
+    kill(pid, SIGTERM);
+    for (i = 0; i < 100; i++) {
+        if (waitpid(pid, &status, WNOHANG) == pid) {
+            return;
+        }
+        nanosleep(&pause, NULL);
+    }
+    kill(pid, SIGKILL);
+    waitpid(pid, &status, 0);
+}
+
+void cjit_watch_report(CJITState *cjit, int status)
+{
+    if (cjit->quiet) {
+        return;
+    }
+    if (WIFSIGNALED(status)) {
+        _err("Watch: terminated with signal %d, waiting for changes", WTERMSIG(status));
+    } else {
+        _err("Watch: exited with status %d, waiting for changes", WEXITSTATUS(status));
+    }
+}
+
+int cjit_watch_run(CJITState *cjit, int argc, char **argv, CJITWatchRun run)
+{
+    Watcher w;
+    char **args = calloc((size_t)argc + 1, sizeof(char *));
+    int count = 0;
+    int options = 1;
+    int i;
+
+    memset(&w, 0, sizeof(w));
+    w.inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (w.inotify < 0) {
+        _err("Watch: cannot use inotify: %s", strerror(errno));
+        free(args);
+        return 1;
+    }
+    /* the builds run the same command line, without --watch */
+    for (i = 0; i < argc; i++) {
+        if (options && strcmp(argv[i], "--watch") == 0) {
+            continue;
+        }
+        if (strcmp(argv[i], "--") == 0) {
+            options = 0;
+        }
+        args[count++] = argv[i];
+    }
+    w.files = string_list_new();
+    w.dirs = string_list_new();
+    w.changes = string_list_new();
+    w.relink = -1;
+    if (cjit->relink) {
+        /* a write to a build gone must not end the watcher */
+        signal(SIGPIPE, SIG_IGN);
+    }
+    for (;;) {
+        pid_t pid = watch_build(cjit, &w, count, args, run);
+        int running = pid > 0;
+        int changed = 0;
+        int status;
+
+        if (pid < 0) {
+            _err("Watch: cannot fork the build: %s", strerror(errno));
+            break;
+        }
+        for (;;) {
+            struct pollfd fds[2];
+            int n;
+
+            fds[0].fd = w.inotify;
+            fds[0].events = POLLIN;
+            fds[1].fd = w.notes;
+            fds[1].events = POLLIN;
+            n = poll(fds, w.notes >= 0 ? 2 : 1,
+                     changed ? CJIT_WATCH_DEBOUNCE : running ? 100 : -1);
+            if (n < 0 && errno != EINTR) {
+                break;
+            }
+            if (n > 0 && w.notes >= 0 && fds[1].revents) {
+                watch_read_notes(&w);
+            }
+            if (n > 0 && (fds[0].revents & POLLIN)) {
+                changed |= watch_read_events(&w);
+                continue;
+            }
+            if (n == 0 && changed) {
+                /* a --relink build links the changes over its program */
+                if (running && w.relink >= 0 && watch_send_changes(&w)) {
+                    string_list_free(&w.changes);
+                    w.changes = string_list_new();
+                    changed = 0;
+                    continue;
+                }
+                break;
+            }
+            if (running && waitpid(pid, &status, WNOHANG) == pid) {
+                running = 0;
+                if (w.relink >= 0 && WIFEXITED(status)
+                    && WEXITSTATUS(status) == CJIT_WATCH_REBUILD) {
+                    changed = 1;
+                    break;
+                }
+                /* a --relink build tells how its own runs exited */
+                cjit_watch_report(cjit, status);
+            }
+        }
+        if (running) {
+            cjit_watch_stop(pid);
+        }
+        if (w.notes >= 0) {
+            close(w.notes);
+            w.notes = -1;
+        }
+        if (w.relink >= 0) {
+            close(w.relink);
+            w.relink = -1;
+        }
+        if (!changed) {
+            break;
+        }
+        if (!cjit->quiet) {
+            _err("Watch: %s changed, restarting", w.changed);
+        }
+        string_list_free(&w.changes);
+        w.changes = string_list_new();
+    }
+    close(w.inotify);
+    string_list_free(&w.changes);
+    string_list_free(&w.files);
+    string_list_free(&w.dirs);
+    free(w.wds);
+    free(args);
+    return 1;
+}
+
+#else
+
+int cjit_watch_run(CJITState *cjit, int argc, char **argv, CJITWatchRun run)
+{
+    (void)cjit;
+    (void)argc;
+    (void)argv;
+    (void)run;
+    _err("Watch: not supported on this platform, use -p with an external watcher");
+    return 1;
+}
+
+void cjit_watch_stop(int pid)
+{
+    (void)pid;
+}
+
+void cjit_watch_report(CJITState *cjit, int status)
+{
+    (void)cjit;
+    (void)status;
+}
+
+#endif
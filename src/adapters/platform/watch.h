@@ -0,0 +1,59 @@
+#ifndef CJIT_ADAPTERS_PLATFORM_WATCH_H
+#define CJIT_ADAPTERS_PLATFORM_WATCH_H
+
+#include "cjit.h"
+
+struct TCCState;
+
+/**
+ * Milliseconds without further changes after which the files changed
+ * are rebuilt, so that the steps of one save trigger a single build.
+ */
+#define CJIT_WATCH_DEBOUNCE 20
+
+/**
+ * Exit status of a `--relink` build that cannot link the changes over
+ * the program, for the watcher to build it again.
+ */
+#define CJIT_WATCH_REBUILD 75
+
+/**
+ * Runs one cjit command line on `cjit` and returns its exit status.
+ */
+typedef int (*CJITWatchRun)(CJITState *cjit, int argc, char **argv);
+
+/**
+ * Builds and runs the command line, without `--watch`, in a child
+ * process, then watches the sources and every header they included.
+ * When some change, the child is stopped and the command line runs
+ * again, compiling only the sources whose object is not cached.
+ * With `--relink` the child stays instead: sources changed are sent to
+ * it to link over the program it built, see cjit_relink_wait().
+ * Messages of the watcher follow the verbosity of `cjit`. Returns only
+ * on errors.
+ */
+int cjit_watch_run(CJITState *cjit, int argc, char **argv, CJITWatchRun run);
+
+/**
+ * Asks the process `pid` to terminate and kills it when it does not
+ * within a second.
+ */
+void cjit_watch_stop(int pid);
+
+/**
+ * Tells how the program exited with `status`, unless `cjit` is quiet.
+ */
+void cjit_watch_report(CJITState *cjit, int status);
+
+/**
+ * Reports `path`, a file read to build the program, to the watcher.
+ * Does nothing outside of a `--watch` child.
+ */
+void cjit_watch_note(CJITState *cjit, const char *path);
+
+/**
+ * Reports the headers included by the compilations of `tcc`.
+ */
+void cjit_watch_note_deps(CJITState *cjit, struct TCCState *tcc);
+
+#endif
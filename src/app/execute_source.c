@@ -13,6 +13,20 @@ static ExecuteResponse make_error(CJITResultCode code, int exit_status, const ch
     return response;
 }
 
+/**
+ * True when one of the sources is `-`, which has to be read in order.
+ */
+static int reads_stdin(const ExecuteRequest *request)
+{
+    int i;
+    for (i = 0; i < request->source_count; ++i) {
+        if (*request->sources[i] == '-') {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 ExecuteResponse execute_source(CJITState *cjit, const ExecuteRequest *request)
 {
     char *stdin_code = NULL;
@@ -49,6 +63,19 @@ ExecuteResponse execute_source(CJITState *cjit, const ExecuteRequest *request)
         free(stdin_code);
         stdin_code = NULL;
 #endif
+    } else if (request->source_count > 1 && !reads_stdin(request)) {
+        if (cjit->verbose) {
+            _err("Source code:");
+            for (i = 0; i < request->source_count; ++i) {
+                _err("+ %s", request->sources[i]);
+            }
+        }
+        if (!compiler.add_source_files(compiler.context, &session,
+                                       request->sources, request->source_count).ok) {
+            response = make_error(CJIT_RESULT_COMPILER_ERROR, 1,
+                                  "Error loading source input");
+            goto cleanup;
+        }
     } else {
         if (cjit->verbose) {
             _err("Source code:");
@@ -0,0 +1,43 @@
+// Generated by cjit/build/init-assets.sh
+// Mon Oct 19 15:33:27 UTC 2026
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <muntarfs.h>
+#include <assets.h>
+#include <cjit.h>
+
+// main function
+bool extract_assets(CJITState *CJIT,const char *optional_path) {
+  if( !cjit_mkdtemp(CJIT, optional_path) ) return false;
+  // if( !CJIT->tmpdir ) return(false);
+  bool res = 0;
+  char incpath[512];
+
+// vv libtcc1.a vv
+snprintf(incpath,511,"%s/%s",CJIT->tmpdir,"libtcc1.a");
+if(CJIT->fresh) res = muntarfs_extract_targz_to_path(CJIT->tmpdir,(const uint8_t*)&libtcc1_a,libtcc1_a_len);
+if(res!=0) { _err("Error extracting %s",incpath); return(false); }
+cjit_add_include_path(CJIT, incpath);
+// ^^ libtcc1.a ^^
+
+
+// vv include vv
+snprintf(incpath,511,"%s/%s",CJIT->tmpdir,"include");
+if(CJIT->fresh) res = muntarfs_extract_targz_to_path(CJIT->tmpdir,(const uint8_t*)&include,include_len);
+if(res!=0) { _err("Error extracting %s",incpath); return(false); }
+cjit_add_include_path(CJIT, incpath);
+// ^^ include ^^
+
+
+// vv libtcc1.so vv
+snprintf(incpath,511,"%s/%s",CJIT->tmpdir,"libtcc1.so");
+if(CJIT->fresh) res = muntarfs_extract_targz_to_path(CJIT->tmpdir,(const uint8_t*)&libtcc1_so,libtcc1_so_len);
+if(res!=0) { _err("Error extracting %s",incpath); return(false); }
+cjit_add_include_path(CJIT, incpath);
+// ^^ libtcc1.so ^^
+
+
+return(true);
+}
@@ -0,0 +1,20 @@
+// Generated by cjit/build/init-assets.sh
+// Mon Oct 19 15:33:27 UTC 2026
+
+#ifndef __ASSETS_H__
+#define __ASSETS_H__
+
+
+extern const char *libtcc1_a;
+extern const unsigned int libtcc1_a_len;
+
+
+extern const char *include;
+extern const unsigned int include_len;
+
+
+extern const char *libtcc1_so;
+extern const unsigned int libtcc1_so_len;
+
+
+#endif
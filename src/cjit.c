@@ -21,7 +21,13 @@
 #include <libtcc.h>
 #include "support/cwalk.h"
 #include <adapters/compiler/tinycc_adapter.h>
+#include <adapters/compiler/codegen_report.h>
+#include <adapters/compiler/layout_profile.h>
+#include <adapters/compiler/object_cache.h>
+#include <adapters/compiler/make_deps.h>
+#include <adapters/platform/job_pool.h>
 #include <adapters/platform/runtime_platform.h>
+#include <adapters/platform/watch.h>
 #include <support/source_files.h>
 #include <support/string_list.h>
 #include <stdlib.h>
@@ -88,11 +94,18 @@ CJITState* cjit_new() {
 	cjit->tcc_output = TCC_OUTPUT_MEMORY;
 	// error handler callback for TCC
 	tcc_set_error_func(tcc(cjit), stderr, cjit_tcc_handle_error);
+	// large images are relocated on a pool of threads
+	cjit_job_pool_attach(cjit, tcc(cjit));
 	// initialize internal arrays
 	cjit->sources  = string_list_new();
 	cjit->libs     = string_list_new();
 	cjit->libpaths = string_list_new();
 	cjit->reallibs = string_list_new();
+	cjit->ccflags  = string_list_new();
+	cjit->tccopts  = string_list_new();
+	cjit->objcache = true;
+	cjit->watch_fd = -1;
+	cjit->relink_fd = -1;
 	return(cjit);
 }
 
@@ -101,33 +114,66 @@ void cjit_free(CJITState *cjit) {
 	if(cjit->write_pid) free(cjit->write_pid);
 	if(cjit->entry) free(cjit->entry);
 	if(cjit->output_filename) free(cjit->output_filename);
+	if(cjit->deps_file) free(cjit->deps_file);
+	if(cjit->deps_targets) string_list_free(&cjit->deps_targets);
+	cjit_codegen_report_free(cjit);
 	if(cjit->TCC) tcc_delete(tcc(cjit));
 	string_list_free(&cjit->sources);
 	string_list_free(&cjit->libs);
 	string_list_free(&cjit->libpaths);
 	string_list_free(&cjit->reallibs);
+	string_list_free(&cjit->ccflags);
+	string_list_free(&cjit->tccopts);
 	free(cjit);
 }
 
-CJITResult cjit_prepare(CJITState *cjit) {
-	// set output in memory for just in time execution
-	if(cjit->done_setup) {
+CJITResult cjit_prepare_assets(CJITState *cjit) {
+#if !defined(SHAREDTCC)
+	if(cjit->tmpdir) { // already extracted in this state
 		return cjit_result_ok();
 	}
-#if !defined(SHAREDTCC)
 	// extract all runtime assets to tmpdir
 	if(!extract_assets(cjit,NULL)) {
 		fail("error extracting assets in temp dir");
 		return cjit_result_error(CJIT_RESULT_IO_ERROR, 1,
 					 "Failed to extract runtime assets");
 	}
+#else
+	(void)cjit;
 #endif
+	return cjit_result_ok();
+}
+
+CJITResult cjit_prepare(CJITState *cjit) {
+	// set output in memory for just in time execution
+	if(cjit->done_setup) {
+		return cjit_result_ok();
+	}
+	{
+		CJITResult result = cjit_prepare_assets(cjit);
+		if (!result.ok) {
+			return result;
+		}
+	}
 	if (tcc_set_output_type(tcc(cjit), cjit->tcc_output) < 0) {
 		return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
 					 "Failed to set compiler output mode");
 	}
 #if defined(LIBC_MUSL)
 	tcc_add_libc_symbols(tcc(cjit));
+#endif
+#if !defined(SHAREDTCC) && !defined(WINDOWS)
+	if(cjit->tcc_output == TCC_OUTPUT_MEMORY && cjit->tmpdir) {
+		// libtcc1 prelinked by the build, when it was embedded: mapped
+		// once in place of loading members of libtcc1.a at each link
+		char *image = malloc(strlen(cjit->tmpdir) + 32);
+		sprintf(image, "-Wl,--runtime-image=%s/libtcc1.so", cjit->tmpdir);
+		if(access(image + 20, R_OK) == 0) {
+			debug(" -C %s",image);
+			tcc_set_options(tcc(cjit), image);
+		}
+		free(image);
+	}
 #endif
 	if(getenv("CFLAGS")) {
 		char *extra_cflags = NULL;
@@ -138,9 +184,42 @@ CJITResult cjit_prepare(CJITState *cjit) {
 			return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
 						 "Failed to apply compiler options");
 		}
+		add(tccopts,extra_cflags);
+	}
+	if(cjit->tiered || cjit->hot_reload
+	   || cjit->relink_fd >= 0) { // entry slots to repoint
+		debug(" -C %s","-ftiered");
+		if (tcc_set_options(tcc(cjit), "-ftiered") < 0) {
+			return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
+						 "Tiered execution is not supported by this compiler");
+		}
+		add(tccopts,"-ftiered");
+	}
+	// code loaded later over the program may call what the link dropped
+	if(cjit->gc_sections && !cjit->hot_reload && cjit->relink_fd < 0) {
+		debug(" -C %s","-ffunction-sections -Wl,--gc-sections");
+		tcc_set_options(tcc(cjit), "-ffunction-sections -Wl,--gc-sections");
+		add(tccopts,"-ffunction-sections -Wl,--gc-sections");
+		if(cjit->entry) { // keep the entry function
+			char *opt = malloc(strlen(cjit->entry) + 8);
+			sprintf(opt, "-Wl,-e=%s", cjit->entry);
+			tcc_set_options(tcc(cjit), opt);
+			free(opt);
+		}
+	}
+	if(cjit->watch_fd >= 0) { // list the headers to the watcher
+		tcc_set_options(tcc(cjit), "-MD");
+	} else if(cjit->make_deps) {
+		tcc_set_options(tcc(cjit),
+				cjit->make_deps & CJIT_MAKE_DEPS_SYSTEM ? "-MD" : "-MMD");
+	}
+	if(cjit->codegen_report) {
+		cjit_codegen_report_begin(cjit);
 	}
-	// When using SDL2 these defines are needed
-	tcc_define_symbol(tcc(cjit),"SDL_DISABLE_IMMINTRIN_H",NULL);
+	if(cjit->layout) { // profiles recorded at exit
+		cjit_layout_attach(cjit, tcc(cjit));
+	}
+	// When using SDL2 this define is needed
 	tcc_define_symbol(tcc(cjit),"SDL_MAIN_HANDLED",NULL);
 
 	// where is libtcc1.a found
@@ -268,14 +347,10 @@ bool cjit_add_buffer(CJITState *cjit, const char *buffer) {
 	return cjit_add_buffer_result(cjit, buffer).ok;
 }
 
-CJITResult cjit_add_source_result(CJITState *cjit, const char *path) {
-	CJITResult result;
+CJITResult cjit_read_source(CJITState *cjit, const char *path, char **contents) {
 	size_t length;
 	int res = detect_bom(path,&length);
-	result = cjit_prepare(cjit);
-	if (!result.ok) {
-		return result;
-	}
+	*contents = NULL;
 	if(res<0) {
 		fail(path);
 		return cjit_result_error(CJIT_RESULT_IO_ERROR, 1,
@@ -299,30 +374,76 @@ CJITResult cjit_add_source_result(CJITState *cjit, const char *path) {
 		return cjit_result_error(CJIT_RESULT_IO_ERROR, 1,
 					 "Error loading source input");
 	}
+	cjit_watch_note(cjit,path);
 	sprintf(spath,"#line 1 \"%s\"\n",path);
 	size_t spath_len = strlen(spath);
-	char *contents =
+	char *buf =
 		(char*)malloc
 		((spath_len + length + 1)
 		 * sizeof(char));
-	if (!contents) {
+	if (!buf) {
 		fail(path);
 		free(spath);
 		fclose(file);
 		return cjit_result_error(CJIT_RESULT_IO_ERROR, 1,
 					 "Error loading source input");
 	}
-	strcpy(contents,spath);
+	strcpy(buf,spath);
 	free(spath);
-	if(0== fread(contents+spath_len, 1, length, file)) {
+	if(0== fread(buf+spath_len, 1, length, file)) {
 		fail(file);
 		fclose(file);
-		free(contents);
+		free(buf);
 		return cjit_result_error(CJIT_RESULT_IO_ERROR, 1,
 					 "Error loading source input");
 	}
-	contents[length+spath_len] = 0x0;
+	buf[length+spath_len] = 0x0;
 	fclose(file);
+	*contents = buf;
+	return cjit_result_ok();
+}
+
+CJITResult cjit_add_source_result(CJITState *cjit, const char *path) {
+	CJITResult result;
+	char *contents;
+	int res;
+	result = cjit_prepare(cjit);
+	if (!result.ok) {
+		return result;
+	}
+	if(cjit->snapshot_source && strcmp(path,cjit->snapshot_source)==0) {
+		// compiled by the compile server zygote, after its prelude
+		debug("+S %s",path);
+		if (cjit->snapshot_result < 0) {
+			return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
+						 "Error loading source input");
+		}
+		return cjit_result_ok();
+	}
+	result = cjit_read_source(cjit, path, &contents);
+	if (!result.ok) {
+		return result;
+	}
+	if(cjit_object_cache_enabled(cjit)) {
+		res = cjit_object_cache_add_source(cjit, path, contents);
+		free(contents);
+		debug(res>0?"+C %s":"+S %s",path);
+		if (res < 0) {
+			return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
+						 "Error loading source input");
+		}
+		return cjit_result_ok();
+	}
+	if(cjit_layout_enabled(cjit)) { // on a unit with its own profile
+		res = cjit_layout_add_source(cjit, path, contents);
+		free(contents);
+		debug("+S %s",path);
+		if (res < 0) {
+			return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
+						 "Error loading source input");
+		}
+		return cjit_result_ok();
+	}
 	{ // if inside a dir then add dir to includes too
 		size_t dirname;
 		cwk_path_get_dirname(path,&dirname);
@@ -336,6 +457,7 @@ CJITResult cjit_add_source_result(CJITState *cjit, const char *path) {
 	}
 	res = tcc_compile_string(tcc(cjit),contents);
 	free(contents);
+	cjit_watch_note_deps(cjit,tcc(cjit));
 	debug("+S %s",path);
 	if (res < 0) {
 		return cjit_result_error(CJIT_RESULT_COMPILER_ERROR, 1,
@@ -467,6 +589,56 @@ int cjit_exec(CJITState *cjit, int argc, char **argv) {
 }
 
 
+CJITResult cjit_load_result(CJITState *cjit) {
+	RuntimeSession session;
+	CompilerPort compiler = tinycc_compiler_port;
+	CJITResult result = cjit_result_ok();
+	compiler.context = cjit;
+	result = compiler.begin_session(compiler.context, &session);
+	if (!result.ok) {
+		return result;
+	}
+	result = compiler.relocate(compiler.context, &session);
+	compiler.end_session(compiler.context, &session);
+	return result;
+}
+
+CJITResult cjit_run_result(CJITState *cjit, int mode, int argc, char **argv, int *exit_status) {
+	RuntimeSession session;
+	CompilerPort compiler = tinycc_compiler_port;
+	CJITResult result = cjit_result_ok();
+	int local_exit_status = 1;
+	compiler.context = cjit;
+	result = compiler.begin_session(compiler.context, &session);
+	if (!result.ok) {
+		return result;
+	}
+	result = compiler.run_program(compiler.context, &session, mode==CJIT_RUN_IN_PROCESS,
+				      argc, argv, &local_exit_status);
+	compiler.end_session(compiler.context, &session);
+	if (exit_status) {
+		*exit_status = local_exit_status;
+	}
+	return result;
+}
+
+void *cjit_get_symbol(CJITState *cjit, const char *symbol) {
+	RuntimeSession session;
+	CompilerPort compiler = tinycc_compiler_port;
+	void *addr = NULL;
+	compiler.context = cjit;
+	if (!compiler.begin_session(compiler.context, &session).ok) {
+		return NULL;
+	}
+	if (compiler.relocate(compiler.context, &session).ok
+	    && !compiler.resolve_symbol(compiler.context, &session, symbol, &addr).ok) {
+		addr = NULL;
+	}
+	compiler.end_session(compiler.context, &session);
+	return addr;
+}
+
+
 // wrappers to make TCC opaque
 void cjit_set_output(CJITState *cjit, int output) {
 	if(output>5 || output<1)
@@ -476,6 +648,12 @@ void cjit_set_output(CJITState *cjit, int output) {
 }
 void cjit_define_symbol(CJITState *cjit, const char *sym, const char *value) {
 	tcc_define_symbol(tcc(cjit),sym,value);
+	{ // keep a copy for the host compiler used by tiered execution
+		char *flag = malloc(strlen(sym)+(value?strlen(value):0)+4);
+		sprintf(flag,"-D%s%s%s",sym,value?"=":"",value?value:"");
+		add(ccflags,flag);
+		free(flag);
+	}
 	if(cjit->verbose)_err("+D %s %s",sym,value?value:"");
 }
 void cjit_add_include_path(CJITState *cjit, const char *path) {
@@ -485,6 +663,12 @@ void cjit_add_include_path(CJITState *cjit, const char *path) {
 		return;
 	}
 	tcc_add_include_path(tcc(cjit), toadd);
+	{
+		char *flag = malloc(strlen(toadd)+3);
+		sprintf(flag,"-I%s",toadd);
+		add(ccflags,flag);
+		free(flag);
+	}
 	free(toadd);
 	debug(" -I %s",path);
 }
@@ -506,6 +690,7 @@ void cjit_add_library(CJITState *cjit, const char *path) {
 }
 void cjit_set_tcc_options(CJITState *cjit, const char *opts) {
 	tcc_set_options(tcc(cjit),opts);
+	add(tccopts,opts);
 	debug(" +O %s",opts);
 }
 
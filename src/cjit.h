@@ -51,13 +51,31 @@ struct CJITState {
 	char *output_filename; // output in case of compilation mode
 	bool done_setup;
 	bool done_exec;
+	bool done_relocate; // linked in memory, ready to run again and again
 	bool print_status;
+	bool tiered; // recompile hot functions with the host C compiler
+	bool hot_reload; // recompile changed sources into the running program
+	bool relink; // --watch: link changed sources over the program built
+	int codegen_report; // print per-function statistics, table or json
+	bool objcache; // reuse objects compiled by earlier runs
+	bool layout; // lay out hot and cold functions by a recorded profile
+	bool gc_sections; // drop the functions nothing reaches when linking
+	int make_deps; // -MD -MMD -MP: write make dependencies with -c
+	char *deps_file; // -MF: where to write them
+	StringList *deps_targets; // -MT -MQ: targets of the rule, or NULL
 	// INTERNAL
 	// sources and libs used and paths to libs
 	StringList *sources; // source files loaded
 	StringList *libs;    // library names to be resolved
 	StringList *libpaths; // library paths to be searched
 	StringList *reallibs; // paths made by resolve_libs()
+	StringList *ccflags; // -D and -I flags replayed to the host compiler
+	StringList *tccopts; // options given to tinycc, part of the cache key
+	void *report; // rows collected for the codegen report
+	const char *snapshot_source; // compiled already over a server prelude
+	int snapshot_result; // what compiling snapshot_source returned
+	int watch_fd; // --watch: files read by the build are noted here, or -1
+	int relink_fd; // --relink: sources changed come from the watcher, or -1
 	// switch gcc subcall emulation
 	bool call_ar; // execute ar
 	bool output_obj; // don't link just compile obj
@@ -67,6 +85,12 @@ typedef struct CJITState CJITState;
 extern CJITState* cjit_new();
 extern bool cjit_status(CJITState *cjit);
 
+/**
+ * Extracts the runtime assets and adds their include paths, once per
+ * state. Done by cjit_prepare, or ahead of time by a compile server.
+ */
+extern CJITResult cjit_prepare_assets(CJITState *cjit);
+
 /**
  * Prepares the runtime/compiler session before source ingestion or execution.
  */
@@ -79,6 +103,12 @@ extern CJITResult cjit_add_file_result(CJITState *cjit, const char *path);
 extern CJITResult cjit_add_source_result(CJITState *cjit, const char *path);
 extern CJITResult cjit_add_buffer_result(CJITState *cjit, const char *buffer);
 
+/**
+ * Loads a C source file into a new buffer prefixed by its #line marker,
+ * refusing encodings the compiler does not support.
+ */
+extern CJITResult cjit_read_source(CJITState *cjit, const char *path, char **contents);
+
 // setup functions to add source and libs
 extern bool cjit_add_file(CJITState *cjit, const char *path);
 extern bool cjit_add_source(CJITState *cjit, const char *path);
@@ -92,6 +122,17 @@ extern CJITResult cjit_link_result(CJITState *cjit);
 extern CJITResult cjit_exec_result(CJITState *cjit, int argc, char **argv, int *exit_status);
 extern CJITResult cjit_compile_file_result(CJITState *cjit, const char *path);
 
+/**
+ * Reusable programs: the sources added are linked in memory once, by
+ * cjit_load_result or the first call of the others, and then run or
+ * looked up any number of times without compiling again.
+ */
+#define CJIT_RUN_FORK 0 /* each run in a child process, like cjit_exec */
+#define CJIT_RUN_IN_PROCESS 1 /* call the entry point in this process */
+extern CJITResult cjit_load_result(CJITState *cjit);
+extern CJITResult cjit_run_result(CJITState *cjit, int mode, int argc, char **argv, int *exit_status);
+extern void *cjit_get_symbol(CJITState *cjit, const char *symbol); // NULL if missing
+
 extern void cjit_free(CJITState *CJIT);
 
 
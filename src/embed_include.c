@@ -0,0 +1,910 @@
+// Embedded: lib/tinycc/include
+// source generated by cjit/build/embed-path.sh
+// Mon Oct 19 15:33:27 UTC 2026
+// include
+const char include[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0x5d,
+  0x7d, 0x73, 0xdb, 0x36, 0x93, 0xef, 0xbf, 0xf5, 0xa7, 0xc0, 0xa5, 0x33,
+  0xa9, 0xe8, 0xca, 0x8e, 0xde, 0x2c, 0xbb, 0x71, 0xec, 0x67, 0x1c, 0x5b,
+  0x49, 0x74, 0x23, 0xcb, 0x7e, 0x2c, 0x27, 0x4d, 0xaf, 0xd7, 0x72, 0x28,
+  0x0a, 0xb2, 0xf9, 0x84, 0x22, 0x55, 0xbe, 0xc8, 0xf2, 0xd3, 0xe4, 0x3e,
+  0xfb, 0xed, 0x02, 0x20, 0x09, 0x92, 0x20, 0x45, 0x29, 0x89, 0x33, 0xbd,
+  0x33, 0x27, 0x23, 0x4b, 0xe0, 0xe2, 0xb7, 0x8b, 0xc5, 0x62, 0xb1, 0x20,
+  0xc0, 0x8d, 0xe5, 0x98, 0x76, 0x38, 0xa1, 0xcf, 0xbe, 0xfb, 0x8a, 0x57,
+  0x03, 0xae, 0xfd, 0xfd, 0x3d, 0xf6, 0x17, 0xae, 0xec, 0x5f, 0xf6, 0xbd,
+  0xb9, 0xd7, 0xea, 0xee, 0x75, 0xda, 0x9d, 0x46, 0xbb, 0xfd, 0x5d, 0xa3,
+  0xd9, 0xda, 0x6b, 0x74, 0xbf, 0x23, 0x7b, 0x5f, 0x53, 0xa8, 0xe8, 0x0a,
+  0xfd, 0xc0, 0xf0, 0x40, 0x14, 0xcf, 0x75, 0x83, 0x32, 0xba, 0x55, 0xf7,
+  0xb3, 0x8d, 0xfb, 0x9b, 0x5c, 0x96, 0xe8, 0x7f, 0x3f, 0x98, 0x8c, 0x5d,
+  0xd7, 0xde, 0xbd, 0xfd, 0x0a, 0x3c, 0x50, 0x1f, 0xdd, 0x6e, 0xa7, 0xb0,
+  0xff, 0x5b, 0x5d, 0xd6, 0xff, 0xcd, 0x66, 0xa3, 0xdb, 0x6c, 0x41, 0xc7,
+  0x37, 0x9a, 0x9d, 0x76, 0xb3, 0xf1, 0x1d, 0x79, 0x10, 0x25, 0xfe, 0x3f,
+  0xef, 0xff, 0x1f, 0xac, 0xa9, 0x33, 0xa1, 0x53, 0xa2, 0x8f, 0xae, 0xcf,
+  0x5e, 0x5e, 0x5c, 0x0c, 0xf4, 0x37, 0x5b, 0x3f, 0xc0, 0x6f, 0xcb, 0xa1,
+  0x72, 0xd1, 0xd6, 0xb3, 0x6d, 0xd2, 0x1f, 0x5d, 0x9c, 0xfe, 0xfc, 0x33,
+  0x41, 0x2b, 0xa1, 0x86, 0x43, 0xb6, 0x9f, 0x6d, 0xc5, 0x94, 0x58, 0xf6,
+  0xbd, 0xfe, 0x12, 0x3e, 0xe3, 0xa2, 0xc0, 0x0b, 0xe9, 0xf7, 0xcd, 0xf8,
+  0xe7, 0xd4, 0xb0, 0x7d, 0xfa, 0x7d, 0x23, 0xc1, 0xd6, 0xb1, 0x8e, 0x8e,
+  0x54, 0x3a, 0xbb, 0xa7, 0x1b, 0x1e, 0xd5, 0xf9, 0xcd, 0x09, 0x69, 0x02,
+  0x34, 0x75, 0x26, 0xd6, 0x94, 0x00, 0xdf, 0x44, 0x0c, 0xe4, 0xf9, 0xad,
+  0xf5, 0xf5, 0x7f, 0xed, 0x8a, 0xc6, 0x3f, 0x9d, 0xcd, 0x2c, 0x27, 0xf0,
+  0x2c, 0xe7, 0x2b, 0x78, 0x00, 0x36, 0xfe, 0x3b, 0x45, 0xe3, 0xbf, 0xd9,
+  0x05, 0xcf, 0x9f, 0xf1, 0xff, 0x9d, 0xee, 0x7e, 0xf3, 0x71, 0xfc, 0x3f,
+  0xc4, 0x05, 0x03, 0x6c, 0x34, 0xea, 0xb5, 0x08, 0xef, 0x7c, 0xdf, 0x32,
+  0x7d, 0x32, 0x75, 0x3d, 0x12, 0x98, 0x66, 0x9d, 0xf8, 0x94, 0x92, 0x65,
+  0x62, 0x17, 0x38, 0xfc, 0x62, 0x77, 0xd1, 0x3b, 0x3f, 0xef, 0x0f, 0xaf,
+  0xaf, 0xfa, 0x43, 0xd9, 0x61, 0xc8, 0x85, 0x40, 0xca, 0x4d, 0x8b, 0xbc,
+  0x90, 0x30, 0x8e, 0xb7, 0xb6, 0x82, 0xfb, 0x39, 0x45, 0x88, 0x89, 0x1b,
+  0x8e, 0x6d, 0xf4, 0x04, 0xb3, 0x66, 0xeb, 0x60, 0x02, 0x7f, 0x8d, 0x00,
+  0x68, 0xc6, 0x61, 0x40, 0x75, 0xbd, 0x56, 0xd3, 0xf5, 0x05, 0x35, 0x03,
+  0xd7, 0xd3, 0x7d, 0xeb, 0xdf, 0x58, 0xd0, 0xec, 0x6a, 0x9a, 0x76, 0x18,
+  0x57, 0xb6, 0x5d, 0xe7, 0x86, 0x7f, 0xf0, 0xfa, 0xd6, 0x9a, 0xf5, 0xd3,
+  0xcc, 0xf5, 0xf0, 0x73, 0xd9, 0xaf, 0x8d, 0x10, 0x0b, 0xb0, 0x68, 0x4d,
+  0xa6, 0x9f, 0xc1, 0x1d, 0xaa, 0xaf, 0xdb, 0x76, 0xff, 0xd6, 0xf5, 0x02,
+  0xac, 0x7a, 0x70, 0xbb, 0x6e, 0x55, 0xf3, 0xd6, 0xf0, 0xb0, 0x66, 0xb3,
+  0xfb, 0xe7, 0xba, 0x55, 0x43, 0x30, 0xae, 0x1b, 0x74, 0xee, 0x60, 0x0a,
+  0x08, 0xd1, 0xf1, 0xd7, 0x55, 0x59, 0x8c, 0x20, 0x35, 0x60, 0x63, 0x0c,
+  0xa9, 0x25, 0x55, 0x31, 0x70, 0x12, 0x14, 0xdd, 0x06, 0x23, 0x41, 0xd7,
+  0xaf, 0x4f, 0x4f, 0xf5, 0xf3, 0xf3, 0xc4, 0x80, 0x67, 0x33, 0xdd, 0xa7,
+  0xc1, 0xbf, 0xa9, 0xe7, 0xea, 0xf3, 0x49, 0x6d, 0xe1, 0x5a, 0x13, 0x6d,
+  0xeb, 0xaf, 0xf8, 0xb6, 0x47, 0x8e, 0xc8, 0x5f, 0xa4, 0x51, 0x27, 0x0d,
+  0xf2, 0xe9, 0x90, 0x78, 0x34, 0x08, 0x3d, 0x87, 0x78, 0x87, 0xe4, 0x53,
+  0x21, 0x52, 0x13, 0x61, 0x04, 0x43, 0x05, 0xd4, 0xa4, 0x4e, 0x26, 0x59,
+  0xa8, 0x78, 0x24, 0x72, 0x04, 0x00, 0x68, 0xca, 0x68, 0x85, 0xac, 0x24,
+  0x4e, 0xb4, 0x59, 0x8f, 0x5a, 0x49, 0x1b, 0x79, 0xae, 0x14, 0x5a, 0x40,
+  0x9b, 0x55, 0x9b, 0xe0, 0xc9, 0xc0, 0x8d, 0x04, 0xb8, 0xf9, 0x59, 0xc0,
+  0xb6, 0x6b, 0x4c, 0x10, 0xd8, 0x74, 0x1d, 0x3f, 0x88, 0xbb, 0x64, 0xae,
+  0x01, 0x8a, 0xa8, 0xbb, 0x2d, 0xee, 0x45, 0xb5, 0xb6, 0xb5, 0x79, 0x29,
+  0x5a, 0xb8, 0x16, 0x1c, 0x0c, 0xf6, 0x2c, 0x20, 0xf6, 0x36, 0x6f, 0x34,
+  0xd8, 0x0d, 0x95, 0x5a, 0xbd, 0x3d, 0xaf, 0xc7, 0xdc, 0x0c, 0x84, 0xdc,
+  0xae, 0x49, 0x42, 0x41, 0xcb, 0x8d, 0x12, 0x9c, 0xb0, 0x12, 0x10, 0x17,
+  0x27, 0x07, 0x15, 0x79, 0x18, 0x00, 0x33, 0x17, 0x81, 0x3f, 0xd1, 0xa7,
+  0xdd, 0x4e, 0x2d, 0x85, 0x20, 0x5a, 0x67, 0xfc, 0xd6, 0xf8, 0x1d, 0x6b,
+  0xaa, 0xd5, 0x63, 0x4c, 0x98, 0xae, 0xe3, 0x8a, 0x89, 0x14, 0x63, 0x19,
+  0x83, 0xfc, 0x44, 0xc6, 0xc5, 0x96, 0x10, 0x8e, 0x2b, 0x61, 0xec, 0x94,
+  0x60, 0xcc, 0x42, 0xbb, 0x12, 0xc6, 0x76, 0x09, 0xc6, 0xc4, 0x5a, 0x54,
+  0xc2, 0x78, 0x56, 0x26, 0x87, 0xe5, 0x14, 0x62, 0x80, 0x51, 0xa3, 0x77,
+  0xb3, 0x0e, 0xd9, 0x1c, 0x5a, 0xb3, 0xa0, 0x4f, 0x1a, 0x87, 0xc4, 0x22,
+  0x2f, 0x48, 0x0b, 0xfe, 0xfc, 0xf4, 0x93, 0x46, 0x20, 0xa4, 0xad, 0x8d,
+  0x7f, 0xb3, 0x7e, 0x87, 0x22, 0x03, 0xfe, 0x68, 0xec, 0x13, 0xc8, 0xb0,
+  0x2c, 0xb6, 0x7c, 0xa3, 0x98, 0xb9, 0xb1, 0xfc, 0x12, 0xcc, 0x8f, 0x37,
+  0x62, 0x6e, 0x38, 0xc5, 0x96, 0xb0, 0x15, 0x6b, 0x2f, 0xba, 0xaf, 0x31,
+  0x3f, 0x0a, 0xb3, 0x93, 0x66, 0x90, 0xa7, 0x24, 0xfa, 0x3e, 0xd6, 0x0a,
+  0xe1, 0x5d, 0x6f, 0x43, 0xf4, 0x8f, 0x55, 0xd0, 0x97, 0x1b, 0xc3, 0xff,
+  0x51, 0x05, 0xde, 0x9c, 0xcd, 0xe9, 0x9f, 0x15, 0x6c, 0x2b, 0x61, 0x60,
+  0x90, 0x23, 0xd0, 0x7c, 0x29, 0xa2, 0x1d, 0xac, 0x89, 0xf8, 0x62, 0x05,
+  0xe0, 0xcd, 0xba, 0x80, 0xc7, 0x02, 0x10, 0xa7, 0x3e, 0x30, 0x2e, 0x7a,
+  0x43, 0x3d, 0xc5, 0xdc, 0x67, 0xa5, 0xe6, 0x3e, 0xdf, 0x82, 0xa2, 0xcc,
+  0xf4, 0x67, 0x55, 0x9f, 0xfe, 0x62, 0x30, 0x9d, 0xce, 0xad, 0x6e, 0x67,
+  0x59, 0x4b, 0xa2, 0x1d, 0x9c, 0x9a, 0xa4, 0x5f, 0x8d, 0x3c, 0x7e, 0xa5,
+  0x49, 0xc4, 0x4a, 0xa6, 0xc4, 0x3c, 0x0b, 0x05, 0x26, 0x40, 0xae, 0x23,
+  0x73, 0xbb, 0x55, 0xc3, 0x71, 0x48, 0xdb, 0x75, 0x36, 0x1e, 0x69, 0x4b,
+  0xfc, 0x6d, 0x8a, 0xbf, 0x42, 0x6c, 0x08, 0x80, 0xd2, 0x52, 0xd7, 0x19,
+  0x29, 0x6d, 0x4b, 0xbc, 0x44, 0x57, 0x58, 0x5a, 0x29, 0x53, 0x4f, 0xe6,
+  0xda, 0xc8, 0x70, 0x8b, 0xb8, 0xb7, 0xbf, 0x34, 0xd7, 0xa6, 0xcc, 0x35,
+  0x0f, 0x5e, 0x8f, 0xfe, 0x6d, 0x06, 0xdc, 0xec, 0xd6, 0x78, 0x94, 0x17,
+  0x41, 0x63, 0xac, 0x9a, 0x85, 0xae, 0x7f, 0x36, 0x9b, 0x83, 0x1a, 0x8b,
+  0x03, 0x91, 0xc9, 0x16, 0x81, 0x2b, 0x0a, 0x6d, 0xcb, 0x38, 0x15, 0xfd,
+  0x03, 0x09, 0x18, 0x46, 0x5e, 0x8a, 0xad, 0x02, 0x29, 0x58, 0x1c, 0xc3,
+  0x87, 0x8b, 0x1c, 0x5f, 0x58, 0x99, 0xe0, 0x43, 0x15, 0xba, 0x58, 0x52,
+  0xe8, 0xa2, 0x40, 0xc0, 0x90, 0xa0, 0x04, 0x23, 0x13, 0xad, 0x70, 0x80,
+  0x84, 0x79, 0x3d, 0x66, 0xc2, 0x03, 0x8d, 0xd5, 0x61, 0x4a, 0x0a, 0x81,
+  0x31, 0x5f, 0x8d, 0xc1, 0xd6, 0x01, 0x22, 0x38, 0xc1, 0xea, 0x00, 0x02,
+  0xe6, 0x94, 0xaa, 0x15, 0xa9, 0xb2, 0xc6, 0x6d, 0x4b, 0x33, 0x34, 0x11,
+  0xaa, 0x28, 0xb5, 0xc1, 0x80, 0xda, 0x2d, 0x21, 0x0c, 0xc2, 0xcb, 0x20,
+  0xe9, 0x11, 0x8a, 0x8e, 0x88, 0xfd, 0x33, 0x34, 0x55, 0xe8, 0x63, 0xc5,
+  0xa1, 0x0f, 0x33, 0x92, 0x58, 0xa8, 0xa4, 0x55, 0x8a, 0x59, 0xc3, 0xe2,
+  0xb3, 0x06, 0x1a, 0x90, 0x86, 0xf1, 0x50, 0xfc, 0x43, 0xe9, 0x94, 0x53,
+  0x2c, 0xc0, 0xdc, 0xd7, 0xe2, 0x01, 0xa3, 0x21, 0x66, 0x81, 0xdf, 0x57,
+  0x73, 0x90, 0x55, 0x5b, 0x85, 0x03, 0x53, 0xb7, 0xe0, 0x80, 0xdf, 0x57,
+  0x73, 0x88, 0xa3, 0xcb, 0x0c, 0x87, 0xd5, 0x41, 0xa2, 0x15, 0x07, 0x89,
+  0x1b, 0x6b, 0x7b, 0xa7, 0x92, 0xb6, 0x05, 0x8b, 0xcd, 0xb4, 0xbd, 0x53,
+  0x45, 0xdb, 0x82, 0xc3, 0x66, 0xda, 0xde, 0xa9, 0xa2, 0x6d, 0xc1, 0xa1,
+  0x8a, 0xb6, 0xd5, 0xe1, 0xb4, 0x15, 0x85, 0xd3, 0xb6, 0xbb, 0xb9, 0x32,
+  0xb6, 0x33, 0xca, 0x28, 0xb0, 0x0c, 0x67, 0x92, 0x71, 0x2e, 0x85, 0xb2,
+  0x3e, 0x2d, 0x91, 0x15, 0x60, 0x1c, 0x37, 0xa8, 0x86, 0xf4, 0x3f, 0xe5,
+  0x50, 0x6c, 0x51, 0x5f, 0x49, 0xa0, 0x8f, 0x25, 0x28, 0xcb, 0xea, 0x30,
+  0x7f, 0x70, 0x98, 0x82, 0xbe, 0xb4, 0x6d, 0x2b, 0xdf, 0x07, 0xe8, 0xb9,
+  0x1c, 0x49, 0xff, 0x0e, 0x84, 0x61, 0xcd, 0x3d, 0xf2, 0x0f, 0x45, 0x94,
+  0xa5, 0x91, 0xe7, 0xb9, 0xee, 0x09, 0xa1, 0x7b, 0x5e, 0xbc, 0x00, 0x84,
+  0x62, 0x13, 0x12, 0x6c, 0xd3, 0x56, 0xaa, 0x62, 0xdb, 0x6e, 0x56, 0x64,
+  0xdb, 0xf1, 0xab, 0xb3, 0x4d, 0x9b, 0xae, 0x8a, 0x6d, 0xb7, 0x5d, 0xc8,
+  0x96, 0x33, 0x29, 0xe6, 0xe1, 0x7d, 0x25, 0x8d, 0x1e, 0x1f, 0x97, 0x36,
+  0xcd, 0xfb, 0x4a, 0x1a, 0x5d, 0xc5, 0xd6, 0xa8, 0xd0, 0x5a, 0xd5, 0xf8,
+  0x05, 0xdc, 0x5a, 0xac, 0x05, 0xf8, 0x78, 0x0e, 0x35, 0x56, 0xf3, 0x29,
+  0x6f, 0x9e, 0xca, 0xa5, 0x45, 0x7c, 0x58, 0xb3, 0xe1, 0x23, 0xe6, 0x53,
+  0x30, 0x85, 0xb3, 0x65, 0x54, 0xe9, 0x2c, 0x10, 0x87, 0x68, 0x87, 0x45,
+  0xcb, 0xdd, 0x66, 0x57, 0xac, 0x77, 0x3d, 0xbe, 0xbc, 0xdd, 0xa9, 0x49,
+  0x33, 0x85, 0xc6, 0xca, 0x8e, 0x48, 0x52, 0x34, 0xc6, 0x22, 0x6d, 0x9d,
+  0xe8, 0x31, 0x96, 0x72, 0x33, 0x37, 0x8f, 0xdc, 0x57, 0xfb, 0x79, 0xbe,
+  0x5c, 0xdb, 0x98, 0xc9, 0x71, 0x45, 0x1e, 0xf6, 0x67, 0xf0, 0x78, 0x51,
+  0xc4, 0x23, 0x0a, 0xed, 0x66, 0xee, 0x82, 0xce, 0x0c, 0xff, 0x43, 0xa6,
+  0x47, 0xb3, 0xd1, 0xf6, 0x82, 0x1c, 0x25, 0xd3, 0xb7, 0xc1, 0xa3, 0x68,
+  0xd6, 0xb7, 0x75, 0x32, 0x63, 0xdd, 0xca, 0x4a, 0x8a, 0xba, 0x99, 0xdd,
+  0xc4, 0x6b, 0x46, 0x3e, 0x02, 0xce, 0x82, 0x3f, 0x5d, 0x69, 0x68, 0xe8,
+  0x28, 0xac, 0x54, 0x48, 0x3e, 0xc3, 0x48, 0x1c, 0x97, 0xb2, 0x10, 0x2b,
+  0x2f, 0xa8, 0xe7, 0x5b, 0x10, 0x32, 0x13, 0x98, 0x5c, 0x88, 0x69, 0xf8,
+  0x81, 0xaf, 0x58, 0xd8, 0x46, 0x61, 0x25, 0xd3, 0x90, 0x3e, 0xf7, 0x95,
+  0x4d, 0xc0, 0x45, 0x4f, 0xd4, 0x02, 0xa6, 0x97, 0x43, 0x71, 0x87, 0x21,
+  0xf0, 0x95, 0xc4, 0x02, 0xe2, 0xd6, 0x3a, 0x7c, 0x36, 0xd9, 0x67, 0x8b,
+  0x7d, 0xb6, 0x7f, 0xcf, 0xac, 0x18, 0x8a, 0x17, 0x0a, 0x20, 0x42, 0x30,
+  0xf7, 0x53, 0x1d, 0xc5, 0x44, 0x48, 0xaf, 0xb9, 0x0c, 0xc6, 0xc4, 0x60,
+  0x4c, 0x0c, 0xc6, 0xc4, 0xe0, 0x4c, 0x2a, 0x99, 0x36, 0x67, 0x84, 0x8a,
+  0x60, 0xc1, 0x78, 0xaa, 0xb1, 0xb9, 0x87, 0x03, 0x9a, 0xea, 0x29, 0x91,
+  0x15, 0x43, 0x80, 0xac, 0xf2, 0xf4, 0xa8, 0x42, 0xb0, 0x94, 0x10, 0x93,
+  0xac, 0x14, 0x93, 0x32, 0x29, 0x26, 0xab, 0xc4, 0x48, 0x47, 0x1f, 0x93,
+  0xea, 0x72, 0xc8, 0x10, 0xb1, 0x26, 0x94, 0xf5, 0x57, 0x34, 0x03, 0x34,
+  0x11, 0xb7, 0xa1, 0xa4, 0x09, 0xb8, 0xaf, 0x46, 0xa2, 0xdd, 0x6f, 0x5d,
+  0xb7, 0xda, 0x07, 0x5d, 0x5d, 0x27, 0x1f, 0x3f, 0x4a, 0x65, 0x4b, 0x28,
+  0xea, 0x76, 0x74, 0x5d, 0xb1, 0x08, 0xb3, 0xa7, 0xd4, 0x31, 0x29, 0x7f,
+  0xe4, 0x42, 0xd0, 0x28, 0x0c, 0x7f, 0x06, 0xd5, 0xc1, 0x38, 0x5c, 0xdb,
+  0x08, 0x2c, 0x1b, 0xf7, 0x30, 0x9e, 0x70, 0xa2, 0x27, 0xe4, 0xf9, 0xf3,
+  0xe7, 0xe4, 0xc9, 0x8c, 0xce, 0x5c, 0xef, 0xfe, 0x49, 0x7a, 0xd4, 0xc6,
+  0x78, 0xb3, 0x2a, 0x78, 0xb3, 0xea, 0x78, 0x73, 0x23, 0xf4, 0x57, 0xc1,
+  0x31, 0x1a, 0x0e, 0xc0, 0xb7, 0xfe, 0x53, 0x47, 0x00, 0xa4, 0x8d, 0xc5,
+  0xc7, 0x43, 0x00, 0x5f, 0xf4, 0x92, 0xce, 0xff, 0x80, 0xad, 0x7d, 0x95,
+  0xe3, 0x3f, 0xab, 0xce, 0xff, 0xb4, 0x9a, 0x9d, 0xdc, 0xf9, 0x9f, 0x66,
+  0xb3, 0xf5, 0xb8, 0xff, 0xff, 0x10, 0x97, 0x7c, 0xfe, 0xe7, 0xac, 0xf7,
+  0x2a, 0x73, 0xfc, 0x87, 0x97, 0xc4, 0xbb, 0xa7, 0xba, 0x3e, 0xea, 0xff,
+  0x57, 0x4f, 0xbf, 0xfe, 0xf5, 0xb2, 0x07, 0x03, 0x98, 0xed, 0x8e, 0x06,
+  0x87, 0xd2, 0xdd, 0xcb, 0xeb, 0xab, 0xb3, 0xfe, 0xab, 0x57, 0x31, 0x41,
+  0x9e, 0xe2, 0x97, 0xd3, 0x37, 0x27, 0x57, 0xd1, 0xfd, 0x3b, 0x7c, 0xf8,
+  0x56, 0x8a, 0x30, 0x0f, 0x3c, 0x70, 0x01, 0xd3, 0x52, 0x1a, 0x88, 0x14,
+  0x80, 0x2c, 0x4d, 0x22, 0x8b, 0x19, 0x26, 0x04, 0xcc, 0xcd, 0xea, 0xd8,
+  0xb0, 0x53, 0xfd, 0x5d, 0xef, 0x6a, 0xd4, 0xbf, 0x18, 0x02, 0xc1, 0xf1,
+  0x11, 0x69, 0x35, 0x9a, 0x60, 0x71, 0x03, 0x69, 0x9b, 0x18, 0x62, 0x03,
+  0xf0, 0x55, 0xf2, 0x4e, 0xbb, 0x6d, 0x1f, 0xf2, 0xaf, 0xf1, 0xd6, 0xbd,
+  0x3d, 0x01, 0x77, 0x45, 0x70, 0x4f, 0xc6, 0xb0, 0xad, 0x1b, 0x07, 0x39,
+  0xc4, 0xbe, 0x4b, 0xa8, 0x75, 0xf8, 0x76, 0x30, 0x88, 0x35, 0x8a, 0x3f,
+  0x20, 0xf0, 0x44, 0x47, 0xb8, 0xad, 0x35, 0xb4, 0x84, 0x38, 0x64, 0xb4,
+  0xee, 0x74, 0x0a, 0x8b, 0x02, 0x77, 0x1a, 0xd3, 0x47, 0x05, 0x35, 0x14,
+  0xab, 0x4e, 0xa6, 0x16, 0xb5, 0xc1, 0x83, 0xd6, 0x6a, 0x5c, 0xad, 0xda,
+  0xd3, 0x1a, 0xbb, 0x41, 0x10, 0x6b, 0xe7, 0x98, 0xdf, 0x5d, 0x6b, 0x26,
+  0x61, 0x0e, 0x7a, 0xdb, 0xb0, 0x6d, 0xd7, 0x34, 0x04, 0x28, 0xeb, 0x54,
+  0xed, 0x30, 0xe3, 0x83, 0x59, 0xd0, 0x74, 0x61, 0x4f, 0xa8, 0x47, 0x6e,
+  0x6c, 0x6b, 0x6c, 0xc2, 0x24, 0xf6, 0x67, 0x68, 0x79, 0x14, 0x56, 0x63,
+  0x77, 0xa0, 0x5d, 0xa8, 0x36, 0xf5, 0xdc, 0x19, 0x79, 0x11, 0x39, 0x11,
+  0x08, 0x3e, 0xef, 0x6e, 0xa9, 0xc3, 0xc8, 0xa8, 0x1f, 0xd0, 0x09, 0x86,
+  0x39, 0xe3, 0x7b, 0xe0, 0xed, 0x50, 0x3a, 0xd1, 0x79, 0x1d, 0x08, 0x4f,
+  0x7c, 0xe2, 0x06, 0xb7, 0xd4, 0xbb, 0xb3, 0x7c, 0x4a, 0xa2, 0xba, 0xc4,
+  0xf2, 0x9d, 0x1f, 0x03, 0x82, 0x52, 0xdd, 0x81, 0xb8, 0x81, 0x8b, 0x75,
+  0xa3, 0x43, 0x65, 0xb7, 0x96, 0x4f, 0xb0, 0xcd, 0xda, 0x2e, 0x14, 0x0e,
+  0xdd, 0x00, 0x8b, 0x8c, 0x80, 0x97, 0xcf, 0x60, 0x24, 0x93, 0x31, 0x68,
+  0x2d, 0x84, 0xe0, 0x61, 0x82, 0x77, 0x28, 0x71, 0x5c, 0x6f, 0x66, 0xd8,
+  0x88, 0x10, 0x5b, 0x33, 0xb9, 0x09, 0x0d, 0x6f, 0x52, 0x27, 0xbe, 0xcb,
+  0xeb, 0x5a, 0x01, 0xb9, 0x73, 0xbd, 0x0f, 0x3e, 0xa1, 0x0b, 0x90, 0x98,
+  0x89, 0x7d, 0x47, 0x7f, 0x5c, 0x50, 0x22, 0x3c, 0xe3, 0x84, 0x01, 0x4d,
+  0x61, 0x9a, 0x42, 0x18, 0xc3, 0xf6, 0xa8, 0x31, 0xb9, 0x87, 0xf6, 0x59,
+  0xc1, 0x2d, 0x70, 0x12, 0x9a, 0xb0, 0xc0, 0x2c, 0x78, 0xab, 0x50, 0xb2,
+  0x91, 0x3b, 0xa3, 0xbc, 0x65, 0x04, 0xb4, 0xe5, 0x47, 0xd2, 0xeb, 0xbf,
+  0xc0, 0x1c, 0xa6, 0x5f, 0x23, 0x0c, 0xf4, 0x11, 0xdc, 0xbe, 0x47, 0x36,
+  0x11, 0xe2, 0xdc, 0x73, 0x17, 0x16, 0x67, 0x87, 0x2d, 0x62, 0x3d, 0x0e,
+  0x32, 0xde, 0x51, 0x88, 0x4e, 0x1d, 0x02, 0x93, 0x23, 0xbf, 0x01, 0x3a,
+  0x63, 0x0d, 0xd8, 0x45, 0x18, 0x98, 0x68, 0x05, 0xb8, 0x8f, 0x63, 0x8b,
+  0xc1, 0x73, 0xa3, 0xc7, 0x60, 0x39, 0xf4, 0x41, 0x16, 0x7e, 0x66, 0x27,
+  0xee, 0xfd, 0x5a, 0xaa, 0x0b, 0xb4, 0xe4, 0x3c, 0x8f, 0x90, 0xed, 0x87,
+  0x8c, 0xac, 0xd2, 0xc8, 0x95, 0xd0, 0x79, 0xed, 0xd8, 0x4a, 0x84, 0xfd,
+  0xa6, 0xa0, 0xa3, 0x7b, 0xdf, 0xda, 0xbf, 0x3d, 0x5e, 0xe5, 0x97, 0x34,
+  0xff, 0x1b, 0x81, 0x3b, 0xb3, 0xcc, 0xaf, 0x75, 0xfe, 0xaf, 0x70, 0xfe,
+  0x6f, 0x76, 0xe1, 0xca, 0xce, 0xff, 0xdd, 0xbd, 0xc7, 0xf9, 0xff, 0x41,
+  0x2e, 0x70, 0xec, 0xd7, 0xe8, 0x3d, 0xd1, 0xc1, 0x81, 0xeb, 0x05, 0x47,
+  0xe1, 0x59, 0x0b, 0x70, 0x14, 0xcc, 0xa1, 0x9b, 0xb6, 0xe1, 0xdc, 0xfc,
+  0xe8, 0x13, 0xc9, 0x38, 0xd8, 0xb9, 0xdf, 0x67, 0xdb, 0x47, 0x47, 0x47,
+  0x3b, 0x70, 0xa5, 0xee, 0xec, 0x90, 0x51, 0x00, 0xab, 0x69, 0x70, 0x4e,
+  0xe4, 0x16, 0x5c, 0x1a, 0x78, 0x3f, 0xf4, 0x42, 0xfc, 0x36, 0x73, 0x68,
+  0x7c, 0xb1, 0xed, 0xce, 0xa9, 0x07, 0x61, 0x3f, 0xae, 0xbd, 0x11, 0x62,
+  0x07, 0xa0, 0xb6, 0xc8, 0x36, 0xfc, 0x23, 0x97, 0x86, 0x17, 0xc0, 0xa4,
+  0xc7, 0x1c, 0xee, 0x60, 0xf0, 0xee, 0x9c, 0x5c, 0x7a, 0xee, 0xbf, 0xa8,
+  0x09, 0x33, 0x05, 0x3a, 0x18, 0x8f, 0x95, 0x9f, 0xcc, 0x0d, 0x13, 0x6f,
+  0x5b, 0x26, 0x75, 0xc0, 0x27, 0x2e, 0x5a, 0xbb, 0x0d, 0x82, 0xbe, 0x98,
+  0x57, 0xe8, 0x2d, 0x4d, 0x3a, 0x67, 0xd8, 0xbb, 0x08, 0x38, 0xa2, 0x94,
+  0xdc, 0xe2, 0xd2, 0xf9, 0xf9, 0xb3, 0x67, 0xb6, 0xbd, 0x98, 0xed, 0xba,
+  0xde, 0xcd, 0xb3, 0x41, 0xff, 0xb4, 0x37, 0x1c, 0xf5, 0x76, 0x83, 0x65,
+  0xc0, 0x04, 0xb4, 0x05, 0x94, 0xe5, 0x4c, 0x71, 0xb6, 0xc0, 0xda, 0xbc,
+  0xf2, 0xe5, 0xd9, 0xfb, 0x1d, 0xc1, 0x67, 0xa7, 0x3f, 0xa1, 0x4e, 0x60,
+  0xc1, 0x1c, 0xeb, 0x3d, 0x17, 0x22, 0xec, 0x20, 0xe7, 0x5f, 0xfa, 0xd7,
+  0x6f, 0x18, 0xe7, 0x1d, 0x1a, 0x71, 0xe6, 0x6d, 0x11, 0xfa, 0xf9, 0x02,
+  0x17, 0x57, 0xcf, 0xb3, 0x24, 0xa4, 0xc0, 0x99, 0xec, 0xe4, 0xfa, 0xe2,
+  0xbc, 0x7f, 0x9a, 0x09, 0xd6, 0xe2, 0x42, 0xe9, 0xe8, 0x65, 0x3c, 0x23,
+  0xa7, 0xcb, 0xc0, 0x45, 0xe7, 0xca, 0xf8, 0xf1, 0xff, 0xe3, 0x2d, 0xe9,
+  0x8c, 0xb6, 0x40, 0xbc, 0xea, 0x0d, 0x4e, 0xde, 0xf7, 0xce, 0x48, 0x23,
+  0x7f, 0xeb, 0xf4, 0x62, 0x38, 0x7a, 0x7b, 0xde, 0x23, 0xcd, 0xfc, 0xad,
+  0x93, 0xd3, 0x7f, 0xbe, 0xed, 0x5f, 0xf5, 0x48, 0x4b, 0x09, 0xd8, 0x3b,
+  0x19, 0xf5, 0x48, 0x5b, 0x59, 0x0b, 0x6f, 0x93, 0x4e, 0xfe, 0xd6, 0xa8,
+  0xf7, 0x4f, 0xfd, 0x74, 0x74, 0x4d, 0xf6, 0x58, 0x38, 0x72, 0xce, 0x96,
+  0x9c, 0xc4, 0xf5, 0xd0, 0x62, 0x61, 0xfa, 0x05, 0x15, 0x45, 0x93, 0x15,
+  0x75, 0xc2, 0x19, 0xe1, 0xcf, 0x67, 0xf8, 0xc2, 0x54, 0x67, 0x54, 0xba,
+  0x47, 0x6d, 0x63, 0x09, 0xb6, 0x7d, 0x94, 0x6b, 0x5a, 0x3d, 0x4f, 0x8c,
+  0xfb, 0xa9, 0x21, 0xcc, 0xe3, 0x47, 0xb9, 0xc6, 0x2a, 0x88, 0x0d, 0x93,
+  0xc7, 0x43, 0x47, 0xb9, 0xe6, 0x2b, 0x88, 0x41, 0x0c, 0x6a, 0xf8, 0x34,
+  0x23, 0x06, 0x2a, 0x44, 0x8d, 0x8c, 0x15, 0x32, 0xc8, 0x58, 0x41, 0x41,
+  0xec, 0xd3, 0x3f, 0x75, 0x13, 0xa2, 0xa0, 0xa3, 0x9c, 0xd2, 0xea, 0x5b,
+  0x9f, 0x52, 0xa4, 0xfc, 0x34, 0xe3, 0x49, 0x32, 0x36, 0x41, 0x6f, 0xbe,
+  0xac, 0x43, 0x9d, 0xdf, 0xab, 0xb1, 0x53, 0xfd, 0x9a, 0x18, 0xc5, 0xec,
+  0xd0, 0xfe, 0x61, 0x8e, 0x06, 0xc3, 0xf8, 0x98, 0x04, 0x7f, 0xe4, 0x49,
+  0xa4, 0x53, 0x97, 0x31, 0xa5, 0xaf, 0x26, 0x4d, 0x1d, 0xd1, 0x8c, 0x89,
+  0xc3, 0x02, 0x5c, 0x3c, 0x24, 0x90, 0x20, 0xe2, 0xaf, 0x12, 0xc4, 0x34,
+  0x75, 0x58, 0x40, 0x0e, 0x83, 0x23, 0xa6, 0x81, 0xef, 0x25, 0x78, 0x32,
+  0x65, 0xa8, 0x24, 0xc5, 0x05, 0x43, 0x4c, 0x82, 0x3f, 0x4a, 0xd0, 0x52,
+  0xb4, 0xa1, 0x9a, 0x38, 0x5e, 0x90, 0x24, 0xa0, 0x15, 0x50, 0xb3, 0xd0,
+  0x05, 0x55, 0x30, 0x70, 0x43, 0xd3, 0x0c, 0x9a, 0x5d, 0x3d, 0x48, 0x75,
+  0x28, 0x16, 0x94, 0x55, 0x68, 0xb7, 0x32, 0x15, 0xb0, 0x20, 0x5f, 0x41,
+  0x2c, 0xf8, 0x62, 0xca, 0xfc, 0x02, 0x30, 0xe9, 0x02, 0x0e, 0x7c, 0xa0,
+  0xa7, 0xfa, 0x22, 0x2e, 0x2c, 0x13, 0x46, 0xae, 0x13, 0x96, 0x57, 0x52,
+  0xb7, 0x38, 0x55, 0x5a, 0x59, 0x4f, 0xe1, 0x8a, 0x6a, 0x6a, 0x65, 0xa5,
+  0x4a, 0x2b, 0xab, 0x38, 0x5c, 0x51, 0x2d, 0xbe, 0x0d, 0xeb, 0x3c, 0x05,
+  0x2f, 0x2c, 0x2d, 0xe3, 0x95, 0xaa, 0x15, 0xae, 0xa8, 0x86, 0xb7, 0xa7,
+  0x8a, 0xae, 0x9a, 0x96, 0xf6, 0x54, 0xb6, 0x46, 0x58, 0x5a, 0x25, 0xba,
+  0x99, 0xeb, 0xa6, 0x69, 0x79, 0x2f, 0xe5, 0xea, 0x84, 0xe5, 0x95, 0xa2,
+  0xbb, 0xb9, 0x2e, 0x9a, 0x96, 0xf7, 0x50, 0xae, 0x4e, 0x58, 0x5e, 0x29,
+  0xba, 0x9b, 0xeb, 0x9e, 0x69, 0x79, 0xef, 0xe4, 0xea, 0x84, 0xe5, 0x95,
+  0xa2, 0x47, 0x1f, 0x32, 0x8f, 0xec, 0xc3, 0x12, 0x09, 0x3f, 0x4d, 0x1b,
+  0x16, 0x13, 0x8b, 0x27, 0x10, 0xb1, 0xdf, 0xcd, 0x3e, 0xe7, 0x11, 0x64,
+  0xf1, 0xe3, 0x9b, 0x98, 0x52, 0xf5, 0x40, 0x27, 0x91, 0x15, 0x1f, 0xa5,
+  0xa4, 0x64, 0x65, 0x05, 0x6a, 0x59, 0xd3, 0xb4, 0x61, 0x42, 0x2c, 0x4d,
+  0x6c, 0x53, 0xdb, 0x48, 0x05, 0x06, 0x7e, 0xe0, 0x85, 0x66, 0x20, 0x42,
+  0x03, 0x69, 0x4a, 0x23, 0x0b, 0xc3, 0x0e, 0xe9, 0x21, 0xcc, 0x91, 0xa2,
+  0x10, 0x2b, 0x1e, 0x26, 0x91, 0x90, 0x98, 0x4b, 0x5f, 0x0d, 0x4e, 0x5e,
+  0xeb, 0xfd, 0x61, 0xff, 0x9a, 0xfc, 0xd5, 0xf8, 0x94, 0xbd, 0xf9, 0xee,
+  0xe4, 0x8a, 0xdd, 0xab, 0x31, 0x2c, 0x8d, 0x88, 0xbf, 0x09, 0x88, 0x04,
+  0xad, 0x07, 0xd4, 0x0f, 0xf8, 0xe9, 0x08, 0x3c, 0x91, 0xb4, 0x9c, 0x43,
+  0x0c, 0x6a, 0x05, 0x35, 0x77, 0xcc, 0xa3, 0x5d, 0x36, 0x43, 0x6b, 0x24,
+  0x77, 0xfd, 0xb7, 0xd8, 0x58, 0x12, 0x48, 0x32, 0x08, 0x7f, 0xaa, 0x44,
+  0xb6, 0xb5, 0xda, 0xd3, 0x9a, 0xc0, 0xd1, 0x76, 0x8e, 0xb9, 0x08, 0x5a,
+  0x84, 0xb8, 0x52, 0x94, 0xa8, 0x66, 0x9e, 0xb5, 0x5a, 0x94, 0xea, 0x4d,
+  0xca, 0xc6, 0x23, 0x05, 0x7a, 0x31, 0xc1, 0xcf, 0x78, 0xd5, 0x15, 0xa2,
+  0xd6, 0x0b, 0x03, 0xa9, 0xd5, 0x58, 0xc7, 0x6e, 0xa0, 0x10, 0x5e, 0x3d,
+  0xd2, 0x44, 0xbe, 0xa1, 0x05, 0x32, 0x2a, 0x5a, 0x08, 0x86, 0xf8, 0x9a,
+  0x3a, 0x10, 0x9e, 0x9a, 0xc4, 0x73, 0xc3, 0x80, 0x3d, 0xa6, 0xc1, 0xe7,
+  0x31, 0x69, 0xa6, 0x96, 0x23, 0xa1, 0x4c, 0xa8, 0x0f, 0x71, 0xe4, 0xa4,
+  0x42, 0x0f, 0xe4, 0x7a, 0x81, 0x9f, 0xe5, 0xcb, 0xc9, 0x25, 0x10, 0xeb,
+  0xb9, 0x98, 0x37, 0xdf, 0x05, 0xab, 0x10, 0x4a, 0xba, 0x81, 0x4b, 0x52,
+  0xc3, 0xdd, 0x1d, 0x1c, 0x6c, 0xee, 0x54, 0xd7, 0x49, 0xac, 0x43, 0x18,
+  0xf4, 0xb8, 0x3f, 0x2a, 0x7e, 0x1e, 0x56, 0x6b, 0x15, 0xeb, 0xd1, 0x04,
+  0x6b, 0x1b, 0x40, 0x34, 0x12, 0xcc, 0xf0, 0x1c, 0x61, 0x2d, 0xd2, 0xd2,
+  0x4a, 0x28, 0x19, 0x4b, 0x6e, 0x24, 0x41, 0xd7, 0x54, 0x27, 0x4f, 0x01,
+  0xaf, 0x0e, 0x82, 0xb1, 0x76, 0xad, 0x44, 0xe3, 0x58, 0x9f, 0x72, 0x56,
+  0xc3, 0x10, 0x37, 0xeb, 0x41, 0x21, 0x9e, 0x52, 0xff, 0xa4, 0xa4, 0x0b,
+  0x0b, 0x47, 0x11, 0x3b, 0x52, 0xba, 0xee, 0xf8, 0x91, 0x65, 0x79, 0x88,
+  0x2e, 0x5c, 0xdd, 0x6d, 0x05, 0x58, 0x52, 0x23, 0x37, 0xea, 0xc1, 0x04,
+  0x6b, 0x6d, 0x29, 0x8a, 0xb0, 0xf2, 0xe6, 0x80, 0xd2, 0xc5, 0x7a, 0x53,
+  0x75, 0x0b, 0x59, 0xc3, 0x2b, 0xd2, 0x25, 0x84, 0xc8, 0xce, 0xcd, 0x26,
+  0xa3, 0xf2, 0x81, 0xfa, 0x13, 0x5c, 0xea, 0xc6, 0x43, 0xf2, 0x2b, 0xd8,
+  0x46, 0xa4, 0xb0, 0xc8, 0x3e, 0x40, 0xbc, 0x8a, 0x56, 0xf2, 0x10, 0xb6,
+  0x11, 0x49, 0xb7, 0x81, 0xb7, 0x40, 0xc8, 0x22, 0xa3, 0xd8, 0xc8, 0x55,
+  0x98, 0xee, 0x6c, 0x6e, 0x30, 0x7f, 0x23, 0xd0, 0x20, 0x3a, 0x82, 0x75,
+  0x61, 0xde, 0xd2, 0xa0, 0x00, 0xfe, 0x22, 0x68, 0x8c, 0xee, 0x87, 0xa6,
+  0x49, 0x7d, 0xbf, 0x4e, 0xa6, 0x86, 0x65, 0x87, 0x1e, 0xd5, 0x1e, 0x76,
+  0x02, 0x10, 0x72, 0x54, 0xe9, 0xa5, 0xbc, 0x85, 0x64, 0xdb, 0xcd, 0x0d,
+  0x25, 0x69, 0x24, 0x37, 0x96, 0x86, 0xa2, 0x91, 0x87, 0x85, 0xfd, 0x5a,
+  0xa0, 0xcb, 0x62, 0x15, 0x6a, 0x19, 0x01, 0x2b, 0xf6, 0x09, 0x29, 0xeb,
+  0x14, 0xa9, 0xb1, 0xd5, 0xae, 0xdc, 0x43, 0xa2, 0x4d, 0xac, 0xe6, 0x8e,
+  0x1a, 0x1f, 0x1e, 0x6d, 0x86, 0xd9, 0x4c, 0xf3, 0xf3, 0x6c, 0x06, 0x35,
+  0x59, 0xc5, 0x62, 0x56, 0xd9, 0x4c, 0xaa, 0x47, 0x56, 0x58, 0xcc, 0x9a,
+  0x36, 0xb3, 0x89, 0xc5, 0x4c, 0x69, 0x60, 0xde, 0xe2, 0x4b, 0x02, 0x49,
+  0x38, 0x82, 0x3b, 0x00, 0xce, 0x44, 0xcb, 0x06, 0xee, 0x85, 0x94, 0x2a,
+  0x36, 0x45, 0x5c, 0x92, 0x96, 0xe7, 0x71, 0x0b, 0x64, 0xf3, 0xc3, 0x71,
+  0x45, 0xd9, 0x14, 0x94, 0x95, 0x65, 0x63, 0x07, 0xf7, 0x0b, 0x64, 0x83,
+  0x7b, 0x05, 0xb2, 0xb9, 0x5e, 0x45, 0xd1, 0xf2, 0x84, 0x95, 0x25, 0x73,
+  0xbd, 0x42, 0xc1, 0x5c, 0xaf, 0x40, 0xae, 0x65, 0x65, 0xc1, 0x14, 0x94,
+  0x95, 0x25, 0x5b, 0x96, 0x88, 0xb6, 0x2c, 0x94, 0x0d, 0x38, 0x54, 0xb5,
+  0xb5, 0x3c, 0x65, 0x75, 0x5b, 0x73, 0x4a, 0x6c, 0xcd, 0x01, 0x5b, 0xa3,
+  0xcb, 0x80, 0x7a, 0x0e, 0x3f, 0x06, 0x17, 0x2d, 0xd9, 0x6f, 0x71, 0xb3,
+  0x5f, 0x67, 0x47, 0xe7, 0x48, 0x4d, 0x7e, 0x20, 0xaf, 0x1d, 0xa6, 0xe8,
+  0x93, 0x45, 0x7e, 0x59, 0x8d, 0x8c, 0x5c, 0x32, 0xad, 0x08, 0x76, 0x8a,
+  0x80, 0xc4, 0xfa, 0x57, 0x21, 0x22, 0x3e, 0x36, 0x36, 0xec, 0x75, 0x44,
+  0x2c, 0xad, 0x91, 0x5d, 0x2b, 0x49, 0xb4, 0x39, 0x11, 0x53, 0x40, 0x59,
+  0x19, 0xd9, 0x72, 0x3e, 0x26, 0xb5, 0x7c, 0x88, 0xa9, 0xcd, 0x0f, 0xfa,
+  0xd4, 0xa3, 0x54, 0x3e, 0xba, 0x52, 0xe7, 0xb2, 0x31, 0xc7, 0x9f, 0x63,
+  0x9e, 0xaa, 0x74, 0xf1, 0xf2, 0x3f, 0x35, 0x35, 0x1e, 0x61, 0x80, 0xee,
+  0x14, 0xe6, 0x0f, 0x46, 0xa5, 0x41, 0xe8, 0xc8, 0xfe, 0x6e, 0xa9, 0x65,
+  0x91, 0x9f, 0x7c, 0x10, 0xf1, 0x1c, 0xa6, 0x4e, 0xaa, 0x68, 0x8e, 0x3d,
+  0x4a, 0x20, 0xe2, 0x49, 0x45, 0xae, 0x4a, 0x26, 0x07, 0x52, 0xb4, 0xbd,
+  0xf7, 0x65, 0x0f, 0x40, 0xc6, 0xfb, 0xff, 0xdf, 0x2c, 0xff, 0x4f, 0xa3,
+  0xd5, 0x6a, 0x75, 0x44, 0xfe, 0x9f, 0xc6, 0x7e, 0x67, 0x9f, 0xed, 0xff,
+  0xef, 0x3f, 0xe6, 0xff, 0x7a, 0x98, 0x8b, 0xe7, 0xff, 0xe9, 0xec, 0x36,
+  0xd7, 0xce, 0x00, 0x34, 0x52, 0x65, 0x00, 0x1a, 0xa9, 0x33, 0x00, 0xd1,
+  0x54, 0x06, 0xa0, 0xf2, 0x17, 0xd2, 0x36, 0x7b, 0x17, 0x61, 0xbb, 0xca,
+  0xfb, 0x0e, 0x98, 0xbb, 0xa1, 0x94, 0x83, 0x7c, 0xa6, 0x7f, 0x29, 0x9f,
+  0xe9, 0xaf, 0x93, 0x7b, 0xe9, 0xe7, 0x58, 0x7a, 0x47, 0x41, 0xfd, 0x72,
+  0x42, 0x47, 0x4a, 0xb9, 0x70, 0xcf, 0xdf, 0x48, 0x58, 0xb2, 0x94, 0x0b,
+  0x4b, 0xfe, 0x4e, 0x0a, 0x96, 0xa9, 0x5f, 0x17, 0x5e, 0x16, 0xbe, 0x05,
+  0x80, 0xcf, 0xb7, 0xbf, 0x91, 0xf4, 0xc7, 0x9b, 0x49, 0x1f, 0xbd, 0x07,
+  0x02, 0xce, 0xcf, 0x33, 0x4c, 0xc5, 0x9b, 0x26, 0x4c, 0x86, 0x82, 0x37,
+  0x7d, 0x2d, 0xf2, 0x94, 0xb4, 0x8b, 0xdf, 0xf6, 0x05, 0x53, 0xa5, 0x5e,
+  0x01, 0xe4, 0x22, 0x42, 0x4e, 0x5e, 0x91, 0x48, 0xe9, 0xe3, 0x10, 0x1b,
+  0xc2, 0xe0, 0xa1, 0x74, 0x91, 0x7f, 0x3f, 0x62, 0x99, 0xe2, 0x3a, 0xb5,
+  0x5d, 0x03, 0x67, 0x78, 0x18, 0x11, 0x2c, 0x89, 0xc8, 0x3c, 0x3e, 0xcf,
+  0x1f, 0xa9, 0x9f, 0x8c, 0x39, 0xc3, 0x59, 0xd4, 0x09, 0xbc, 0x8a, 0x9f,
+  0xbc, 0xbc, 0x52, 0x51, 0xd9, 0x33, 0x4c, 0x95, 0xd1, 0xec, 0xb2, 0x57,
+  0x57, 0x34, 0x0d, 0x00, 0x7e, 0x3a, 0xe2, 0x49, 0x3a, 0xb6, 0x79, 0x92,
+  0x0e, 0x59, 0xe7, 0xbe, 0xc2, 0x50, 0x78, 0x96, 0x93, 0x79, 0xf2, 0xce,
+  0x42, 0x25, 0x19, 0xe5, 0xa6, 0x01, 0x3d, 0x10, 0xce, 0x34, 0xc5, 0x4b,
+  0x2c, 0x28, 0x1c, 0xbe, 0xc6, 0xe5, 0x93, 0xe7, 0xb8, 0x3c, 0xc6, 0x9f,
+  0xad, 0xf4, 0xcf, 0x4e, 0xfa, 0xe7, 0x41, 0xf4, 0x53, 0xf5, 0xa2, 0x4b,
+  0x6a, 0x76, 0x7b, 0x3c, 0xde, 0xff, 0xad, 0xae, 0x68, 0xfe, 0x5f, 0x18,
+  0x9e, 0xe1, 0xdd, 0xf8, 0xdf, 0x24, 0xff, 0xe7, 0x5e, 0xa7, 0x9d, 0xcf,
+  0xff, 0xd9, 0x7e, 0x9c, 0xff, 0x1f, 0xe2, 0x7a, 0xb6, 0xcd, 0x8e, 0xde,
+  0x25, 0x67, 0x00, 0x6f, 0x0d, 0x9f, 0x38, 0x2e, 0x31, 0xdd, 0xf9, 0xbd,
+  0x67, 0xdd, 0xdc, 0xe2, 0x89, 0x63, 0x71, 0x92, 0x04, 0x0f, 0xef, 0x01,
+  0xd5, 0xdc, 0x36, 0x4c, 0x76, 0xf6, 0x85, 0x9d, 0xc7, 0xbb, 0x0c, 0xc7,
+  0xb0, 0x02, 0x22, 0x67, 0xee, 0xcc, 0xb0, 0xf8, 0xb9, 0xb9, 0xd4, 0x71,
+  0xc2, 0xb9, 0x74, 0xa4, 0xef, 0xae, 0xdb, 0x21, 0x30, 0x03, 0xdf, 0xdc,
+  0xed, 0x78, 0xa1, 0x13, 0x58, 0x33, 0x0a, 0x77, 0xcd, 0x0f, 0xc6, 0x0d,
+  0x65, 0xd5, 0x86, 0x2e, 0xb9, 0x33, 0x3c, 0x58, 0x81, 0x05, 0xf7, 0x58,
+  0xf1, 0xc6, 0x5a, 0x50, 0x07, 0x3d, 0xf3, 0x14, 0x0f, 0xfe, 0xb9, 0xf1,
+  0x21, 0x6c, 0x72, 0xd6, 0x1f, 0x9d, 0x0e, 0x4e, 0xfa, 0xe7, 0xbd, 0x2b,
+  0x76, 0xee, 0x8f, 0x89, 0xc1, 0x18, 0xc5, 0x50, 0x52, 0x8c, 0xf2, 0xee,
+  0xe4, 0xea, 0xe4, 0xea, 0xf5, 0x48, 0x8e, 0x50, 0x92, 0x22, 0xf0, 0x40,
+  0x9e, 0x07, 0xce, 0xf8, 0xc9, 0xb5, 0xe5, 0xdc, 0x9f, 0x9e, 0x62, 0xab,
+  0xf1, 0x60, 0x0c, 0xf0, 0xb3, 0x66, 0x73, 0x9b, 0xce, 0xa8, 0x13, 0xf8,
+  0xe4, 0x45, 0x3c, 0x30, 0x8e, 0x77, 0x9f, 0xc4, 0x35, 0xae, 0xe8, 0x02,
+  0xcf, 0xac, 0xdf, 0xbb, 0xa1, 0x07, 0x9a, 0xc2, 0xc3, 0xe6, 0x2e, 0x3b,
+  0xa2, 0x8d, 0xe7, 0xe8, 0x80, 0x9a, 0x13, 0xff, 0x2d, 0x8e, 0x40, 0x47,
+  0xe3, 0xdf, 0xfa, 0x76, 0xf9, 0x3f, 0x21, 0xfe, 0xdf, 0xcf, 0xe5, 0xff,
+  0xec, 0xee, 0x3f, 0x8e, 0xff, 0x87, 0xb8, 0x78, 0xfc, 0xff, 0xec, 0xe4,
+  0xdd, 0xfb, 0x2a, 0x0b, 0x80, 0x5d, 0x02, 0xc3, 0x9b, 0x92, 0xd6, 0x5e,
+  0x97, 0x8c, 0xad, 0x20, 0x3a, 0xd4, 0xeb, 0xb1, 0x57, 0x23, 0xe6, 0x9e,
+  0x8b, 0x8f, 0x3e, 0xd1, 0x51, 0xf8, 0x24, 0xb8, 0x73, 0x09, 0x0b, 0x3a,
+  0x80, 0xea, 0xd6, 0xb0, 0x17, 0xd4, 0xdf, 0x4d, 0x0d, 0xcc, 0xbe, 0x6a,
+  0xf1, 0xd0, 0xaf, 0xb0, 0x78, 0x90, 0x8e, 0xac, 0x2a, 0xb3, 0x8a, 0x46,
+  0xc1, 0xda, 0x0c, 0x65, 0x5c, 0x91, 0xd7, 0xb1, 0xdd, 0x2a, 0xc8, 0x09,
+  0x0a, 0x75, 0x57, 0x26, 0x24, 0xcd, 0x54, 0x4e, 0x65, 0x04, 0x85, 0xfa,
+  0x2b, 0xd3, 0x63, 0x66, 0xea, 0xcb, 0x72, 0xaf, 0x4e, 0x26, 0x5a, 0x2a,
+  0xf9, 0xda, 0xd5, 0x73, 0xb2, 0xaf, 0x8d, 0x20, 0x72, 0x7a, 0x1e, 0xf8,
+  0xeb, 0x36, 0x3b, 0x95, 0xca, 0xb4, 0xb3, 0x3a, 0x95, 0xa9, 0xa8, 0x8e,
+  0x47, 0x2b, 0xb8, 0xc6, 0x32, 0x2f, 0x6d, 0xb3, 0x5e, 0x9f, 0x31, 0x25,
+  0xc6, 0xb9, 0x38, 0x7d, 0x39, 0x19, 0x19, 0x12, 0x24, 0xb9, 0xc8, 0xf2,
+  0xff, 0xca, 0x32, 0x7d, 0xa5, 0xc1, 0x9b, 0x88, 0xcc, 0x85, 0x98, 0xe6,
+  0xc0, 0xa7, 0x75, 0xd5, 0xbf, 0xea, 0xe0, 0x09, 0x36, 0xdd, 0xaf, 0x8b,
+  0xa6, 0xd2, 0x6e, 0xfc, 0x6d, 0x2f, 0xfe, 0xd6, 0xa9, 0xaf, 0x78, 0x7e,
+  0x2f, 0xe8, 0xda, 0x71, 0x8d, 0x56, 0xfc, 0xad, 0x19, 0x7f, 0x6b, 0xe4,
+  0x1a, 0x90, 0xce, 0x0e, 0x56, 0x47, 0x46, 0x8c, 0x2d, 0x0a, 0x41, 0xf7,
+  0xab, 0x37, 0xc4, 0x93, 0x5a, 0xd2, 0x50, 0x70, 0x4e, 0xa4, 0x69, 0xaf,
+  0x6a, 0x49, 0xd2, 0xe4, 0xbc, 0x1a, 0x12, 0xd5, 0xec, 0x7f, 0x9d, 0xa6,
+  0xf0, 0x9c, 0xa3, 0xbe, 0x48, 0xb3, 0x25, 0x6c, 0xaf, 0x20, 0x47, 0x28,
+  0x56, 0x53, 0x64, 0x1c, 0xcd, 0xa0, 0x85, 0x6b, 0xc0, 0x95, 0x64, 0x1c,
+  0x65, 0x7a, 0xe6, 0x49, 0x47, 0x23, 0x45, 0x8b, 0xec, 0x5b, 0xc8, 0x2f,
+  0xc9, 0x14, 0x2a, 0x84, 0x2a, 0x4c, 0xe5, 0x15, 0xe3, 0x84, 0xab, 0x81,
+  0x0a, 0x32, 0x8e, 0x0a, 0x1f, 0xc6, 0xb1, 0x30, 0x1b, 0x97, 0xaf, 0x4f,
+  0xf9, 0xe2, 0x3c, 0x46, 0xc8, 0xa4, 0x1c, 0x2d, 0x50, 0x0f, 0xcb, 0x39,
+  0xea, 0xc7, 0x15, 0x63, 0x21, 0x56, 0x26, 0x93, 0x92, 0x6d, 0x0f, 0x73,
+  0x8e, 0xae, 0xc4, 0x50, 0xa4, 0x48, 0x92, 0x30, 0x58, 0xce, 0xd1, 0x95,
+  0x18, 0x8a, 0x8c, 0xa3, 0x12, 0x06, 0xcb, 0x39, 0xba, 0x12, 0x43, 0x91,
+  0x71, 0x54, 0xc2, 0x98, 0xce, 0x0a, 0x35, 0x12, 0x7f, 0x33, 0xb3, 0x32,
+  0x81, 0x7e, 0xcc, 0xb2, 0xb6, 0x61, 0x1e, 0x53, 0xa5, 0x5c, 0xc5, 0x89,
+  0x44, 0x0f, 0x3e, 0x2b, 0x8b, 0xa9, 0xcc, 0x1c, 0xf3, 0x98, 0x7e, 0x2e,
+  0xf3, 0xb5, 0xb2, 0x98, 0xca, 0xd6, 0xe5, 0x14, 0x59, 0x57, 0xfa, 0x11,
+  0x23, 0x94, 0x89, 0x94, 0x39, 0x7e, 0x92, 0xc4, 0xf4, 0x40, 0xf9, 0x84,
+  0x51, 0x42, 0x77, 0xbd, 0x4d, 0xc0, 0x3f, 0x56, 0x03, 0x5f, 0x6e, 0x86,
+  0xfe, 0x47, 0x09, 0xba, 0x78, 0x6a, 0xc4, 0x86, 0x2c, 0x4b, 0x58, 0x81,
+  0xdf, 0xe6, 0xbe, 0x48, 0x9b, 0xc1, 0x07, 0x6e, 0x9c, 0x13, 0xb3, 0x6a,
+  0xa6, 0x91, 0xa2, 0x04, 0x23, 0x88, 0x2d, 0x1e, 0x06, 0x4e, 0x93, 0x2c,
+  0x23, 0xa2, 0x2d, 0xf1, 0x23, 0x3b, 0xec, 0xf4, 0x1a, 0x3e, 0x9f, 0x6b,
+  0x6a, 0x60, 0xc8, 0x9d, 0x43, 0x92, 0x63, 0x6f, 0x31, 0x96, 0x16, 0x98,
+  0x78, 0x33, 0xfe, 0xd6, 0x8a, 0xbf, 0xe5, 0x44, 0x29, 0x48, 0xf0, 0x21,
+  0x0f, 0xab, 0xdc, 0xb3, 0x32, 0xf1, 0xad, 0x70, 0x58, 0x15, 0x67, 0x03,
+  0xe7, 0xd1, 0x63, 0x26, 0x08, 0x99, 0x64, 0x82, 0x90, 0x49, 0x2e, 0x0a,
+  0x59, 0x31, 0x11, 0x4d, 0xd2, 0xa1, 0x47, 0x2e, 0x33, 0xb8, 0x84, 0x89,
+  0x5b, 0xfc, 0x75, 0x65, 0x7e, 0xf0, 0x12, 0x4c, 0x39, 0x53, 0x77, 0x3b,
+  0xc9, 0xd4, 0xdd, 0x92, 0x92, 0x76, 0xe7, 0x13, 0x83, 0x4b, 0x4c, 0x0b,
+  0xd3, 0x89, 0x96, 0x32, 0x5e, 0x2b, 0x95, 0x37, 0xab, 0xa8, 0x9e, 0x58,
+  0x27, 0x99, 0x99, 0x75, 0x0d, 0xc4, 0x6a, 0x73, 0x6b, 0x36, 0x0f, 0x37,
+  0xe3, 0x99, 0x9a, 0x14, 0xcb, 0x13, 0x7a, 0xcb, 0xd3, 0x6b, 0x05, 0xac,
+  0x82, 0x19, 0x36, 0xd3, 0xd8, 0x24, 0x37, 0x37, 0x87, 0x48, 0xd0, 0xaa,
+  0xcc, 0x94, 0x93, 0xd4, 0x54, 0x59, 0x01, 0x46, 0x3d, 0x59, 0x4e, 0x52,
+  0xb3, 0x65, 0x05, 0x18, 0xf5, 0x7c, 0x39, 0x49, 0x4d, 0x98, 0x15, 0x60,
+  0xd4, 0x53, 0xe6, 0x24, 0x33, 0x67, 0xaa, 0x81, 0x92, 0xaf, 0xa5, 0xe3,
+  0xbb, 0x20, 0xe5, 0x31, 0x5f, 0xde, 0xa5, 0x07, 0xb8, 0x6f, 0xc1, 0xaf,
+  0xcc, 0x18, 0xb7, 0xd6, 0x1d, 0xe3, 0x56, 0x6a, 0x8c, 0xe7, 0xf3, 0xeb,
+  0x1e, 0x28, 0xf2, 0xeb, 0x96, 0x24, 0xc1, 0x45, 0xc4, 0x7c, 0xae, 0x27,
+  0x99, 0x8f, 0xc8, 0x40, 0x8b, 0xa2, 0xcb, 0x63, 0x62, 0x65, 0x06, 0xda,
+  0x2c, 0x46, 0xa8, 0x02, 0xa9, 0x98, 0x84, 0x36, 0x19, 0x64, 0x1c, 0x23,
+  0x11, 0xa1, 0x1e, 0xb3, 0x5a, 0x95, 0x87, 0x56, 0x1a, 0x5d, 0x29, 0x90,
+  0x24, 0x15, 0x6d, 0x29, 0x4c, 0xa6, 0x45, 0xa9, 0x94, 0xa9, 0xbc, 0x62,
+  0x82, 0xa1, 0x98, 0x6a, 0x2d, 0x79, 0xae, 0xfd, 0xa9, 0x7c, 0x26, 0xb7,
+  0xe4, 0x41, 0xb7, 0x31, 0x93, 0x9d, 0x8a, 0x4c, 0x32, 0x9b, 0xaa, 0xeb,
+  0xb2, 0xd9, 0xae, 0xc8, 0x26, 0x95, 0x01, 0x36, 0xcf, 0x64, 0xb5, 0x2b,
+  0xb2, 0xe4, 0xd8, 0x2c, 0x6d, 0x06, 0x85, 0x48, 0x8a, 0x34, 0x9f, 0x32,
+  0x12, 0x7b, 0x66, 0x50, 0x09, 0x48, 0x91, 0xe9, 0x53, 0x06, 0x5a, 0x56,
+  0x47, 0xfa, 0xa3, 0x34, 0x8a, 0xe7, 0x69, 0xcd, 0x78, 0x78, 0x55, 0x4b,
+  0x99, 0x64, 0x26, 0x72, 0x2b, 0x35, 0xce, 0x38, 0xbf, 0x5a, 0x22, 0x91,
+  0x0a, 0x44, 0x91, 0xd7, 0x4c, 0x16, 0x25, 0x9d, 0xd3, 0x4e, 0x48, 0x92,
+  0xec, 0x20, 0x1f, 0x48, 0x39, 0xed, 0x0e, 0x52, 0x39, 0xed, 0x5a, 0xf1,
+  0xb2, 0x5a, 0x9d, 0xd3, 0x0e, 0x3f, 0x3b, 0xec, 0x73, 0x8f, 0x7d, 0x76,
+  0xd9, 0xe7, 0xbe, 0x32, 0xd7, 0x9d, 0xbc, 0x05, 0xd8, 0x7f, 0xdc, 0x02,
+  0xfc, 0x26, 0x97, 0x9c, 0xff, 0x03, 0x37, 0x2e, 0xbe, 0x06, 0x8f, 0x95,
+  0xfb, 0x7f, 0xcd, 0xfd, 0x5c, 0xfe, 0xaf, 0xf6, 0xe3, 0xfe, 0xdf, 0x83,
+  0x5c, 0xa9, 0xac, 0x12, 0x57, 0xaf, 0xb3, 0x29, 0x25, 0x58, 0x89, 0x94,
+  0x05, 0x68, 0x1c, 0x5a, 0x76, 0x60, 0x39, 0xfa, 0xc2, 0xd0, 0x6d, 0x0b,
+  0xa6, 0x7a, 0xf1, 0x37, 0x39, 0x6a, 0x07, 0x05, 0xa8, 0xd0, 0x20, 0x4d,
+  0xcb, 0x8a, 0x64, 0x1a, 0xb0, 0xb5, 0x34, 0x05, 0x14, 0xc8, 0xf7, 0x71,
+  0xfb, 0x31, 0x4d, 0x80, 0x25, 0x32, 0x05, 0xb8, 0x8e, 0x34, 0x01, 0xc5,
+  0x33, 0x97, 0xf8, 0x5c, 0xd8, 0x5a, 0x82, 0x2b, 0x1e, 0x87, 0x37, 0x37,
+  0xf7, 0x64, 0x42, 0xe7, 0x50, 0x4c, 0x1d, 0xf3, 0x9e, 0xb8, 0x0e, 0x79,
+  0x7d, 0x7a, 0x8a, 0xdb, 0x96, 0xb6, 0x35, 0xb6, 0x5c, 0x7e, 0x98, 0x29,
+  0x6a, 0x58, 0xd4, 0x1c, 0x5d, 0xbf, 0x71, 0x42, 0x53, 0xcf, 0xb5, 0x4a,
+  0x7f, 0x77, 0xa2, 0x0f, 0xfa, 0xa3, 0x6b, 0xfd, 0xac, 0xf7, 0xaa, 0x3f,
+  0xec, 0x9d, 0xe5, 0xce, 0xe6, 0xa1, 0x9e, 0xfe, 0x96, 0x7e, 0x2b, 0x1a,
+  0xff, 0x81, 0x69, 0x62, 0x0a, 0x88, 0x6f, 0xb0, 0xff, 0xdf, 0xea, 0x76,
+  0x1a, 0xb9, 0xfc, 0x7f, 0xad, 0xee, 0xe3, 0xff, 0xff, 0xf7, 0x20, 0x17,
+  0x18, 0x30, 0x89, 0xfb, 0x7e, 0x8b, 0x4d, 0xd1, 0x43, 0x17, 0xb7, 0xd5,
+  0x6f, 0x78, 0x36, 0x20, 0x9e, 0x36, 0x6c, 0x4c, 0xa7, 0xf8, 0xd6, 0x64,
+  0x10, 0x6f, 0xed, 0xf3, 0x74, 0x37, 0x04, 0x54, 0x77, 0x43, 0x03, 0x32,
+  0x33, 0x4c, 0xa8, 0x01, 0x2b, 0x10, 0xf1, 0xdb, 0xf5, 0xf9, 0x0b, 0x0a,
+  0x8e, 0x48, 0x9e, 0x46, 0xef, 0x08, 0x83, 0xf4, 0x09, 0xa6, 0x60, 0x09,
+  0x58, 0x5a, 0x37, 0xe2, 0xb2, 0x74, 0x39, 0x04, 0x96, 0x3a, 0x01, 0xbb,
+  0x85, 0x3b, 0xf9, 0xa6, 0x39, 0x9f, 0xef, 0x9a, 0xcf, 0xf1, 0x38, 0xd2,
+  0xdc, 0x63, 0x39, 0x49, 0x6a, 0xda, 0x2e, 0x97, 0x2a, 0x75, 0xac, 0x80,
+  0x5a, 0x2c, 0xbb, 0x5a, 0x9c, 0xa2, 0xcd, 0x08, 0x48, 0x74, 0xa6, 0xc0,
+  0x00, 0x24, 0x1f, 0xdf, 0x8a, 0x13, 0x59, 0x7e, 0x03, 0x7e, 0x72, 0x41,
+  0x9c, 0xc2, 0x8a, 0xe8, 0x7d, 0x72, 0xba, 0xe3, 0xe3, 0xe6, 0x21, 0x30,
+  0x86, 0xca, 0xf8, 0x0e, 0x05, 0x40, 0xef, 0x30, 0x84, 0x1a, 0xf7, 0x1a,
+  0xa8, 0x02, 0x90, 0xef, 0xf4, 0x62, 0xf8, 0xaa, 0xff, 0x9a, 0x85, 0x51,
+  0x97, 0x57, 0x3d, 0x18, 0xff, 0xa3, 0x48, 0xa2, 0x24, 0xff, 0x9c, 0x8d,
+  0x3e, 0xc2, 0x42, 0x47, 0x83, 0xba, 0x08, 0x02, 0xea, 0xf9, 0xcf, 0x39,
+  0xcd, 0x0e, 0x77, 0x38, 0xf8, 0xe6, 0x2f, 0xf3, 0x81, 0x08, 0xca, 0xf8,
+  0xd9, 0xe1, 0xcc, 0xc1, 0x17, 0x46, 0xe6, 0xa0, 0x0f, 0xcc, 0x3b, 0x84,
+  0x3a, 0xf4, 0x5c, 0xb6, 0x99, 0x0a, 0x4a, 0x12, 0x67, 0x2c, 0xc6, 0xf7,
+  0x62, 0x4b, 0xc4, 0x74, 0x3d, 0x8f, 0xfa, 0x73, 0x97, 0x4b, 0x85, 0x69,
+  0xdf, 0x84, 0xa6, 0x53, 0x82, 0x73, 0x08, 0x4c, 0x40, 0x47, 0x29, 0xb6,
+  0x7e, 0x8a, 0x27, 0x93, 0x77, 0x4d, 0x7c, 0x92, 0x2a, 0x70, 0xb0, 0x37,
+  0x98, 0xa3, 0x73, 0xa7, 0x39, 0xce, 0x7e, 0x38, 0x9f, 0xbb, 0x4c, 0x5d,
+  0xa5, 0x22, 0xef, 0x46, 0x0d, 0x73, 0x1d, 0xfb, 0x5e, 0xd0, 0xf1, 0xa6,
+  0x43, 0xcd, 0xe3, 0x23, 0xd2, 0x61, 0x4d, 0x30, 0xcc, 0x20, 0x34, 0x6c,
+  0x20, 0x88, 0x55, 0x0e, 0xeb, 0x58, 0x7e, 0x8a, 0x83, 0x2e, 0xa9, 0x19,
+  0x06, 0xc6, 0xd8, 0xa6, 0xd1, 0x86, 0x8f, 0x79, 0x4b, 0xcd, 0x0f, 0x91,
+  0x15, 0xea, 0xbb, 0xb7, 0xbb, 0x5b, 0x22, 0xdf, 0x11, 0xe1, 0x99, 0x1c,
+  0x2f, 0x5e, 0xe9, 0x97, 0x17, 0x10, 0x1d, 0xf6, 0xae, 0x74, 0x1d, 0xb3,
+  0x67, 0x77, 0x58, 0x3d, 0xb0, 0xdc, 0x76, 0x0b, 0xf7, 0x97, 0xfd, 0x7b,
+  0x3f, 0xa0, 0xb3, 0x78, 0x83, 0x39, 0x36, 0x5a, 0xa8, 0x7d, 0x01, 0x1d,
+  0xf9, 0x72, 0x74, 0xa6, 0xeb, 0xac, 0x46, 0x92, 0x51, 0x28, 0x95, 0x1f,
+  0x52, 0xce, 0x94, 0x92, 0xa1, 0xcb, 0xa4, 0x9a, 0x64, 0x14, 0x3f, 0x50,
+  0xdb, 0xa7, 0x55, 0xf0, 0xa0, 0xc5, 0xe5, 0x70, 0x48, 0x20, 0xce, 0x88,
+  0xa4, 0xe9, 0xfa, 0x83, 0x4b, 0x88, 0xcd, 0x75, 0xd2, 0xcc, 0x96, 0x0f,
+  0xaf, 0xbb, 0x1d, 0x59, 0x98, 0x58, 0x22, 0x59, 0x57, 0x83, 0x8b, 0xe1,
+  0xeb, 0x8c, 0xa2, 0xba, 0x1d, 0x54, 0xd4, 0x2f, 0xd0, 0x4f, 0xee, 0x1d,
+  0x57, 0x54, 0x45, 0x7d, 0x54, 0x54, 0x8a, 0x8a, 0x6c, 0x30, 0xb8, 0xc4,
+  0x2c, 0x93, 0x6b, 0x34, 0x42, 0xa8, 0x15, 0x73, 0x4d, 0xb2, 0xe1, 0xcd,
+  0xa5, 0x96, 0xbb, 0xf7, 0xcb, 0xf5, 0x62, 0x46, 0xd6, 0x48, 0xd4, 0x1f,
+  0x48, 0x2a, 0x7d, 0x26, 0x98, 0x77, 0xb8, 0xcc, 0x59, 0x4f, 0xae, 0x05,
+  0x50, 0x0d, 0xa5, 0x47, 0xc9, 0x4f, 0x2e, 0x2f, 0x07, 0xbd, 0x3a, 0x01,
+  0xa3, 0xcb, 0xcb, 0x5b, 0xd4, 0x72, 0x22, 0xd2, 0x28, 0xaa, 0x4c, 0x41,
+  0xf4, 0x29, 0x26, 0x5f, 0xd4, 0x45, 0x7f, 0xa6, 0x00, 0xf5, 0xf3, 0x93,
+  0xf7, 0x70, 0xa7, 0xb1, 0xdc, 0x9f, 0xf2, 0x2b, 0x3d, 0x6e, 0xb2, 0xb6,
+  0x20, 0x35, 0x19, 0xef, 0x64, 0x2b, 0x0f, 0x94, 0xd6, 0xad, 0x24, 0x9d,
+  0x4a, 0x55, 0x8a, 0xe5, 0x66, 0x55, 0x85, 0x10, 0x07, 0x2a, 0xd8, 0x72,
+  0xec, 0x41, 0xa6, 0x0a, 0xcb, 0x1e, 0xfb, 0xb2, 0x7f, 0xad, 0x40, 0xbb,
+  0xb8, 0x3a, 0x03, 0xff, 0x30, 0xe8, 0x5f, 0x5f, 0x0f, 0x7a, 0x7a, 0x6f,
+  0x78, 0xd6, 0x3f, 0xc1, 0xdc, 0xae, 0xcd, 0x56, 0x3b, 0xdb, 0x70, 0x4e,
+  0xf8, 0x12, 0x7c, 0x7a, 0x4c, 0xd5, 0x69, 0xb7, 0xb2, 0x56, 0xfa, 0xf2,
+  0xd7, 0xeb, 0x9e, 0x20, 0xd5, 0x8b, 0xd0, 0xd3, 0xb9, 0x56, 0x7f, 0xe9,
+  0x0f, 0xdb, 0xad, 0x0c, 0x4a, 0x2a, 0xdd, 0x6d, 0x3a, 0x0d, 0x55, 0x96,
+  0x52, 0x4a, 0xaf, 0x99, 0x21, 0xe4, 0xc3, 0x7b, 0x95, 0x51, 0xa6, 0x58,
+  0xe5, 0x5d, 0x8f, 0x12, 0x9f, 0x3b, 0xa0, 0x7c, 0x87, 0xaf, 0x81, 0x25,
+  0xf9, 0x30, 0x4e, 0xb5, 0x22, 0xc3, 0x2e, 0xa3, 0x21, 0x89, 0x99, 0x20,
+  0xe1, 0xf0, 0x42, 0xbc, 0x71, 0x35, 0x4a, 0xdc, 0x45, 0x9e, 0xe4, 0xf4,
+  0xe2, 0x1c, 0x86, 0xd6, 0xfb, 0x32, 0x92, 0xeb, 0x37, 0x57, 0xbd, 0x93,
+  0x33, 0x8e, 0x82, 0x82, 0xfc, 0x87, 0xaa, 0x73, 0x32, 0xd5, 0xde, 0x5e,
+  0xbf, 0xd2, 0x9b, 0xdd, 0x42, 0x54, 0xbc, 0x2d, 0x7c, 0xb1, 0x6c, 0xe7,
+  0x49, 0x9a, 0xdf, 0x72, 0x03, 0x98, 0x50, 0xd3, 0xf6, 0xe7, 0xd4, 0xac,
+  0x2d, 0xf9, 0xcb, 0x46, 0xd2, 0xd1, 0x96, 0xa5, 0xa6, 0x65, 0x88, 0x4d,
+  0xa4, 0xde, 0xca, 0xf5, 0xf7, 0x2b, 0x8f, 0x52, 0xd5, 0x24, 0xf6, 0x7a,
+  0xf8, 0xf6, 0x14, 0x04, 0xfb, 0x59, 0x55, 0x7c, 0xde, 0x1f, 0x5e, 0xa0,
+  0xe5, 0xb6, 0x55, 0x37, 0x2f, 0x4f, 0xae, 0x4f, 0xdf, 0x0c, 0x7a, 0xef,
+  0x7a, 0x03, 0x1c, 0x75, 0x2a, 0x0a, 0xd6, 0xf4, 0xfe, 0x70, 0x00, 0x6b,
+  0x1d, 0x85, 0x07, 0x47, 0x4d, 0x0f, 0x46, 0xb9, 0xe2, 0xab, 0xb7, 0xc3,
+  0x1e, 0xb3, 0x0a, 0x36, 0x55, 0x0f, 0x4f, 0x06, 0x91, 0x3f, 0x55, 0xcf,
+  0xe2, 0x07, 0x91, 0xb3, 0x7f, 0xd5, 0x7f, 0x7f, 0xde, 0xc3, 0x47, 0x6a,
+  0x60, 0x4b, 0xb8, 0x29, 0x18, 0x60, 0x84, 0x17, 0xfa, 0x2c, 0xfe, 0xc1,
+  0xf0, 0xf0, 0x5f, 0xe1, 0x6c, 0x9e, 0x77, 0xa6, 0x31, 0x71, 0x94, 0xd4,
+  0x27, 0xfb, 0x7f, 0xfb, 0x4e, 0xc2, 0xd9, 0xec, 0xfe, 0xb7, 0x66, 0xf7,
+  0x77, 0x59, 0xf1, 0xb5, 0x1a, 0x4b, 0xd5, 0x4c, 0x27, 0xe2, 0x3f, 0xf5,
+  0x25, 0x9f, 0xd4, 0x7e, 0x8b, 0x4f, 0x2d, 0x0a, 0x37, 0x13, 0xb5, 0x24,
+  0x9a, 0x52, 0x18, 0x49, 0x51, 0x48, 0x20, 0x03, 0x65, 0xdd, 0x90, 0x02,
+  0xa8, 0x13, 0x4f, 0x05, 0x85, 0x36, 0xf0, 0x81, 0x7a, 0x0e, 0xb5, 0xc1,
+  0x14, 0x72, 0x14, 0x43, 0x1a, 0x94, 0x18, 0x49, 0x96, 0x7b, 0xca, 0x48,
+  0xb2, 0x1d, 0xb9, 0xd2, 0x48, 0x2e, 0x3d, 0xe3, 0x66, 0x66, 0x80, 0x05,
+  0x67, 0x2a, 0xf6, 0x06, 0xaf, 0xe2, 0xb1, 0x97, 0x48, 0x66, 0x18, 0x9e,
+  0x79, 0xcb, 0x12, 0x4e, 0xa7, 0xa8, 0x07, 0x17, 0xa7, 0x17, 0x57, 0x3d,
+  0x34, 0x00, 0x03, 0x1f, 0xe3, 0x63, 0x97, 0x1b, 0x37, 0x98, 0xf4, 0x9a,
+  0xb0, 0xff, 0x21, 0x80, 0x45, 0x73, 0x05, 0xda, 0x28, 0x0a, 0xeb, 0xd4,
+  0x8d, 0x3d, 0x19, 0x8e, 0xfa, 0xe0, 0xba, 0x5f, 0x5e, 0x9d, 0x5c, 0xfd,
+  0x0a, 0xc2, 0xe5, 0xd0, 0xd8, 0x94, 0x2d, 0xb0, 0x40, 0x1a, 0x3a, 0x0b,
+  0x71, 0x8d, 0xc2, 0x67, 0xf2, 0x1d, 0x7c, 0x66, 0x00, 0x81, 0xeb, 0xcc,
+  0xf8, 0x80, 0x91, 0xf3, 0xd8, 0xfc, 0xd1, 0x17, 0xc9, 0x4d, 0x71, 0x29,
+  0xe2, 0x47, 0xf1, 0xf7, 0xf3, 0xbc, 0x7d, 0x46, 0xb2, 0x70, 0xd0, 0x89,
+  0xe1, 0xdd, 0x41, 0x58, 0x4d, 0x67, 0x56, 0xe0, 0xe3, 0x39, 0x67, 0xe7,
+  0x7f, 0xdb, 0xbb, 0xf2, 0xe6, 0xb6, 0x71, 0x2b, 0xfe, 0x77, 0xf3, 0x29,
+  0x58, 0x67, 0x26, 0x43, 0x26, 0x92, 0xcd, 0x43, 0x97, 0x93, 0x74, 0x3b,
+  0x3e, 0xe4, 0x44, 0xb3, 0xb2, 0x94, 0xb1, 0xe4, 0x6d, 0x32, 0x9d, 0x96,
+  0x43, 0xcb, 0xb4, 0xa5, 0x5d, 0x5d, 0x4b, 0x4a, 0x8e, 0xed, 0x76, 0xf7,
+  0xb3, 0xf7, 0x3d, 0x1c, 0x24, 0x00, 0x82, 0xa4, 0x94, 0x38, 0xd9, 0x76,
+  0x2a, 0xce, 0x64, 0x57, 0x06, 0xde, 0x01, 0x3c, 0x3c, 0x3c, 0x1c, 0x04,
+  0x7f, 0x60, 0xab, 0x0b, 0x10, 0xff, 0xb6, 0x96, 0x65, 0xa6, 0x45, 0x3a,
+  0x41, 0x01, 0x0e, 0xb2, 0xe3, 0x59, 0x88, 0xb7, 0x43, 0x32, 0xe5, 0x3f,
+  0xc1, 0x45, 0x00, 0xae, 0x9c, 0x82, 0x29, 0x1e, 0x4a, 0xce, 0xf2, 0x66,
+  0x86, 0x40, 0x39, 0xff, 0x0c, 0x0f, 0xe9, 0x38, 0x0d, 0x76, 0x89, 0xb6,
+  0x74, 0x2b, 0x37, 0x2a, 0xc2, 0x7a, 0x12, 0x54, 0xf1, 0x9f, 0x11, 0x4e,
+  0x1b, 0xf5, 0xe2, 0xc9, 0x3b, 0xe3, 0x85, 0x41, 0xfa, 0x0d, 0x9e, 0x89,
+  0xc6, 0xe5, 0x01, 0x2c, 0x19, 0xfa, 0x03, 0xbc, 0x37, 0x68, 0x70, 0xfa,
+  0x23, 0xb3, 0x47, 0x9c, 0x29, 0xc9, 0x69, 0x1f, 0x86, 0x89, 0xcb, 0x01,
+  0xd4, 0x83, 0x45, 0x05, 0x12, 0x4e, 0x58, 0x79, 0x34, 0xcd, 0x0e, 0xb6,
+  0x38, 0x20, 0x88, 0xb3, 0x06, 0x46, 0xcc, 0xc9, 0xcd, 0x64, 0x64, 0xb0,
+  0xed, 0x9d, 0x98, 0x6d, 0xdb, 0x8c, 0xaa, 0x82, 0xed, 0x35, 0x36, 0x3f,
+  0x43, 0x00, 0xae, 0x36, 0x4c, 0x27, 0x86, 0xef, 0xfd, 0x7e, 0xaf, 0xfb,
+  0x49, 0x53, 0xfb, 0xfe, 0xc5, 0xb0, 0x73, 0xf6, 0xc9, 0x1f, 0xf4, 0x2f,
+  0x2f, 0x4e, 0xda, 0xcc, 0xaf, 0x0f, 0x0e, 0x52, 0x11, 0xe3, 0x20, 0xe6,
+  0x9b, 0x4a, 0x18, 0xb3, 0x6d, 0x8d, 0xbb, 0xf4, 0x4e, 0x2f, 0xfa, 0x1d,
+  0xd5, 0xf9, 0x8c, 0x63, 0x18, 0xea, 0x3a, 0x10, 0x34, 0xfb, 0x27, 0xc3,
+  0x2e, 0x46, 0xc8, 0x41, 0xe7, 0x5d, 0xaf, 0x7d, 0xda, 0x6b, 0x0f, 0x06,
+  0x7e, 0x1f, 0x46, 0xc2, 0x6e, 0xff, 0x88, 0xec, 0x1a, 0x09, 0x93, 0xdc,
+  0x2e, 0x8e, 0xe3, 0x14, 0xda, 0x55, 0x18, 0x40, 0xf1, 0x40, 0x2e, 0xe2,
+  0x87, 0x73, 0x20, 0x5e, 0xfe, 0x0e, 0x92, 0x9e, 0xb5, 0x45, 0x84, 0x6d,
+  0xba, 0x7c, 0xc6, 0xd5, 0x1f, 0x47, 0x72, 0xc5, 0xbf, 0x99, 0x27, 0xd2,
+  0xa5, 0xe2, 0x68, 0x35, 0x25, 0x3b, 0x5e, 0x31, 0x4a, 0xe2, 0x0b, 0xbd,
+  0x58, 0x3a, 0x81, 0x9b, 0x17, 0x30, 0x2e, 0x21, 0x44, 0x43, 0x50, 0xca,
+  0xcc, 0x15, 0xd4, 0x69, 0x74, 0x76, 0x2a, 0x2a, 0x70, 0x65, 0x88, 0xf5,
+  0xcb, 0x9c, 0xde, 0x10, 0x86, 0x56, 0x61, 0x22, 0x91, 0x3b, 0x68, 0x83,
+  0x51, 0x28, 0xf0, 0x3c, 0xcd, 0x83, 0xc5, 0xc0, 0xdf, 0xc0, 0x42, 0x0b,
+  0x63, 0xbe, 0x58, 0xf1, 0x75, 0x2b, 0x16, 0x7d, 0x00, 0x63, 0x4b, 0xef,
+  0xe8, 0xbc, 0x8d, 0x2b, 0x75, 0x18, 0x55, 0x40, 0x6a, 0xc6, 0x45, 0x60,
+  0x09, 0xdf, 0xb9, 0x68, 0x9f, 0x0c, 0xcd, 0x79, 0x30, 0x0b, 0x2b, 0x78,
+  0x68, 0x79, 0xb5, 0xa8, 0xa0, 0x73, 0x07, 0xb1, 0x65, 0x60, 0x1a, 0x4d,
+  0x32, 0xf8, 0x2d, 0x25, 0xe6, 0x73, 0x9a, 0x97, 0x23, 0xc6, 0xef, 0x0d,
+  0xdf, 0x6f, 0x2b, 0x0a, 0x12, 0x60, 0xa2, 0xd2, 0xff, 0x5b, 0x81, 0xc8,
+  0x5e, 0xf7, 0x4b, 0x85, 0xf6, 0xba, 0xaa, 0x37, 0xa1, 0x8d, 0x92, 0x0f,
+  0x1a, 0xc0, 0xac, 0x8a, 0x49, 0xb0, 0xad, 0x2e, 0xda, 0xc3, 0xe1, 0x27,
+  0xff, 0xec, 0xb2, 0x77, 0x32, 0xa4, 0x13, 0x36, 0x5f, 0xf8, 0x43, 0x29,
+  0x66, 0xa6, 0x83, 0x64, 0xb3, 0x6f, 0xc2, 0x60, 0xb5, 0x8e, 0xc2, 0x34,
+  0x1b, 0x4a, 0x71, 0xe2, 0x7a, 0xc6, 0x8f, 0xe1, 0xc3, 0xe7, 0x45, 0x74,
+  0x9d, 0x8d, 0x14, 0xbd, 0xc5, 0x7c, 0xbe, 0x9e, 0x4e, 0x95, 0x44, 0x48,
+  0xc1, 0x5d, 0x02, 0x7d, 0xaa, 0x1f, 0x85, 0xf1, 0x7a, 0xba, 0xca, 0x66,
+  0xfa, 0xe0, 0xb1, 0x34, 0x7c, 0x84, 0xd7, 0x89, 0x0d, 0xe2, 0x5f, 0x26,
+  0xcb, 0x74, 0xb7, 0x78, 0x7f, 0x7f, 0x9f, 0x62, 0x46, 0x57, 0xdb, 0x49,
+  0x51, 0x92, 0x6e, 0x41, 0x36, 0x7a, 0x3e, 0xe0, 0x08, 0x2b, 0x57, 0x8c,
+  0xef, 0x34, 0xe7, 0x5d, 0xca, 0x20, 0x2d, 0x47, 0xf9, 0xdd, 0x0c, 0xd2,
+  0xd5, 0x0c, 0x7a, 0x79, 0xfc, 0xdb, 0x48, 0xfa, 0x62, 0x0c, 0x5f, 0xa5,
+  0x46, 0x68, 0xb8, 0x7b, 0xa5, 0x2f, 0xf0, 0x59, 0xbf, 0xf1, 0xe2, 0x45,
+  0x5e, 0x0f, 0xe1, 0x53, 0xa6, 0x59, 0xb0, 0x1a, 0xd3, 0xed, 0x6d, 0xbd,
+  0xc6, 0xf1, 0xfa, 0x36, 0xf4, 0xef, 0x82, 0xa9, 0x69, 0x19, 0x4e, 0x58,
+  0xb7, 0xd5, 0x16, 0x54, 0xc9, 0x6e, 0x18, 0x9d, 0xda, 0x7b, 0x55, 0xba,
+  0x44, 0x9e, 0xdd, 0x55, 0x97, 0xd1, 0xe2, 0x08, 0x9b, 0x15, 0x30, 0x0f,
+  0xe6, 0x37, 0x26, 0x04, 0x99, 0x45, 0x14, 0x5e, 0xfb, 0x74, 0x53, 0x0e,
+  0x0c, 0x6a, 0xef, 0xdb, 0x67, 0x07, 0xf8, 0x1f, 0x4b, 0xad, 0x1f, 0x39,
+  0x66, 0x1a, 0xd3, 0xa8, 0x97, 0x38, 0xb6, 0x71, 0xd6, 0x1d, 0xfa, 0x17,
+  0xfd, 0xcb, 0xde, 0xe9, 0xc0, 0x38, 0x39, 0x3c, 0xa4, 0x9b, 0x5a, 0xfb,
+  0x30, 0x7a, 0xc2, 0x4c, 0x13, 0xe8, 0xe6, 0x61, 0x00, 0x0e, 0xb3, 0xca,
+  0x37, 0xca, 0xcd, 0x14, 0x9a, 0x60, 0xb1, 0x9e, 0x5f, 0xc7, 0x58, 0x0d,
+  0x55, 0xa5, 0x7f, 0x73, 0x0d, 0x53, 0xf9, 0x9b, 0x22, 0xab, 0x5e, 0xe1,
+  0x31, 0x10, 0x73, 0x59, 0x31, 0x92, 0x9a, 0xe0, 0x4d, 0x1a, 0x46, 0x92,
+  0x4c, 0x31, 0x05, 0xcc, 0x97, 0xe6, 0x12, 0xe6, 0x9d, 0x6c, 0xc3, 0xe0,
+  0x4b, 0x0d, 0xa2, 0xec, 0x18, 0xf0, 0xd2, 0x66, 0x5f, 0xcf, 0x28, 0x3b,
+  0x62, 0xc2, 0xdd, 0x1f, 0x05, 0x91, 0x16, 0xa7, 0x3c, 0x04, 0x54, 0x66,
+  0x35, 0x21, 0x07, 0xcc, 0x90, 0x88, 0xcc, 0x38, 0x70, 0x90, 0x66, 0x92,
+  0x93, 0xdd, 0x18, 0x8e, 0x1f, 0x0f, 0xd3, 0x89, 0xf5, 0x14, 0x37, 0x8a,
+  0x71, 0xa8, 0x8e, 0x1f, 0xe6, 0x23, 0xda, 0xc3, 0x70, 0xc3, 0x0f, 0x57,
+  0x35, 0x01, 0x85, 0x7c, 0xc7, 0x4c, 0xfc, 0x66, 0x0a, 0x62, 0xf9, 0x01,
+  0xfc, 0x5b, 0x8d, 0x46, 0xce, 0xfe, 0x88, 0x8b, 0xd2, 0xa2, 0x74, 0xe2,
+  0x93, 0x8c, 0x41, 0xb7, 0x4b, 0xd6, 0xfd, 0xa0, 0xdf, 0xf1, 0x9f, 0x6f,
+  0x04, 0x32, 0x72, 0x69, 0x8b, 0x74, 0x8a, 0x3c, 0x61, 0x5d, 0xdc, 0xc1,
+  0xb4, 0x61, 0xba, 0xf8, 0x9c, 0xe1, 0xc2, 0x87, 0x2c, 0x18, 0x5e, 0x26,
+  0x24, 0x30, 0xcf, 0x82, 0x7f, 0x61, 0x90, 0x12, 0xfd, 0x96, 0xfe, 0xa4,
+  0xb4, 0x51, 0x78, 0xeb, 0xc7, 0xc1, 0x5d, 0x28, 0xd0, 0xfd, 0x96, 0xb5,
+  0xff, 0xdf, 0x9d, 0x7f, 0xbc, 0xa1, 0xad, 0x43, 0x51, 0x21, 0x7c, 0xf6,
+  0xa6, 0xcb, 0xcc, 0xb6, 0x54, 0xb0, 0xa4, 0x07, 0x20, 0x51, 0x37, 0x8d,
+  0x2c, 0xf8, 0x17, 0x85, 0xb4, 0x20, 0xe9, 0x38, 0xfd, 0x62, 0x5f, 0xe5,
+  0x66, 0x3d, 0x86, 0xbf, 0x62, 0x33, 0x51, 0xcc, 0x34, 0x88, 0x13, 0xe0,
+  0x4a, 0x78, 0xc0, 0xe5, 0x82, 0xa5, 0x65, 0xfc, 0x85, 0x1c, 0x2e, 0x53,
+  0xd4, 0x5a, 0x26, 0x01, 0xef, 0x7e, 0x69, 0x09, 0x1d, 0x21, 0x82, 0x41,
+  0x86, 0x84, 0xa1, 0x30, 0x8e, 0x4d, 0xdb, 0x32, 0xaa, 0x86, 0x5b, 0xcb,
+  0x2c, 0x55, 0xe5, 0x37, 0x77, 0x44, 0x2d, 0x81, 0x0d, 0x15, 0xb5, 0xae,
+  0x10, 0x7d, 0xd3, 0x17, 0x49, 0x54, 0x3e, 0x52, 0xd3, 0xd8, 0x5c, 0x59,
+  0x49, 0xf7, 0xc0, 0x9f, 0x3e, 0xbd, 0x4e, 0x07, 0x21, 0x9c, 0xe0, 0x6f,
+  0xab, 0x48, 0x37, 0xbe, 0x14, 0x44, 0xe8, 0x39, 0x70, 0x88, 0x38, 0x1a,
+  0x59, 0xa8, 0x15, 0xff, 0xa2, 0xb5, 0xc5, 0x14, 0x8b, 0xcd, 0xb9, 0x48,
+  0xf7, 0x00, 0x2f, 0x6f, 0xd4, 0x54, 0x6f, 0xa3, 0xed, 0x99, 0xb1, 0x4c,
+  0x81, 0xa5, 0x85, 0x0a, 0x9b, 0x66, 0x52, 0x6e, 0xe3, 0x07, 0xa3, 0x85,
+  0xf7, 0xec, 0x08, 0x29, 0x2f, 0xc4, 0x3f, 0xaa, 0x86, 0x03, 0x55, 0x11,
+  0xe0, 0x96, 0xfe, 0x6a, 0xbc, 0x24, 0x36, 0x02, 0x23, 0x81, 0x38, 0xfc,
+  0xd2, 0xbb, 0x85, 0x54, 0x2d, 0xbc, 0x0a, 0x14, 0x33, 0x8c, 0x4c, 0x86,
+  0x95, 0xbb, 0x20, 0x0a, 0xa2, 0x19, 0x0b, 0xaf, 0xdb, 0x55, 0x0b, 0x5f,
+  0xb4, 0x30, 0x63, 0x93, 0xf1, 0x0a, 0x6b, 0x84, 0xa0, 0xe6, 0x30, 0x7c,
+  0xf1, 0x5e, 0x48, 0x04, 0x8d, 0xde, 0x90, 0x35, 0xc1, 0xfd, 0x9b, 0xdf,
+  0xd8, 0x6d, 0x43, 0xea, 0xd2, 0x2f, 0x11, 0x64, 0xa2, 0xe7, 0x54, 0xb8,
+  0xac, 0x04, 0x86, 0xdc, 0xc2, 0x64, 0xe3, 0x95, 0x4e, 0x23, 0x1a, 0x66,
+  0x23, 0x14, 0xaa, 0x17, 0xc6, 0xef, 0x66, 0x0e, 0x7f, 0x81, 0x8b, 0x24,
+  0xfd, 0x82, 0x76, 0x0b, 0xb4, 0x28, 0xde, 0xfe, 0x49, 0xed, 0x03, 0x15,
+  0x25, 0xc9, 0x16, 0x1e, 0xdb, 0xe2, 0x8d, 0x45, 0x52, 0x5e, 0x79, 0xd6,
+  0x8b, 0xdf, 0xbd, 0x0d, 0xfc, 0x9e, 0x55, 0x95, 0x8a, 0x65, 0x20, 0xbc,
+  0x38, 0x1d, 0x10, 0x2c, 0xc2, 0x88, 0x5e, 0x71, 0x67, 0x20, 0x7f, 0x78,
+  0x25, 0x95, 0x46, 0xed, 0x15, 0x74, 0x04, 0x7a, 0xc5, 0x13, 0x2a, 0xa8,
+  0x0a, 0xfe, 0xc6, 0x64, 0x90, 0x32, 0x5a, 0x1a, 0x87, 0x48, 0xd6, 0xdc,
+  0xcf, 0x73, 0x47, 0xe2, 0xdc, 0x78, 0xcb, 0x83, 0x15, 0x98, 0x6e, 0xf4,
+  0x4b, 0x6e, 0x70, 0x7b, 0x23, 0x2e, 0x67, 0x36, 0x93, 0x55, 0xc1, 0x5f,
+  0xb7, 0x91, 0xbf, 0x5a, 0x2c, 0xc9, 0xcf, 0x3b, 0xf2, 0x33, 0x8d, 0xad,
+  0x18, 0xe8, 0x70, 0x42, 0x0a, 0x24, 0x18, 0xa6, 0x31, 0x14, 0xdc, 0xd1,
+  0x9f, 0xc5, 0xa5, 0x60, 0x83, 0xa1, 0x6c, 0x82, 0x68, 0x12, 0x8f, 0xee,
+  0xbe, 0xa4, 0xab, 0x43, 0x32, 0x09, 0xef, 0xb8, 0xee, 0x35, 0x99, 0x1c,
+  0xff, 0x7e, 0x1a, 0xce, 0xf1, 0x36, 0x5b, 0x6f, 0x4b, 0xc7, 0xa7, 0xd0,
+  0xfb, 0xdc, 0xfb, 0xc5, 0xc8, 0xb6, 0xad, 0xf3, 0x57, 0xcd, 0x0c, 0xfb,
+  0xe6, 0xee, 0xf9, 0x52, 0x72, 0x1c, 0xbc, 0x1d, 0xd6, 0x7d, 0x29, 0xd5,
+  0xd4, 0xc2, 0x78, 0xc4, 0x9c, 0x2d, 0x0d, 0x3c, 0x0a, 0x49, 0x55, 0x4d,
+  0x78, 0x9d, 0x38, 0x3e, 0x1f, 0x4f, 0x34, 0x7e, 0x8f, 0x7d, 0x4b, 0x72,
+  0x5b, 0xd9, 0xc4, 0x68, 0x02, 0xa8, 0x9d, 0x2c, 0xb9, 0x62, 0x14, 0x3a,
+  0xbe, 0xb1, 0x81, 0x08, 0xcb, 0x92, 0xa3, 0x3f, 0xbf, 0x0b, 0xed, 0xab,
+  0xe3, 0xff, 0x37, 0x8f, 0x28, 0xa4, 0xbd, 0x56, 0xb4, 0x15, 0x5e, 0xfd,
+  0x25, 0x1d, 0x43, 0x98, 0x84, 0xaa, 0x99, 0x49, 0xa2, 0x35, 0xd5, 0x2c,
+  0xb1, 0xe5, 0xf3, 0x31, 0x64, 0x22, 0x40, 0x0f, 0x29, 0xe3, 0x4f, 0x65,
+  0xe5, 0xa3, 0x1e, 0xb6, 0x21, 0xb9, 0xc6, 0x46, 0xc3, 0x2e, 0x1f, 0x74,
+  0xc9, 0x98, 0x2b, 0xed, 0x90, 0xe3, 0x6f, 0x9c, 0x23, 0xc2, 0x9c, 0xf2,
+  0xf8, 0xf8, 0xb2, 0xd3, 0x1d, 0x76, 0x7a, 0xc6, 0x51, 0xef, 0xd4, 0x38,
+  0xa6, 0x53, 0xf5, 0xa3, 0x6e, 0xe7, 0x68, 0xd0, 0x1e, 0x08, 0xcb, 0x30,
+  0x5a, 0x96, 0x69, 0x18, 0xe0, 0xab, 0x6e, 0x9f, 0x5c, 0xfc, 0x13, 0x8f,
+  0x16, 0x51, 0xa8, 0x16, 0xe7, 0xa2, 0x8d, 0x2b, 0x7d, 0xf3, 0xa3, 0xc5,
+  0x97, 0xc2, 0xe6, 0x9e, 0xbf, 0xf7, 0x91, 0x2b, 0x4f, 0x26, 0xd7, 0x45,
+  0x0c, 0x1f, 0xb3, 0x45, 0x4d, 0x0a, 0x80, 0xcb, 0xc0, 0xe3, 0x93, 0xf7,
+  0xed, 0x93, 0x1f, 0xf9, 0xba, 0x25, 0x95, 0xc4, 0xea, 0x71, 0x7c, 0x62,
+  0xc2, 0xa2, 0xad, 0x42, 0x16, 0xea, 0x4b, 0x98, 0xe0, 0xce, 0x60, 0x15,
+  0x0e, 0x09, 0x82, 0xa9, 0x9e, 0x3f, 0xa7, 0x2b, 0x76, 0x92, 0x99, 0x16,
+  0x61, 0x0f, 0x28, 0x70, 0xa9, 0xe1, 0xef, 0x91, 0x7c, 0x3e, 0xab, 0x13,
+  0x14, 0xa0, 0x71, 0xf4, 0xc2, 0xb7, 0x11, 0xa8, 0xb3, 0xc2, 0xd7, 0x96,
+  0x7d, 0xab, 0x12, 0x8b, 0xe6, 0xe5, 0x96, 0xd5, 0xbd, 0x25, 0x39, 0xee,
+  0x0f, 0xdf, 0x73, 0x21, 0x6a, 0x16, 0x2d, 0x6f, 0x56, 0xb4, 0x6e, 0xcf,
+  0x1d, 0xe5, 0x64, 0xeb, 0x55, 0x54, 0xe9, 0xe2, 0x92, 0x97, 0x96, 0x62,
+  0x3b, 0x9b, 0x89, 0x8e, 0xc6, 0x0a, 0x4b, 0xee, 0x82, 0x24, 0xc8, 0x6f,
+  0xa3, 0xe5, 0x43, 0x25, 0x45, 0x8f, 0xa3, 0x07, 0xe9, 0x59, 0xae, 0xbc,
+  0xb5, 0x60, 0xe9, 0xf9, 0xf1, 0xae, 0xed, 0xaf, 0x12, 0x40, 0x96, 0x55,
+  0x09, 0x3f, 0x0c, 0xc5, 0x85, 0x7c, 0x24, 0x1f, 0x8b, 0x4d, 0x90, 0x95,
+  0x53, 0x6d, 0xdb, 0xe8, 0x96, 0xb2, 0x2a, 0x38, 0x77, 0x80, 0x41, 0x36,
+  0x91, 0xc6, 0xe2, 0xa9, 0xc4, 0x41, 0x16, 0x2b, 0x84, 0x92, 0x9a, 0x8b,
+  0xd2, 0x70, 0x8d, 0xc5, 0x1c, 0xf3, 0x3c, 0x96, 0xe2, 0x42, 0x92, 0x8a,
+  0xa2, 0x42, 0xa1, 0xa2, 0x8c, 0x4b, 0xf8, 0x43, 0xcf, 0x33, 0x2f, 0x66,
+  0x2a, 0xd4, 0x2b, 0x54, 0x35, 0x58, 0xb1, 0x72, 0x17, 0xe9, 0x14, 0x2b,
+  0x9a, 0xc3, 0xb0, 0xa9, 0xbe, 0x71, 0xa4, 0x16, 0x1a, 0xd7, 0x04, 0x39,
+  0xd4, 0x5b, 0x92, 0x5f, 0xaf, 0x15, 0x8b, 0x58, 0x96, 0x3a, 0x45, 0xbd,
+  0x38, 0xf7, 0xdb, 0x47, 0xc7, 0x1d, 0x16, 0x77, 0x79, 0x0f, 0xa5, 0xee,
+  0x04, 0xa1, 0x3b, 0x0c, 0xae, 0x26, 0x3e, 0xeb, 0x30, 0x2c, 0x55, 0x74,
+  0xb8, 0xbc, 0x2a, 0x6a, 0x65, 0x90, 0x4e, 0xf3, 0x14, 0x42, 0x6a, 0x4f,
+  0x22, 0xa5, 0xf5, 0xd5, 0x52, 0xb0, 0x13, 0xb3, 0x54, 0x74, 0x42, 0x95,
+  0x57, 0xfb, 0xde, 0x3a, 0xd9, 0x5a, 0x94, 0x6e, 0x89, 0x65, 0x2b, 0x05,
+  0xe3, 0xe0, 0xc0, 0x78, 0x7f, 0xf4, 0x53, 0xdb, 0x38, 0x3f, 0xea, 0x76,
+  0xfb, 0x27, 0x74, 0x97, 0x5a, 0x89, 0x8e, 0xe7, 0x47, 0x9f, 0x8e, 0xdb,
+  0x34, 0x27, 0x8d, 0x95, 0xda, 0x00, 0xad, 0x50, 0x82, 0x6b, 0x88, 0xd3,
+  0x16, 0x29, 0x3f, 0x89, 0x4c, 0xe4, 0x7e, 0xda, 0x8a, 0x61, 0xea, 0xed,
+  0xa0, 0xe1, 0x88, 0x42, 0xce, 0xc2, 0x03, 0xd2, 0xc6, 0xac, 0x23, 0xad,
+  0xb2, 0x2d, 0x04, 0x40, 0x13, 0x90, 0xc9, 0xef, 0x97, 0x8a, 0xa8, 0x18,
+  0x88, 0x40, 0xca, 0x8a, 0x9e, 0xed, 0x1b, 0x85, 0xd7, 0xf9, 0x66, 0xa3,
+  0x3a, 0xbd, 0xda, 0x57, 0x63, 0xbb, 0xb4, 0x6d, 0xd2, 0xb1, 0xad, 0x9c,
+  0x47, 0x68, 0x28, 0x91, 0x09, 0x78, 0xae, 0x16, 0x11, 0x1f, 0x3c, 0x34,
+  0x1e, 0x5a, 0x21, 0x8b, 0xa0, 0x9f, 0x49, 0x2c, 0x64, 0x55, 0xd2, 0x6d,
+  0x3d, 0xca, 0x4e, 0x6d, 0xcc, 0x66, 0x01, 0x63, 0x10, 0x33, 0xe9, 0xb8,
+  0xb3, 0x9e, 0x27, 0x99, 0xe2, 0xb4, 0x97, 0xdf, 0x43, 0x9b, 0x8c, 0xf7,
+  0xda, 0x64, 0x25, 0x31, 0x9d, 0x74, 0xa4, 0x49, 0xe0, 0x97, 0x52, 0x8a,
+  0xd0, 0x4c, 0x72, 0x06, 0x1d, 0xe1, 0xd5, 0x77, 0x05, 0x4c, 0x91, 0xdf,
+  0xfe, 0x88, 0x07, 0x21, 0xe8, 0xab, 0x9c, 0xb5, 0x65, 0xfc, 0xe9, 0x4f,
+  0xe9, 0x4a, 0x8f, 0x22, 0xa6, 0xc8, 0x13, 0x07, 0x73, 0x4d, 0x22, 0xe7,
+  0x9b, 0x32, 0xba, 0xe7, 0xcf, 0xa7, 0x40, 0x4a, 0x16, 0x96, 0x6f, 0xca,
+  0x49, 0x39, 0x2d, 0x63, 0x90, 0x1b, 0x90, 0x17, 0x11, 0x57, 0xdb, 0x96,
+  0x3e, 0x6b, 0x34, 0x7d, 0xac, 0x24, 0xfb, 0xa8, 0x79, 0x34, 0xab, 0x0d,
+  0x68, 0xa6, 0x51, 0x7c, 0x95, 0xa7, 0x64, 0xb9, 0x58, 0x8e, 0x60, 0x06,
+  0xbb, 0x2a, 0x95, 0x02, 0x73, 0xab, 0xc9, 0xea, 0x41, 0x25, 0x53, 0x9b,
+  0x98, 0x51, 0x3f, 0x13, 0x26, 0xa0, 0xe4, 0x55, 0x98, 0xfc, 0x8a, 0xe7,
+  0x7f, 0xf2, 0xc0, 0xfe, 0x13, 0x3f, 0xfc, 0xfc, 0xff, 0xfd, 0x1f, 0x87,
+  0xff, 0xe5, 0xb8, 0xf5, 0x86, 0x8a, 0xff, 0xd5, 0xb4, 0x77, 0xf8, 0x5f,
+  0xdf, 0xe5, 0xa1, 0xf8, 0x5f, 0x5a, 0xec, 0xaf, 0xc5, 0xdc, 0x58, 0x2d,
+  0x96, 0xec, 0x40, 0x8e, 0x78, 0x72, 0x4d, 0x80, 0x64, 0x32, 0x7b, 0x96,
+  0x65, 0x91, 0xbb, 0xc8, 0x7f, 0x22, 0x89, 0xf4, 0x00, 0xfb, 0x38, 0x9c,
+  0x92, 0x53, 0xe4, 0x14, 0xd0, 0xba, 0x82, 0xe2, 0xd8, 0xd1, 0x17, 0xaa,
+  0x8b, 0xee, 0x12, 0x92, 0x2b, 0x80, 0x89, 0xb6, 0x31, 0x19, 0x8b, 0x42,
+  0xfa, 0x26, 0xaf, 0x4a, 0xae, 0x83, 0xc7, 0x6e, 0x3e, 0x9e, 0x85, 0xab,
+  0xc9, 0x88, 0x7c, 0x46, 0xb0, 0x9c, 0x06, 0x20, 0xef, 0x84, 0x90, 0x87,
+  0x77, 0x61, 0xf4, 0x40, 0x3f, 0x51, 0xc0, 0x61, 0x4c, 0x06, 0x16, 0xfb,
+  0xa8, 0x03, 0x16, 0x13, 0x13, 0xb3, 0x88, 0x5b, 0x04, 0x0e, 0xa2, 0x18,
+  0x76, 0x8a, 0x1e, 0x16, 0xd3, 0xb2, 0x96, 0x63, 0x65, 0xe5, 0x30, 0xdf,
+  0xd5, 0xe2, 0x8c, 0x65, 0x4b, 0x58, 0x19, 0xcc, 0x56, 0xad, 0x1c, 0x66,
+  0x8b, 0x31, 0x0a, 0x97, 0xe8, 0xb2, 0xef, 0x40, 0xc1, 0xdb, 0xd1, 0xa6,
+  0x78, 0x7e, 0x0e, 0xcf, 0xee, 0xe3, 0x7b, 0x6e, 0x1d, 0x34, 0x86, 0x1e,
+  0x3c, 0x2b, 0x85, 0xe0, 0xd8, 0xec, 0x93, 0x76, 0x41, 0x9a, 0x06, 0x2d,
+  0x2b, 0x95, 0x96, 0x8f, 0x90, 0x95, 0x94, 0x9f, 0x4a, 0x41, 0x60, 0x12,
+  0x51, 0x62, 0x9e, 0x36, 0x01, 0x74, 0x6a, 0x33, 0xe0, 0xab, 0xb4, 0x2c,
+  0x9b, 0xe3, 0x58, 0x08, 0xfa, 0xb6, 0x40, 0xb9, 0x7a, 0x1a, 0x85, 0x7e,
+  0x5c, 0x68, 0xcd, 0x9c, 0xb6, 0xd1, 0x4a, 0xdb, 0x06, 0xd9, 0x0a, 0x79,
+  0x34, 0x00, 0x1c, 0xa2, 0xa8, 0x8d, 0x61, 0xad, 0x68, 0xdf, 0x29, 0x91,
+  0xe6, 0x14, 0x4a, 0x13, 0x7d, 0x0b, 0x32, 0x54, 0x87, 0x61, 0x35, 0x73,
+  0x24, 0x69, 0xf9, 0x36, 0x88, 0xcb, 0x35, 0x21, 0x0d, 0x53, 0x94, 0xc1,
+  0x20, 0xc8, 0x41, 0xe1, 0x22, 0xc0, 0x32, 0x09, 0xb6, 0x07, 0x33, 0x60,
+  0x2e, 0x90, 0x41, 0x1e, 0x04, 0x57, 0x46, 0x4a, 0x0e, 0x40, 0x88, 0x52,
+  0x98, 0x38, 0x57, 0x0c, 0x61, 0x55, 0x51, 0xb8, 0x12, 0x00, 0x2f, 0x19,
+  0xbd, 0x2b, 0xe1, 0x52, 0xd0, 0xbb, 0xb4, 0xa6, 0xcc, 0x85, 0xd4, 0x29,
+  0x83, 0x01, 0x48, 0xbc, 0x3b, 0x01, 0xee, 0x2a, 0x12, 0xa0, 0xc1, 0x22,
+  0xe1, 0x02, 0x52, 0xd4, 0xae, 0x22, 0x01, 0x1a, 0x14, 0x92, 0x04, 0x40,
+  0x3b, 0x81, 0xec, 0x2a, 0x12, 0xa0, 0xc1, 0x1f, 0x11, 0x6d, 0x10, 0xe7,
+  0x09, 0x40, 0xeb, 0xe1, 0xbb, 0x95, 0x2b, 0x62, 0xc5, 0x3c, 0xbc, 0x2a,
+  0xd1, 0x1a, 0xc5, 0xa2, 0xaa, 0x9b, 0x8a, 0x42, 0xbb, 0x14, 0x8b, 0x7a,
+  0xb9, 0xa9, 0x28, 0xb4, 0x50, 0xb1, 0xa8, 0x03, 0x9d, 0x28, 0x7d, 0xb1,
+  0x12, 0x20, 0x32, 0x55, 0x56, 0x3e, 0x16, 0x58, 0xed, 0xab, 0x80, 0xc8,
+  0x12, 0xcd, 0x09, 0x0a, 0xd9, 0x57, 0x68, 0x2e, 0x45, 0x21, 0xd3, 0x7b,
+  0xc8, 0x3c, 0xaf, 0x97, 0x64, 0xae, 0x39, 0x10, 0x6f, 0x39, 0x78, 0x51,
+  0x7c, 0xcb, 0x01, 0x17, 0x3d, 0x5f, 0xac, 0x36, 0x97, 0xfe, 0xfb, 0x76,
+  0xe2, 0x13, 0x04, 0xb2, 0xad, 0x0a, 0xfe, 0xef, 0x0d, 0x24, 0xdf, 0x7f,
+  0x99, 0xe8, 0x7f, 0x2a, 0xa2, 0xb5, 0xb2, 0x47, 0xb3, 0x65, 0xf8, 0x6b,
+  0x69, 0xa7, 0x4e, 0xa4, 0x07, 0x78, 0x6c, 0x2c, 0xbf, 0xa4, 0x20, 0x6d,
+  0xbe, 0x9d, 0xb8, 0x3f, 0x97, 0x88, 0x9b, 0xe6, 0x35, 0x98, 0x56, 0xda,
+  0xdb, 0x12, 0x61, 0xe1, 0x56, 0xc2, 0x4a, 0x8a, 0x76, 0xbb, 0x55, 0xd1,
+  0x7e, 0x28, 0x11, 0xb6, 0x55, 0xd1, 0x7e, 0xc8, 0x14, 0x8d, 0xdf, 0x28,
+  0x81, 0xbb, 0xa5, 0xb3, 0x20, 0xfe, 0x45, 0x94, 0xa6, 0xdc, 0x80, 0xc1,
+  0xf1, 0x4b, 0x6a, 0x29, 0x7e, 0x09, 0xd7, 0x80, 0xd0, 0x25, 0x60, 0x44,
+  0xdb, 0x42, 0xbf, 0x44, 0x04, 0x13, 0xfa, 0xc7, 0xdb, 0xb7, 0x86, 0x43,
+  0x53, 0xdc, 0x34, 0xc5, 0xa5, 0x29, 0x5e, 0x9a, 0xe2, 0x11, 0xec, 0x12,
+  0x5d, 0x05, 0xd7, 0x73, 0x84, 0x21, 0x9f, 0x2e, 0xf2, 0xdd, 0x58, 0x9a,
+  0xa8, 0x51, 0x18, 0xbd, 0x2b, 0x01, 0x4c, 0xef, 0x0a, 0xcb, 0xb2, 0xc1,
+  0x0c, 0x90, 0x2a, 0x1a, 0x4f, 0x36, 0x56, 0xe4, 0x12, 0xe1, 0x1c, 0xa9,
+  0x0f, 0x7f, 0x6f, 0x84, 0xd7, 0x47, 0xec, 0x3c, 0xce, 0x1b, 0x4e, 0x55,
+  0x35, 0x57, 0x4c, 0x8d, 0xb7, 0x2d, 0x2c, 0x20, 0x51, 0x33, 0x1d, 0x6f,
+  0x65, 0x36, 0x6e, 0x30, 0x7b, 0x53, 0xb3, 0xf1, 0x4b, 0x2e, 0xe2, 0xf1,
+  0xfa, 0xe6, 0x26, 0xaf, 0x8b, 0x28, 0x77, 0x64, 0x28, 0x7a, 0x67, 0xe4,
+  0xce, 0x10, 0xd4, 0x6d, 0xce, 0xf0, 0x30, 0x88, 0x6b, 0xb1, 0x84, 0x2b,
+  0x96, 0x50, 0x53, 0x13, 0x1a, 0x34, 0x41, 0x87, 0x7e, 0x23, 0x2d, 0x6d,
+  0xd2, 0x32, 0xf1, 0x0b, 0x38, 0xb4, 0x05, 0xe6, 0x99, 0x29, 0xf3, 0xf9,
+  0xb9, 0x3f, 0x78, 0x7f, 0x79, 0x76, 0xd6, 0x6d, 0x9b, 0x8f, 0x15, 0x03,
+  0xd6, 0xda, 0xf7, 0x15, 0xe3, 0x33, 0x39, 0x81, 0xf2, 0x48, 0x9c, 0xb5,
+  0x41, 0x7c, 0xdc, 0x7c, 0x20, 0x7f, 0xd4, 0xe8, 0x1f, 0xf7, 0xd4, 0xb1,
+  0xc9, 0x1f, 0x9f, 0x2d, 0xe1, 0xc6, 0x3e, 0x94, 0x36, 0xbc, 0x38, 0xea,
+  0x0d, 0x3e, 0xf4, 0x07, 0xed, 0x9a, 0xff, 0x61, 0x60, 0x46, 0xb0, 0x8c,
+  0x88, 0x60, 0x71, 0x12, 0xc1, 0xe2, 0x24, 0xf2, 0x2c, 0x3c, 0x73, 0xff,
+  0xaf, 0xe4, 0x2a, 0x35, 0x6e, 0x57, 0x1b, 0xef, 0x10, 0x51, 0xdc, 0x9f,
+  0x32, 0x92, 0xd3, 0x7c, 0x2b, 0x47, 0x97, 0x4f, 0x05, 0xbe, 0xc9, 0x08,
+  0x73, 0x25, 0x62, 0xea, 0xe2, 0xa2, 0x30, 0x4f, 0x97, 0x2f, 0x0b, 0x03,
+  0x7a, 0x8b, 0x51, 0x89, 0x8e, 0xb5, 0xb2, 0x69, 0x69, 0x80, 0xce, 0x04,
+  0x69, 0x02, 0x05, 0xf7, 0xf0, 0x95, 0x43, 0x28, 0x6c, 0x41, 0x92, 0xab,
+  0x95, 0xe4, 0xd2, 0xa2, 0x10, 0x49, 0x9e, 0x56, 0x92, 0x47, 0x28, 0x5c,
+  0x22, 0xe9, 0x37, 0xe3, 0xf3, 0x18, 0x3f, 0xcd, 0x30, 0x61, 0xb5, 0xa9,
+  0x99, 0xaa, 0x2f, 0xf1, 0x92, 0x83, 0xd5, 0x68, 0x2c, 0xbd, 0x45, 0x5d,
+  0x0a, 0x97, 0xe3, 0xd0, 0x25, 0x38, 0xac, 0x93, 0xe8, 0x8f, 0x89, 0xb4,
+  0xce, 0x81, 0x26, 0x7b, 0x4f, 0xbe, 0xc7, 0xb4, 0x0d, 0x4f, 0x93, 0xea,
+  0x18, 0xae, 0x26, 0xd5, 0xc5, 0x8f, 0xb4, 0xd4, 0xd4, 0xde, 0xf0, 0xc8,
+  0xb0, 0xb7, 0x79, 0xe1, 0xa0, 0x59, 0x75, 0xd0, 0x8b, 0xdd, 0x48, 0x31,
+  0x09, 0x6a, 0x27, 0xfd, 0x48, 0x01, 0xa2, 0xf0, 0x62, 0x1a, 0xac, 0xc0,
+  0x06, 0x78, 0x4c, 0x83, 0x12, 0xed, 0x19, 0xaf, 0x5f, 0xbf, 0x36, 0xf6,
+  0xe8, 0x16, 0xd1, 0x1e, 0x5d, 0xbb, 0x25, 0xa7, 0x1b, 0x13, 0x6c, 0x95,
+  0x8f, 0x3b, 0x58, 0xa8, 0x6f, 0xfb, 0xf0, 0xfd, 0x5f, 0xb2, 0xf4, 0xfb,
+  0x36, 0xf0, 0x4f, 0x65, 0xf8, 0x4f, 0x5e, 0xc3, 0x51, 0xf1, 0x5f, 0xbc,
+  0x66, 0x7d, 0x87, 0xff, 0xf2, 0x5d, 0x9e, 0x64, 0xe3, 0xf4, 0xac, 0xdb,
+  0x3f, 0x1a, 0xfa, 0xef, 0xfd, 0x34, 0x2e, 0x24, 0x29, 0x49, 0x12, 0xf9,
+  0xc6, 0xe2, 0xe8, 0xb4, 0xf3, 0x11, 0x82, 0x0a, 0x42, 0x2d, 0x75, 0xda,
+  0xed, 0x76, 0x8a, 0xc3, 0x2f, 0x52, 0x9d, 0x1f, 0x41, 0x40, 0x39, 0xed,
+  0xbc, 0x33, 0xdc, 0x9a, 0x94, 0x8e, 0x49, 0x0d, 0x59, 0x1e, 0x3d, 0x08,
+  0xe6, 0x48, 0x89, 0xed, 0x0f, 0x83, 0x4e, 0xb7, 0xdf, 0x33, 0x9c, 0x7d,
+  0xe7, 0xd0, 0xb5, 0x0f, 0xdd, 0x43, 0x3b, 0xac, 0xda, 0xcd, 0x33, 0x59,
+  0x05, 0x79, 0xcd, 0xf3, 0xc1, 0x30, 0xab, 0x8e, 0x5b, 0xb7, 0xd4, 0x2c,
+  0x64, 0x6d, 0xd6, 0x6b, 0x87, 0x35, 0xaf, 0x1e, 0x56, 0xbd, 0x56, 0x96,
+  0xd5, 0xb1, 0x19, 0xb7, 0xd7, 0x54, 0x98, 0x8f, 0x3e, 0x92, 0x1c, 0x18,
+  0x8f, 0xd4, 0x74, 0xc3, 0xdb, 0xaf, 0xd9, 0x6e, 0xcb, 0xf5, 0x6a, 0xcd,
+  0xf0, 0x55, 0x46, 0x28, 0xf0, 0x31, 0xa1, 0x5e, 0x2b, 0x35, 0x4f, 0x8a,
+  0x11, 0xcc, 0x89, 0x4f, 0x8f, 0xbb, 0xa9, 0x7d, 0xea, 0x9e, 0x94, 0x8e,
+  0x49, 0x4e, 0x5d, 0x4a, 0xe2, 0xb6, 0x70, 0xf7, 0x5d, 0xd7, 0xae, 0xd5,
+  0x1a, 0x76, 0xed, 0xd0, 0xad, 0xdb, 0x9e, 0xe3, 0x39, 0x61, 0xd5, 0x69,
+  0xc8, 0x52, 0x53, 0x93, 0xd8, 0xae, 0x63, 0xa9, 0x79, 0x44, 0x44, 0xdd,
+  0x6e, 0x7a, 0xad, 0x7a, 0x0b, 0xfe, 0xe7, 0xda, 0x4e, 0x0d, 0x6c, 0x63,
+  0xb7, 0x32, 0x32, 0x52, 0xdb, 0xd8, 0x4d, 0x45, 0x0a, 0x37, 0x8e, 0x2d,
+  0x34, 0x2c, 0xcb, 0x00, 0x93, 0x37, 0x0f, 0x9b, 0x8d, 0x43, 0x28, 0x5a,
+  0xad, 0xd5, 0x70, 0x3d, 0xa7, 0x8e, 0x56, 0x52, 0xc5, 0x0b, 0x56, 0xb2,
+  0xa9, 0x99, 0xc6, 0x8b, 0x28, 0x22, 0x5f, 0x9a, 0xe0, 0xa7, 0x8e, 0x53,
+  0xfa, 0xae, 0x52, 0xb0, 0xda, 0xe6, 0xe3, 0x51, 0xa2, 0xa8, 0x2b, 0x99,
+  0xb8, 0x51, 0x93, 0x33, 0x88, 0x8d, 0x5b, 0x72, 0x5a, 0xea, 0x70, 0x76,
+  0xab, 0xe6, 0x82, 0xf1, 0x9a, 0x6e, 0xad, 0x55, 0xaf, 0x83, 0xbd, 0xbd,
+  0x9a, 0x8d, 0x86, 0x3e, 0xec, 0x2a, 0xd2, 0x53, 0x53, 0x37, 0xbc, 0x96,
+  0x60, 0x6b, 0x9e, 0x0b, 0xbe, 0xe2, 0x35, 0x5c, 0x07, 0x1a, 0xaa, 0xe6,
+  0x39, 0x10, 0xd6, 0x0e, 0xbd, 0xba, 0xdd, 0x70, 0x1b, 0x61, 0xb5, 0x76,
+  0xe8, 0xb9, 0x1a, 0x61, 0x89, 0xcd, 0x21, 0x3f, 0x23, 0x8e, 0x5b, 0x1d,
+  0x54, 0xd5, 0x32, 0x59, 0xe8, 0xea, 0xad, 0xc3, 0x26, 0x28, 0x3a, 0xac,
+  0x7b, 0xf5, 0x26, 0x18, 0xbe, 0xd9, 0xa8, 0xdb, 0x6e, 0xf8, 0x4a, 0xa7,
+  0x29, 0x35, 0x3f, 0xe6, 0xa6, 0x4d, 0xd3, 0x3e, 0xe9, 0x9c, 0x1f, 0x51,
+  0xdb, 0xb8, 0x9a, 0x6f, 0xa4, 0x93, 0xf3, 0xe4, 0xb2, 0xe9, 0xe9, 0x19,
+  0xeb, 0x03, 0x72, 0x85, 0xd4, 0x65, 0x8c, 0xb8, 0x6c, 0xd3, 0x75, 0x18,
+  0x1b, 0x37, 0xd1, 0x62, 0xf6, 0x1a, 0xd3, 0x6e, 0x47, 0x23, 0xa3, 0x7a,
+  0x7d, 0x8e, 0x1f, 0xda, 0x55, 0xef, 0x47, 0xc6, 0xc1, 0x75, 0x78, 0x77,
+  0x80, 0x5f, 0xfa, 0xc1, 0xcc, 0xf3, 0x36, 0x0a, 0x97, 0xa4, 0x4c, 0xf0,
+  0x1b, 0xbf, 0xb2, 0xaa, 0x86, 0xc6, 0x5e, 0x7c, 0xe0, 0xfb, 0x07, 0x07,
+  0xb7, 0x7b, 0xcf, 0xc4, 0xee, 0x22, 0x37, 0xa6, 0xe3, 0x78, 0xd9, 0xd6,
+  0xf4, 0xbc, 0xbc, 0xd6, 0x84, 0xae, 0x02, 0xd1, 0xe3, 0x10, 0x9a, 0xb1,
+  0x05, 0x86, 0x01, 0xb7, 0xf7, 0xec, 0x7a, 0xfd, 0xb0, 0xd9, 0x3c, 0xac,
+  0xb9, 0xf5, 0x16, 0x74, 0xa4, 0xa6, 0xe7, 0x42, 0x17, 0xa8, 0x3d, 0x51,
+  0xe3, 0xba, 0x8d, 0x66, 0xb3, 0xe5, 0x80, 0x4c, 0x08, 0x3d, 0x6e, 0xc3,
+  0xfe, 0x6e, 0x6d, 0xdd, 0xaa, 0x37, 0xeb, 0xa0, 0xa9, 0xd1, 0x70, 0x5b,
+  0xb6, 0xdd, 0x2c, 0x68, 0xfa, 0xac, 0x60, 0xb1, 0xe1, 0xbd, 0x06, 0x3f,
+  0xd2, 0x8f, 0xdd, 0x32, 0x0e, 0x28, 0x9a, 0x56, 0x4e, 0x14, 0xeb, 0xe6,
+  0x85, 0xb1, 0xae, 0x26, 0x8e, 0x75, 0xcb, 0x03, 0x59, 0x7e, 0x13, 0x48,
+  0xa1, 0xac, 0x5b, 0x12, 0xcb, 0x8a, 0xac, 0x2d, 0x45, 0xb3, 0x6e, 0x6e,
+  0x38, 0xeb, 0x96, 0xc4, 0xb3, 0xfc, 0x2e, 0x25, 0x05, 0x3b, 0xc1, 0xb0,
+  0x4e, 0xf3, 0x99, 0x6e, 0x72, 0xcb, 0x07, 0xd8, 0x3f, 0x72, 0x66, 0x9b,
+  0xe0, 0xff, 0xdd, 0xd2, 0xcf, 0x46, 0xbf, 0x85, 0x8e, 0x92, 0xf9, 0x5f,
+  0xb3, 0xde, 0x70, 0x33, 0xf8, 0x9f, 0x35, 0x77, 0x37, 0xff, 0xfb, 0x1e,
+  0x0f, 0x8d, 0xdd, 0x9d, 0x41, 0xdf, 0x38, 0x31, 0x06, 0xab, 0x60, 0x7e,
+  0x1d, 0x44, 0xd7, 0xaf, 0x0d, 0xa3, 0x09, 0xbd, 0xcb, 0x30, 0x86, 0x0f,
+  0xcb, 0xb0, 0x7a, 0x1b, 0xce, 0xc3, 0x68, 0x32, 0x22, 0x9f, 0x15, 0x1b,
+  0x6f, 0xb9, 0x9f, 0xfc, 0xf0, 0xcc, 0x60, 0x20, 0x6d, 0x74, 0xfa, 0x38,
+  0x7c, 0x47, 0x50, 0x17, 0x84, 0x97, 0xee, 0x49, 0x8a, 0x70, 0x67, 0x17,
+  0xe7, 0x15, 0x60, 0x08, 0x46, 0xcb, 0xe9, 0x3a, 0xc6, 0x7f, 0xc2, 0xbb,
+  0x6a, 0xaa, 0xc4, 0xc7, 0x83, 0x7c, 0xe6, 0x7d, 0xc5, 0x38, 0xa3, 0x9f,
+  0xc8, 0xf8, 0xef, 0x58, 0x49, 0x70, 0x07, 0x83, 0xbd, 0x50, 0x7d, 0x6d,
+  0x9c, 0x3d, 0x7f, 0x7e, 0x53, 0x11, 0x27, 0x0d, 0x24, 0x69, 0x5a, 0xc1,
+  0x51, 0x2a, 0x58, 0x4f, 0x91, 0xc2, 0x42, 0xa4, 0x12, 0xad, 0x74, 0xdf,
+  0xf5, 0x1d, 0xd4, 0xf0, 0xf0, 0x24, 0x4a, 0x40, 0x4e, 0xae, 0x9e, 0x02,
+  0x2d, 0xaf, 0xcc, 0x87, 0x27, 0xd4, 0xe4, 0x25, 0xba, 0x1e, 0x9f, 0x52,
+  0x1d, 0x88, 0xcb, 0xd5, 0x58, 0xae, 0xef, 0x95, 0xf9, 0xf8, 0xa5, 0x3a,
+  0x71, 0x28, 0x3a, 0x5b, 0xcf, 0xd9, 0x71, 0x11, 0x3e, 0xf5, 0x98, 0xe0,
+  0x25, 0xec, 0xe8, 0x8f, 0xcc, 0xa3, 0xc8, 0x21, 0x91, 0xb7, 0xf8, 0xd5,
+  0xf2, 0x34, 0xbc, 0xc7, 0xbf, 0x4d, 0xf4, 0xe0, 0x65, 0xcd, 0x12, 0x87,
+  0xac, 0x60, 0xb4, 0x88, 0x71, 0x5b, 0x2c, 0x79, 0x64, 0x4f, 0x83, 0xf2,
+  0x23, 0x45, 0x5a, 0xcd, 0x20, 0x9e, 0xcc, 0x4b, 0xe8, 0x81, 0x42, 0xa0,
+  0x87, 0xfe, 0x53, 0x42, 0x0f, 0x14, 0x96, 0x54, 0x9e, 0xb1, 0xc8, 0xa0,
+  0x2d, 0xcf, 0x58, 0x2e, 0x50, 0x09, 0x03, 0x52, 0xc8, 0x25, 0x2a, 0x61,
+  0x40, 0x8a, 0x94, 0x41, 0xb5, 0x50, 0x96, 0x41, 0xb2, 0x90, 0x6a, 0xa0,
+  0x2c, 0xb9, 0x64, 0x20, 0xd5, 0x3e, 0x59, 0x72, 0xc9, 0x3e, 0xaa, 0x79,
+  0xb4, 0x85, 0x19, 0x4b, 0xa5, 0x29, 0xa1, 0x97, 0xad, 0xa3, 0x1a, 0x47,
+  0x5b, 0x1c, 0x81, 0x3e, 0xbc, 0x5f, 0x96, 0x14, 0x1f, 0x28, 0x52, 0xf2,
+  0xe9, 0xe2, 0xb6, 0x84, 0x1c, 0x28, 0x52, 0xf2, 0xe5, 0xe2, 0xb3, 0xf9,
+  0xe8, 0x54, 0x1e, 0x5d, 0x4b, 0x47, 0x0e, 0xbd, 0x1a, 0x32, 0x8d, 0x47,
+  0xb7, 0x82, 0x84, 0x42, 0x9d, 0x7f, 0x8d, 0x56, 0x25, 0x75, 0x06, 0x8a,
+  0x94, 0xfe, 0x26, 0xb8, 0x2a, 0xe9, 0x03, 0x48, 0x51, 0xd0, 0xed, 0x92,
+  0x1e, 0x47, 0xf0, 0x3f, 0x69, 0x37, 0xab, 0xcb, 0xdd, 0x0c, 0xac, 0x86,
+  0x31, 0xe8, 0x21, 0xaf, 0x22, 0xb4, 0x6f, 0x13, 0x32, 0xa1, 0xb1, 0xaf,
+  0xa0, 0x22, 0xf7, 0xb9, 0x05, 0x03, 0x1e, 0xa4, 0x10, 0xe8, 0xc3, 0xc9,
+  0xb4, 0x84, 0x1e, 0x28, 0x44, 0x67, 0x5a, 0x3e, 0xe0, 0x91, 0xd1, 0xa4,
+  0x60, 0xfa, 0x52, 0x71, 0x32, 0xa1, 0xd5, 0xa3, 0x1b, 0x49, 0x4f, 0x56,
+  0x11, 0x50, 0x48, 0xe4, 0xa3, 0xe2, 0x72, 0x21, 0x85, 0xe4, 0x54, 0x6e,
+  0x09, 0x3d, 0x50, 0x48, 0xf4, 0x33, 0x47, 0x64, 0xd0, 0xd1, 0xcf, 0x84,
+  0x19, 0xf3, 0xcd, 0xf5, 0x64, 0x26, 0xb6, 0x46, 0x4e, 0xc5, 0x91, 0x4c,
+  0x60, 0x9a, 0x2e, 0x16, 0x51, 0xa1, 0x16, 0x42, 0x21, 0x30, 0x20, 0x1e,
+  0x58, 0xe5, 0xa1, 0xf2, 0xa8, 0x6f, 0x74, 0x61, 0x8c, 0x00, 0x4a, 0x89,
+  0xed, 0x7e, 0x93, 0xc2, 0x01, 0x99, 0xc8, 0x34, 0x99, 0x6f, 0xc4, 0x24,
+  0xc6, 0x9e, 0x9b, 0xd9, 0xe2, 0x7a, 0x23, 0xa6, 0xc5, 0xb5, 0xc0, 0x14,
+  0x61, 0x9f, 0xcf, 0x77, 0xe5, 0x64, 0xf6, 0x40, 0x08, 0x53, 0xbe, 0xf1,
+  0xc3, 0x72, 0xb1, 0x2a, 0xef, 0x02, 0x84, 0x2c, 0xe5, 0x9a, 0x40, 0x3c,
+  0xb8, 0x2a, 0x34, 0x3a, 0xa1, 0x10, 0x22, 0xcc, 0xf5, 0x86, 0xc5, 0x23,
+  0x84, 0x02, 0xdf, 0x6d, 0x30, 0x23, 0xf8, 0x6d, 0xb9, 0x8a, 0x28, 0x85,
+  0xc0, 0x31, 0x8d, 0x26, 0xf3, 0x55, 0x21, 0x07, 0xa1, 0x90, 0x38, 0xf0,
+  0x93, 0xc4, 0x94, 0x45, 0xc7, 0x81, 0x14, 0x52, 0xc0, 0x74, 0xec, 0xc2,
+  0xfa, 0x13, 0x0a, 0x99, 0x61, 0x59, 0xca, 0x20, 0x87, 0xe4, 0x92, 0xce,
+  0x86, 0x14, 0x12, 0xfd, 0x55, 0x29, 0xbd, 0xd8, 0x20, 0x8a, 0x95, 0x34,
+  0xf4, 0x8a, 0x95, 0x14, 0x23, 0xe9, 0x18, 0x64, 0x23, 0x21, 0x92, 0xcd,
+  0xd5, 0x83, 0xa0, 0x26, 0xc3, 0x91, 0x50, 0x88, 0x4c, 0xf7, 0xab, 0xe0,
+  0x66, 0x15, 0x46, 0xdc, 0x59, 0xf4, 0xfe, 0x98, 0x90, 0xc9, 0x9c, 0xab,
+  0xc5, 0x67, 0x58, 0x15, 0x30, 0xd6, 0x7c, 0x4e, 0x4a, 0x96, 0xb2, 0x46,
+  0x21, 0xde, 0x09, 0x7e, 0x5d, 0xa6, 0x34, 0x21, 0x93, 0x38, 0x7f, 0x5d,
+  0x2f, 0x84, 0x78, 0x52, 0x30, 0xc5, 0xa5, 0xb4, 0x02, 0xaf, 0xd2, 0x02,
+  0x59, 0xfb, 0xc8, 0x2d, 0xa0, 0x36, 0x80, 0x86, 0x5e, 0x6e, 0x80, 0x78,
+  0x14, 0x4c, 0xaf, 0xa6, 0x42, 0x00, 0xca, 0xeb, 0x74, 0x8c, 0x50, 0xe1,
+  0x14, 0x23, 0x57, 0x21, 0xa7, 0x38, 0x6f, 0x2a, 0xed, 0xaf, 0x2b, 0xa5,
+  0xbf, 0xae, 0x22, 0x18, 0xbb, 0x0b, 0x6b, 0x45, 0x28, 0x8a, 0xc6, 0x79,
+  0x61, 0x32, 0x2d, 0x0c, 0xf5, 0x0d, 0x61, 0x44, 0xc5, 0xef, 0xd5, 0xb5,
+  0x53, 0x09, 0x58, 0xd3, 0xdd, 0xfb, 0xc8, 0x44, 0xe6, 0x68, 0x40, 0x26,
+  0x30, 0x4d, 0x66, 0xc1, 0xad, 0x76, 0x46, 0x2a, 0x33, 0x21, 0x99, 0x38,
+  0x78, 0xcf, 0x7f, 0xde, 0x44, 0x15, 0x90, 0x09, 0x4c, 0xcb, 0x68, 0xf1,
+  0xf3, 0x06, 0xaa, 0x90, 0x4c, 0xe0, 0xa2, 0xf3, 0xa0, 0x52, 0x2e, 0x24,
+  0xb3, 0x9e, 0x25, 0x20, 0x95, 0x14, 0x62, 0x20, 0x59, 0xcc, 0x1a, 0x72,
+  0x06, 0x5f, 0x0b, 0xff, 0xf7, 0xbd, 0xc3, 0x14, 0xee, 0x7f, 0x41, 0xbc,
+  0x29, 0x3c, 0x9e, 0xf0, 0xe4, 0x9b, 0x40, 0x25, 0xfb, 0x3f, 0xb6, 0xd3,
+  0xac, 0x2b, 0xfb, 0x3f, 0x75, 0xd7, 0x6b, 0xec, 0xf6, 0x7f, 0xbe, 0xc7,
+  0x23, 0xde, 0xff, 0xd2, 0xeb, 0x5f, 0xb4, 0x87, 0x97, 0x17, 0x3d, 0xe5,
+  0x12, 0x18, 0x21, 0x99, 0xbc, 0xd5, 0x1a, 0xf4, 0x4f, 0x1c, 0xc7, 0xe0,
+  0xde, 0x22, 0xce, 0xfc, 0x93, 0x34, 0xbf, 0xc7, 0x7e, 0xa9, 0x17, 0xa5,
+  0xa4, 0xb2, 0xfe, 0xfb, 0xba, 0xc2, 0xff, 0xe5, 0x23, 0xde, 0xff, 0x84,
+  0x1f, 0xae, 0x7e, 0x8b, 0x1d, 0xe0, 0xb2, 0xfe, 0x5f, 0xaf, 0x65, 0xf6,
+  0x7f, 0x6b, 0xf5, 0xdd, 0xfe, 0xef, 0x77, 0x79, 0xa4, 0xfb, 0x9f, 0xba,
+  0x9d, 0x77, 0x6a, 0xe7, 0xe7, 0x69, 0xcf, 0xb4, 0xc0, 0xee, 0x6f, 0x39,
+  0xae, 0x3b, 0xc2, 0x52, 0x9a, 0x6c, 0xf6, 0x60, 0x72, 0xf0, 0x63, 0x4b,
+  0x78, 0x59, 0x08, 0x89, 0xc3, 0x4e, 0xef, 0xd3, 0x09, 0xfd, 0x94, 0x38,
+  0x01, 0x0e, 0x39, 0x42, 0x9f, 0x0b, 0x10, 0x02, 0xce, 0xc8, 0x7c, 0xd1,
+  0xc4, 0x90, 0xba, 0x19, 0x0a, 0x9c, 0xca, 0x44, 0x51, 0xd5, 0x64, 0xac,
+  0xb8, 0xf4, 0x25, 0x0b, 0xdf, 0x8a, 0xa0, 0xe2, 0x13, 0x3d, 0x72, 0x06,
+  0x7e, 0xd9, 0xc6, 0x64, 0x89, 0x5f, 0x4a, 0x31, 0x26, 0x7f, 0x12, 0xfb,
+  0x7c, 0x3e, 0xe4, 0xa8, 0xd9, 0xa0, 0x50, 0xca, 0x56, 0xef, 0x83, 0xa2,
+  0x56, 0x23, 0x5b, 0xe4, 0x7f, 0x74, 0x0b, 0xef, 0x9e, 0xdd, 0xb3, 0x7b,
+  0x76, 0xcf, 0xee, 0xd9, 0x3d, 0xbb, 0x67, 0xf7, 0xec, 0x9e, 0xdd, 0xb3,
+  0x7b, 0x76, 0xcf, 0xee, 0xd9, 0x3d, 0xbb, 0xe7, 0xff, 0xfd, 0xf9, 0x0f,
+  0x58, 0xf6, 0xcd, 0xc3, 0x00, 0xf0, 0x00, 0x00
+};
+const unsigned int include_len = 10832;
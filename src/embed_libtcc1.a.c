@@ -0,0 +1,720 @@
+// Embedded: lib/tinycc/libtcc1.a
+// source generated by cjit/build/embed-path.sh
+// Mon Oct 19 15:33:27 UTC 2026
+// libtcc1.a
+const char libtcc1_a[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0x5d,
+  0x0b, 0x70, 0x1c, 0xc5, 0x99, 0x9e, 0x7d, 0x49, 0xab, 0x97, 0x77, 0x2d,
+  0xbf, 0x64, 0x5b, 0x96, 0x57, 0x60, 0x62, 0xe4, 0x87, 0xac, 0xc7, 0x5a,
+  0x5e, 0x3b, 0x60, 0x2b, 0x29, 0x96, 0x2c, 0x44, 0x4b, 0xb8, 0x70, 0x2e,
+  0x7c, 0x84, 0x3b, 0x59, 0x5e, 0x49, 0xb6, 0x38, 0xbd, 0x90, 0xd6, 0x44,
+  0x70, 0x3c, 0x2c, 0xd6, 0xf2, 0x69, 0x6b, 0x2d, 0xce, 0x10, 0x48, 0x14,
+  0x2a, 0x80, 0x2f, 0x71, 0x25, 0x90, 0x72, 0xc0, 0x70, 0xc4, 0x96, 0xa9,
+  0xc3, 0xb7, 0x8b, 0x7d, 0x58, 0x04, 0x9f, 0xd1, 0x11, 0x8a, 0x92, 0x01,
+  0xc3, 0x72, 0xe5, 0x33, 0xda, 0x98, 0x24, 0x1b, 0x70, 0x72, 0x9b, 0x1c,
+  0xc1, 0xd7, 0x8f, 0x7f, 0x66, 0x7a, 0x7a, 0x7a, 0xac, 0x95, 0x77, 0x49,
+  0xe9, 0xaa, 0x3c, 0x55, 0xbb, 0xdd, 0xfd, 0xcd, 0xd7, 0xdd, 0xff, 0xfc,
+  0x7f, 0xff, 0xdd, 0x3d, 0xb3, 0xdd, 0xb3, 0xed, 0x6d, 0x5b, 0x82, 0x81,
+  0x40, 0x75, 0x65, 0x93, 0xf4, 0xc5, 0x1d, 0x55, 0xe8, 0xa8, 0x73, 0xbb,
+  0x49, 0x88, 0x0e, 0x6d, 0x58, 0x5d, 0x53, 0xe5, 0xae, 0x72, 0x4b, 0xd5,
+  0xab, 0x6b, 0xea, 0x56, 0xbb, 0x6b, 0xd6, 0x54, 0x55, 0xd5, 0x4a, 0x08,
+  0x5b, 0x8d, 0xe8, 0xae, 0xaa, 0x2f, 0x50, 0x26, 0xe5, 0xd8, 0xde, 0x1b,
+  0x6c, 0xea, 0x41, 0xa2, 0xf4, 0x74, 0x75, 0x05, 0x2f, 0xc6, 0x9b, 0xec,
+  0x3c, 0x7f, 0x71, 0xff, 0x4f, 0x8e, 0xf2, 0x6b, 0x9a, 0x7a, 0x02, 0xdb,
+  0xd6, 0xe7, 0xaf, 0x72, 0x69, 0x8f, 0x2a, 0x5d, 0xbc, 0x4a, 0x83, 0xd7,
+  0xd4, 0xba, 0x3d, 0x34, 0xb6, 0x39, 0x1f, 0x15, 0xb3, 0x55, 0x92, 0xf2,
+  0xba, 0xd3, 0xff, 0xcc, 0x6d, 0x90, 0xa4, 0x05, 0x76, 0x49, 0x2a, 0x5b,
+  0x72, 0xf9, 0x23, 0x7f, 0x36, 0x8d, 0xd1, 0xcf, 0xed, 0x4b, 0xb2, 0xf3,
+  0xb9, 0x03, 0x99, 0xe5, 0x7b, 0x3f, 0x90, 0xa4, 0x27, 0xb6, 0x35, 0x36,
+  0xb6, 0xb6, 0x77, 0x35, 0x05, 0xb7, 0x77, 0x36, 0xb7, 0xf5, 0xb6, 0x4a,
+  0x4c, 0xaa, 0x59, 0x93, 0xea, 0x23, 0xa9, 0xb6, 0xbe, 0xed, 0x9d, 0xbd,
+  0xbd, 0xad, 0xcd, 0x6d, 0x34, 0x01, 0xb1, 0x8e, 0x7b, 0x5a, 0x7a, 0xba,
+  0x7a, 0x55, 0x42, 0xb3, 0x42, 0x68, 0x66, 0x08, 0xcd, 0x2a, 0xa1, 0x4f,
+  0x21, 0x90, 0x58, 0x53, 0x7b, 0x7b, 0x57, 0xa0, 0x09, 0x01, 0x5b, 0xba,
+  0x50, 0x55, 0x8d, 0x4a, 0xb2, 0x29, 0xd8, 0xd5, 0xd1, 0x16, 0x68, 0xec,
+  0x0d, 0x76, 0xf5, 0xb4, 0x34, 0x56, 0xab, 0x40, 0x70, 0x5b, 0x4f, 0x4b,
+  0x53, 0x73, 0x63, 0x6b, 0x4b, 0x67, 0xa0, 0x45, 0x45, 0x91, 0xa4, 0xcd,
+  0x2c, 0x2b, 0xd0, 0xd5, 0xd1, 0xdd, 0x84, 0x32, 0xb6, 0xf4, 0x05, 0xb6,
+  0x35, 0x75, 0x6e, 0xd5, 0x94, 0x20, 0xc2, 0x9a, 0x9a, 0x71, 0x91, 0xc1,
+  0xc0, 0x36, 0x16, 0xec, 0xdd, 0xbe, 0x45, 0x0f, 0x36, 0x75, 0x0a, 0x98,
+  0x5d, 0x3d, 0x7a, 0xac, 0x4f, 0x04, 0x76, 0x0a, 0xb3, 0x53, 0x00, 0xcb,
+  0xa0, 0x03, 0xb1, 0x0c, 0x7a, 0x66, 0xa7, 0x80, 0x89, 0xaa, 0xd3, 0x61,
+  0x7d, 0x22, 0xb0, 0x93, 0xcb, 0x4e, 0x55, 0x5c, 0xc3, 0x29, 0xb3, 0xe6,
+  0x22, 0xca, 0xac, 0x11, 0x28, 0xb3, 0x46, 0xa4, 0xcc, 0x1a, 0x91, 0x32,
+  0x6b, 0x44, 0xca, 0xac, 0x11, 0x28, 0xb3, 0x46, 0xa4, 0xcc, 0x1a, 0xa1,
+  0x32, 0x6b, 0x44, 0xca, 0xd4, 0x81, 0x58, 0x06, 0x3d, 0xb3, 0x53, 0xc0,
+  0x44, 0xd5, 0xe9, 0xb0, 0x3e, 0x11, 0xd8, 0xc9, 0x65, 0xa7, 0xca, 0x74,
+  0x73, 0xca, 0x74, 0x5f, 0x44, 0x99, 0x6e, 0x81, 0x32, 0xdd, 0x22, 0x65,
+  0xba, 0x45, 0xca, 0x74, 0x8b, 0x94, 0xe9, 0x16, 0x28, 0xd3, 0x2d, 0x52,
+  0xa6, 0x5b, 0xa8, 0x4c, 0xb7, 0x48, 0x99, 0x3a, 0x10, 0xcb, 0xa0, 0x67,
+  0x76, 0x0a, 0x98, 0xa8, 0x3a, 0x1d, 0xd6, 0x27, 0x02, 0x3b, 0xb9, 0xec,
+  0x54, 0x99, 0x1e, 0x4e, 0x99, 0x9e, 0x8b, 0x28, 0xd3, 0x23, 0x50, 0xa6,
+  0x47, 0xa4, 0x4c, 0x8f, 0x48, 0x99, 0x1e, 0x91, 0x32, 0x3d, 0x02, 0x65,
+  0x7a, 0x44, 0xca, 0xf4, 0x08, 0x95, 0xe9, 0x11, 0x29, 0x53, 0x07, 0x62,
+  0x19, 0xf4, 0xcc, 0x4e, 0x01, 0x13, 0x55, 0xa7, 0xc3, 0xfa, 0x44, 0x60,
+  0x27, 0x97, 0xbd, 0xb7, 0x6d, 0x6b, 0x67, 0x53, 0x3b, 0xdf, 0x71, 0xb6,
+  0xf5, 0x22, 0xa5, 0x06, 0xfe, 0xbe, 0xb1, 0xb5, 0xa7, 0x85, 0x41, 0x83,
+  0x2d, 0xbd, 0x41, 0x52, 0x7d, 0x6f, 0x4b, 0x90, 0xd1, 0x76, 0x7b, 0x0b,
+  0x9a, 0x10, 0xa1, 0x9e, 0x7a, 0x7b, 0x5b, 0x7b, 0xb0, 0xad, 0xb3, 0xb1,
+  0xb5, 0xb5, 0x57, 0x9b, 0x6a, 0x6f, 0xe7, 0xd2, 0x4c, 0x32, 0xd0, 0x7e,
+  0x8f, 0x36, 0xd5, 0xce, 0x9d, 0xd5, 0x24, 0x83, 0xf7, 0x68, 0x53, 0xed,
+  0xdc, 0x59, 0x6d, 0xde, 0x9e, 0xde, 0x2d, 0x7c, 0xba, 0x5d, 0xc7, 0x60,
+  0x81, 0xee, 0xae, 0xee, 0x00, 0x1a, 0x6e, 0x82, 0x02, 0xa8, 0x5d, 0xc4,
+  0xd3, 0x60, 0x4d, 0x3d, 0x6d, 0xc1, 0xbb, 0x75, 0x40, 0xbb, 0x9e, 0x83,
+  0x11, 0xda, 0x84, 0x89, 0x3e, 0x03, 0x5d, 0x77, 0xb5, 0xf4, 0x34, 0x6d,
+  0xc5, 0x6a, 0xbe, 0xab, 0xa9, 0xb1, 0xa9, 0x67, 0x2b, 0x8a, 0x34, 0xf7,
+  0x76, 0x35, 0xa2, 0x56, 0xda, 0xdc, 0xde, 0x22, 0xb5, 0xc3, 0x7c, 0xbb,
+  0x6b, 0xd5, 0xc5, 0xe7, 0x59, 0xd5, 0x64, 0xca, 0xec, 0x72, 0xd5, 0xd6,
+  0xd4, 0xd6, 0xc8, 0xf3, 0xac, 0x07, 0xbc, 0x0d, 0xd7, 0x9b, 0x4d, 0x26,
+  0x65, 0xee, 0x66, 0x92, 0xd6, 0x4b, 0x26, 0xc1, 0x9c, 0x8e, 0xcc, 0xc8,
+  0xe0, 0xa8, 0x87, 0xef, 0x3c, 0xc9, 0x2e, 0x6d, 0xf4, 0x85, 0xff, 0xdb,
+  0xd7, 0xff, 0xb1, 0x0b, 0x01, 0xbe, 0xf0, 0x7d, 0x29, 0x5f, 0xc4, 0x9b,
+  0xf2, 0x85, 0xbd, 0xc9, 0x88, 0xf7, 0x7c, 0x28, 0x25, 0x39, 0x76, 0xcf,
+  0xc0, 0x78, 0xc4, 0x9b, 0xfc, 0xd4, 0xe7, 0x58, 0x16, 0x4d, 0xac, 0x81,
+  0xd4, 0xcd, 0x1f, 0xac, 0x58, 0xe2, 0x0b, 0x1d, 0xb3, 0x9f, 0x8a, 0xbe,
+  0x7b, 0x5f, 0xfc, 0xf4, 0xf8, 0xbb, 0x2b, 0x71, 0x79, 0xef, 0x76, 0xc4,
+  0xdf, 0x8f, 0xc9, 0x48, 0x47, 0xfc, 0xd4, 0xed, 0x4b, 0x92, 0x9f, 0x3a,
+  0x9c, 0xd7, 0x2d, 0x49, 0x26, 0xf0, 0xd9, 0xd7, 0x8e, 0xa6, 0x59, 0xd3,
+  0x27, 0x53, 0xae, 0xe9, 0x34, 0xaa, 0xe9, 0x93, 0x29, 0xd4, 0x34, 0x93,
+  0x2b, 0x3b, 0xb1, 0x72, 0x0a, 0x95, 0xe9, 0xab, 0x68, 0x75, 0xbc, 0xed,
+  0x4d, 0xb5, 0x3a, 0x3a, 0xf1, 0xd7, 0xfd, 0xde, 0xf3, 0x50, 0xcb, 0x80,
+  0x03, 0x17, 0x3a, 0x22, 0xab, 0x3c, 0x71, 0x02, 0x7d, 0xa1, 0x53, 0xb1,
+  0x89, 0x79, 0xfd, 0xf1, 0x0b, 0x28, 0x1e, 0x9a, 0xb8, 0x3f, 0x34, 0x51,
+  0x42, 0xa5, 0x42, 0xc8, 0x85, 0x07, 0xa4, 0xfe, 0x51, 0x49, 0xda, 0x81,
+  0x04, 0xf6, 0x4e, 0x20, 0x51, 0x42, 0xa9, 0x0a, 0xc7, 0x6e, 0x4d, 0x11,
+  0x3b, 0x12, 0x61, 0x52, 0x44, 0x92, 0x5c, 0xc3, 0x2c, 0x2a, 0xf2, 0x44,
+  0xc4, 0x9f, 0xf4, 0xfd, 0x32, 0x8e, 0x33, 0x25, 0x36, 0xc8, 0xa7, 0x13,
+  0x8e, 0xdd, 0x68, 0xaa, 0x27, 0x91, 0x8c, 0xe8, 0x7c, 0xc5, 0xa8, 0x2f,
+  0xe2, 0x9f, 0xf0, 0x85, 0xfd, 0xf1, 0x70, 0x0c, 0x65, 0x89, 0xfb, 0x7e,
+  0x39, 0x41, 0xf8, 0x9c, 0x80, 0xcb, 0xa9, 0x80, 0xfd, 0x71, 0x5c, 0x17,
+  0xae, 0x63, 0xe7, 0x1c, 0x0d, 0x81, 0x14, 0x82, 0xca, 0x42, 0x59, 0x71,
+  0xc5, 0x42, 0x15, 0xd8, 0x24, 0x92, 0xe8, 0xf4, 0xa7, 0x1c, 0xab, 0x46,
+  0x0f, 0x48, 0xf7, 0x58, 0x1c, 0xdf, 0x89, 0x3a, 0x0e, 0x46, 0xc3, 0xde,
+  0x8f, 0x49, 0x81, 0xf8, 0x74, 0xa2, 0x84, 0x52, 0x90, 0x49, 0x22, 0x32,
+  0xdd, 0xee, 0xb8, 0x35, 0x96, 0xb0, 0xc9, 0x38, 0xd6, 0xe2, 0x04, 0x8e,
+  0x4d, 0x4c, 0x90, 0x7a, 0x89, 0x8e, 0x98, 0x02, 0xe6, 0xf2, 0x62, 0x25,
+  0x91, 0x58, 0x09, 0x2b, 0xd8, 0x50, 0x91, 0xab, 0x4a, 0x96, 0xeb, 0x53,
+  0x54, 0x5e, 0x0a, 0xc7, 0x92, 0xf8, 0xbc, 0x4f, 0x64, 0x9c, 0xf7, 0xc1,
+  0x38, 0xa9, 0xd9, 0xc8, 0x14, 0xb9, 0x92, 0xd4, 0x3f, 0xf1, 0xb9, 0x05,
+  0x9b, 0x68, 0x35, 0x92, 0x9c, 0x64, 0x3a, 0x7c, 0x81, 0x1c, 0x0e, 0xc9,
+  0x57, 0x3e, 0xea, 0x3b, 0x4c, 0x73, 0x39, 0x25, 0x5f, 0x1e, 0x56, 0x47,
+  0x9c, 0x48, 0x57, 0x68, 0x60, 0xae, 0x8f, 0x59, 0x73, 0xc5, 0x23, 0xfe,
+  0x8f, 0xa9, 0xb9, 0xe2, 0x60, 0x2e, 0x74, 0xfa, 0x84, 0xc6, 0x5c, 0x1f,
+  0x13, 0x73, 0x21, 0x8a, 0x7f, 0x9c, 0x98, 0x6b, 0x9c, 0x9a, 0x2b, 0x7e,
+  0x09, 0xe6, 0x8a, 0x53, 0x73, 0xc5, 0x71, 0xc5, 0x7a, 0x73, 0x21, 0xb5,
+  0x10, 0xfd, 0xa3, 0xd0, 0x8f, 0xd4, 0x63, 0x68, 0xaf, 0xf9, 0x94, 0xa3,
+  0xd8, 0x0b, 0xc5, 0xed, 0xad, 0xb2, 0xc1, 0x14, 0xdd, 0xc6, 0x71, 0x2c,
+  0x9e, 0xb1, 0xc1, 0xde, 0xed, 0x70, 0x62, 0x57, 0x4b, 0x9e, 0x1e, 0x57,
+  0x6d, 0x55, 0x8a, 0x70, 0xc7, 0x21, 0x6f, 0x4a, 0x64, 0xb8, 0xa7, 0xe0,
+  0x1c, 0x32, 0xdb, 0x03, 0xc4, 0x6c, 0x1b, 0xb0, 0xd9, 0xea, 0x65, 0xb3,
+  0xc9, 0xc6, 0x91, 0x1c, 0x0f, 0x71, 0xc6, 0x69, 0x95, 0xb5, 0x1f, 0x73,
+  0x0c, 0x71, 0x65, 0x7e, 0x7d, 0x72, 0x63, 0xd0, 0x2a, 0x91, 0xb7, 0x4a,
+  0x53, 0xd0, 0xbc, 0x13, 0x5f, 0x1f, 0x74, 0x29, 0xce, 0xf7, 0x4f, 0x7d,
+  0x10, 0xff, 0xc3, 0x31, 0x9b, 0xe3, 0x51, 0xaa, 0xef, 0xf3, 0xaa, 0xb6,
+  0xf2, 0x41, 0x0d, 0xf1, 0x84, 0x85, 0xc6, 0xe4, 0xac, 0xf7, 0x2e, 0x91,
+  0x4e, 0x8f, 0x53, 0x0d, 0x87, 0x8e, 0x39, 0x51, 0xf1, 0xa9, 0x08, 0x9b,
+  0x4f, 0xa7, 0xe5, 0x14, 0xa3, 0xe5, 0xd4, 0x6b, 0x47, 0x25, 0xcd, 0xb1,
+  0x63, 0x43, 0xfd, 0x94, 0xd2, 0x17, 0x3b, 0x76, 0x18, 0xc4, 0x35, 0x07,
+  0x1e, 0x93, 0xac, 0xd2, 0xef, 0x2e, 0xf0, 0xf8, 0x7c, 0x72, 0xce, 0xa2,
+  0xa4, 0x9d, 0x10, 0x2e, 0x07, 0xdc, 0xc9, 0xe1, 0xd7, 0x02, 0xee, 0xe2,
+  0xf0, 0x4d, 0x80, 0xcb, 0x0f, 0x59, 0xac, 0x10, 0xde, 0x07, 0xb8, 0x07,
+  0xd2, 0x76, 0x08, 0x7f, 0x04, 0x78, 0x3d, 0x57, 0x4e, 0x01, 0xfa, 0x14,
+  0x33, 0x23, 0xe8, 0x1d, 0x10, 0x2e, 0x02, 0xfc, 0x0e, 0x0e, 0x5f, 0x05,
+  0xf8, 0x5b, 0x90, 0x0e, 0x40, 0xf8, 0x15, 0xc0, 0xd7, 0x40, 0x51, 0x16,
+  0x08, 0x6f, 0x02, 0x7c, 0x9d, 0x99, 0xa6, 0x87, 0x81, 0x7f, 0x3b, 0xfa,
+  0xcc, 0x44, 0xf2, 0xdc, 0xcc, 0xc9, 0xdf, 0x0a, 0xfc, 0x37, 0x81, 0x3f,
+  0x0f, 0xca, 0xe9, 0x05, 0x3c, 0x01, 0xaa, 0x7b, 0x1c, 0xf8, 0x0f, 0x42,
+  0x39, 0x9b, 0xb8, 0xeb, 0xdd, 0x0d, 0xfc, 0x10, 0x14, 0x1c, 0x07, 0xfc,
+  0xfb, 0x80, 0x07, 0x6c, 0x34, 0xbd, 0x4b, 0xe2, 0x0e, 0x79, 0x72, 0x12,
+  0x90, 0xb4, 0x8f, 0x0c, 0x1a, 0x2a, 0xeb, 0xb8, 0xc7, 0x06, 0x0d, 0x95,
+  0x6b, 0xb8, 0x47, 0x07, 0x0d, 0x95, 0x1e, 0xa3, 0xc7, 0x07, 0x0d, 0x95,
+  0x6b, 0x27, 0x7f, 0x84, 0xd0, 0x50, 0x59, 0x5d, 0x35, 0xf9, 0x73, 0x04,
+  0xc4, 0xaa, 0x56, 0xc4, 0xbd, 0x1e, 0x42, 0x33, 0x7c, 0x3e, 0xa3, 0x3d,
+  0xf7, 0x85, 0x03, 0x0c, 0x6e, 0x61, 0xf0, 0x45, 0x26, 0x15, 0xb7, 0x32,
+  0xf8, 0x4d, 0x66, 0x15, 0xb7, 0x31, 0xf8, 0x7d, 0x80, 0xe7, 0xa1, 0x4f,
+  0x11, 0x83, 0x3f, 0x61, 0x56, 0xed, 0x56, 0xc0, 0xe0, 0x7f, 0xb6, 0xa8,
+  0xe5, 0xe4, 0x30, 0xf8, 0x4a, 0xab, 0x5a, 0x8e, 0x93, 0xad, 0xd7, 0xaa,
+  0x96, 0x33, 0x83, 0xc1, 0xbb, 0x6d, 0x6a, 0x39, 0xb9, 0xec, 0x75, 0xd9,
+  0x54, 0xfe, 0x4c, 0x06, 0x57, 0x14, 0x52, 0x19, 0x6c, 0xe9, 0x0b, 0x4a,
+  0x95, 0xcd, 0x4d, 0xc1, 0x26, 0xfa, 0x5d, 0xd9, 0xd3, 0x25, 0x55, 0x6e,
+  0xe9, 0xed, 0x95, 0x2a, 0x7b, 0xef, 0xee, 0x08, 0x36, 0x6d, 0x41, 0x61,
+  0xb0, 0x87, 0x84, 0x3d, 0x2d, 0xed, 0x4d, 0x40, 0xef, 0xdd, 0x06, 0x60,
+  0xa6, 0x87, 0x09, 0x3e, 0x39, 0x1c, 0x5e, 0x0f, 0x61, 0xc2, 0xa6, 0xc5,
+  0xed, 0x1c, 0x2f, 0x17, 0xf2, 0x5b, 0x38, 0xbc, 0x8a, 0x2f, 0xd0, 0x20,
+  0x7f, 0xd1, 0x24, 0xf9, 0x37, 0x73, 0xb8, 0x93, 0x4b, 0xcf, 0x85, 0x32,
+  0xf9, 0xfc, 0x7b, 0xd2, 0xac, 0x7f, 0xa1, 0x44, 0x6d, 0xc6, 0x1f, 0x72,
+  0xfe, 0x51, 0x68, 0x7f, 0x39, 0x90, 0x57, 0xce, 0x5f, 0x02, 0xe1, 0x95,
+  0x82, 0xba, 0xf1, 0xb1, 0x19, 0x88, 0x4f, 0x73, 0x38, 0x3f, 0xf7, 0xc7,
+  0xfd, 0xa8, 0x55, 0xd2, 0x1f, 0xce, 0x3c, 0x90, 0x17, 0x32, 0xd8, 0x20,
+  0x2f, 0x5f, 0x7f, 0x9d, 0x41, 0xfd, 0x2e, 0xb8, 0x9f, 0xa8, 0x9f, 0xa4,
+  0x7e, 0xfa, 0x54, 0x4f, 0xb9, 0xb5, 0x99, 0xf4, 0xde, 0xc6, 0xb3, 0xb6,
+  0xce, 0x35, 0xd5, 0x7b, 0x9b, 0x7a, 0x06, 0xac, 0x87, 0x6f, 0x7c, 0x6f,
+  0x73, 0x9b, 0x2f, 0x9c, 0xf2, 0xd9, 0xc8, 0xf0, 0x7e, 0x55, 0x12, 0x4f,
+  0xdf, 0x76, 0xe2, 0x73, 0xbe, 0x8a, 0x63, 0xbe, 0x70, 0xfc, 0x9b, 0x47,
+  0x05, 0x05, 0x31, 0xd7, 0x20, 0x1a, 0xab, 0x66, 0xc2, 0xd9, 0x52, 0x0e,
+  0xc7, 0xaa, 0x70, 0x8a, 0x24, 0x83, 0x8b, 0xbf, 0x45, 0x7e, 0xd4, 0xd9,
+  0x5d, 0xab, 0x39, 0x5d, 0x0c, 0x21, 0xb6, 0x0f, 0xdb, 0x57, 0x29, 0x84,
+  0x69, 0xee, 0xbb, 0x65, 0x1c, 0x9e, 0xae, 0xef, 0x6e, 0x36, 0xa8, 0x2f,
+  0x5d, 0xdf, 0x4d, 0x37, 0xbf, 0x91, 0xef, 0xa6, 0x9b, 0xdf, 0xc8, 0x77,
+  0x37, 0x73, 0x61, 0x0e, 0xd4, 0x91, 0xae, 0xef, 0x46, 0x21, 0x9c, 0xcd,
+  0xe1, 0xe9, 0xfa, 0x6e, 0x9c, 0xab, 0x67, 0xaa, 0xbe, 0x2b, 0x57, 0x54,
+  0x3f, 0x49, 0xfd, 0xb4, 0xd5, 0xae, 0xdc, 0x12, 0x04, 0xf7, 0x9d, 0xcc,
+  0x77, 0xd7, 0xae, 0xad, 0x99, 0xb2, 0xef, 0xee, 0xbd, 0x98, 0xef, 0x86,
+  0x5f, 0xf5, 0xd9, 0x70, 0x87, 0xac, 0x73, 0xdf, 0x8f, 0xb0, 0x07, 0xdf,
+  0x4c, 0x26, 0xc3, 0x9b, 0x6e, 0xbb, 0x98, 0x2b, 0x1b, 0xfa, 0x72, 0x29,
+  0x9c, 0x5d, 0xce, 0xe1, 0xb8, 0xcd, 0x89, 0x7c, 0x79, 0xb1, 0xa4, 0x1f,
+  0x1b, 0x34, 0x87, 0xaa, 0xac, 0x5b, 0xf8, 0x9f, 0x34, 0x90, 0xdb, 0xcb,
+  0x48, 0x67, 0xcb, 0xb7, 0x1b, 0x7b, 0x5a, 0xb6, 0xb6, 0x75, 0x75, 0x72,
+  0xd9, 0xe7, 0x40, 0xc8, 0xf7, 0x05, 0x57, 0x31, 0x38, 0x3b, 0x3f, 0x99,
+  0xee, 0x7d, 0xc3, 0x4a, 0x0e, 0x4f, 0xb7, 0x6f, 0xe8, 0x36, 0xa8, 0x2f,
+  0xdd, 0xbe, 0x21, 0xdd, 0xfc, 0x46, 0x7d, 0x43, 0xba, 0xf9, 0x8d, 0xfa,
+  0x06, 0x39, 0x7f, 0x1f, 0x84, 0x53, 0xed, 0x1b, 0x92, 0x10, 0xd6, 0x70,
+  0x78, 0xba, 0x7d, 0x43, 0x15, 0x10, 0xe5, 0xfb, 0xa0, 0xa9, 0xf6, 0x0d,
+  0x9b, 0xd3, 0xec, 0x1b, 0x7a, 0x83, 0xcd, 0xf4, 0xd9, 0x70, 0x9a, 0x7d,
+  0x43, 0xb5, 0x7b, 0x6d, 0x5d, 0xd5, 0x14, 0xfb, 0x86, 0x2a, 0x8f, 0x1a,
+  0xaf, 0x87, 0x6f, 0xd1, 0x33, 0xcb, 0xf0, 0x76, 0x74, 0xab, 0xbf, 0x11,
+  0x3f, 0x96, 0x4a, 0x39, 0x0e, 0xfa, 0x93, 0x83, 0xf6, 0x11, 0x72, 0xdb,
+  0x1b, 0x3e, 0x4e, 0x3a, 0x08, 0xcd, 0x0d, 0xb8, 0xcc, 0x1f, 0x31, 0x33,
+  0x0c, 0x9a, 0x51, 0x25, 0xd6, 0xf3, 0x05, 0x87, 0xfd, 0xf1, 0x86, 0xb0,
+  0x77, 0xbc, 0x21, 0xec, 0x1f, 0xc3, 0xcf, 0x15, 0x10, 0x77, 0xd0, 0x7b,
+  0x12, 0x1e, 0x2b, 0x46, 0x7d, 0x91, 0x8d, 0xe8, 0x26, 0xde, 0x3f, 0xe1,
+  0x38, 0xe8, 0x3d, 0x99, 0x74, 0x1c, 0xc8, 0x1f, 0xf4, 0xbe, 0x41, 0x49,
+  0xfe, 0x37, 0x06, 0xed, 0x08, 0x7c, 0x03, 0xc5, 0x4e, 0xae, 0x1d, 0xa5,
+  0xb7, 0xfa, 0xfa, 0x87, 0x93, 0x50, 0x07, 0xb9, 0x73, 0xc7, 0x1d, 0x1e,
+  0x29, 0xf5, 0x38, 0x49, 0x12, 0xe1, 0x50, 0xa6, 0x41, 0xef, 0x59, 0x54,
+  0x4e, 0x72, 0xd0, 0xfb, 0xd1, 0x08, 0x36, 0xe7, 0x0d, 0xe1, 0x18, 0x84,
+  0xd1, 0x11, 0x13, 0x09, 0x8f, 0xa2, 0xd3, 0x1f, 0xdd, 0x10, 0x7e, 0xc5,
+  0x37, 0xe4, 0x3d, 0xab, 0x96, 0xd1, 0x10, 0x7e, 0xb3, 0x21, 0x7c, 0x4a,
+  0x53, 0x12, 0x79, 0x5c, 0x70, 0x00, 0xf7, 0xa5, 0x07, 0xbd, 0x67, 0x33,
+  0x90, 0xe5, 0x2c, 0xd6, 0xb3, 0x69, 0x34, 0x5b, 0x12, 0xfd, 0x94, 0x4a,
+  0xf4, 0x51, 0xa6, 0x12, 0x55, 0x4c, 0x3b, 0x89, 0xca, 0xa7, 0x9d, 0x44,
+  0x79, 0xd3, 0x4e, 0xa2, 0xea, 0x69, 0x27, 0x51, 0xf9, 0x68, 0x28, 0x79,
+  0x21, 0x5b, 0x42, 0xfd, 0x24, 0x4b, 0x42, 0x65, 0xdd, 0xdd, 0x32, 0xee,
+  0x00, 0xb2, 0xee, 0x6e, 0x19, 0x4b, 0x94, 0x75, 0x77, 0xcb, 0x58, 0xa2,
+  0xac, 0xbb, 0x5b, 0xc6, 0x12, 0x65, 0xdd, 0xdd, 0xb2, 0x60, 0xb5, 0xec,
+  0xbb, 0x9b, 0xb1, 0x50, 0x64, 0xb4, 0x3f, 0xe4, 0x4f, 0xb6, 0x86, 0x2f,
+  0x69, 0x9e, 0x70, 0x68, 0x0a, 0xf3, 0x84, 0x43, 0x52, 0x6b, 0xd8, 0x7b,
+  0x42, 0x33, 0x51, 0x38, 0x84, 0x26, 0x0a, 0x87, 0xbc, 0x27, 0x92, 0xad,
+  0x8e, 0xe7, 0xf3, 0xd1, 0xc9, 0x93, 0x94, 0xe7, 0x3f, 0x89, 0xa4, 0x41,
+  0xf8, 0x49, 0x14, 0x3d, 0x91, 0xc1, 0x5c, 0xe1, 0x50, 0x14, 0x95, 0x79,
+  0x06, 0x15, 0x84, 0xae, 0xce, 0x7b, 0xd6, 0x50, 0x9f, 0x87, 0xbc, 0x67,
+  0xa9, 0x3e, 0xcf, 0x4c, 0xae, 0xcf, 0xe7, 0xb0, 0x3e, 0x0f, 0x79, 0xcf,
+  0x64, 0x22, 0xcd, 0x19, 0xac, 0x6f, 0xd3, 0x68, 0xd6, 0x64, 0x7a, 0x86,
+  0xca, 0x74, 0x29, 0x0d, 0x4f, 0x2b, 0x53, 0xc5, 0x34, 0x94, 0xa9, 0x7c,
+  0x1a, 0xca, 0x94, 0x37, 0x0d, 0x65, 0xaa, 0x9e, 0x86, 0x32, 0x91, 0x9e,
+  0x2c, 0x6b, 0x62, 0xfd, 0x38, 0x5b, 0x62, 0x65, 0xdf, 0xf5, 0x32, 0xef,
+  0x0e, 0xb2, 0xef, 0x7a, 0x99, 0xcb, 0x94, 0x7d, 0xd7, 0xcb, 0x5c, 0xa6,
+  0xec, 0xbb, 0x5e, 0xe6, 0x32, 0x65, 0xdf, 0xf5, 0xb2, 0x61, 0xbb, 0x2f,
+  0xc0, 0xf5, 0x8c, 0xc5, 0xc2, 0xf9, 0x23, 0xfe, 0xe4, 0x25, 0xcd, 0x21,
+  0x22, 0xe9, 0x4f, 0x21, 0x22, 0x52, 0xd8, 0x3b, 0xca, 0x4e, 0x20, 0x22,
+  0xfe, 0x89, 0x88, 0x77, 0x34, 0x89, 0x66, 0x0f, 0x74, 0x66, 0x91, 0x8c,
+  0xf8, 0x4f, 0x84, 0xed, 0x11, 0xef, 0x89, 0x88, 0x7f, 0xf4, 0xd2, 0x27,
+  0x0e, 0x64, 0xa1, 0x44, 0x12, 0x69, 0xd3, 0x48, 0x79, 0x11, 0xef, 0x19,
+  0xaa, 0xbb, 0xf8, 0xe4, 0xba, 0x7b, 0x01, 0xe9, 0x8e, 0x5f, 0x72, 0x92,
+  0xbe, 0x14, 0xf1, 0x08, 0xee, 0xaf, 0xb2, 0x24, 0xca, 0xcf, 0x88, 0x28,
+  0x97, 0xd0, 0xb8, 0x14, 0x51, 0x2a, 0xa6, 0x8f, 0x28, 0xe5, 0xd3, 0x47,
+  0x94, 0xbc, 0xe9, 0x23, 0x4a, 0xf5, 0xf4, 0x11, 0x85, 0x74, 0x41, 0x59,
+  0x92, 0xe6, 0xa7, 0x19, 0x4b, 0x93, 0x65, 0x27, 0xca, 0xc4, 0x9f, 0xb3,
+  0xec, 0x44, 0x99, 0x88, 0x92, 0x65, 0x27, 0xca, 0x44, 0x94, 0x2c, 0x3b,
+  0x51, 0x26, 0xa2, 0x64, 0xd9, 0x89, 0x32, 0x33, 0x50, 0xb6, 0x9d, 0xc8,
+  0x58, 0x1a, 0x92, 0x1d, 0xaf, 0x47, 0xbc, 0xa4, 0x61, 0xdc, 0xc7, 0x8c,
+  0xe3, 0x37, 0xf3, 0x25, 0x73, 0xe3, 0x38, 0xe2, 0xd2, 0x11, 0x9c, 0x8c,
+  0xe4, 0x23, 0x68, 0x24, 0x1f, 0x21, 0x0b, 0x6a, 0x23, 0xde, 0x68, 0xd2,
+  0x87, 0x06, 0x73, 0x1f, 0x1d, 0xe6, 0x11, 0xcf, 0x3f, 0x8a, 0xa4, 0x41,
+  0x51, 0xbc, 0xf2, 0x30, 0xea, 0xd3, 0x0d, 0xe9, 0x55, 0xe9, 0x2a, 0x14,
+  0x95, 0x38, 0x2e, 0x2f, 0x82, 0x34, 0xd2, 0x25, 0x5e, 0x9f, 0x48, 0x95,
+  0x39, 0x9e, 0xde, 0x83, 0x00, 0xbc, 0x06, 0xf2, 0x92, 0x45, 0x19, 0x27,
+  0xaa, 0x36, 0x8d, 0x66, 0x4d, 0xa2, 0xa7, 0xa9, 0x44, 0xf1, 0x0c, 0x25,
+  0xaa, 0x98, 0x76, 0x12, 0x95, 0x4f, 0x3b, 0x89, 0xf2, 0xa6, 0x9d, 0x44,
+  0xd5, 0xd3, 0x4e, 0x22, 0x64, 0x35, 0xd4, 0x75, 0x65, 0x4d, 0xaa, 0x7d,
+  0xd9, 0x91, 0x2a, 0xfb, 0xfe, 0x96, 0x69, 0x0f, 0x90, 0x7d, 0x7f, 0xcb,
+  0x54, 0xa2, 0xec, 0xfb, 0x5b, 0xa6, 0x12, 0x65, 0xdf, 0xdf, 0x32, 0x95,
+  0x28, 0xfb, 0xfe, 0x96, 0x05, 0xab, 0x7d, 0x01, 0xfe, 0x36, 0xae, 0x1b,
+  0xfc, 0x75, 0x40, 0xd2, 0x17, 0x2a, 0x5c, 0x22, 0xd8, 0x67, 0x84, 0xa4,
+  0x4f, 0xe0, 0x75, 0xdf, 0xa4, 0xfa, 0x41, 0xef, 0x6f, 0x13, 0x2d, 0x6c,
+  0x62, 0x13, 0x9b, 0xf8, 0x3a, 0x9b, 0x58, 0x2f, 0xc1, 0x8e, 0x03, 0x9c,
+  0xc0, 0x4b, 0x99, 0x89, 0xa4, 0xa1, 0x94, 0xc9, 0xb1, 0xf3, 0x79, 0x2c,
+  0x54, 0x28, 0x65, 0x76, 0xec, 0x7c, 0x91, 0xc6, 0xac, 0x8e, 0x9d, 0x87,
+  0x68, 0xcc, 0xee, 0xd8, 0xf9, 0x12, 0x8a, 0x25, 0x5e, 0xc1, 0x8f, 0x2a,
+  0x8e, 0x78, 0x7f, 0xcb, 0x2f, 0xf1, 0xd7, 0x1f, 0x46, 0x6b, 0xa1, 0xf0,
+  0x5a, 0x1a, 0x76, 0xcd, 0xbb, 0xbc, 0x76, 0xa4, 0x0c, 0xf0, 0x3b, 0x5d,
+  0x34, 0x3d, 0x0f, 0x70, 0x37, 0xe0, 0x32, 0xaf, 0x02, 0xc2, 0xeb, 0x00,
+  0xff, 0x1b, 0x48, 0x37, 0x43, 0xb8, 0x19, 0xf0, 0x97, 0x21, 0xbd, 0x1b,
+  0xc2, 0x20, 0xe0, 0x37, 0x40, 0xd5, 0x8f, 0x00, 0x1e, 0x06, 0xfc, 0x5d,
+  0x0e, 0x7f, 0x12, 0xf0, 0x0e, 0xb3, 0x16, 0xff, 0x17, 0xc0, 0x2f, 0x70,
+  0xf8, 0x71, 0xc0, 0x1f, 0xb6, 0x68, 0xf1, 0xf7, 0x00, 0xbf, 0x12, 0x16,
+  0xd0, 0x3c, 0x06, 0xf8, 0x27, 0x80, 0x8f, 0x58, 0xb5, 0xfc, 0x5c, 0x13,
+  0xc5, 0x6f, 0xb4, 0x69, 0xf1, 0x52, 0xc0, 0xdf, 0xe3, 0xf0, 0x6a, 0xc0,
+  0x3b, 0x73, 0xb4, 0xb8, 0x17, 0x70, 0xb2, 0xf8, 0x89, 0xc1, 0x6f, 0x03,
+  0xfc, 0x91, 0x5c, 0xad, 0x3c, 0xdd, 0x80, 0x2f, 0x85, 0xc5, 0x3b, 0xf2,
+  0x2a, 0xf7, 0x7e, 0xc0, 0x37, 0x01, 0x2e, 0xeb, 0xff, 0x61, 0xc0, 0xfb,
+  0x01, 0xdf, 0x06, 0xf8, 0xcf, 0x00, 0x4f, 0x00, 0xfe, 0x10, 0xe0, 0x31,
+  0xc0, 0xbf, 0x0d, 0x6b, 0x81, 0x1f, 0x05, 0xfc, 0x6d, 0xc0, 0x0b, 0xf2,
+  0xb5, 0xf8, 0x39, 0xc0, 0x9f, 0xe2, 0x70, 0xbc, 0x10, 0x0a, 0xe3, 0xb5,
+  0x05, 0x5a, 0x7c, 0x36, 0xe0, 0xc7, 0x39, 0xbc, 0x02, 0xf0, 0x6f, 0x15,
+  0xd2, 0xf4, 0xf7, 0x00, 0xdf, 0x00, 0xf8, 0x27, 0x85, 0x5a, 0xfe, 0x5f,
+  0x03, 0xbe, 0xab, 0x48, 0x8b, 0xb7, 0x01, 0xbe, 0x60, 0x86, 0x16, 0xbf,
+  0x1f, 0xf0, 0x67, 0x39, 0xfc, 0x11, 0xc0, 0xbf, 0xea, 0xd0, 0xe2, 0x3f,
+  0x01, 0xfc, 0x6d, 0x87, 0x56, 0x9e, 0x97, 0x01, 0xef, 0x80, 0x85, 0x7f,
+  0xab, 0x00, 0x3f, 0x09, 0xf8, 0x0f, 0x00, 0xbf, 0x1a, 0xf0, 0xf7, 0x01,
+  0x3f, 0x06, 0xf8, 0xdf, 0x01, 0xfe, 0x27, 0xc0, 0xaf, 0xa0, 0x0b, 0x88,
+  0x95, 0x3d, 0x16, 0x33, 0x2c, 0x14, 0x7f, 0x1a, 0xf0, 0x08, 0xe0, 0x57,
+  0x02, 0x5e, 0x5b, 0xac, 0xc5, 0x3d, 0x80, 0x1f, 0xe1, 0x70, 0x3f, 0xe0,
+  0x37, 0xcc, 0xd2, 0xe2, 0x4d, 0x80, 0xbf, 0xc5, 0xe1, 0x77, 0x01, 0xde,
+  0x08, 0x0b, 0x50, 0xe5, 0xf6, 0xb0, 0x1b, 0xf0, 0x5f, 0xcf, 0xd6, 0xf2,
+  0xff, 0x19, 0xf0, 0xbe, 0x39, 0x5a, 0xfc, 0x20, 0xe0, 0x96, 0xb9, 0x5a,
+  0xfc, 0x75, 0xc0, 0x1f, 0xe2, 0xf0, 0x0f, 0x00, 0x9f, 0x3f, 0x4f, 0x8b,
+  0x9f, 0x07, 0x7c, 0xdf, 0x3c, 0xad, 0x3c, 0xf9, 0x56, 0x8a, 0xd7, 0x94,
+  0xd0, 0xb4, 0xdc, 0xfe, 0x17, 0x02, 0x1e, 0x00, 0x5c, 0x6e, 0xff, 0xcb,
+  0x01, 0xdf, 0x0d, 0x78, 0x1b, 0xe0, 0x5f, 0x03, 0xfc, 0xf7, 0x25, 0xda,
+  0x7a, 0xbf, 0x05, 0xf8, 0x8e, 0xf9, 0x34, 0x2d, 0xfb, 0x63, 0x37, 0xe0,
+  0xc5, 0x0b, 0xb4, 0xf8, 0x00, 0xe0, 0xfb, 0x38, 0xfc, 0x71, 0xc0, 0xeb,
+  0x16, 0x6a, 0xf1, 0x67, 0x01, 0x1f, 0xe5, 0xf0, 0xa3, 0x80, 0xdf, 0x06,
+  0x0b, 0xc9, 0xbf, 0x0b, 0xf8, 0x29, 0xc0, 0x93, 0xa5, 0x5a, 0xfe, 0x6f,
+  0x00, 0x7f, 0x70, 0x91, 0x16, 0xb7, 0xd8, 0x28, 0x3e, 0xbb, 0x4c, 0x8b,
+  0x97, 0x00, 0xfe, 0x63, 0x0e, 0x5f, 0x01, 0xb8, 0x67, 0xb1, 0x16, 0xff,
+  0x0a, 0xe0, 0xbf, 0x58, 0xac, 0x95, 0xe7, 0x56, 0xc0, 0x37, 0xbb, 0x68,
+  0x1a, 0x9a, 0xa9, 0xd4, 0x01, 0xf8, 0x20, 0xe0, 0x7b, 0x24, 0xee, 0x50,
+  0x17, 0x07, 0x06, 0x2e, 0xbf, 0xcf, 0xe3, 0xf2, 0xfb, 0x3c, 0x2e, 0xbf,
+  0xcf, 0xe3, 0xf2, 0xfb, 0x3c, 0x2e, 0xbf, 0xcf, 0xe3, 0x2f, 0xfa, 0x3e,
+  0x0f, 0xcd, 0xb1, 0x0c, 0x42, 0x3c, 0xad, 0x65, 0xf7, 0x3e, 0x36, 0x18,
+  0xe0, 0x09, 0x06, 0x67, 0xf7, 0x1c, 0xd4, 0x9a, 0x54, 0x9c, 0xdd, 0x13,
+  0xb9, 0xdd, 0x24, 0xe6, 0xff, 0xbb, 0x01, 0x3f, 0xd7, 0x2c, 0xe6, 0xdf,
+  0x6a, 0x16, 0xf3, 0xbf, 0x6f, 0xc0, 0x4f, 0x18, 0xf0, 0x97, 0x5b, 0xc4,
+  0xfc, 0x7f, 0xb0, 0x88, 0xf9, 0x2f, 0x1b, 0xf0, 0x8b, 0xac, 0x62, 0xfe,
+  0x37, 0xac, 0x62, 0xfe, 0x0f, 0x0d, 0xf8, 0x67, 0x0c, 0xf8, 0x6e, 0x9b,
+  0x98, 0x7f, 0x97, 0x4d, 0xcc, 0x7f, 0xd5, 0x80, 0x6f, 0xcf, 0x11, 0xf3,
+  0x37, 0xe5, 0x88, 0xf9, 0x8f, 0x1b, 0xf0, 0x7f, 0x65, 0xc0, 0x5f, 0x91,
+  0x2b, 0xe6, 0xdf, 0x9b, 0x2b, 0xe6, 0x1f, 0x31, 0xe0, 0xcf, 0xb4, 0x8b,
+  0xf9, 0xdf, 0x64, 0x70, 0xb6, 0x1d, 0x06, 0x0d, 0xf0, 0x39, 0x79, 0x2a,
+  0x3e, 0x9b, 0xc1, 0x9b, 0x18, 0x7c, 0x0e, 0x83, 0xff, 0xc8, 0x80, 0xff,
+  0x7b, 0x03, 0xfe, 0x9a, 0x7c, 0x31, 0x3f, 0x9c, 0x2f, 0xe6, 0xbf, 0x6e,
+  0xc0, 0x5f, 0x54, 0x20, 0xe6, 0x37, 0x16, 0x88, 0xf9, 0xcf, 0x1b, 0xf0,
+  0x3f, 0x35, 0xe0, 0x7b, 0x0b, 0xc5, 0xfc, 0x7f, 0x2c, 0x14, 0xf3, 0xdf,
+  0x33, 0xe0, 0x97, 0x15, 0x89, 0xf9, 0xdd, 0x45, 0x62, 0xfe, 0x0b, 0x06,
+  0x7c, 0xeb, 0x0c, 0x31, 0xff, 0xfa, 0x19, 0x62, 0xfe, 0xb0, 0x01, 0xff,
+  0x1d, 0x03, 0xfe, 0x0a, 0x87, 0x98, 0xdf, 0xe9, 0x10, 0xf3, 0xa3, 0x06,
+  0x7c, 0xb3, 0x53, 0xcc, 0xbf, 0xd5, 0x29, 0xe6, 0x7f, 0x97, 0xc1, 0xd9,
+  0x76, 0x38, 0x62, 0x80, 0xdf, 0x34, 0x53, 0xc5, 0x97, 0x30, 0xf8, 0x77,
+  0x18, 0xfc, 0x2a, 0x06, 0x7f, 0xcb, 0x80, 0x5f, 0x56, 0x2c, 0xe6, 0x37,
+  0x16, 0x8b, 0xf9, 0xcf, 0x18, 0xf0, 0x7f, 0x65, 0xc0, 0x77, 0xcf, 0x12,
+  0xf3, 0xb7, 0xcf, 0x12, 0xf3, 0xff, 0xcd, 0x80, 0x2f, 0x6f, 0x64, 0xe4,
+  0xf9, 0x37, 0xce, 0x16, 0xf3, 0x23, 0x06, 0xfc, 0x71, 0x03, 0xfe, 0xfc,
+  0x39, 0x62, 0x7e, 0x60, 0x8e, 0x98, 0xbf, 0xcf, 0x80, 0xff, 0x1b, 0x03,
+  0xfe, 0xaa, 0xb9, 0x62, 0xfe, 0xdd, 0x73, 0xc5, 0xfc, 0x97, 0x0c, 0xf8,
+  0xd6, 0x79, 0x62, 0xbe, 0x77, 0x9e, 0x98, 0xff, 0x4f, 0x06, 0xfc, 0x31,
+  0x03, 0xfe, 0xa2, 0x12, 0x31, 0xff, 0x6f, 0x19, 0x9c, 0x6d, 0x87, 0x0f,
+  0x18, 0xe0, 0xe5, 0xf3, 0x55, 0xdc, 0xcd, 0xe0, 0x77, 0x30, 0xf8, 0x6a,
+  0x06, 0xdf, 0x6f, 0xc0, 0xff, 0xcc, 0x80, 0xbf, 0x7e, 0x81, 0x98, 0xff,
+  0xd0, 0x02, 0x31, 0x7f, 0xcc, 0x80, 0xef, 0x5a, 0x28, 0xe6, 0x6f, 0x59,
+  0x28, 0xe6, 0xbf, 0x60, 0xc0, 0x3f, 0x6f, 0xc0, 0xbf, 0xae, 0x54, 0xcc,
+  0xdf, 0x55, 0x2a, 0xe6, 0xbf, 0x63, 0xc0, 0x2f, 0x5d, 0x24, 0xe6, 0xb7,
+  0x2f, 0x12, 0xf3, 0x9f, 0x35, 0xe0, 0x7f, 0x6e, 0xc0, 0xaf, 0x2f, 0x13,
+  0xf3, 0xf7, 0x94, 0x89, 0xf9, 0x6f, 0x1a, 0xf0, 0xaf, 0x58, 0x2c, 0xe6,
+  0x37, 0x2f, 0x16, 0xf3, 0x5f, 0x34, 0xe0, 0xff, 0xc1, 0x80, 0x7f, 0xa3,
+  0x4b, 0xcc, 0x9f, 0xee, 0x7b, 0x55, 0x4b, 0xca, 0xb5, 0x78, 0xba, 0x7b,
+  0x55, 0x37, 0x73, 0xf9, 0x8c, 0xf2, 0x1b, 0xee, 0x63, 0x4f, 0x33, 0xbf,
+  0xe1, 0x3e, 0xf6, 0x34, 0xf3, 0x1b, 0xee, 0x63, 0x87, 0xfc, 0x7d, 0xa0,
+  0x98, 0x1c, 0xe0, 0xa5, 0xbb, 0x57, 0x35, 0xbe, 0x94, 0x86, 0x21, 0x9b,
+  0x16, 0x4f, 0x77, 0xaf, 0x6a, 0x37, 0x6c, 0x12, 0xde, 0x01, 0xf3, 0x27,
+  0x9b, 0x34, 0xb5, 0xbd, 0xaa, 0xc9, 0x35, 0x34, 0xac, 0xe7, 0x70, 0xdd,
+  0x3e, 0x76, 0x76, 0xa3, 0x6a, 0x1a, 0x7b, 0x55, 0xd7, 0x5c, 0xc2, 0x3e,
+  0xf6, 0x12, 0xc1, 0x3e, 0x76, 0x3b, 0x6a, 0x39, 0xe4, 0x47, 0x9e, 0x5d,
+  0xb9, 0x47, 0xab, 0xa3, 0xe8, 0x4b, 0x90, 0x8f, 0x95, 0x59, 0xf4, 0xdb,
+  0x0c, 0x56, 0x4d, 0xb1, 0xa0, 0x46, 0x17, 0xe0, 0xbc, 0xad, 0xe5, 0x8b,
+  0xbd, 0x25, 0xbd, 0x57, 0x3a, 0x4e, 0xe9, 0x1d, 0x13, 0x59, 0x73, 0x48,
+  0x69, 0x72, 0x9f, 0x2c, 0xe2, 0xf0, 0x74, 0x7d, 0xf2, 0x66, 0x49, 0x7c,
+  0xa4, 0xeb, 0x93, 0xe9, 0xe6, 0x37, 0xf2, 0xc9, 0x74, 0xf3, 0x1b, 0xf9,
+  0xa4, 0x9c, 0x7f, 0x33, 0x84, 0x53, 0xf5, 0x49, 0xf9, 0x3d, 0x47, 0xab,
+  0x38, 0x5c, 0xe4, 0x93, 0x42, 0x9f, 0x86, 0x70, 0xf5, 0x24, 0xf9, 0xe1,
+  0x7d, 0x97, 0xe9, 0xbf, 0xb3, 0xd2, 0xed, 0xf1, 0x4c, 0xd5, 0xa7, 0x36,
+  0x17, 0xa8, 0xf1, 0x7a, 0xf8, 0x66, 0xf6, 0x7f, 0xcb, 0x3f, 0xc7, 0x92,
+  0x9f, 0x4e, 0x23, 0xfe, 0x54, 0xc5, 0x28, 0xfa, 0x2a, 0x8f, 0x8d, 0x54,
+  0xff, 0xfc, 0xde, 0x5c, 0xc7, 0x73, 0xa3, 0xb1, 0xc4, 0x42, 0xdf, 0x10,
+  0xe9, 0x99, 0x7c, 0x26, 0x7c, 0x26, 0xf4, 0x47, 0xc9, 0xf1, 0x58, 0xcc,
+  0x71, 0xf0, 0x35, 0xc7, 0x41, 0xc9, 0x34, 0xaa, 0x5f, 0xe2, 0x35, 0x22,
+  0x57, 0x05, 0xef, 0x4e, 0x23, 0x41, 0x79, 0xcc, 0x37, 0xd2, 0xe1, 0x79,
+  0xec, 0x44, 0xe0, 0xf4, 0x2a, 0xb3, 0x0f, 0x15, 0xea, 0x8b, 0x25, 0xd6,
+  0xa9, 0xa5, 0x12, 0xca, 0x24, 0xe5, 0x46, 0xbc, 0xa9, 0xd8, 0x84, 0x09,
+  0x11, 0xf3, 0x62, 0x61, 0x3f, 0x4d, 0x99, 0x35, 0x29, 0xab, 0x26, 0x65,
+  0xd7, 0xa4, 0x9c, 0x4c, 0xea, 0xf0, 0xe9, 0xfd, 0xc7, 0xd0, 0x75, 0xc5,
+  0x62, 0x13, 0xe8, 0xba, 0x8a, 0xa8, 0x04, 0xa8, 0xda, 0xbc, 0xb0, 0xe0,
+  0x5a, 0xf0, 0xef, 0xc7, 0xa8, 0x56, 0x22, 0x5f, 0x5e, 0xcc, 0x87, 0x0a,
+  0x00, 0xc8, 0xac, 0x87, 0xac, 0x7a, 0xc8, 0xae, 0x87, 0x9c, 0x7a, 0xc8,
+  0xc5, 0x43, 0x87, 0xc3, 0xf9, 0xaf, 0xbf, 0x78, 0xe7, 0x13, 0xff, 0x63,
+  0x41, 0x9a, 0x8a, 0x21, 0xc2, 0xba, 0xc9, 0xe4, 0x4c, 0xc7, 0x72, 0xec,
+  0xc6, 0xfc, 0x4c, 0x6c, 0x25, 0x2a, 0x27, 0x42, 0xdf, 0x2a, 0x38, 0x84,
+  0x9f, 0x03, 0xe0, 0x38, 0x5e, 0x78, 0x48, 0x14, 0x1f, 0x37, 0x41, 0x24,
+  0xa5, 0xb1, 0x5c, 0x4a, 0x63, 0xb9, 0x94, 0xc6, 0x72, 0x29, 0x8d, 0xe5,
+  0x52, 0x99, 0x58, 0x8e, 0xc8, 0x54, 0x28, 0xc9, 0xeb, 0x00, 0xc8, 0x1a,
+  0x07, 0x50, 0x7a, 0xdc, 0xa4, 0xc6, 0x53, 0x7a, 0xfb, 0xa6, 0xf4, 0xf6,
+  0x4d, 0xe9, 0xed, 0x9b, 0xd2, 0xdb, 0x37, 0xa5, 0xb7, 0x6f, 0x2a, 0x73,
+  0xfb, 0xd2, 0xb6, 0xdf, 0x1f, 0xdf, 0x88, 0x0e, 0x6c, 0x66, 0xd0, 0x47,
+  0x7f, 0xbc, 0x16, 0x1d, 0x08, 0x88, 0x25, 0xcc, 0xfd, 0x1f, 0xe2, 0x38,
+  0x5e, 0xab, 0xac, 0x7a, 0x83, 0x29, 0xd6, 0xff, 0xa1, 0x03, 0x1d, 0xa0,
+  0x3d, 0x13, 0x3a, 0x88, 0xf6, 0x4a, 0x42, 0xf1, 0x0d, 0xc6, 0x6d, 0xfd,
+  0xf0, 0x46, 0x38, 0xf0, 0xc2, 0x10, 0xd2, 0x2c, 0x18, 0xc9, 0x6b, 0xe1,
+  0x90, 0xcf, 0xa1, 0x9a, 0x7d, 0x2f, 0xa9, 0xe0, 0x7f, 0xd2, 0x65, 0x52,
+  0x5a, 0x97, 0x30, 0xa1, 0xf6, 0xe4, 0x80, 0x03, 0x37, 0x2e, 0xa5, 0x30,
+  0x13, 0x1c, 0xa0, 0x06, 0x8f, 0x2f, 0x14, 0x7f, 0x00, 0x99, 0xc6, 0x85,
+  0x7d, 0xe2, 0x2f, 0xa0, 0x03, 0xd3, 0x34, 0xd5, 0x81, 0x49, 0xd5, 0x01,
+  0x3f, 0x78, 0x94, 0x9a, 0x17, 0xcd, 0x28, 0xb1, 0x94, 0xcd, 0x9d, 0xed,
+  0x98, 0x3f, 0xd3, 0x6a, 0x5f, 0xbc, 0xb0, 0x68, 0xde, 0x9c, 0x59, 0xce,
+  0xdc, 0x05, 0x85, 0xc5, 0x39, 0x05, 0xb6, 0xfc, 0xbc, 0xc5, 0x73, 0xcb,
+  0xe6, 0x14, 0xe7, 0x2f, 0x32, 0xcf, 0x9e, 0xe9, 0x28, 0xca, 0xcb, 0x29,
+  0x35, 0xcd, 0x9b, 0x55, 0x60, 0x71, 0xce, 0xc8, 0x2d, 0x29, 0xb4, 0xda,
+  0xe7, 0xdb, 0x16, 0xa0, 0x91, 0xd2, 0x64, 0x5e, 0x6d, 0xc9, 0xad, 0x5b,
+  0x68, 0xfd, 0x52, 0x85, 0xfd, 0x8a, 0x35, 0x55, 0xa5, 0xeb, 0x6d, 0x4b,
+  0x2b, 0x57, 0x2c, 0x9b, 0x9b, 0x57, 0x72, 0xe5, 0x97, 0x3d, 0xd5, 0xc5,
+  0x8b, 0x0a, 0x36, 0xb8, 0x73, 0x16, 0x5c, 0x75, 0x75, 0xf9, 0xaa, 0x6b,
+  0x57, 0x2e, 0x9f, 0x33, 0x6f, 0xdd, 0xcc, 0xfc, 0xda, 0xf9, 0x4b, 0x5c,
+  0xd7, 0xcc, 0x5e, 0xeb, 0xac, 0x59, 0x3c, 0xcb, 0x51, 0x36, 0xa3, 0xa8,
+  0x70, 0x83, 0x73, 0x7d, 0xae, 0x63, 0xc9, 0xb5, 0x96, 0x9c, 0x19, 0x73,
+  0x17, 0x5c, 0xb9, 0xea, 0x1a, 0x73, 0x9e, 0xad, 0xb4, 0xa0, 0x68, 0xce,
+  0xb2, 0x59, 0xf3, 0x17, 0x5f, 0x71, 0x75, 0xa5, 0xfb, 0xcb, 0xa6, 0x99,
+  0xf6, 0xab, 0xac, 0xf3, 0x16, 0x56, 0xe5, 0x2f, 0x2a, 0x5c, 0x3e, 0xdb,
+  0x55, 0xb1, 0xba, 0xf8, 0x4b, 0x25, 0xd5, 0x65, 0x2b, 0xca, 0xeb, 0x96,
+  0xd6, 0xac, 0x5c, 0x53, 0xeb, 0x59, 0xbb, 0x4e, 0x30, 0x32, 0xc9, 0xe3,
+  0x96, 0x78, 0xce, 0x56, 0x20, 0x69, 0xdf, 0x69, 0xe9, 0x82, 0x70, 0xae,
+  0xa4, 0x7d, 0x77, 0xa5, 0x1c, 0x96, 0x4b, 0xda, 0x77, 0x51, 0xca, 0xe1,
+  0x0a, 0xc0, 0x77, 0x70, 0x38, 0x9e, 0xf6, 0xb2, 0x73, 0x42, 0xf9, 0x9d,
+  0x87, 0x5e, 0xc0, 0xe5, 0xf4, 0x26, 0x08, 0x37, 0x1a, 0xe0, 0xcd, 0x80,
+  0x3f, 0x09, 0x69, 0xf9, 0xbf, 0x4c, 0x7a, 0x00, 0x2f, 0x86, 0x2a, 0x9e,
+  0x06, 0xfc, 0x41, 0x03, 0xfc, 0x61, 0xc0, 0x5f, 0x02, 0xdc, 0x03, 0xf8,
+  0x53, 0x80, 0x7f, 0x02, 0xb8, 0x0f, 0xf0, 0xe7, 0x0c, 0xf0, 0x23, 0x92,
+  0xf6, 0xdd, 0x98, 0xf2, 0xef, 0xd3, 0x27, 0x01, 0x3f, 0x61, 0x56, 0xd3,
+  0xf8, 0x88, 0x1b, 0xe0, 0xbf, 0x03, 0xfc, 0x71, 0x8b, 0x7a, 0x9d, 0xf8,
+  0xb0, 0xc2, 0xfa, 0x95, 0xcf, 0x01, 0xdf, 0x0b, 0xf8, 0x7c, 0x03, 0x7c,
+  0x25, 0xe0, 0x4f, 0x5a, 0xb5, 0xe5, 0xac, 0x07, 0xdc, 0x6c, 0xd3, 0xf2,
+  0xff, 0xca, 0x00, 0x57, 0x26, 0x4b, 0x01, 0x09, 0xcd, 0x9e, 0xdb, 0x5b,
+  0x1a, 0xab, 0x1b, 0x6b, 0x6b, 0x20, 0x5a, 0xa3, 0x46, 0xab, 0x1b, 0xeb,
+  0xdc, 0x0a, 0x5a, 0xe7, 0xbe, 0xfc, 0xba, 0xf5, 0x29, 0xbc, 0x6e, 0x5d,
+  0x73, 0xac, 0x80, 0x90, 0x7f, 0x07, 0xe8, 0x83, 0x0c, 0xce, 0xfe, 0x2e,
+  0x61, 0x35, 0xa9, 0x38, 0xfb, 0x9c, 0x6c, 0x3f, 0x83, 0xb3, 0xbf, 0x57,
+  0x9c, 0x35, 0x89, 0xcb, 0xaf, 0x34, 0x8b, 0xcb, 0x3f, 0x62, 0x16, 0x97,
+  0xbf, 0xdb, 0x22, 0x2e, 0x7f, 0xba, 0x3f, 0x2f, 0xf9, 0x21, 0x77, 0xbf,
+  0x9f, 0xee, 0xbd, 0x59, 0x92, 0xcb, 0x67, 0x94, 0xdf, 0xe8, 0xde, 0x4c,
+  0xce, 0x1f, 0x9d, 0x24, 0xbf, 0xd1, 0xbd, 0xd9, 0x81, 0x0c, 0xdf, 0xd9,
+  0x29, 0xe7, 0xaf, 0x87, 0x93, 0x39, 0x92, 0xfa, 0xde, 0x4e, 0x7c, 0x4c,
+  0x76, 0x6f, 0x96, 0x04, 0x62, 0x80, 0xbb, 0xd9, 0x49, 0xf7, 0x79, 0x89,
+  0xfc, 0x0e, 0xff, 0x28, 0xa4, 0xa7, 0xfa, 0xbc, 0xc4, 0x05, 0xf7, 0x53,
+  0xf5, 0x1c, 0xce, 0xd7, 0x1f, 0x0c, 0x74, 0xdd, 0xa5, 0x3e, 0x2d, 0x49,
+  0xe3, 0xdd, 0x5e, 0xd5, 0x75, 0xd5, 0x75, 0x53, 0xbc, 0xb7, 0x73, 0x31,
+  0x2f, 0xde, 0xab, 0x87, 0x6f, 0xe6, 0xde, 0x4e, 0x5e, 0x11, 0x4c, 0x1e,
+  0x9f, 0xb4, 0x86, 0xbd, 0x63, 0x64, 0xc6, 0x8f, 0x22, 0x6f, 0x32, 0x73,
+  0x7f, 0xbc, 0x18, 0x98, 0x4d, 0xc5, 0x61, 0x27, 0xd1, 0xc4, 0xc8, 0x41,
+  0x13, 0x5e, 0xff, 0xfb, 0xca, 0xc8, 0x57, 0x25, 0x76, 0x1d, 0x71, 0x43,
+  0xf8, 0x4d, 0x76, 0xc3, 0x91, 0xfc, 0xaa, 0x7e, 0xfe, 0x05, 0xe0, 0x78,
+  0xb8, 0xf4, 0x0d, 0x79, 0xc7, 0x70, 0x01, 0xb9, 0xb4, 0x00, 0xc4, 0xe4,
+  0xf3, 0x2b, 0x6f, 0xfe, 0x26, 0xa9, 0x88, 0x84, 0x97, 0xe6, 0x0e, 0x60,
+  0x8b, 0x24, 0xa2, 0xc8, 0x85, 0xe5, 0xfb, 0x0e, 0x39, 0xab, 0x76, 0x5b,
+  0x91, 0x4b, 0x62, 0xd6, 0x3b, 0xb3, 0x57, 0x30, 0x81, 0x37, 0xec, 0x04,
+  0xa2, 0xf2, 0xd4, 0x8b, 0x4c, 0xfe, 0x92, 0xe1, 0x58, 0x28, 0x8a, 0x6e,
+  0x4c, 0x92, 0xf8, 0x46, 0x73, 0x27, 0xc9, 0x1a, 0xf1, 0x4e, 0xa0, 0xb9,
+  0x16, 0x9d, 0xc5, 0x87, 0x62, 0x17, 0x30, 0x0f, 0x4d, 0xc0, 0xe9, 0xa2,
+  0xf1, 0x89, 0x73, 0x78, 0x5b, 0xf0, 0x84, 0xb8, 0x2e, 0xba, 0xfd, 0x68,
+  0x42, 0xde, 0x17, 0x44, 0x0a, 0x0a, 0x45, 0xed, 0xe4, 0x95, 0xe5, 0xa1,
+  0x98, 0x3d, 0x22, 0x45, 0xf2, 0xd6, 0x8e, 0x3a, 0x76, 0x91, 0xcb, 0x58,
+  0x2d, 0xd7, 0xa4, 0x27, 0x90, 0x07, 0x7e, 0xe4, 0x4d, 0xe5, 0x44, 0x78,
+  0xf2, 0x0e, 0xdf, 0x11, 0xdc, 0x73, 0xd1, 0x98, 0xc9, 0xf0, 0x5a, 0x45,
+  0xf5, 0xa3, 0xa2, 0x35, 0xf5, 0x86, 0xe5, 0x7a, 0xd5, 0x13, 0xb4, 0xbe,
+  0x56, 0x81, 0x40, 0x78, 0x5f, 0x55, 0x24, 0xcf, 0xa7, 0x70, 0x3c, 0x17,
+  0xe5, 0xec, 0x9a, 0x5c, 0xee, 0x8b, 0x5e, 0xcb, 0x1e, 0x89, 0x99, 0x6f,
+  0x63, 0xf9, 0xb5, 0x6d, 0x91, 0xdc, 0xad, 0x45, 0xad, 0xf2, 0x24, 0x1a,
+  0xdd, 0x71, 0x92, 0x46, 0xf2, 0x6b, 0x1b, 0xdc, 0xc9, 0xd1, 0x3d, 0x5e,
+  0xa3, 0xca, 0x1e, 0x32, 0xba, 0x21, 0x6c, 0x1c, 0x85, 0x78, 0x8f, 0xd8,
+  0x18, 0xb9, 0xef, 0xdb, 0x79, 0x2d, 0xbd, 0x82, 0x31, 0xba, 0x4d, 0x0c,
+  0xb3, 0x71, 0xf3, 0x1d, 0x21, 0x1b, 0xc8, 0x8e, 0x2b, 0x2d, 0x8f, 0xb6,
+  0xb4, 0x99, 0x32, 0x37, 0x14, 0x2d, 0xa1, 0x3b, 0xcc, 0xc6, 0xce, 0xfd,
+  0x5c, 0x29, 0x6a, 0xe0, 0x8f, 0xa4, 0x5d, 0xbb, 0x14, 0x11, 0x95, 0x6a,
+  0xd5, 0xea, 0x06, 0x96, 0x91, 0xc6, 0x2e, 0x37, 0x56, 0x78, 0xc7, 0x3f,
+  0xad, 0x8c, 0x59, 0x76, 0x8f, 0xa4, 0x4c, 0x7c, 0x2d, 0x07, 0x2a, 0x53,
+  0xb6, 0xa8, 0xe1, 0x7a, 0xed, 0xe4, 0xdf, 0x10, 0x94, 0x64, 0xa1, 0x36,
+  0xe9, 0x94, 0xff, 0x2c, 0x01, 0x97, 0x6e, 0x57, 0x44, 0xe5, 0xc0, 0x71,
+  0x2a, 0x4a, 0x91, 0x7a, 0xe5, 0xe3, 0x09, 0x50, 0x03, 0x56, 0xce, 0x01,
+  0x14, 0x1e, 0x90, 0x2f, 0x91, 0xe8, 0x08, 0xae, 0xfb, 0x80, 0x7a, 0xdd,
+  0x07, 0xce, 0xbd, 0xa3, 0x02, 0xfe, 0x31, 0x5a, 0x6e, 0x14, 0x25, 0x4d,
+  0x8c, 0x2f, 0xb1, 0x46, 0xb9, 0xce, 0xaa, 0x18, 0x65, 0x2f, 0x0a, 0xf7,
+  0x2a, 0xda, 0xd1, 0x67, 0x91, 0x5f, 0xe8, 0xaf, 0x4a, 0x8d, 0xee, 0xaa,
+  0x42, 0x1f, 0xe6, 0x92, 0x73, 0xf4, 0x9e, 0x69, 0x84, 0xf6, 0x28, 0xfb,
+  0x65, 0xa5, 0x44, 0xfc, 0xfb, 0x23, 0xd2, 0xda, 0x98, 0x23, 0x84, 0x5f,
+  0xeb, 0x9e, 0xc0, 0x17, 0x16, 0xf1, 0xee, 0xc7, 0x7e, 0x6c, 0x42, 0xa4,
+  0x73, 0xa7, 0x64, 0xed, 0x20, 0x9a, 0x2f, 0xf0, 0x9a, 0x2f, 0xf6, 0xa1,
+  0x0d, 0x5f, 0x05, 0x29, 0x6a, 0x18, 0x9d, 0x1b, 0x06, 0xdb, 0xef, 0xbd,
+  0x98, 0xed, 0xf1, 0x18, 0x74, 0xee, 0x19, 0xbe, 0xc2, 0x81, 0x5d, 0x26,
+  0xa5, 0x49, 0xd8, 0x89, 0x26, 0x42, 0xb1, 0x42, 0xf0, 0xa2, 0x07, 0x8f,
+  0xab, 0xcd, 0xa5, 0x50, 0x39, 0x97, 0x87, 0xba, 0x15, 0x5c, 0x1f, 0x14,
+  0x5b, 0xcc, 0x70, 0x22, 0x52, 0x2c, 0x6e, 0xa2, 0x6e, 0x60, 0x25, 0xb0,
+  0x7f, 0x24, 0x6c, 0x52, 0x2c, 0x4b, 0x0b, 0x40, 0xe1, 0x46, 0x14, 0xbe,
+  0x52, 0x18, 0x29, 0xf6, 0xc5, 0xfe, 0xcb, 0x46, 0x24, 0x0f, 0xfb, 0xf7,
+  0xf8, 0xc2, 0x1b, 0x07, 0x11, 0x73, 0x90, 0x5e, 0xc1, 0x1e, 0xe6, 0x0a,
+  0x70, 0x29, 0x3e, 0xb6, 0x18, 0x69, 0xaa, 0x0d, 0xf1, 0x88, 0x45, 0x11,
+  0x51, 0x96, 0xc2, 0x8e, 0xea, 0x1c, 0x89, 0xe4, 0x85, 0x7f, 0x11, 0x8a,
+  0xe1, 0x07, 0x24, 0x7b, 0xb0, 0xd6, 0x50, 0x13, 0xc0, 0x02, 0x41, 0xed,
+  0xa6, 0x31, 0x45, 0xb9, 0x11, 0xff, 0x5e, 0xda, 0x3e, 0x86, 0x89, 0x92,
+  0x90, 0xc4, 0x23, 0x76, 0xb9, 0x56, 0x32, 0x4e, 0xd0, 0xaa, 0xe0, 0x66,
+  0x56, 0xb9, 0xea, 0x61, 0x6d, 0xf3, 0xc6, 0x49, 0xa7, 0x36, 0xa9, 0x6b,
+  0xd8, 0x29, 0xa8, 0x40, 0xd3, 0xf2, 0x0e, 0x52, 0x0b, 0x0d, 0x83, 0x15,
+  0x86, 0xb1, 0x12, 0x39, 0x0b, 0x0d, 0xc3, 0xa5, 0xd1, 0x73, 0x62, 0x0b,
+  0x11, 0x8e, 0x91, 0x85, 0x86, 0xc1, 0x11, 0x70, 0x01, 0x28, 0xdc, 0x88,
+  0xc2, 0x57, 0x9c, 0xc4, 0x42, 0xd6, 0xa9, 0x58, 0x68, 0x98, 0xf5, 0xba,
+  0x29, 0x58, 0xa8, 0xd4, 0xac, 0x88, 0x28, 0x4b, 0x51, 0x68, 0x64, 0x21,
+  0xab, 0xc6, 0x42, 0x3b, 0x84, 0xa6, 0x08, 0x0f, 0xf4, 0x5d, 0x20, 0x9b,
+  0x73, 0x76, 0xf8, 0x22, 0x43, 0x24, 0x1a, 0x4b, 0xd8, 0x7d, 0xfd, 0x1f,
+  0xa2, 0x98, 0x03, 0x79, 0x0f, 0xb2, 0x53, 0xc2, 0x45, 0x14, 0xbe, 0x83,
+  0xf4, 0xbf, 0x0a, 0x67, 0x89, 0xee, 0xa4, 0x3c, 0x66, 0xda, 0x65, 0x35,
+  0x30, 0xf5, 0xed, 0xd1, 0x2b, 0x20, 0x45, 0x0c, 0x81, 0x0c, 0x98, 0x58,
+  0xf7, 0x39, 0x11, 0x00, 0xc9, 0x14, 0x23, 0x5d, 0x04, 0xc6, 0xf6, 0xff,
+  0xaf, 0x1e, 0xb3, 0xfc, 0x89, 0xee, 0x22, 0xd2, 0x76, 0xea, 0xb9, 0x26,
+  0x7d, 0x93, 0x45, 0x43, 0x92, 0x6c, 0x0a, 0xaa, 0x54, 0xbc, 0x61, 0x49,
+  0xe9, 0xad, 0xf1, 0xb6, 0x25, 0x22, 0x12, 0xd3, 0x03, 0xd0, 0x9d, 0x4b,
+  0x44, 0x44, 0xe8, 0x70, 0xce, 0xab, 0xfe, 0x7f, 0x9e, 0x76, 0x38, 0x61,
+  0xb5, 0xc3, 0x39, 0x0f, 0x1d, 0xce, 0x79, 0xb6, 0xc3, 0x39, 0xcf, 0x75,
+  0x38, 0x03, 0xdd, 0x44, 0xb3, 0x34, 0x20, 0xe6, 0x1a, 0xa2, 0x51, 0xdc,
+  0x35, 0x88, 0x04, 0x74, 0xa6, 0x27, 0x60, 0xe2, 0x5e, 0x6a, 0x31, 0x76,
+  0x6c, 0x4a, 0x9c, 0xfb, 0x9c, 0xdb, 0x62, 0xb5, 0x67, 0xa9, 0x76, 0xe3,
+  0x17, 0x1e, 0xba, 0x0f, 0x9b, 0x64, 0x9f, 0x82, 0x3f, 0x80, 0x21, 0xad,
+  0xbe, 0x8c, 0xf6, 0xd7, 0x49, 0x3c, 0x29, 0x73, 0x2e, 0xa5, 0x26, 0x1b,
+  0x1a, 0x18, 0x1d, 0x47, 0x05, 0x92, 0x7a, 0xa1, 0xf3, 0xc6, 0xca, 0xbe,
+  0x13, 0xeb, 0x67, 0x9d, 0xc4, 0x71, 0xd4, 0xfd, 0x63, 0x84, 0xd4, 0x20,
+  0x8f, 0x2f, 0xc4, 0x70, 0x03, 0x51, 0x4c, 0x1a, 0x82, 0xad, 0xe5, 0x6a,
+  0x13, 0xa7, 0xb8, 0x6e, 0xe6, 0x67, 0x72, 0x0c, 0xc0, 0xe3, 0xd9, 0x89,
+  0x88, 0xff, 0x0c, 0x6a, 0xd1, 0xb2, 0xb7, 0xe3, 0x92, 0x83, 0x16, 0x79,
+  0x64, 0xa1, 0xb9, 0xa1, 0x10, 0xc6, 0xbf, 0xc2, 0x03, 0x07, 0x08, 0x92,
+  0xd6, 0xd5, 0x54, 0x68, 0xbd, 0xce, 0xe0, 0x7a, 0x06, 0xc8, 0x70, 0xb0,
+  0x7f, 0x72, 0xe2, 0xce, 0x5d, 0x6c, 0x79, 0x4a, 0x7b, 0x1f, 0xc7, 0xe3,
+  0x1d, 0x11, 0x7a, 0x88, 0x5e, 0xf2, 0xc0, 0xd3, 0x54, 0x76, 0x2c, 0x29,
+  0x31, 0x35, 0x00, 0x3a, 0xbd, 0xa8, 0xc3, 0xd2, 0x0a, 0x51, 0xc9, 0x43,
+  0xe4, 0x52, 0xc9, 0x4f, 0x25, 0xb8, 0x0e, 0xc7, 0x11, 0xd4, 0x9b, 0xb9,
+  0xe0, 0x2f, 0x6b, 0x6e, 0x34, 0xcb, 0x0d, 0x79, 0xe0, 0x5f, 0xc7, 0xc1,
+  0x95, 0x70, 0x5b, 0x1e, 0xc2, 0x29, 0xda, 0x9c, 0x67, 0x21, 0x4a, 0x02,
+  0x2f, 0x3b, 0x8a, 0x10, 0x0a, 0x6d, 0xd1, 0x24, 0x7a, 0x6e, 0x4c, 0xf6,
+  0x4f, 0xca, 0xe7, 0xdb, 0xf5, 0x30, 0xc2, 0xa0, 0xf0, 0x47, 0xd5, 0xe8,
+  0x1e, 0x35, 0xba, 0x8f, 0x5e, 0x20, 0xe6, 0x91, 0xc1, 0x6e, 0x68, 0x9f,
+  0x52, 0xeb, 0xb0, 0x49, 0xa9, 0x75, 0x9f, 0x5a, 0x2b, 0x8e, 0x9e, 0xfb,
+  0x0f, 0x35, 0x4b, 0x09, 0xcd, 0x42, 0x2b, 0xb6, 0x2a, 0x15, 0x0f, 0xd2,
+  0x72, 0x07, 0x49, 0x69, 0xe1, 0x81, 0x9d, 0x38, 0x24, 0xf5, 0x46, 0x86,
+  0x70, 0x1c, 0x4f, 0x55, 0xf7, 0x49, 0x69, 0x37, 0xe6, 0xbb, 0xd3, 0x69,
+  0xcc, 0xdf, 0x10, 0x35, 0xe6, 0x81, 0x20, 0x98, 0x2e, 0xed, 0xf6, 0x1c,
+  0x21, 0x59, 0xa8, 0x92, 0x12, 0x3e, 0x72, 0x17, 0x33, 0xd0, 0x4b, 0x0a,
+  0x39, 0x8a, 0x62, 0x7d, 0xba, 0xe2, 0x58, 0x91, 0x35, 0x5b, 0x2a, 0xf1,
+  0x86, 0xc5, 0x81, 0x9b, 0x48, 0x89, 0x58, 0xf7, 0xa4, 0x75, 0x90, 0x76,
+  0x4c, 0xd5, 0x42, 0x47, 0x45, 0xc5, 0x2d, 0x50, 0x77, 0x2d, 0xb7, 0x11,
+  0x68, 0x7c, 0x26, 0xc7, 0x11, 0x52, 0x71, 0x28, 0xb5, 0x0c, 0xfe, 0x21,
+  0x89, 0x94, 0x93, 0xe8, 0x40, 0xfd, 0x47, 0xe2, 0x93, 0x3f, 0x2b, 0x4d,
+  0x05, 0x3a, 0x96, 0x54, 0xe2, 0xfe, 0xcf, 0x2e, 0x5c, 0x50, 0x3a, 0x95,
+  0x28, 0x74, 0x2a, 0xf0, 0x4a, 0x07, 0xed, 0x50, 0xa2, 0x4c, 0xed, 0x68,
+  0xef, 0xac, 0xaa, 0x92, 0x4e, 0xcd, 0x89, 0xa8, 0x55, 0x54, 0x9d, 0x63,
+  0x9c, 0xf2, 0x98, 0xf1, 0x4e, 0xa3, 0xbf, 0xc4, 0x9d, 0xf9, 0xb2, 0xc7,
+  0x2b, 0xa5, 0x8d, 0xa0, 0xce, 0xe4, 0x3d, 0xda, 0x45, 0x2a, 0x33, 0x78,
+  0xd5, 0xb4, 0x23, 0x72, 0x07, 0xca, 0xdc, 0x3f, 0xbc, 0x0a, 0xb7, 0x06,
+  0x32, 0x27, 0x42, 0xf3, 0x33, 0xf5, 0xcb, 0xa7, 0xd5, 0x9a, 0xff, 0xaf,
+  0xbd, 0xab, 0x8f, 0x8d, 0xa3, 0xb8, 0xe2, 0x7b, 0x96, 0x83, 0x13, 0x07,
+  0x38, 0xe3, 0x44, 0x89, 0x9d, 0xd0, 0x70, 0xb1, 0x7b, 0x05, 0x27, 0x25,
+  0x38, 0xfe, 0xc2, 0x36, 0xc8, 0x1c, 0x2a, 0x17, 0xdc, 0x14, 0x57, 0x86,
+  0x10, 0x29, 0x09, 0x51, 0x9c, 0xe3, 0x7c, 0x97, 0xb8, 0x5c, 0xee, 0x8e,
+  0xbb, 0x73, 0xd2, 0x42, 0x04, 0x44, 0x8e, 0x4b, 0xdd, 0x23, 0x88, 0x54,
+  0x6e, 0x1b, 0xa1, 0x50, 0x2c, 0x44, 0xa5, 0x48, 0x14, 0x81, 0xf8, 0x90,
+  0x2c, 0x84, 0x84, 0x1d, 0x68, 0x95, 0x46, 0xfc, 0x51, 0x68, 0x55, 0x01,
+  0x12, 0x70, 0x88, 0xa0, 0xf8, 0x48, 0xd4, 0x98, 0x0f, 0x09, 0x4b, 0x95,
+  0x48, 0xe7, 0xcd, 0xbc, 0xb9, 0x7d, 0xb7, 0x37, 0x63, 0xaf, 0x43, 0xc5,
+  0x97, 0xe6, 0xe9, 0xb4, 0x1f, 0xbf, 0x7b, 0xf3, 0xde, 0xdb, 0x99, 0x9d,
+  0x79, 0xb3, 0xbb, 0x6f, 0x66, 0xd0, 0x0b, 0x9c, 0xc5, 0xfd, 0x14, 0xee,
+  0x4f, 0xe1, 0x3e, 0x27, 0xd4, 0xca, 0x0e, 0x34, 0xdc, 0x29, 0xa7, 0xb9,
+  0xe4, 0xb3, 0xe8, 0x19, 0xce, 0x12, 0x37, 0xf2, 0x6c, 0x91, 0x1b, 0x79,
+  0xca, 0xd2, 0xb8, 0x91, 0x67, 0xd5, 0x6e, 0x24, 0x78, 0x8c, 0xb5, 0x85,
+  0xc8, 0x28, 0xcd, 0x80, 0xc7, 0xbd, 0x63, 0xbc, 0x6a, 0xf5, 0x4c, 0x0b,
+  0xa9, 0xbd, 0xb6, 0xd4, 0x69, 0x64, 0x9e, 0x3e, 0xf3, 0x76, 0x36, 0x78,
+  0x0a, 0x4f, 0x4e, 0x61, 0x8a, 0x1a, 0x18, 0xde, 0x5b, 0x54, 0xad, 0xb8,
+  0xe7, 0x16, 0x55, 0xe2, 0xf7, 0x70, 0x43, 0xb0, 0x2e, 0xb9, 0x67, 0x72,
+  0xa4, 0x27, 0x77, 0xe6, 0xc5, 0xfc, 0x36, 0xe1, 0x68, 0xe8, 0xc3, 0x40,
+  0x7e, 0xf1, 0x79, 0x3e, 0x7b, 0x0e, 0x2f, 0x4d, 0x70, 0xf0, 0xfc, 0x31,
+  0x8e, 0xc9, 0xcf, 0x06, 0x73, 0x7c, 0x7d, 0xc1, 0xcf, 0xbc, 0xf7, 0xf1,
+  0x2f, 0x57, 0x9f, 0x7a, 0xb7, 0x9e, 0x60, 0x7c, 0x1c, 0xfb, 0xd4, 0xbb,
+  0xe3, 0x44, 0xd4, 0xfb, 0xef, 0x9e, 0x31, 0x58, 0xca, 0x6c, 0x8c, 0x5d,
+  0xce, 0x4f, 0x47, 0x26, 0x58, 0x56, 0x89, 0x61, 0xc4, 0xce, 0x7b, 0x41,
+  0x96, 0x05, 0xdc, 0xf6, 0x1e, 0xcb, 0xee, 0xfb, 0x38, 0xb2, 0x1b, 0x46,
+  0x74, 0xf2, 0x33, 0x78, 0xca, 0xa0, 0xc9, 0xc7, 0x8a, 0xfc, 0x41, 0xf0,
+  0x08, 0x1a, 0x38, 0x2a, 0x7a, 0x4d, 0x05, 0xaf, 0xd7, 0x55, 0x51, 0x28,
+  0xe4, 0x92, 0xc2, 0xfd, 0xbe, 0x94, 0x9d, 0xaa, 0x9c, 0xc0, 0x58, 0xc6,
+  0x06, 0xe5, 0x32, 0x59, 0x54, 0x56, 0x3d, 0xbc, 0xac, 0x26, 0xa1, 0xac,
+  0x20, 0x4f, 0x59, 0x79, 0xf1, 0xc6, 0x83, 0xf1, 0xf0, 0xf6, 0x89, 0x97,
+  0xda, 0xab, 0x98, 0xbf, 0x6e, 0x8a, 0x4c, 0x9b, 0x89, 0x1b, 0x16, 0xcc,
+  0x37, 0x13, 0xf1, 0xfa, 0x99, 0x88, 0x51, 0x21, 0x62, 0x50, 0xdc, 0x12,
+  0x47, 0x8a, 0x5b, 0xf9, 0x83, 0xaa, 0x56, 0x7e, 0x23, 0x57, 0x34, 0x8a,
+  0x8a, 0x46, 0x47, 0x0e, 0x65, 0x44, 0x13, 0x7e, 0x50, 0xb4, 0xbe, 0x59,
+  0x55, 0x5b, 0x4e, 0xaf, 0xc7, 0x6e, 0x8b, 0xf6, 0x9e, 0x97, 0x0e, 0xae,
+  0xe4, 0x4e, 0xf9, 0x7a, 0xca, 0x54, 0x53, 0x9c, 0xc7, 0x2e, 0xa4, 0x38,
+  0x67, 0x2f, 0xc8, 0x92, 0x52, 0x2c, 0xbd, 0xc0, 0x7b, 0x45, 0x5f, 0x4c,
+  0x79, 0x0d, 0xe0, 0x9c, 0x93, 0x42, 0x89, 0xee, 0x1a, 0xcb, 0x81, 0x27,
+  0x36, 0x3b, 0x0f, 0xcf, 0x87, 0x91, 0xe1, 0x9d, 0x76, 0xc7, 0x62, 0x3b,
+  0xf7, 0xf8, 0x49, 0xee, 0xf1, 0x63, 0xc2, 0xe3, 0xa3, 0x13, 0xdb, 0xc2,
+  0x6f, 0xd1, 0x42, 0x56, 0x97, 0x98, 0x5b, 0xee, 0x99, 0xdd, 0xdc, 0xdb,
+  0x5d, 0x98, 0xdb, 0xeb, 0xca, 0xdc, 0x6e, 0x62, 0xe3, 0xed, 0xc2, 0xc6,
+  0xe1, 0xfd, 0xc2, 0x43, 0x77, 0x73, 0x0f, 0x0d, 0x45, 0x58, 0x55, 0x28,
+  0x42, 0x7e, 0x4d, 0x79, 0x3f, 0x61, 0xc8, 0x1e, 0x82, 0x2b, 0xe6, 0x2f,
+  0xd5, 0x2e, 0x25, 0xb0, 0xc8, 0x88, 0x2c, 0xb7, 0x34, 0x7b, 0xa8, 0xb7,
+  0xf4, 0xea, 0xb9, 0x7d, 0x22, 0x53, 0x49, 0x4e, 0xf0, 0x47, 0x58, 0xb1,
+  0x39, 0xfd, 0x25, 0x70, 0x6d, 0xc1, 0x6e, 0x03, 0x7f, 0xd5, 0x93, 0xe5,
+  0xec, 0xd8, 0x0b, 0x13, 0x29, 0x47, 0xd9, 0x63, 0x0a, 0x76, 0xa6, 0xbe,
+  0x91, 0x6a, 0x76, 0xcf, 0x79, 0xb4, 0x02, 0x0b, 0x78, 0xe8, 0x62, 0x8f,
+  0x6b, 0x2b, 0x3e, 0x10, 0xf9, 0xb5, 0xb3, 0x90, 0xcf, 0xf0, 0xbe, 0x9e,
+  0x58, 0x11, 0x1c, 0x75, 0x65, 0xc2, 0x6f, 0x79, 0xce, 0x6c, 0x97, 0x19,
+  0x15, 0xa0, 0x42, 0x26, 0xb8, 0x90, 0x57, 0x51, 0x8b, 0x2b, 0x71, 0xd7,
+  0x7d, 0xb5, 0xf4, 0x24, 0x5b, 0xf3, 0x1f, 0x42, 0x37, 0x2d, 0xc9, 0xba,
+  0x64, 0xf9, 0x57, 0xc4, 0xd3, 0xb0, 0x9b, 0x5c, 0xb9, 0xf9, 0xff, 0x55,
+  0x36, 0x67, 0x1e, 0xe6, 0x4e, 0xd4, 0x9e, 0xa8, 0xab, 0xa8, 0x67, 0xb0,
+  0x73, 0x86, 0x5b, 0x34, 0x2e, 0x94, 0x3e, 0x55, 0xec, 0x02, 0xc6, 0x8b,
+  0x5c, 0xc0, 0xcf, 0x74, 0x7e, 0x74, 0x7c, 0x0e, 0x17, 0x50, 0x53, 0x78,
+  0xa9, 0x68, 0x3b, 0xf9, 0x33, 0x2f, 0xc9, 0x84, 0x8a, 0x3f, 0x49, 0xc7,
+  0x61, 0xdc, 0x36, 0x76, 0x5c, 0xf4, 0x1c, 0x04, 0x4b, 0xfe, 0x66, 0xd1,
+  0xcd, 0x29, 0xbc, 0x3d, 0xc6, 0x20, 0x8b, 0xd4, 0x5a, 0xab, 0x87, 0x2f,
+  0x33, 0xe4, 0x8b, 0xa4, 0x52, 0x89, 0x94, 0xaf, 0x68, 0xbd, 0xe9, 0x4a,
+  0xeb, 0xb6, 0xc8, 0x85, 0xfe, 0xe9, 0x1f, 0xb4, 0x1a, 0x3b, 0x37, 0x0c,
+  0xc4, 0x22, 0x9d, 0xda, 0x3d, 0x63, 0xf1, 0xc7, 0x62, 0x83, 0xfe, 0x70,
+  0xa5, 0xf5, 0x93, 0x50, 0x3c, 0x9e, 0xc8, 0xf8, 0xc2, 0xa9, 0x48, 0x28,
+  0x13, 0xf1, 0x49, 0x29, 0xbe, 0x28, 0xf0, 0xf9, 0xfc, 0xe9, 0x4a, 0x4b,
+  0x7e, 0x3f, 0xba, 0xba, 0x93, 0x7f, 0x3f, 0xea, 0xbc, 0x6d, 0x30, 0x9e,
+  0xee, 0xf4, 0x0f, 0x96, 0xfe, 0x71, 0x63, 0x2c, 0xd6, 0xe9, 0x4f, 0xfb,
+  0x40, 0x03, 0x30, 0xf8, 0x36, 0x0c, 0xc6, 0xc3, 0x99, 0x81, 0x04, 0xe7,
+  0xf6, 0xf9, 0xd7, 0x35, 0x36, 0x45, 0xfd, 0xfe, 0xc2, 0x5a, 0xd6, 0x5b,
+  0x03, 0xa9, 0x12, 0x01, 0xdc, 0x36, 0x90, 0x30, 0x4b, 0xc2, 0xad, 0x01,
+  0x3b, 0x95, 0xbf, 0x75, 0x90, 0xb1, 0x97, 0x8a, 0xc1, 0xe4, 0x20, 0xca,
+  0xa9, 0x56, 0x97, 0xbe, 0x1e, 0x48, 0x02, 0xfe, 0x76, 0x96, 0x37, 0x6b,
+  0x0a, 0x67, 0x1d, 0xec, 0xac, 0x54, 0x17, 0x02, 0x73, 0x93, 0x2e, 0xd6,
+  0x04, 0xdc, 0x6c, 0x19, 0xf9, 0xc2, 0xf6, 0x1e, 0xee, 0x3b, 0xad, 0xe2,
+  0x18, 0x14, 0x79, 0xb4, 0x01, 0xf9, 0x25, 0x9f, 0xfc, 0x74, 0xde, 0x8b,
+  0xf8, 0x46, 0x14, 0xf5, 0x00, 0xe2, 0xdb, 0x10, 0x3f, 0x89, 0xf8, 0xeb,
+  0x88, 0xf7, 0x23, 0xfe, 0x07, 0xfc, 0x16, 0x7a, 0x2b, 0x8e, 0xf9, 0x7b,
+  0x08, 0xf5, 0x4a, 0x7d, 0x72, 0xad, 0xbc, 0x63, 0x88, 0xe3, 0xd0, 0x01,
+  0x0b, 0x87, 0x3a, 0x58, 0x4f, 0x23, 0x7e, 0xbd, 0x03, 0x1f, 0x47, 0xf9,
+  0xa7, 0x71, 0x8c, 0xde, 0x66, 0xfc, 0x20, 0xfa, 0x0e, 0xf2, 0xcb, 0x39,
+  0x66, 0xa4, 0x9e, 0x73, 0x88, 0x6f, 0x27, 0xf9, 0x02, 0xf4, 0x5f, 0xc4,
+  0xfb, 0x1d, 0x38, 0x64, 0x19, 0xe0, 0x31, 0x07, 0x7e, 0x09, 0xe2, 0x19,
+  0x07, 0x5e, 0x8b, 0xf8, 0x7e, 0x87, 0xde, 0x55, 0x88, 0xdf, 0xef, 0xe0,
+  0xef, 0x40, 0xfc, 0x41, 0x3c, 0x97, 0xa1, 0xfa, 0x37, 0x21, 0x2e, 0x63,
+  0x67, 0x70, 0x08, 0x0d, 0x9f, 0x03, 0x07, 0xf0, 0x49, 0x3c, 0x6f, 0xc3,
+  0xfd, 0xcf, 0x11, 0x9f, 0x71, 0xc8, 0xdf, 0x84, 0xb8, 0x2c, 0x7a, 0xf9,
+  0xbd, 0x7a, 0x07, 0xe2, 0x65, 0x88, 0xaf, 0x43, 0x3c, 0x8c, 0xb8, 0x5c,
+  0x1f, 0x4a, 0xca, 0xd9, 0x8d, 0x78, 0x3b, 0xe2, 0x85, 0x39, 0x1e, 0x10,
+  0x97, 0x73, 0xf3, 0xf8, 0x11, 0x4f, 0x21, 0x9e, 0x74, 0xc8, 0xd9, 0x87,
+  0xf8, 0x2f, 0x1d, 0x72, 0xf6, 0x23, 0x3e, 0xe2, 0xc0, 0x0f, 0x20, 0xfe,
+  0x28, 0xe2, 0x38, 0xe4, 0xcf, 0xfa, 0xb5, 0xcc, 0x1f, 0xc4, 0x65, 0x1c,
+  0x78, 0x16, 0xf1, 0x17, 0x1d, 0x72, 0x60, 0xa8, 0x94, 0x6a, 0x5d, 0xb6,
+  0x55, 0x1a, 0xbc, 0x5e, 0x83, 0x37, 0x68, 0xf0, 0x1b, 0x34, 0xf8, 0x3e,
+  0x0d, 0x7e, 0x9f, 0x06, 0x1f, 0xd6, 0xe0, 0x87, 0x35, 0xf8, 0x11, 0x0d,
+  0x3e, 0xa6, 0xc1, 0x9f, 0xd3, 0xe0, 0xaf, 0x6b, 0xf0, 0x37, 0x35, 0xf8,
+  0xfb, 0x1a, 0xfc, 0x73, 0x0d, 0xbe, 0xc0, 0xa3, 0xc6, 0xab, 0x35, 0x78,
+  0x3d, 0xc6, 0x48, 0x5d, 0x8f, 0x05, 0x7e, 0x0e, 0x1b, 0xd5, 0x2e, 0x0d,
+  0xff, 0x16, 0x0d, 0xfe, 0x88, 0x06, 0xff, 0xa3, 0x06, 0x2f, 0x10, 0x0f,
+  0x6e, 0x08, 0x5b, 0x89, 0x64, 0x24, 0xde, 0x07, 0xc7, 0x7d, 0xe0, 0xa3,
+  0xac, 0x5d, 0x91, 0x4c, 0x72, 0xa0, 0x9f, 0xa3, 0x56, 0x34, 0x2c, 0xe2,
+  0x90, 0x98, 0x5b, 0x8c, 0x27, 0x60, 0x4c, 0x7d, 0x08, 0xfc, 0x80, 0x75,
+  0xcb, 0xba, 0xa6, 0x56, 0x2b, 0xda, 0xcf, 0x59, 0x18, 0x7b, 0xdf, 0xde,
+  0x50, 0x6c, 0x30, 0x62, 0xa5, 0x13, 0xa9, 0x4c, 0x5f, 0x94, 0xf9, 0x0a,
+  0x71, 0x14, 0x1b, 0x88, 0x23, 0x56, 0xe4, 0x4e, 0xad, 0x74, 0x26, 0x15,
+  0x63, 0xe9, 0xd8, 0x2e, 0xbc, 0x27, 0x69, 0xed, 0xe1, 0x7e, 0x17, 0x24,
+  0xb6, 0xc1, 0x5c, 0x29, 0x4c, 0x91, 0x15, 0x4d, 0xa6, 0x06, 0xe2, 0x99,
+  0xa8, 0x95, 0x8a, 0x14, 0xfe, 0xbb, 0x16, 0x36, 0xed, 0xd6, 0xdd, 0x20,
+  0xce, 0xda, 0x13, 0x49, 0xed, 0x8a, 0x38, 0x84, 0x46, 0x99, 0x19, 0x69,
+  0x90, 0x99, 0x0a, 0xef, 0x4e, 0x01, 0x33, 0x2c, 0xa9, 0x3c, 0x90, 0x4e,
+  0x84, 0x3b, 0x3a, 0xfa, 0xd2, 0xe9, 0x70, 0x28, 0x0e, 0x2b, 0x30, 0x37,
+  0x37, 0x02, 0x07, 0xfb, 0xc1, 0xf1, 0x7a, 0xd8, 0x34, 0x01, 0x10, 0x07,
+  0x3b, 0xd8, 0x49, 0x33, 0xb7, 0x89, 0x27, 0x6f, 0x6e, 0x81, 0x4d, 0x2b,
+  0x93, 0x21, 0x66, 0x6b, 0x28, 0x56, 0xc6, 0xfe, 0x6a, 0xb3, 0xa2, 0xe9,
+  0x48, 0xe4, 0x2e, 0x38, 0x04, 0xdb, 0x9a, 0xdb, 0x61, 0xd3, 0xc1, 0x36,
+  0x2d, 0x8d, 0x56, 0x94, 0xe7, 0x0b, 0x3b, 0x04, 0x15, 0x2d, 0x4d, 0xb0,
+  0x69, 0x86, 0x0d, 0xc8, 0x6c, 0x69, 0x85, 0x4d, 0x1b, 0x6c, 0x20, 0x5d,
+  0x0b, 0xa4, 0x6b, 0x81, 0x74, 0xad, 0x2c, 0x5d, 0x38, 0x96, 0x48, 0xb3,
+  0x4b, 0x91, 0x93, 0x16, 0x74, 0x61, 0x31, 0x41, 0x73, 0x5f, 0x67, 0xd9,
+  0x31, 0x51, 0x11, 0x82, 0xd7, 0x13, 0xfc, 0xcf, 0x04, 0xa7, 0x63, 0x25,
+  0x9f, 0x27, 0x38, 0x1d, 0x2b, 0x79, 0x12, 0x71, 0x67, 0x2c, 0xd6, 0x5b,
+  0x84, 0xff, 0x47, 0x04, 0x3f, 0x4d, 0xe6, 0x18, 0xb8, 0x92, 0xe0, 0x57,
+  0x90, 0x39, 0x03, 0xae, 0x22, 0xf8, 0x0e, 0x82, 0x37, 0x10, 0x7c, 0x1f,
+  0x89, 0xf5, 0x5a, 0x48, 0xf0, 0x03, 0x88, 0x83, 0x9b, 0x5b, 0x43, 0xf0,
+  0xc3, 0x44, 0xce, 0x5a, 0x82, 0xef, 0x2f, 0x57, 0xdb, 0xb3, 0x92, 0xcc,
+  0x0d, 0x40, 0xed, 0x79, 0x97, 0xe0, 0x3f, 0x26, 0xb8, 0x0c, 0xee, 0x2a,
+  0x43, 0xdd, 0x12, 0xaf, 0xbc, 0x48, 0x6d, 0xcf, 0x0a, 0x32, 0x37, 0x00,
+  0xb5, 0x67, 0x58, 0x33, 0x97, 0xc0, 0xfd, 0x15, 0x6a, 0xbd, 0x4f, 0x54,
+  0xd8, 0x7a, 0x2b, 0x09, 0xfe, 0x97, 0x0a, 0xb5, 0xde, 0x97, 0x2b, 0xd4,
+  0x7a, 0xab, 0x16, 0xaa, 0xf5, 0x3e, 0xa0, 0xc1, 0xbf, 0x58, 0x68, 0xeb,
+  0xa5, 0xb1, 0x76, 0xf5, 0x64, 0x0e, 0x80, 0xab, 0x09, 0x7e, 0x64, 0x91,
+  0xcd, 0x4f, 0xd7, 0xed, 0x7e, 0x4d, 0xc3, 0xdf, 0x41, 0xe6, 0x00, 0x58,
+  0x47, 0xf0, 0x6d, 0x04, 0xbf, 0x86, 0xe6, 0x5b, 0xa5, 0x2d, 0xff, 0x62,
+  0x82, 0x3f, 0x4e, 0xf8, 0x1b, 0x09, 0xfe, 0x3e, 0xc1, 0x69, 0xb9, 0x57,
+  0x2c, 0x56, 0xeb, 0xad, 0x59, 0x6c, 0xcb, 0xa7, 0xeb, 0x94, 0xaf, 0x21,
+  0xfc, 0xeb, 0x09, 0x7e, 0x23, 0xe1, 0xa7, 0xeb, 0x8e, 0x6f, 0xd2, 0xf0,
+  0xef, 0x26, 0xfc, 0x5e, 0x82, 0x27, 0x09, 0x3f, 0xb5, 0xf3, 0x39, 0x82,
+  0x37, 0x11, 0xfc, 0x38, 0x91, 0x43, 0xd7, 0x41, 0x3f, 0xa9, 0x91, 0x73,
+  0x11, 0x99, 0x7b, 0x80, 0x5e, 0xef, 0x95, 0x04, 0x6f, 0x26, 0xf8, 0xe6,
+  0x4b, 0x6c, 0xf9, 0x74, 0x7d, 0xf4, 0x04, 0xe1, 0xa7, 0xf9, 0xfc, 0x24,
+  0xe1, 0xaf, 0x26, 0xf8, 0xa4, 0x86, 0xff, 0x0e, 0x32, 0x57, 0x01, 0xbd,
+  0xdf, 0x52, 0x04, 0xa7, 0x31, 0xa2, 0xbf, 0xbb, 0xd4, 0x96, 0xbf, 0x84,
+  0xe0, 0x47, 0x11, 0x77, 0xde, 0xff, 0xcf, 0x10, 0x39, 0xf4, 0xfe, 0x9f,
+  0x20, 0x38, 0x5d, 0x0f, 0xfe, 0x03, 0x82, 0xd3, 0x75, 0xe8, 0x17, 0x90,
+  0xb9, 0x10, 0xe8, 0xd8, 0xdc, 0x6a, 0xaf, 0x6d, 0x0f, 0x9d, 0x0b, 0xa1,
+  0xc1, 0xab, 0xd6, 0xfb, 0x8b, 0x2a, 0x9b, 0x7f, 0x19, 0xc1, 0xff, 0x44,
+  0x70, 0x3a, 0x77, 0x02, 0x9d, 0x23, 0x81, 0xca, 0x79, 0x97, 0xf0, 0x2f,
+  0x27, 0xf8, 0x39, 0xc2, 0xdf, 0x46, 0xf0, 0x65, 0xd5, 0x36, 0x7f, 0x2d,
+  0xc1, 0x6f, 0x25, 0x78, 0x0d, 0xc1, 0xef, 0xaa, 0x56, 0xeb, 0x3d, 0x4b,
+  0x70, 0x7a, 0xff, 0xac, 0x5e, 0x62, 0xcb, 0x59, 0x41, 0xf0, 0xeb, 0x96,
+  0xa8, 0xe5, 0x7c, 0x44, 0xf8, 0x2f, 0x27, 0xf8, 0x8a, 0xa5, 0x36, 0xbe,
+  0x92, 0xe0, 0xeb, 0x97, 0xaa, 0xe5, 0x6c, 0x22, 0x73, 0x09, 0x50, 0x7b,
+  0x7e, 0xb3, 0xcc, 0x96, 0xf3, 0x03, 0x82, 0x3f, 0xb1, 0x4c, 0x2d, 0xe7,
+  0x6d, 0x8d, 0x9c, 0xc5, 0xcb, 0x6d, 0x39, 0xab, 0x08, 0xee, 0x5f, 0xae,
+  0x96, 0xb3, 0x8d, 0xf0, 0x5f, 0x41, 0xf0, 0x8c, 0x86, 0xff, 0x51, 0xc2,
+  0xef, 0x23, 0xf8, 0x0b, 0x1a, 0xfe, 0x73, 0x04, 0xa7, 0x76, 0xfe, 0xb0,
+  0xc6, 0x96, 0xb3, 0x9a, 0xe0, 0x5d, 0x35, 0x6a, 0x39, 0xb7, 0x10, 0xfc,
+  0x5a, 0x82, 0xff, 0x8b, 0xe0, 0xed, 0x04, 0xff, 0x44, 0x83, 0x2f, 0xad,
+  0x55, 0xe3, 0xfe, 0x5a, 0xb5, 0xfc, 0x6f, 0x7b, 0x6c, 0xf6, 0xda, 0xda,
+  0x62, 0xdc, 0x6d, 0x6c, 0x76, 0xd2, 0x91, 0x4e, 0x97, 0x5e, 0xbb, 0xee,
+  0x32, 0xa6, 0xff, 0x9b, 0x23, 0xd8, 0xd7, 0x6d, 0x6c, 0x76, 0x60, 0xa5,
+  0x3b, 0xfd, 0xba, 0xd8, 0x6c, 0x99, 0x7e, 0x0b, 0xf6, 0x77, 0x20, 0x7f,
+  0xea, 0x2c, 0xf7, 0xb1, 0xd9, 0x63, 0x3e, 0xb1, 0x3f, 0x7a, 0x81, 0xb1,
+  0xd9, 0x81, 0x3a, 0x94, 0x83, 0x0a, 0xe7, 0x1b, 0x9b, 0x9d, 0xc3, 0x49,
+  0xba, 0x02, 0x0e, 0xdc, 0xa9, 0x7f, 0x6f, 0x88, 0x3d, 0x63, 0xa4, 0x33,
+  0xae, 0xc7, 0xdd, 0xae, 0x6f, 0x69, 0x6a, 0x99, 0xef, 0xb8, 0xdb, 0x5e,
+  0x62, 0x60, 0x00, 0xb7, 0x8a, 0xd8, 0x6c, 0xba, 0xd6, 0x41, 0x36, 0x38,
+  0x35, 0x34, 0x51, 0x31, 0x94, 0x9b, 0xe1, 0x31, 0xcc, 0x39, 0x79, 0x9c,
+  0xcb, 0xff, 0x55, 0xbc, 0x17, 0x9f, 0xc9, 0x5a, 0xd9, 0x9e, 0x29, 0xcf,
+  0x89, 0xa1, 0x99, 0x46, 0xef, 0x83, 0x50, 0x9f, 0xc4, 0xf7, 0xf2, 0xe0,
+  0x5b, 0x88, 0x43, 0x78, 0x08, 0x89, 0xb8, 0xca, 0xf6, 0xcc, 0x64, 0x17,
+  0xe1, 0x77, 0x8f, 0x9e, 0x29, 0x78, 0xcf, 0xda, 0x70, 0x22, 0xff, 0x18,
+  0x44, 0x65, 0xfc, 0x47, 0xa6, 0xe5, 0x9f, 0x3b, 0x0e, 0xcc, 0xc0, 0x78,
+  0x67, 0xef, 0xd0, 0x3f, 0x09, 0x2a, 0xa4, 0x0a, 0x29, 0x4c, 0x26, 0x58,
+  0x36, 0xb3, 0xd0, 0x3b, 0xbc, 0xda, 0x66, 0xa9, 0xc2, 0x20, 0xb0, 0x72,
+  0xa9, 0xa3, 0x7b, 0x68, 0xaa, 0x2a, 0xdf, 0xe5, 0x51, 0x49, 0xfe, 0xd5,
+  0xec, 0xc9, 0x64, 0x3c, 0x19, 0x84, 0x41, 0xb2, 0xfd, 0xf1, 0xf2, 0x6c,
+  0x35, 0xc4, 0x1a, 0x7b, 0xde, 0xe8, 0x1e, 0x39, 0x2e, 0x62, 0x82, 0x3d,
+  0xdd, 0x23, 0x65, 0x1a, 0xd3, 0x66, 0x91, 0xeb, 0xcb, 0xc3, 0x20, 0x29,
+  0x3e, 0x11, 0x5b, 0x21, 0x2c, 0x46, 0x64, 0x04, 0x17, 0x6a, 0xc9, 0x88,
+  0x9a, 0x82, 0x90, 0x42, 0x60, 0x5b, 0x76, 0x73, 0xae, 0x3b, 0xfc, 0x26,
+  0x1a, 0x31, 0x94, 0xf7, 0xbc, 0xc4, 0x65, 0x80, 0xe2, 0x60, 0xae, 0xe1,
+  0x38, 0xfc, 0xb5, 0xfa, 0x0d, 0x1e, 0x2b, 0x62, 0x47, 0x28, 0xa2, 0x64,
+  0x26, 0x95, 0xe5, 0x32, 0x14, 0x8e, 0x78, 0x29, 0x6d, 0x47, 0xc4, 0x43,
+  0xa5, 0xc9, 0x06, 0xa7, 0xf9, 0x2b, 0xf3, 0x6b, 0xbe, 0x84, 0x0f, 0x0e,
+  0x1e, 0xef, 0xc1, 0xbd, 0xfc, 0xa0, 0xcc, 0x7b, 0xf0, 0x0e, 0xd6, 0x2c,
+  0xe6, 0xff, 0x7e, 0x1e, 0x22, 0x30, 0x14, 0x37, 0x93, 0x82, 0x66, 0x1b,
+  0x37, 0x47, 0xc7, 0xb5, 0xd5, 0x61, 0x45, 0x07, 0xd7, 0xa9, 0x7c, 0xa6,
+  0x97, 0x95, 0x01, 0x66, 0x19, 0x65, 0xc7, 0xa1, 0xd4, 0x2e, 0x2b, 0x74,
+  0x27, 0x3c, 0x2d, 0x0b, 0xfa, 0x18, 0x45, 0x39, 0xe7, 0xbf, 0x29, 0xa4,
+  0xff, 0x96, 0xb7, 0xe5, 0x75, 0x8e, 0x86, 0xce, 0x75, 0x5b, 0xae, 0x6a,
+  0x20, 0x15, 0xe9, 0xb5, 0x6d, 0xb9, 0xcb, 0xf4, 0xba, 0xb6, 0xdc, 0x6d,
+  0x7a, 0x5d, 0x5b, 0x2e, 0xd3, 0xef, 0xc4, 0xf3, 0xf9, 0xce, 0x81, 0xf0,
+  0x0f, 0x4c, 0xbf, 0xc2, 0x81, 0xbb, 0x6d, 0xcb, 0xa7, 0xcb, 0x8a, 0xf5,
+  0xcc, 0xb7, 0x2d, 0xaf, 0x42, 0x30, 0x30, 0x87, 0xfe, 0xfe, 0x74, 0x62,
+  0x77, 0x28, 0xde, 0x1f, 0x8b, 0x60, 0x6b, 0x3e, 0x57, 0x5b, 0xde, 0xde,
+  0x86, 0x4d, 0xf9, 0x7c, 0xc6, 0xd9, 0x10, 0x30, 0x80, 0xdb, 0x45, 0xa5,
+  0xb3, 0x86, 0x68, 0x49, 0x57, 0x57, 0xe1, 0xde, 0xb9, 0xac, 0xcc, 0x2e,
+  0xbd, 0x12, 0x89, 0xf6, 0xc5, 0x41, 0xed, 0x64, 0x67, 0x7d, 0xe2, 0x54,
+  0x21, 0x5f, 0x79, 0xbb, 0xcc, 0xb7, 0x6e, 0x0a, 0xc6, 0xaf, 0xad, 0x6e,
+  0x3a, 0xc9, 0x6d, 0xdd, 0x94, 0xe9, 0x9d, 0xfc, 0xdf, 0xb5, 0xf9, 0x49,
+  0xe4, 0x98, 0xdd, 0xf9, 0xd6, 0xcd, 0x31, 0xdc, 0x5f, 0x68, 0xdd, 0x9c,
+  0x70, 0xe8, 0x59, 0xa0, 0xd1, 0xaf, 0xed, 0x67, 0xe1, 0x3e, 0x30, 0x87,
+  0x7e, 0x43, 0x86, 0x0c, 0x19, 0x32, 0x64, 0xc8, 0x90, 0x21, 0x43, 0x86,
+  0x0c, 0x19, 0x32, 0x64, 0xc8, 0x90, 0x21, 0x43, 0x86, 0x0c, 0x19, 0x32,
+  0x64, 0xc8, 0x90, 0x21, 0x43, 0x86, 0x0c, 0x19, 0x32, 0x64, 0xc8, 0x90,
+  0x21, 0x43, 0x86, 0x0c, 0x19, 0xfa, 0x2e, 0xd2, 0xff, 0x00, 0x3d, 0xe9,
+  0x90, 0x77, 0x00, 0xc8, 0x00, 0x00
+};
+const unsigned int libtcc1_a_len = 8550;
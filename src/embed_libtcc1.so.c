@@ -0,0 +1,784 @@
+// Embedded: lib/tinycc/libtcc1.so
+// source generated by cjit/build/embed-path.sh
+// Mon Oct 19 15:33:27 UTC 2026
+// libtcc1.so
+const char libtcc1_so[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd4, 0x5b,
+  0x0b, 0x78, 0x53, 0x55, 0xb6, 0x3e, 0x29, 0x2d, 0xa4, 0x15, 0x48, 0xf1,
+  0x81, 0x1d, 0x19, 0x35, 0x60, 0xa9, 0x14, 0x28, 0xb4, 0xa1, 0x8f, 0xf0,
+  0xa8, 0x84, 0x4a, 0x30, 0x40, 0x03, 0xe5, 0xa5, 0xe0, 0x38, 0xb7, 0xa4,
+  0x6d, 0x42, 0x2b, 0x6d, 0x52, 0x92, 0x00, 0xb5, 0x23, 0x42, 0x29, 0x62,
+  0x63, 0x41, 0x11, 0x85, 0x41, 0xd4, 0x11, 0x90, 0xe1, 0xe1, 0xa7, 0x82,
+  0xca, 0xa5, 0x85, 0xeb, 0xc5, 0x96, 0x32, 0x5a, 0xb4, 0x16, 0xc4, 0x71,
+  0x2c, 0x22, 0x10, 0x98, 0x0a, 0xe9, 0x77, 0x19, 0x8d, 0xa8, 0x33, 0x71,
+  0xbe, 0x7b, 0xe1, 0xae, 0x7d, 0xf6, 0x3a, 0x64, 0x9f, 0x47, 0xa8, 0xe5,
+  0xd4, 0xf9, 0xee, 0x3d, 0x1f, 0xbb, 0x67, 0xef, 0x7f, 0xaf, 0xbd, 0xf6,
+  0xbf, 0xd7, 0xda, 0x8f, 0x75, 0xce, 0x09, 0xa5, 0x25, 0x05, 0xde, 0xc2,
+  0xc2, 0xb4, 0x11, 0x1e, 0x17, 0xf7, 0x8b, 0x5d, 0xa9, 0x70, 0x65, 0x65,
+  0x64, 0xf0, 0x77, 0xb8, 0x24, 0xf7, 0xac, 0xcc, 0xd4, 0x8c, 0x54, 0x2e,
+  0x2d, 0xc3, 0x90, 0x99, 0x91, 0x6e, 0xc8, 0x82, 0x32, 0x97, 0x9a, 0x66,
+  0xc8, 0xca, 0x1c, 0xc5, 0xe9, 0x53, 0x7f, 0x39, 0x4a, 0xe1, 0x6b, 0xb1,
+  0xc7, 0x6b, 0x73, 0x03, 0x15, 0xb7, 0xcb, 0xe5, 0xbd, 0x9e, 0x5c, 0x67,
+  0xf5, 0xd2, 0xc1, 0xfd, 0x3f, 0xb9, 0x96, 0x9b, 0x73, 0x27, 0x45, 0x69,
+  0x34, 0xd7, 0xca, 0x3d, 0xb8, 0xfb, 0x38, 0x52, 0xca, 0x1b, 0xa2, 0xe7,
+  0xcb, 0x26, 0xc4, 0x8b, 0x2b, 0xc2, 0x6d, 0x4c, 0x9c, 0x91, 0xeb, 0x09,
+  0x7f, 0x75, 0x5c, 0x5f, 0x5e, 0x36, 0xfa, 0x3a, 0xfa, 0xf3, 0x86, 0x88,
+  0xef, 0x1c, 0x47, 0xf5, 0x92, 0x76, 0x31, 0xa2, 0x7a, 0xbd, 0xe8, 0x5e,
+  0x3c, 0x85, 0x13, 0xdd, 0xd9, 0x76, 0x3d, 0x21, 0x35, 0xb8, 0x29, 0xda,
+  0xe0, 0x36, 0x89, 0xee, 0xc6, 0x18, 0x4e, 0x74, 0x97, 0xb6, 0x0b, 0x2d,
+  0xa5, 0x68, 0x68, 0xe9, 0x7c, 0xd1, 0x5d, 0x7e, 0xd1, 0x76, 0x51, 0xd8,
+  0x6e, 0xd7, 0x62, 0x8a, 0xee, 0x5a, 0x6c, 0x12, 0xdd, 0xe3, 0xd1, 0x74,
+  0xc2, 0x5d, 0x8b, 0xad, 0x67, 0x7e, 0xed, 0x2d, 0xea, 0x0a, 0xcf, 0xb0,
+  0x07, 0x94, 0xaf, 0x6f, 0x48, 0x1f, 0x0a, 0xf8, 0x8f, 0x11, 0xf0, 0x7f,
+  0x46, 0xc0, 0x49, 0x47, 0x4a, 0x78, 0xbf, 0x08, 0x78, 0x42, 0x04, 0xfc,
+  0xee, 0x08, 0x78, 0x52, 0x04, 0x3c, 0x25, 0x02, 0x9e, 0x11, 0x01, 0xcf,
+  0x8e, 0x80, 0xdf, 0x1f, 0x01, 0x9f, 0x1c, 0x01, 0x9f, 0x11, 0x01, 0xb7,
+  0x45, 0xc0, 0x8b, 0x23, 0xe0, 0xe5, 0x11, 0xf0, 0xa5, 0x11, 0xf0, 0x65,
+  0x11, 0xf0, 0xea, 0x08, 0xf8, 0xd3, 0x11, 0xf0, 0x67, 0x23, 0xe0, 0xbb,
+  0x23, 0xe0, 0xad, 0xb0, 0x18, 0x6f, 0xe6, 0x7a, 0x71, 0xef, 0xe7, 0xe8,
+  0xf9, 0xf2, 0x33, 0x88, 0xbf, 0xd8, 0x93, 0xe2, 0x81, 0x69, 0x14, 0x5f,
+  0x87, 0x78, 0x6e, 0x2f, 0x8a, 0x57, 0xce, 0xa0, 0xb8, 0x05, 0xf1, 0x6f,
+  0x10, 0x7f, 0x7a, 0x36, 0xc5, 0xb7, 0x20, 0xfe, 0x56, 0x1c, 0xc1, 0xb5,
+  0x5c, 0x85, 0x5b, 0x2f, 0xea, 0xb7, 0x09, 0xf1, 0x4d, 0x12, 0xfc, 0x4b,
+  0x0d, 0xea, 0x19, 0x4a, 0xf1, 0x4d, 0x88, 0xc7, 0x47, 0x51, 0xfc, 0xce,
+  0x91, 0x14, 0x5f, 0x83, 0x78, 0xdf, 0x18, 0x8a, 0x17, 0x4e, 0xa4, 0x78,
+  0x2d, 0xe2, 0x05, 0x88, 0xaf, 0x9f, 0x44, 0xf1, 0x34, 0x41, 0x3f, 0xe2,
+  0x43, 0xa6, 0x50, 0x7c, 0x3d, 0xe2, 0x7f, 0xc2, 0xf1, 0xae, 0x98, 0x2e,
+  0xe6, 0xd3, 0x82, 0x7c, 0x12, 0x93, 0x29, 0x5e, 0x88, 0x78, 0x5a, 0x0f,
+  0x8a, 0x4f, 0xce, 0x12, 0xdb, 0xed, 0xb5, 0x58, 0x3a, 0x2e, 0xe3, 0x22,
+  0xb1, 0x9e, 0xff, 0x42, 0xbc, 0x42, 0x82, 0x1f, 0xe6, 0xa8, 0x9e, 0x26,
+  0xe4, 0x99, 0x8c, 0xf8, 0x79, 0xe4, 0xd3, 0x8a, 0x7c, 0xe6, 0x22, 0x3e,
+  0x13, 0xfd, 0xb5, 0x72, 0x3c, 0xc5, 0x57, 0x23, 0xfe, 0x2d, 0x8e, 0xeb,
+  0x20, 0x8e, 0x6b, 0x23, 0xe2, 0x1f, 0xa1, 0x5f, 0x92, 0xd0, 0x2f, 0x45,
+  0x88, 0xc7, 0x09, 0xf6, 0x97, 0xf0, 0x59, 0x8b, 0xb8, 0x45, 0xe2, 0x97,
+  0x91, 0xc8, 0xc7, 0x9b, 0x4b, 0x71, 0xc1, 0x6e, 0xe3, 0x22, 0xcc, 0x87,
+  0x15, 0x5a, 0x32, 0xdf, 0x7a, 0xcb, 0xf6, 0xcb, 0x4c, 0xd4, 0xdf, 0x26,
+  0xe9, 0xf7, 0x55, 0xb0, 0x73, 0x3f, 0x2e, 0x96, 0x4b, 0xf0, 0x98, 0xf8,
+  0xb2, 0xb0, 0x2f, 0x4e, 0x43, 0xbf, 0x7f, 0x92, 0x2a, 0xee, 0x77, 0x1a,
+  0x47, 0xf1, 0x03, 0x23, 0xc4, 0xe3, 0x72, 0xa1, 0x5f, 0xae, 0x1a, 0x29,
+  0xfe, 0x02, 0xe2, 0x95, 0x28, 0x7f, 0x2e, 0x93, 0xe2, 0xc5, 0x88, 0x1f,
+  0x42, 0xff, 0x1e, 0xc4, 0x73, 0xe4, 0x51, 0xc4, 0x3d, 0x68, 0xcf, 0x39,
+  0x0f, 0x50, 0x5c, 0x98, 0x57, 0x1a, 0xc1, 0x9e, 0x79, 0x14, 0x17, 0xce,
+  0x78, 0x43, 0x84, 0xf1, 0xea, 0x71, 0xbc, 0xf5, 0x92, 0xf1, 0x16, 0xe2,
+  0xb8, 0xf2, 0xd3, 0xc4, 0xe3, 0xda, 0x86, 0x78, 0xc2, 0x28, 0x31, 0xbe,
+  0x0e, 0xfd, 0x7e, 0xd7, 0x04, 0x31, 0x9f, 0x6a, 0xf4, 0x4b, 0x03, 0xae,
+  0xd3, 0x7e, 0x88, 0xf7, 0xd7, 0x52, 0x7c, 0xbe, 0x93, 0xe2, 0x83, 0xa2,
+  0x28, 0xee, 0x44, 0x3e, 0x43, 0x24, 0xfe, 0x1d, 0x80, 0xf6, 0xf9, 0x6c,
+  0x38, 0xc5, 0xfd, 0x88, 0xef, 0x40, 0x3c, 0x11, 0xe7, 0xdb, 0xbf, 0x21,
+  0xbe, 0x0a, 0xed, 0xfc, 0xfc, 0x68, 0x8a, 0x0b, 0x76, 0x6e, 0x42, 0x7c,
+  0xe6, 0x58, 0x31, 0xfe, 0x47, 0xe4, 0xbf, 0x5b, 0xc2, 0xbf, 0x1d, 0x71,
+  0xeb, 0xfd, 0x62, 0x9c, 0x43, 0xfe, 0xa5, 0x85, 0x14, 0xff, 0x36, 0x8e,
+  0xc2, 0xc3, 0x90, 0x7f, 0xb3, 0xc4, 0x9e, 0x6f, 0xa3, 0xbf, 0xa2, 0x27,
+  0x8b, 0xed, 0x36, 0x02, 0xfd, 0x95, 0x83, 0xf3, 0xd3, 0x88, 0xf8, 0x09,
+  0x1c, 0xd7, 0x25, 0x5c, 0x77, 0x25, 0x88, 0x7f, 0x83, 0xf3, 0xe1, 0xdd,
+  0x14, 0x8a, 0x0b, 0xeb, 0xcb, 0x85, 0xeb, 0x37, 0x41, 0xd2, 0xef, 0x8f,
+  0x88, 0xd7, 0x48, 0x71, 0xf4, 0xe3, 0xfc, 0x0c, 0x31, 0x9f, 0x3a, 0x94,
+  0xb7, 0x48, 0xe4, 0x87, 0x20, 0x9f, 0x4f, 0xd1, 0x8f, 0xb7, 0x23, 0xde,
+  0x1f, 0xed, 0xb3, 0x2d, 0x9b, 0xe2, 0x82, 0x3d, 0x3f, 0xc0, 0xf1, 0x6e,
+  0x94, 0x8c, 0x37, 0x06, 0xe7, 0x43, 0xde, 0x54, 0x31, 0xfe, 0x22, 0xda,
+  0x6d, 0xae, 0xc4, 0xef, 0xdb, 0x11, 0x2f, 0x96, 0xe0, 0x59, 0xa8, 0xff,
+  0x31, 0x33, 0xc5, 0x05, 0xbf, 0xfc, 0x06, 0xed, 0x79, 0x78, 0x86, 0x58,
+  0xff, 0x41, 0x2d, 0xee, 0x27, 0xe5, 0x62, 0x3d, 0x75, 0x68, 0x87, 0xd7,
+  0x25, 0xf3, 0xf9, 0x72, 0x84, 0xfd, 0x6d, 0x21, 0xea, 0x9f, 0x3d, 0x93,
+  0xe2, 0xad, 0x88, 0x3f, 0x12, 0x61, 0x7d, 0x15, 0x20, 0xff, 0x04, 0x09,
+  0xff, 0x0d, 0xb8, 0x9f, 0xc4, 0xe3, 0x7e, 0x22, 0xc4, 0x9c, 0xa3, 0x91,
+  0xcf, 0x58, 0xc9, 0x7e, 0xd2, 0x86, 0xf3, 0xf6, 0x82, 0x64, 0xde, 0xde,
+  0x8d, 0x7c, 0x36, 0xe3, 0x7a, 0xdf, 0x85, 0xf8, 0x56, 0xc4, 0x57, 0xcf,
+  0xa2, 0xf8, 0x16, 0xc4, 0xc7, 0xa2, 0x7f, 0x43, 0x12, 0x3b, 0xdc, 0x86,
+  0x3c, 0x77, 0x49, 0xfc, 0x7e, 0x0e, 0xf9, 0xb4, 0xa6, 0x8b, 0xf9, 0x3c,
+  0x8c, 0x7c, 0x16, 0x4a, 0xf6, 0xb1, 0xbd, 0x38, 0x3f, 0xf3, 0x24, 0xfb,
+  0x55, 0x14, 0xce, 0x93, 0xbe, 0x92, 0x79, 0xf2, 0x13, 0xe2, 0x6d, 0x92,
+  0xf5, 0x35, 0x17, 0xed, 0xbf, 0xc9, 0x2a, 0xee, 0xf7, 0x19, 0x1c, 0xd7,
+  0x20, 0x1c, 0x97, 0xb0, 0xaf, 0xd6, 0x23, 0xff, 0x1a, 0x89, 0x9d, 0x7f,
+  0x87, 0xfa, 0x9f, 0x37, 0x89, 0xf5, 0xf7, 0x42, 0x3b, 0xb4, 0x49, 0xec,
+  0x30, 0x0d, 0xf5, 0x84, 0x24, 0x76, 0x58, 0x89, 0xb8, 0x51, 0xa2, 0xff,
+  0x1e, 0x9c, 0x87, 0xdf, 0x48, 0xce, 0xf7, 0x3d, 0xc8, 0xbf, 0x42, 0x72,
+  0x5e, 0xff, 0x0d, 0xe7, 0x61, 0xb3, 0xa4, 0xdf, 0x16, 0xc1, 0xfe, 0x12,
+  0xfd, 0x89, 0x68, 0xff, 0xdd, 0x23, 0xc5, 0x76, 0x48, 0xe1, 0xe7, 0x5b,
+  0x1f, 0xd9, 0x7c, 0xdb, 0xae, 0x25, 0xf3, 0xea, 0x26, 0xae, 0x7e, 0x89,
+  0x89, 0x2f, 0x9b, 0x30, 0x10, 0x37, 0xa3, 0xbf, 0xbe, 0xc0, 0x78, 0x40,
+  0xb0, 0xff, 0x1d, 0xc8, 0xf3, 0xbc, 0x64, 0x3d, 0xbe, 0x8c, 0xe3, 0x72,
+  0x5b, 0xc4, 0x78, 0x35, 0xda, 0x6d, 0x88, 0xc4, 0x3e, 0x5f, 0x20, 0x3e,
+  0x57, 0x82, 0x9f, 0x47, 0xbc, 0x58, 0x82, 0x3b, 0xd0, 0x2f, 0x5a, 0x89,
+  0x5f, 0x26, 0x22, 0x9f, 0x9e, 0x12, 0xbf, 0x9f, 0x8a, 0x10, 0xbf, 0x3d,
+  0x1f, 0x61, 0xdd, 0xc5, 0xe1, 0x78, 0x2f, 0xe3, 0xfe, 0xb6, 0x01, 0xf1,
+  0x61, 0xd8, 0x6f, 0xe6, 0x7d, 0x14, 0xff, 0x3d, 0xe2, 0x49, 0x11, 0xf4,
+  0x58, 0x22, 0xe0, 0x57, 0x71, 0x9e, 0xcf, 0xc7, 0xf3, 0x5d, 0x78, 0x40,
+  0x5e, 0x8a, 0xfe, 0xfa, 0x4e, 0x72, 0x6e, 0x7e, 0x8c, 0x7e, 0xdf, 0x25,
+  0xf1, 0x7b, 0x5f, 0x0e, 0xe7, 0xf3, 0x30, 0x8a, 0xdf, 0x8e, 0xfe, 0xd2,
+  0x23, 0xff, 0xa7, 0x30, 0x1e, 0x10, 0xe2, 0xc3, 0x4d, 0x88, 0xdf, 0x3b,
+  0x86, 0xe2, 0x82, 0x1f, 0x73, 0x85, 0xf3, 0x05, 0xcf, 0x0b, 0x21, 0xde,
+  0x7b, 0x0a, 0x71, 0xff, 0x03, 0x62, 0x3e, 0xfb, 0x23, 0xec, 0x0f, 0xf7,
+  0x21, 0x9f, 0x75, 0x38, 0x2e, 0x21, 0xde, 0x73, 0x45, 0xb0, 0xc3, 0x74,
+  0xf4, 0xaf, 0x56, 0xe2, 0x5f, 0x0d, 0xea, 0x79, 0x0a, 0xe3, 0xd2, 0x1e,
+  0x38, 0xae, 0x47, 0x11, 0xaf, 0xcf, 0x14, 0xeb, 0x5f, 0x83, 0x76, 0xab,
+  0x36, 0x50, 0x5c, 0xf0, 0xd7, 0x04, 0xf4, 0xd7, 0x27, 0xe8, 0xaf, 0x91,
+  0x88, 0x1f, 0x40, 0x3c, 0x1d, 0x9f, 0x0b, 0x84, 0xf9, 0xb3, 0x2c, 0xc2,
+  0xfe, 0x9c, 0x83, 0xeb, 0x2b, 0x20, 0xe1, 0x39, 0x17, 0x71, 0xad, 0x64,
+  0xdd, 0x85, 0xf8, 0xe7, 0x91, 0x5e, 0x9c, 0x69, 0x84, 0x18, 0x6f, 0x41,
+  0x9e, 0xe3, 0x24, 0xfb, 0xe1, 0x9b, 0xe8, 0x97, 0xff, 0x40, 0xbf, 0x08,
+  0xf3, 0xea, 0x6e, 0x2d, 0xd5, 0xb3, 0x52, 0xe2, 0xf7, 0x8d, 0x68, 0x87,
+  0xff, 0xc6, 0x71, 0x09, 0xaf, 0x13, 0xda, 0x71, 0x5e, 0x8d, 0xc6, 0x38,
+  0x67, 0x33, 0xe2, 0x7f, 0x43, 0xfd, 0x95, 0xe3, 0x28, 0x2e, 0xf8, 0xbd,
+  0x0c, 0xd7, 0xcb, 0x50, 0x3c, 0x97, 0x85, 0xb8, 0xfa, 0xcf, 0x88, 0xd7,
+  0xe0, 0xfe, 0x33, 0x09, 0x71, 0x5d, 0x84, 0xf3, 0xe2, 0x2b, 0x9c, 0x9f,
+  0xf5, 0x12, 0x9e, 0x03, 0xd0, 0xbf, 0x01, 0x09, 0xce, 0xe5, 0xe7, 0x3b,
+  0x4a, 0x2a, 0x16, 0x3b, 0x3d, 0x1e, 0x47, 0x51, 0xc9, 0xb5, 0x42, 0x11,
+  0x5b, 0xa8, 0xa0, 0x05, 0x9b, 0xd7, 0x55, 0x56, 0x52, 0x98, 0xef, 0x2d,
+  0x76, 0xdb, 0x6d, 0x45, 0xf9, 0x0e, 0xbb, 0xb3, 0xd0, 0x1e, 0x46, 0x4b,
+  0x5d, 0x80, 0xa5, 0x85, 0xcb, 0x85, 0xae, 0xb2, 0x72, 0x9b, 0xdb, 0x9e,
+  0x6f, 0xaf, 0x28, 0x2c, 0xb6, 0x39, 0x17, 0xd8, 0xd9, 0x3a, 0x5e, 0xd6,
+  0x70, 0x1d, 0x59, 0x83, 0x44, 0x36, 0xfd, 0x3a, 0xb2, 0xe9, 0x12, 0x59,
+  0xe3, 0x75, 0x64, 0x8d, 0xdc, 0x02, 0xbb, 0xb7, 0xbc, 0xa4, 0x88, 0x73,
+  0x95, 0xdb, 0x9d, 0x9c, 0xa3, 0xd0, 0xe9, 0x2d, 0x05, 0x69, 0xbb, 0xdb,
+  0xed, 0x74, 0x41, 0xe3, 0x42, 0x9b, 0xb7, 0xc4, 0x05, 0x70, 0x11, 0x5f,
+  0xeb, 0xf1, 0xba, 0x4b, 0xe9, 0xad, 0xb0, 0xac, 0x9c, 0x2b, 0xb3, 0x95,
+  0x82, 0x00, 0xe7, 0x28, 0x77, 0x97, 0x38, 0xbd, 0x0e, 0x0e, 0x2c, 0xc0,
+  0x97, 0x17, 0x79, 0x5c, 0x6e, 0x2f, 0xe7, 0x00, 0xad, 0x1e, 0x22, 0xe9,
+  0x2e, 0x2c, 0x76, 0x83, 0xc2, 0x12, 0x8f, 0xab, 0x70, 0xf4, 0xe8, 0x7c,
+  0x8f, 0xa7, 0xd0, 0xe6, 0x74, 0x10, 0x1c, 0xfe, 0x91, 0x9b, 0x93, 0x68,
+  0x22, 0x0a, 0x41, 0xca, 0xe1, 0xb1, 0xdb, 0x17, 0x72, 0x0e, 0x24, 0x52,
+  0xea, 0xf2, 0xd8, 0x39, 0x87, 0xdb, 0x6e, 0xe7, 0x6c, 0x05, 0x44, 0x63,
+  0x7e, 0x7e, 0x59, 0xa5, 0xdd, 0xed, 0xf2, 0x38, 0x84, 0x5c, 0x11, 0xd1,
+  0x53, 0x04, 0x4c, 0x89, 0x53, 0x60, 0x9c, 0xde, 0xc5, 0xce, 0xa2, 0x12,
+  0xbe, 0xfa, 0x5a, 0xa9, 0x48, 0x54, 0xaa, 0x70, 0x50, 0xf7, 0x85, 0xbd,
+  0x1a, 0x76, 0x29, 0xef, 0x4f, 0x7e, 0x00, 0xb6, 0xb0, 0xb1, 0x3c, 0x5e,
+  0x97, 0x5b, 0xe4, 0x25, 0x25, 0xcf, 0xd9, 0x8a, 0x88, 0xe3, 0xbd, 0x85,
+  0xc5, 0x2c, 0xe8, 0x59, 0x5c, 0x20, 0x07, 0x6d, 0x4e, 0x05, 0x49, 0x97,
+  0x5b, 0x8e, 0x55, 0x28, 0x81, 0x4e, 0xc5, 0xe6, 0x14, 0x20, 0x1c, 0x64,
+  0x20, 0xe1, 0x20, 0x97, 0x74, 0x2a, 0x48, 0x42, 0x77, 0x32, 0xac, 0x42,
+  0x09, 0x74, 0x4a, 0x9a, 0x53, 0x03, 0x19, 0x14, 0x0c, 0x64, 0x50, 0x32,
+  0x90, 0x41, 0xc9, 0x40, 0x06, 0x25, 0x03, 0x19, 0x14, 0x0c, 0x64, 0x50,
+  0x32, 0x90, 0x41, 0xd1, 0x40, 0x06, 0x25, 0x03, 0xc9, 0x40, 0xc2, 0x41,
+  0x2e, 0xe9, 0x54, 0x90, 0x84, 0xee, 0x64, 0x58, 0x85, 0x12, 0xe8, 0x94,
+  0x34, 0xa7, 0x06, 0x4a, 0x57, 0x30, 0x50, 0xba, 0x92, 0x81, 0xd2, 0x95,
+  0x0c, 0x94, 0xae, 0x64, 0xa0, 0x74, 0x05, 0x03, 0xa5, 0x2b, 0x19, 0x28,
+  0x5d, 0xd1, 0x40, 0xe9, 0x4a, 0x06, 0x92, 0x81, 0x84, 0x83, 0x5c, 0xd2,
+  0xa9, 0x20, 0x09, 0xdd, 0xc9, 0xb0, 0x0a, 0x25, 0xd0, 0x29, 0x69, 0x4e,
+  0x0d, 0x64, 0x54, 0x30, 0x90, 0x51, 0xc9, 0x40, 0x46, 0x25, 0x03, 0x19,
+  0x95, 0x0c, 0x64, 0x54, 0x30, 0x90, 0x51, 0xc9, 0x40, 0x46, 0x45, 0x03,
+  0x19, 0x95, 0x0c, 0x24, 0x03, 0x09, 0x07, 0xb9, 0xa4, 0x53, 0x41, 0x12,
+  0xba, 0x93, 0x61, 0x15, 0x4a, 0xa0, 0x53, 0xd2, 0xdc, 0x53, 0xb2, 0xc0,
+  0x69, 0x2b, 0x95, 0x1e, 0x2d, 0x25, 0x1e, 0xb2, 0x39, 0x2f, 0xcc, 0xe7,
+  0xf7, 0xc7, 0xf0, 0x31, 0x64, 0xf7, 0x78, 0xf9, 0xee, 0x3d, 0x76, 0x2f,
+  0xb3, 0xe5, 0x97, 0xda, 0x6d, 0x64, 0x8f, 0x2c, 0x58, 0x5c, 0x52, 0xea,
+  0x2d, 0x71, 0xe6, 0x3b, 0x1c, 0x1e, 0x71, 0xa9, 0xb4, 0x54, 0x52, 0x66,
+  0x8a, 0x85, 0xa5, 0x95, 0xe2, 0x52, 0xa9, 0xa4, 0x56, 0x54, 0xf4, 0x56,
+  0x8a, 0x4b, 0xa5, 0x92, 0x5a, 0x71, 0x5b, 0xb7, 0xa7, 0x40, 0x5a, 0x2e,
+  0x95, 0x49, 0xb0, 0x40, 0xb9, 0xab, 0xbc, 0xd0, 0xb5, 0xd8, 0xe9, 0x55,
+  0x80, 0x4a, 0x95, 0xe4, 0x44, 0x98, 0xcd, 0x5d, 0xe2, 0x7d, 0x4c, 0x06,
+  0x94, 0xca, 0x65, 0x08, 0x42, 0xa7, 0x25, 0x6f, 0xcf, 0x42, 0xd7, 0x12,
+  0xbb, 0xdb, 0xb6, 0x80, 0x98, 0x79, 0x89, 0x2d, 0xdf, 0xe6, 0x5e, 0xc0,
+  0xe5, 0xdb, 0xbd, 0xf6, 0x0a, 0x20, 0x61, 0x2f, 0xb2, 0x79, 0xe1, 0xb4,
+  0xb0, 0x3b, 0x8b, 0xa0, 0xae, 0xdc, 0x6d, 0x2f, 0x71, 0x96, 0x80, 0xf9,
+  0xdd, 0x6e, 0xdb, 0x63, 0xf9, 0xe4, 0x3b, 0x95, 0x57, 0x86, 0x52, 0x49,
+  0x05, 0x31, 0x99, 0x8c, 0x03, 0x10, 0x89, 0x0c, 0x03, 0xf1, 0x32, 0x0f,
+  0xe4, 0x4e, 0xcf, 0x99, 0x90, 0x9b, 0x3f, 0x7d, 0xd2, 0xa4, 0x59, 0xe6,
+  0xd9, 0xf9, 0xb3, 0x27, 0xe4, 0xe4, 0x9a, 0xf3, 0x45, 0x81, 0x8b, 0xa9,
+  0xbc, 0xd4, 0x2b, 0x0a, 0x5e, 0x44, 0x40, 0x45, 0x18, 0x50, 0x08, 0x62,
+  0xc4, 0x35, 0x34, 0x90, 0x11, 0x63, 0xf2, 0x60, 0x46, 0xa1, 0x8d, 0xa1,
+  0x93, 0x36, 0x06, 0x85, 0x36, 0xe9, 0x9d, 0xb4, 0x49, 0x57, 0x68, 0x63,
+  0xec, 0xa4, 0x0d, 0xad, 0xa7, 0x81, 0x0e, 0x9f, 0x25, 0x31, 0x06, 0x9f,
+  0xe1, 0x03, 0x1e, 0x6c, 0x2d, 0x0e, 0x7a, 0x68, 0x75, 0xd1, 0x35, 0x49,
+  0x1a, 0xfc, 0x08, 0x59, 0x08, 0x5b, 0xf8, 0x2c, 0x0d, 0x82, 0xa8, 0x2c,
+  0x0d, 0x84, 0xf8, 0x3c, 0x06, 0x43, 0x7c, 0x9e, 0x0f, 0x88, 0xa8, 0x04,
+  0x09, 0x8a, 0x04, 0x0d, 0x24, 0xe4, 0xc1, 0x8e, 0x45, 0xc1, 0x91, 0x50,
+  0x0f, 0xff, 0x84, 0xac, 0x53, 0xe8, 0x8d, 0x06, 0x4a, 0x54, 0x17, 0x09,
+  0x96, 0x68, 0x8e, 0x19, 0x0c, 0x09, 0x9a, 0x68, 0x16, 0x36, 0x06, 0x3e,
+  0xc3, 0x07, 0x4f, 0x7c, 0x8e, 0xe3, 0x56, 0x40, 0xda, 0xcd, 0x84, 0xb9,
+  0x7d, 0x20, 0xfd, 0x11, 0xd2, 0x4e, 0x48, 0xb3, 0x20, 0x25, 0x32, 0x75,
+  0xc3, 0x39, 0xe5, 0xab, 0x12, 0xef, 0x7f, 0x80, 0xf4, 0x1a, 0xe6, 0xc9,
+  0x67, 0xb3, 0x5b, 0x19, 0x99, 0xc7, 0x25, 0x6d, 0x76, 0x28, 0xe8, 0x79,
+  0x0a, 0xd2, 0xc3, 0x90, 0xc8, 0xab, 0x45, 0xf2, 0x99, 0xcf, 0xc4, 0xd4,
+  0xcd, 0x91, 0xc8, 0xf6, 0xc0, 0xbb, 0xf0, 0x1e, 0x49, 0xf8, 0x96, 0xa2,
+  0x83, 0xd4, 0x9b, 0xa3, 0x71, 0xfe, 0x6d, 0x11, 0xf8, 0xde, 0xcc, 0x85,
+  0x9f, 0x33, 0x6e, 0xc1, 0x3b, 0x3c, 0x26, 0xf0, 0xcf, 0x36, 0xc2, 0xf3,
+  0xc4, 0x56, 0xbc, 0x0b, 0xef, 0x27, 0xaf, 0x7d, 0xfe, 0xc4, 0xab, 0x5a,
+  0x41, 0xef, 0xd3, 0x1c, 0x7d, 0x0e, 0x25, 0xef, 0xca, 0x5f, 0x44, 0x8c,
+  0x3c, 0xef, 0x4e, 0xe0, 0xe8, 0xf7, 0x9a, 0x0d, 0x8c, 0xec, 0x00, 0x85,
+  0xf6, 0x4f, 0x72, 0xe1, 0xf7, 0x9b, 0x2f, 0x4b, 0xea, 0xb6, 0xe3, 0x3d,
+  0x17, 0xef, 0xbf, 0x55, 0x68, 0x4f, 0x2e, 0xe1, 0x7d, 0xf3, 0x16, 0x48,
+  0x93, 0xb9, 0xf0, 0xfb, 0x28, 0x72, 0x6d, 0x63, 0xf2, 0x45, 0x5c, 0xe7,
+  0x17, 0x79, 0x45, 0x1d, 0xd3, 0xa9, 0x94, 0xfc, 0xea, 0xc9, 0xe4, 0x6f,
+  0xc2, 0x7b, 0xff, 0x4e, 0xda, 0x24, 0x44, 0xc0, 0xf5, 0x90, 0x92, 0x20,
+  0x0d, 0xc4, 0xf2, 0x9d, 0x4c, 0xdd, 0xaf, 0x39, 0xfa, 0xdc, 0x3d, 0x8c,
+  0xa3, 0xcf, 0xd5, 0x29, 0x88, 0xc7, 0xe2, 0x3d, 0x1d, 0xef, 0x99, 0x90,
+  0x46, 0x31, 0xed, 0x46, 0x40, 0x32, 0x30, 0xe5, 0x34, 0x4e, 0x7e, 0x8d,
+  0x87, 0x74, 0x0f, 0x47, 0xdf, 0xfb, 0xe6, 0x40, 0xba, 0x97, 0xa9, 0x1b,
+  0x04, 0x69, 0x0c, 0xa4, 0xa9, 0x90, 0xee, 0xe2, 0xe8, 0x37, 0x96, 0x71,
+  0x1c, 0x7d, 0x97, 0x90, 0x07, 0xe9, 0x57, 0x5c, 0xf8, 0xf9, 0x93, 0x3c,
+  0xbf, 0xcf, 0x84, 0xf4, 0x00, 0xa4, 0xe9, 0x90, 0xcc, 0x90, 0xc6, 0x42,
+  0x9a, 0xc1, 0xe8, 0x23, 0x9f, 0xc8, 0x1f, 0xc2, 0x7c, 0x06, 0xa4, 0xd9,
+  0x90, 0xee, 0xe0, 0xe8, 0xbb, 0xfd, 0x79, 0x1c, 0x7d, 0x17, 0x5b, 0x00,
+  0x29, 0x0b, 0x92, 0x8d, 0xa3, 0xef, 0xc6, 0x1d, 0x90, 0x1e, 0x84, 0xb4,
+  0x00, 0x52, 0x3e, 0xa4, 0x89, 0x90, 0x4a, 0x21, 0x2d, 0x82, 0xe4, 0x84,
+  0x54, 0x0e, 0xe9, 0x37, 0xa8, 0xd3, 0xc3, 0xd1, 0xef, 0x2b, 0x4b, 0xb0,
+  0xbc, 0x10, 0x52, 0x19, 0x24, 0x2b, 0xa4, 0xf9, 0x90, 0xc8, 0x4f, 0x47,
+  0x84, 0xbd, 0x60, 0x19, 0xca, 0x2c, 0x87, 0x74, 0x37, 0xa4, 0xc1, 0x90,
+  0xb2, 0x21, 0xe1, 0xe7, 0x73, 0x8e, 0xfc, 0x8c, 0xe0, 0x31, 0x48, 0xf7,
+  0x63, 0xf9, 0x77, 0x90, 0x86, 0x42, 0x5a, 0xc9, 0xd1, 0x77, 0x42, 0x3e,
+  0x48, 0x55, 0x90, 0x9e, 0xe0, 0xe8, 0x37, 0xc1, 0xb5, 0x90, 0x1e, 0xe1,
+  0xe8, 0xfb, 0x8a, 0xe7, 0x21, 0xd9, 0x21, 0xad, 0x82, 0xf4, 0x2c, 0x47,
+  0xdf, 0x19, 0xbc, 0xc2, 0xd1, 0x6f, 0x78, 0x35, 0x1c, 0xfd, 0xb6, 0x48,
+  0xbe, 0x23, 0xbd, 0x0a, 0x69, 0x34, 0xea, 0x7f, 0x0e, 0xd2, 0x4b, 0x5c,
+  0xf8, 0xf9, 0x9f, 0xf0, 0x21, 0x73, 0x45, 0xcf, 0xd1, 0x79, 0xa6, 0x89,
+  0xa6, 0x73, 0x9e, 0xcc, 0xd5, 0x28, 0x13, 0xa7, 0x87, 0xe2, 0xde, 0xe1,
+  0x51, 0xd1, 0xb0, 0x06, 0x87, 0xaf, 0xbf, 0xab, 0x07, 0xdd, 0x17, 0xe2,
+  0x35, 0x5c, 0x26, 0xcc, 0x9f, 0xfe, 0xb6, 0x78, 0x13, 0xec, 0x29, 0x7a,
+  0x5e, 0x18, 0x38, 0xf4, 0xaf, 0x82, 0x7b, 0xd4, 0x04, 0xae, 0x16, 0xea,
+  0x13, 0x09, 0xf6, 0x06, 0xa4, 0x15, 0x64, 0x43, 0xe9, 0x1d, 0x15, 0xab,
+  0xd5, 0xf6, 0x8c, 0xbf, 0xf6, 0xd1, 0x6b, 0x6e, 0x34, 0xdd, 0x8c, 0x48,
+  0xa7, 0x70, 0x5f, 0x61, 0xd2, 0xdc, 0xa5, 0xa9, 0x81, 0x1c, 0xf9, 0xa8,
+  0x46, 0x66, 0xe0, 0x5c, 0xfa, 0x16, 0xcb, 0xb4, 0x82, 0xb0, 0x00, 0xd9,
+  0x1a, 0xa2, 0x04, 0x66, 0x85, 0x09, 0xea, 0xf5, 0xb0, 0xf2, 0xf5, 0xb7,
+  0x6a, 0x6b, 0xf8, 0x15, 0xa9, 0x87, 0x6e, 0x4c, 0xd1, 0x9c, 0xc9, 0xc4,
+  0x09, 0xd7, 0x0a, 0x7a, 0x1b, 0x18, 0xfd, 0xb4, 0x99, 0xb0, 0x89, 0xa2,
+  0x6f, 0x8e, 0x37, 0xc6, 0x4c, 0xd4, 0xf3, 0xbd, 0x6b, 0x39, 0x7d, 0x15,
+  0x3f, 0x04, 0xd2, 0xb8, 0xff, 0x84, 0x78, 0x64, 0x00, 0x62, 0xd1, 0x5a,
+  0xd2, 0x74, 0x15, 0xb1, 0x05, 0x99, 0x83, 0x64, 0x9f, 0x1e, 0x82, 0xbe,
+  0x20, 0x73, 0x8e, 0xcc, 0x77, 0x32, 0x97, 0xb2, 0xd0, 0x7f, 0x82, 0xbf,
+  0xc8, 0x3c, 0x24, 0xf3, 0x96, 0xf8, 0x9e, 0xcc, 0x41, 0xb2, 0xc7, 0x93,
+  0xf9, 0x35, 0x0f, 0xfd, 0x44, 0xe6, 0x17, 0x99, 0x2b, 0x64, 0xdf, 0x20,
+  0x73, 0xc8, 0x8b, 0x3e, 0x27, 0x7e, 0x5e, 0x86, 0xbe, 0x15, 0xf6, 0x29,
+  0x1f, 0xfa, 0x98, 0xec, 0x9b, 0x1b, 0xd0, 0x97, 0x64, 0xdf, 0x7c, 0xef,
+  0x5d, 0xfd, 0xa3, 0x89, 0xdc, 0xe9, 0xa4, 0x25, 0xe7, 0x4e, 0x6d, 0x3b,
+  0xf3, 0x92, 0x6b, 0x6f, 0xef, 0x98, 0x71, 0x65, 0xb7, 0x9f, 0xbd, 0xaf,
+  0x6d, 0xef, 0x6b, 0xfd, 0x57, 0x9e, 0xd0, 0x0e, 0x1f, 0x30, 0x62, 0xd8,
+  0x5b, 0xc7, 0xb6, 0xf9, 0x1d, 0x73, 0x8c, 0xfb, 0x42, 0xa3, 0x16, 0x34,
+  0x7e, 0x6d, 0x73, 0x9c, 0x4f, 0x6e, 0x27, 0xb8, 0xe3, 0xbd, 0x84, 0xb8,
+  0xb2, 0xc6, 0xb8, 0xbf, 0x3e, 0xf8, 0xc4, 0xf1, 0x77, 0xfb, 0x3d, 0xbb,
+  0xfa, 0xca, 0x9f, 0x01, 0x6b, 0x00, 0x5d, 0x86, 0x1f, 0xf3, 0x2e, 0x1c,
+  0x9f, 0x12, 0x57, 0x74, 0xda, 0xb2, 0xfd, 0x0b, 0x03, 0x69, 0x1b, 0x3f,
+  0xf7, 0x8a, 0x77, 0xa7, 0x6f, 0xdc, 0xf4, 0x85, 0xa7, 0x0e, 0xff, 0xf3,
+  0xc3, 0xec, 0xa6, 0x61, 0x6f, 0x7c, 0xfc, 0x79, 0x42, 0xe5, 0xa7, 0x99,
+  0x29, 0x78, 0x3f, 0x71, 0x36, 0xb9, 0xbd, 0x0d, 0xda, 0x1e, 0xbe, 0x70,
+  0x25, 0x27, 0xb0, 0xe9, 0xec, 0x60, 0xd7, 0x26, 0xe3, 0xb1, 0xb6, 0x19,
+  0xce, 0x07, 0xe6, 0xef, 0xd9, 0x75, 0x6c, 0x04, 0xc8, 0x8c, 0xdb, 0xfa,
+  0xfe, 0x73, 0x97, 0x5f, 0x9a, 0xfe, 0x59, 0xda, 0x91, 0xe5, 0xf3, 0x5f,
+  0x2f, 0x3d, 0x36, 0xef, 0x0e, 0x68, 0xf3, 0x25, 0xd4, 0x17, 0x42, 0xfd,
+  0x57, 0x70, 0x2f, 0x82, 0xfb, 0x98, 0x29, 0xce, 0xc1, 0x9f, 0xf4, 0xfc,
+  0x4f, 0x93, 0x01, 0xe4, 0x3f, 0xbe, 0x78, 0x25, 0xe7, 0x2e, 0x90, 0x79,
+  0xc1, 0xf6, 0xab, 0x95, 0x05, 0x0f, 0x1f, 0x8f, 0x7d, 0xee, 0x50, 0xec,
+  0xf7, 0x7b, 0x93, 0xa6, 0x7f, 0xba, 0xc7, 0x3b, 0xfb, 0xe4, 0xfe, 0x1d,
+  0x9b, 0x3a, 0xde, 0x81, 0xbc, 0x1f, 0xda, 0x15, 0x43, 0xbb, 0xa9, 0x57,
+  0xde, 0x69, 0x6a, 0x72, 0xe7, 0x1e, 0xdb, 0x07, 0x98, 0x73, 0xcd, 0xac,
+  0x2b, 0x5f, 0x6c, 0xff, 0xfd, 0xc1, 0x82, 0x77, 0xfe, 0x71, 0x3c, 0x71,
+  0xca, 0xe9, 0x6d, 0xab, 0xdd, 0xc5, 0xe7, 0x72, 0x56, 0x17, 0x9c, 0xc8,
+  0x8e, 0x4a, 0x5a, 0x16, 0x38, 0x9a, 0xdd, 0xb4, 0x6d, 0xc5, 0xd6, 0x12,
+  0x52, 0xe7, 0x7c, 0xff, 0xd4, 0x36, 0xcb, 0x92, 0x98, 0x75, 0xf3, 0x93,
+  0xdf, 0x88, 0x4d, 0x31, 0x67, 0x2d, 0x32, 0x2e, 0x7a, 0xbf, 0xfe, 0x35,
+  0xa8, 0x3b, 0x7c, 0x2e, 0xb9, 0x7d, 0x0c, 0xe4, 0x8b, 0x40, 0xa6, 0x1e,
+  0xf4, 0xed, 0xad, 0x0b, 0x7d, 0xf3, 0x76, 0xe5, 0x67, 0xff, 0xb3, 0x1d,
+  0xea, 0xce, 0xc4, 0x6f, 0x8e, 0xed, 0xbb, 0xd9, 0xf6, 0xdd, 0xc5, 0xb7,
+  0x67, 0xef, 0x19, 0x07, 0x32, 0x5f, 0xcd, 0x1c, 0xfb, 0xc2, 0xa4, 0x94,
+  0x75, 0x87, 0xfa, 0x2c, 0x18, 0xfb, 0x93, 0x9f, 0x2b, 0x78, 0xf3, 0xe0,
+  0x5f, 0xd7, 0x3f, 0x5e, 0x95, 0x71, 0xae, 0xf0, 0x3c, 0xe4, 0x4b, 0xa0,
+  0xfd, 0x2e, 0x68, 0xf3, 0xfa, 0xcd, 0xbd, 0x4f, 0x9e, 0x18, 0x54, 0xb9,
+  0xb2, 0xd7, 0xa1, 0xec, 0xb5, 0xed, 0x80, 0x9b, 0xa0, 0x5d, 0x5c, 0x42,
+  0xe1, 0xa1, 0x65, 0xc1, 0xb8, 0x4f, 0xe6, 0xfd, 0xe4, 0x3f, 0xff, 0x30,
+  0xa4, 0x1c, 0xf3, 0xe7, 0x97, 0xde, 0xe5, 0xbe, 0xca, 0x7e, 0x19, 0xfc,
+  0x93, 0x0a, 0xfe, 0xd9, 0x39, 0xec, 0xbd, 0xf3, 0xfd, 0x17, 0x1f, 0x99,
+  0x47, 0xca, 0x06, 0x28, 0x3f, 0x02, 0x32, 0x01, 0x68, 0x9b, 0xfd, 0x96,
+  0xae, 0x75, 0x1a, 0xf8, 0xe9, 0xa3, 0xa6, 0x73, 0x9f, 0xee, 0x3e, 0x77,
+  0xb1, 0xed, 0x83, 0xb7, 0x5a, 0xe6, 0xe5, 0x41, 0xb9, 0x1e, 0xfc, 0xf5,
+  0x07, 0x90, 0x4d, 0x07, 0xd9, 0x83, 0x77, 0xfc, 0xa9, 0xf9, 0xc1, 0x3b,
+  0xcb, 0x46, 0xef, 0x79, 0xe5, 0xc8, 0xd9, 0xf2, 0x33, 0x51, 0x97, 0x87,
+  0x82, 0xef, 0x0e, 0x42, 0xfd, 0xb7, 0xbf, 0x3e, 0x73, 0x69, 0x26, 0xc8,
+  0x72, 0x8f, 0xf6, 0x5d, 0x39, 0x1c, 0xb0, 0xf9, 0xa0, 0xb3, 0xfe, 0xf2,
+  0x95, 0x9c, 0xcd, 0x6f, 0xce, 0xba, 0x32, 0xe6, 0x13, 0xff, 0x43, 0xc9,
+  0x47, 0x3f, 0x6f, 0xf3, 0x2f, 0xa5, 0x6b, 0xa4, 0x27, 0xce, 0x49, 0xe1,
+  0x0a, 0x30, 0x38, 0xbb, 0xa7, 0x07, 0x19, 0xfc, 0x76, 0x06, 0x3f, 0x8e,
+  0xdf, 0x05, 0x7a, 0x71, 0xe2, 0xf3, 0xb7, 0x8d, 0xc1, 0xd7, 0x30, 0xb8,
+  0x9f, 0xc1, 0xef, 0x67, 0xf0, 0x00, 0x83, 0xcf, 0x62, 0xfb, 0x65, 0xf0,
+  0xf5, 0x0c, 0x1e, 0x62, 0xf0, 0x0c, 0x06, 0xe7, 0x96, 0x86, 0xf1, 0x8d,
+  0x0c, 0xac, 0x65, 0xf0, 0x2c, 0x06, 0x8f, 0x67, 0xf0, 0xad, 0x0c, 0x9e,
+  0xc0, 0xe0, 0x13, 0x19, 0x5c, 0xcf, 0xe0, 0x6c, 0xcc, 0x32, 0x84, 0xc1,
+  0xad, 0x0c, 0x9e, 0xca, 0xe0, 0xec, 0x6f, 0x98, 0x8c, 0x0c, 0x1e, 0xc5,
+  0xe0, 0x26, 0x06, 0xef, 0xc1, 0xe0, 0x16, 0x06, 0x67, 0x7f, 0x4f, 0x96,
+  0xc7, 0xe0, 0x6c, 0x2c, 0x31, 0x97, 0xc1, 0xd9, 0x78, 0x61, 0x3e, 0x83,
+  0xf7, 0x62, 0xf0, 0x62, 0x06, 0xd7, 0x32, 0x78, 0x39, 0x83, 0xc7, 0x32,
+  0x78, 0x05, 0x83, 0xc7, 0x31, 0xf8, 0x0a, 0x06, 0xbf, 0x89, 0xc1, 0x6b,
+  0x18, 0xbc, 0x37, 0x83, 0xaf, 0x63, 0xf0, 0x3e, 0x0c, 0xbe, 0x89, 0xc1,
+  0xfb, 0x32, 0xf8, 0x16, 0x06, 0xd7, 0x31, 0xf8, 0x2e, 0x06, 0x67, 0x7f,
+  0xf7, 0xb3, 0x97, 0xc1, 0xfb, 0x31, 0x78, 0x3d, 0x83, 0xdf, 0xcc, 0xe0,
+  0x0d, 0x0c, 0x7e, 0x0b, 0x83, 0x37, 0x33, 0x38, 0x1b, 0x77, 0x1f, 0x67,
+  0x70, 0x36, 0x1e, 0x6e, 0x63, 0x70, 0x36, 0x36, 0x9b, 0x63, 0xf1, 0x7d,
+  0x6d, 0xa9, 0xba, 0xa4, 0x87, 0xac, 0xc5, 0xb7, 0x2c, 0x64, 0xa9, 0x35,
+  0x87, 0x2c, 0x3e, 0x73, 0xb0, 0xd6, 0xfc, 0x43, 0x75, 0x88, 0xd3, 0xad,
+  0x21, 0x43, 0x05, 0x2c, 0xf8, 0xbd, 0x45, 0x37, 0xb4, 0xa1, 0x23, 0x0b,
+  0x4b, 0x79, 0x67, 0x87, 0x27, 0x5a, 0xaa, 0x8f, 0x68, 0x4f, 0x36, 0x9c,
+  0x5a, 0xe6, 0x3f, 0xdd, 0x76, 0x2a, 0x25, 0x69, 0x8a, 0x9e, 0x3b, 0x55,
+  0xe6, 0x3f, 0xd3, 0x28, 0x20, 0x65, 0xfe, 0x93, 0x8f, 0x24, 0x06, 0xbf,
+  0xd7, 0xc5, 0x4f, 0x4c, 0x0c, 0x76, 0x90, 0x7e, 0x8e, 0x36, 0xfd, 0xcc,
+  0x9e, 0x2e, 0x5f, 0xbf, 0xa7, 0x96, 0xc9, 0xb2, 0x9e, 0x4e, 0x43, 0x4f,
+  0x97, 0xbb, 0xd0, 0x53, 0x3f, 0x89, 0xee, 0x8e, 0x94, 0x48, 0x9d, 0xb9,
+  0xe4, 0x9d, 0xc9, 0xbb, 0x70, 0xe8, 0xfe, 0x62, 0x0e, 0x39, 0x74, 0x4e,
+  0xf2, 0xe7, 0x09, 0xf3, 0x0f, 0xd8, 0xcb, 0x93, 0x64, 0x32, 0x58, 0xea,
+  0x05, 0x33, 0x77, 0xb4, 0xc0, 0x1f, 0xa8, 0x6a, 0x0c, 0xdc, 0x5e, 0xe5,
+  0xbf, 0x0a, 0xf9, 0xea, 0xc0, 0x13, 0xd5, 0x81, 0x04, 0xca, 0x0a, 0x90,
+  0xab, 0xcb, 0xb9, 0xaa, 0x66, 0x12, 0x1d, 0x00, 0xd1, 0x00, 0x50, 0xa9,
+  0x0e, 0x25, 0xeb, 0xd6, 0x88, 0x54, 0xac, 0xe8, 0xf0, 0xf1, 0x2a, 0x82,
+  0xfc, 0x18, 0x6e, 0xa1, 0x94, 0x03, 0xb5, 0xd6, 0xa0, 0xe5, 0x33, 0x3f,
+  0x69, 0xd4, 0x31, 0x5e, 0xa8, 0xee, 0xd0, 0xad, 0x21, 0xd1, 0x01, 0xdf,
+  0x10, 0xea, 0x93, 0x9b, 0x2d, 0xb5, 0xd6, 0x80, 0xc5, 0x67, 0xf5, 0xfb,
+  0x1a, 0xa1, 0x89, 0xdf, 0xf2, 0x59, 0x80, 0x97, 0x97, 0x10, 0x1c, 0x46,
+  0x09, 0x56, 0xf9, 0x49, 0x5f, 0xa4, 0x8f, 0x55, 0xb7, 0x89, 0x04, 0x78,
+  0x25, 0xa0, 0x0b, 0x9a, 0x92, 0x8e, 0x15, 0x4d, 0x10, 0x33, 0xcd, 0xa2,
+  0x87, 0x82, 0xd3, 0x1a, 0xd2, 0x8d, 0x6c, 0xde, 0xcb, 0x55, 0xf6, 0xd0,
+  0x3d, 0xdf, 0xa0, 0xdb, 0xdf, 0xe0, 0x33, 0x5f, 0xe2, 0x15, 0x92, 0xfd,
+  0xa0, 0x23, 0x81, 0x97, 0x07, 0x6b, 0x59, 0x6a, 0x63, 0x74, 0x56, 0x5e,
+  0x5c, 0xab, 0x7b, 0xa8, 0xb1, 0x23, 0x46, 0xc0, 0x89, 0x15, 0x03, 0x24,
+  0x17, 0x08, 0xec, 0x34, 0x13, 0x0f, 0x12, 0x1b, 0x31, 0x0a, 0xfa, 0x4b,
+  0x69, 0x05, 0x81, 0x56, 0x47, 0x34, 0xfa, 0xf0, 0x1a, 0xaf, 0x54, 0x81,
+  0xd7, 0xf7, 0xa0, 0x2f, 0x44, 0x72, 0x41, 0x52, 0x6f, 0x51, 0x72, 0xce,
+  0x19, 0x74, 0x4e, 0xe8, 0x56, 0x70, 0x05, 0xac, 0x90, 0xaa, 0xc0, 0x95,
+  0x1e, 0xc4, 0x45, 0x19, 0xc0, 0x9c, 0x6f, 0x74, 0xe0, 0x2a, 0x7f, 0xe9,
+  0x38, 0xcb, 0xc0, 0x66, 0xcb, 0x01, 0xda, 0x2a, 0x9e, 0xb3, 0xc4, 0x12,
+  0x73, 0xf8, 0x79, 0x76, 0xbd, 0x23, 0xb8, 0xeb, 0x12, 0xeb, 0x2e, 0x7f,
+  0xad, 0xf5, 0x12, 0x75, 0x97, 0x1f, 0xdd, 0x05, 0xd5, 0x2d, 0x22, 0x77,
+  0x5d, 0xe2, 0xdd, 0x05, 0x22, 0xd6, 0x36, 0xde, 0x5d, 0x6d, 0xd4, 0x5d,
+  0xfe, 0x1b, 0x70, 0x97, 0x9f, 0xba, 0xcb, 0x4f, 0x3a, 0x96, 0xbb, 0x0b,
+  0xcc, 0x12, 0xb3, 0x73, 0x92, 0x9e, 0x83, 0xbb, 0x15, 0xcc, 0x13, 0xd1,
+  0x5f, 0xe4, 0xe1, 0x86, 0x37, 0x21, 0xf8, 0x6b, 0xc1, 0x54, 0x5e, 0x5e,
+  0xeb, 0x10, 0x1c, 0x76, 0xcd, 0xb6, 0x7e, 0x92, 0xf3, 0x07, 0x7a, 0x4e,
+  0x54, 0xe7, 0xb0, 0x53, 0x65, 0xf1, 0x64, 0xa9, 0x05, 0x4f, 0xb7, 0x85,
+  0x7d, 0x45, 0x9e, 0xfa, 0x74, 0x75, 0xe6, 0x90, 0x92, 0xe3, 0x5e, 0xc5,
+  0x3a, 0x70, 0xdb, 0x72, 0xde, 0x6d, 0xe3, 0x89, 0xdb, 0x4c, 0x82, 0xdb,
+  0x04, 0xe7, 0x70, 0xba, 0x67, 0x24, 0xce, 0x71, 0x08, 0xd6, 0x6f, 0xd4,
+  0xad, 0x95, 0xe8, 0x9c, 0xda, 0xb9, 0x33, 0x68, 0x97, 0x24, 0x96, 0xef,
+  0x82, 0xe5, 0xc9, 0x29, 0x70, 0x2a, 0x65, 0x9c, 0x99, 0x6c, 0x29, 0xf1,
+  0x67, 0x4e, 0x9e, 0xf5, 0xff, 0xfd, 0x48, 0x8c, 0xee, 0x05, 0x6a, 0xef,
+  0x1f, 0xc2, 0xd6, 0x8a, 0x43, 0x33, 0xf8, 0x3b, 0x7a, 0xd0, 0x9c, 0xd0,
+  0xf4, 0x71, 0x08, 0xb1, 0xdb, 0x02, 0xfb, 0xe0, 0xe1, 0x14, 0xf6, 0xa8,
+  0x78, 0x50, 0x1f, 0xaa, 0x65, 0xdb, 0xc9, 0xac, 0x1c, 0x62, 0xac, 0x1c,
+  0x3a, 0xda, 0x84, 0x15, 0x0f, 0x5b, 0x7c, 0x21, 0x4b, 0x0c, 0x3f, 0xe4,
+  0xc1, 0x41, 0x32, 0xa5, 0x57, 0x91, 0xd3, 0xd8, 0x92, 0x7c, 0xc4, 0xe2,
+  0xf3, 0xcf, 0x6c, 0x92, 0x9f, 0x07, 0xbe, 0xc5, 0x60, 0xc6, 0x39, 0x64,
+  0xc9, 0x87, 0x74, 0xfb, 0xad, 0xc1, 0x1a, 0x6d, 0x3d, 0xaf, 0xd2, 0xf7,
+  0x61, 0x60, 0x4c, 0x0e, 0xb3, 0x11, 0xc6, 0x33, 0xf2, 0xf5, 0x51, 0x28,
+  0x91, 0x90, 0x43, 0x3b, 0xd7, 0xed, 0x0f, 0x0b, 0x9a, 0xa4, 0x8a, 0x61,
+  0x5f, 0xca, 0xf5, 0x99, 0xdb, 0x72, 0x7d, 0xd6, 0xe3, 0xc4, 0x67, 0x20,
+  0x5b, 0x63, 0x6e, 0xc5, 0x2d, 0xbb, 0xc1, 0x52, 0x3b, 0x07, 0x0c, 0x64,
+  0x0d, 0xe8, 0xf6, 0x9b, 0x5b, 0x83, 0xba, 0xbd, 0x71, 0x35, 0xe6, 0x63,
+  0x54, 0xc8, 0x7a, 0xac, 0x46, 0x0b, 0xe0, 0x31, 0xc8, 0xb5, 0x8e, 0x6e,
+  0xa6, 0x66, 0x94, 0x6f, 0xfc, 0xd8, 0x07, 0x6f, 0x15, 0x8b, 0xef, 0x03,
+  0xaa, 0xf5, 0x43, 0xbe, 0x18, 0xa8, 0x9d, 0x00, 0x53, 0x67, 0x7f, 0x43,
+  0x8d, 0xf9, 0x02, 0xe8, 0x09, 0xd6, 0x98, 0x2f, 0xd6, 0x13, 0x33, 0x4e,
+  0xf6, 0x35, 0xe2, 0xbd, 0xa1, 0x5e, 0xc3, 0xdf, 0x9b, 0xa0, 0xfa, 0xe2,
+  0x64, 0xdf, 0x61, 0xcb, 0x5a, 0xf3, 0x85, 0xb0, 0x8e, 0x5c, 0xdf, 0x89,
+  0x5c, 0xdf, 0x49, 0xaa, 0x69, 0x06, 0xd5, 0xc4, 0xbb, 0x62, 0x2f, 0x31,
+  0xe9, 0x7e, 0xf3, 0x85, 0xae, 0x71, 0xb9, 0x6a, 0x62, 0xb8, 0x5c, 0x20,
+  0x76, 0xd6, 0x34, 0xab, 0x61, 0xf4, 0xbe, 0x29, 0xcc, 0xe8, 0x75, 0xca,
+  0xe8, 0x62, 0xd7, 0x18, 0x95, 0xc9, 0x18, 0x25, 0xab, 0x62, 0x94, 0xa2,
+  0x9a, 0xd1, 0xa9, 0xf1, 0x52, 0x46, 0x03, 0x55, 0x31, 0x7a, 0x69, 0xbc,
+  0x5a, 0x46, 0x93, 0x65, 0x8c, 0x62, 0x55, 0x31, 0x8a, 0x55, 0xcd, 0xa8,
+  0xee, 0x3e, 0x29, 0xa3, 0x34, 0x55, 0x8c, 0x96, 0xde, 0xa7, 0x96, 0xd1,
+  0x60, 0x19, 0xa3, 0x81, 0xcd, 0xd5, 0xc1, 0xab, 0x6a, 0x48, 0x9d, 0xcf,
+  0x0e, 0x93, 0xda, 0x79, 0x43, 0xa4, 0xd6, 0x65, 0x77, 0xef, 0x72, 0xcb,
+  0xcb, 0x96, 0x99, 0xa9, 0x8b, 0x1b, 0xc0, 0x95, 0x71, 0xdd, 0xbb, 0xdc,
+  0x0e, 0x8d, 0x53, 0xcb, 0xa8, 0x54, 0xc6, 0x48, 0xdd, 0x72, 0x1b, 0xae,
+  0x9a, 0xd1, 0x97, 0x63, 0xbb, 0x77, 0xb9, 0x6d, 0x1e, 0xab, 0x96, 0x91,
+  0x45, 0xc6, 0x48, 0xdd, 0x72, 0xd3, 0xaa, 0x66, 0xb4, 0x7f, 0x4c, 0xb7,
+  0x2f, 0x37, 0xcf, 0x18, 0xd9, 0x72, 0x8b, 0x4c, 0x8a, 0x3f, 0xed, 0xeb,
+  0xac, 0x41, 0x87, 0x2f, 0x1c, 0x27, 0xdc, 0x3c, 0xa6, 0xb3, 0x38, 0x21,
+  0x38, 0x1a, 0xe3, 0x84, 0xba, 0x2e, 0xc4, 0x09, 0x75, 0x9c, 0xc3, 0x67,
+  0x6e, 0x11, 0x05, 0x0a, 0x75, 0x10, 0x28, 0xd4, 0x99, 0x5b, 0x82, 0x0e,
+  0xdd, 0xdb, 0x71, 0x50, 0xd9, 0x4a, 0xe5, 0xac, 0xad, 0xc0, 0x06, 0xf0,
+  0x56, 0xc8, 0xb6, 0xdc, 0x58, 0xac, 0xb0, 0x7c, 0x34, 0x09, 0x33, 0x1b,
+  0x40, 0x67, 0x3b, 0x28, 0x82, 0xd1, 0x99, 0x2f, 0x44, 0xb4, 0x67, 0x9d,
+  0xf9, 0x02, 0xb5, 0x67, 0xbb, 0xb2, 0x3d, 0xef, 0x1f, 0x1d, 0xb6, 0xe7,
+  0x1e, 0x62, 0xcf, 0x3a, 0x73, 0x7b, 0xd7, 0xd8, 0x7c, 0x67, 0x64, 0xd9,
+  0xb4, 0x13, 0x7b, 0x6b, 0x9a, 0x55, 0x71, 0xda, 0x63, 0x0c, 0x73, 0xda,
+  0x4d, 0x39, 0x75, 0x71, 0xe2, 0xfd, 0x56, 0xce, 0x29, 0x59, 0x1d, 0xa7,
+  0x01, 0xaa, 0x39, 0x1d, 0xcd, 0x92, 0x71, 0x1a, 0xa8, 0x8e, 0xd3, 0x53,
+  0x59, 0x6a, 0x39, 0x65, 0xc8, 0x39, 0xc5, 0xaa, 0xe3, 0xf4, 0x7d, 0xa6,
+  0x5a, 0x4e, 0x5b, 0x33, 0x65, 0x9c, 0xd2, 0xd4, 0x71, 0xca, 0x57, 0xcd,
+  0xa9, 0x8f, 0x9c, 0x13, 0xbf, 0x93, 0xa9, 0xa2, 0xd5, 0x9c, 0x11, 0xa6,
+  0xb5, 0xe3, 0x86, 0x68, 0x2d, 0xc9, 0xe8, 0xee, 0xa5, 0x97, 0x9e, 0x21,
+  0x33, 0x55, 0x17, 0xb7, 0x83, 0xf3, 0xe9, 0xdd, 0xbd, 0xf4, 0xb6, 0xa4,
+  0xab, 0xe5, 0x34, 0x4d, 0xce, 0x49, 0xe5, 0xd2, 0xeb, 0xad, 0x9a, 0xd3,
+  0xc1, 0x51, 0xdd, 0xbd, 0xf4, 0x2a, 0x46, 0xa9, 0xe5, 0x94, 0x24, 0xe7,
+  0xa4, 0x72, 0xe9, 0xb5, 0x1b, 0xd4, 0x72, 0x5a, 0x6f, 0xf8, 0x05, 0x96,
+  0x9e, 0xd5, 0x20, 0x5b, 0x7a, 0x91, 0x69, 0x91, 0xf6, 0xb5, 0xd6, 0x20,
+  0x13, 0x43, 0xb4, 0xa6, 0x75, 0x16, 0x43, 0xbc, 0x91, 0x46, 0x63, 0x88,
+  0xda, 0x9f, 0x1f, 0x42, 0xd4, 0x72, 0x3e, 0x73, 0x33, 0x1b, 0x40, 0xd4,
+  0x5a, 0x03, 0xb5, 0xe6, 0xe6, 0x20, 0x44, 0x0f, 0x34, 0xb2, 0x08, 0xd6,
+  0x5a, 0x5b, 0x7c, 0xda, 0x5a, 0x73, 0x4b, 0xad, 0xb5, 0xf9, 0xc6, 0x02,
+  0x07, 0x07, 0xb0, 0xe2, 0x5f, 0x42, 0x05, 0xc1, 0x9a, 0x91, 0x8c, 0x57,
+  0x6b, 0x6e, 0xa7, 0xb6, 0xf3, 0x2b, 0xdb, 0x2e, 0x2d, 0x2d, 0x6c, 0xbb,
+  0x77, 0xc0, 0x76, 0xd2, 0xd7, 0x79, 0x9d, 0xb2, 0xf0, 0xa7, 0x22, 0x0b,
+  0x7f, 0x2d, 0xd9, 0xaf, 0x54, 0x50, 0xd9, 0x91, 0x1a, 0xa6, 0xf2, 0x26,
+  0x4f, 0xa5, 0x8b, 0x93, 0x6b, 0x0e, 0x4b, 0x25, 0x59, 0x0d, 0x95, 0x01,
+  0x6a, 0xa9, 0x7c, 0x34, 0x92, 0xa1, 0x32, 0x50, 0x0d, 0x95, 0x75, 0x23,
+  0x55, 0x52, 0x19, 0xcf, 0x52, 0x89, 0x55, 0x43, 0x25, 0x46, 0x2d, 0x95,
+  0x7d, 0x23, 0x18, 0x2a, 0x69, 0x6a, 0xa8, 0x54, 0x8e, 0x50, 0x49, 0x25,
+  0x79, 0x84, 0xc8, 0x41, 0xb0, 0x05, 0xa9, 0x60, 0x73, 0x29, 0x45, 0xfc,
+  0x6c, 0xd5, 0x65, 0x36, 0x2f, 0xa5, 0x74, 0xd7, 0x22, 0xb2, 0xa5, 0x48,
+  0x0d, 0xd3, 0xc5, 0xf5, 0x1c, 0x9f, 0xd2, 0x5d, 0x8b, 0xe8, 0x2f, 0xc3,
+  0x55, 0x52, 0x79, 0x72, 0x78, 0x77, 0x2d, 0xa2, 0xa9, 0x6a, 0xa9, 0xfc,
+  0x73, 0x58, 0x77, 0x2d, 0xa2, 0x86, 0x61, 0x2a, 0xa9, 0xb8, 0x86, 0x75,
+  0xd7, 0x22, 0xca, 0x50, 0x4b, 0xa5, 0x7d, 0x68, 0x37, 0x2e, 0xa2, 0x9d,
+  0x43, 0xa5, 0x8b, 0x28, 0x32, 0x1b, 0xbe, 0x39, 0xf9, 0xd6, 0xc3, 0x1c,
+  0xe3, 0xbd, 0x86, 0x76, 0x76, 0x8c, 0x7f, 0x9d, 0x4c, 0x8f, 0x71, 0x0b,
+  0x73, 0x8e, 0xe7, 0x49, 0x35, 0x4b, 0xce, 0x71, 0x90, 0xa5, 0x27, 0x38,
+  0x7f, 0x92, 0xd7, 0xc3, 0x49, 0x5e, 0xcf, 0x7f, 0xac, 0xac, 0x35, 0x37,
+  0x04, 0x2d, 0x70, 0x98, 0x5b, 0xe8, 0x31, 0x0f, 0x72, 0xd6, 0x66, 0x60,
+  0x03, 0x59, 0xf2, 0x55, 0xa7, 0xc1, 0x22, 0x3b, 0xd2, 0x53, 0x7f, 0x8e,
+  0x41, 0xdf, 0x4d, 0xe6, 0x3f, 0x71, 0xb5, 0x09, 0x1f, 0x98, 0x22, 0xd9,
+  0x92, 0x7c, 0xfb, 0xa1, 0xc6, 0x6c, 0x8b, 0xb0, 0x3f, 0x26, 0x8b, 0x5f,
+  0x04, 0x90, 0xef, 0x4b, 0x5d, 0xa3, 0x32, 0x24, 0x4c, 0xa5, 0x8d, 0x37,
+  0xb5, 0xa6, 0x59, 0x15, 0xa3, 0xc0, 0x90, 0x30, 0xa3, 0x5d, 0x94, 0x91,
+  0xbf, 0x6b, 0x8c, 0x36, 0x0e, 0x91, 0x30, 0x4a, 0x56, 0xc7, 0xe8, 0x41,
+  0xd5, 0x8c, 0xa2, 0xa5, 0x8c, 0x06, 0xaa, 0x63, 0x74, 0xe4, 0x5e, 0xb5,
+  0x8c, 0xdc, 0xf7, 0x4a, 0x18, 0xc5, 0xaa, 0x63, 0x64, 0x50, 0xcd, 0xc8,
+  0x9f, 0x24, 0x61, 0x94, 0xa6, 0x8e, 0xd1, 0x96, 0x24, 0xb5, 0x8c, 0xa6,
+  0x49, 0x19, 0x81, 0xd7, 0x60, 0xeb, 0x52, 0xc5, 0x2a, 0x8e, 0x61, 0xb5,
+  0xfd, 0x86, 0x58, 0xd5, 0x0f, 0xee, 0xde, 0xf5, 0x56, 0x31, 0x58, 0x66,
+  0xa7, 0x2e, 0xee, 0x00, 0x49, 0x52, 0x46, 0x2a, 0xd7, 0xdb, 0x85, 0x44,
+  0xb5, 0x8c, 0x5e, 0x48, 0xec, 0xde, 0xf5, 0x36, 0x5b, 0x35, 0xa3, 0x28,
+  0x29, 0x23, 0x95, 0xeb, 0xed, 0xf0, 0x3d, 0x6a, 0x19, 0x95, 0xdf, 0xd3,
+  0xbd, 0xeb, 0x2d, 0x55, 0x35, 0xa3, 0x33, 0x83, 0xba, 0x7f, 0xbd, 0x6d,
+  0x1e, 0x24, 0x5b, 0x6f, 0x6d, 0xb2, 0xc3, 0x5f, 0x06, 0x04, 0x2d, 0xd5,
+  0xbd, 0x13, 0x15, 0x7e, 0xc3, 0x05, 0xec, 0x3b, 0xc8, 0xff, 0xab, 0xe0,
+  0xbb, 0xaf, 0x31, 0x7f, 0xdb, 0x61, 0x67, 0x0b, 0x73, 0xd9, 0xc2, 0x54,
+  0xb6, 0x40, 0x7e, 0xa3, 0xcf, 0xf3, 0x21, 0x05, 0xf2, 0xc3, 0x7f, 0x9e,
+  0x69, 0x75, 0x48, 0xa3, 0x5b, 0xf5, 0x36, 0x21, 0x55, 0x1d, 0x8a, 0xd2,
+  0xad, 0xda, 0x47, 0x73, 0xd1, 0xba, 0x55, 0x75, 0x34, 0xa7, 0xd5, 0xad,
+  0x3a, 0x08, 0xb9, 0x8e, 0xc3, 0xe4, 0x55, 0xc5, 0x21, 0xf3, 0xb7, 0x47,
+  0x9b, 0x78, 0x85, 0xab, 0x7b, 0x35, 0xa5, 0x35, 0xc0, 0x1f, 0xee, 0xda,
+  0xef, 0x24, 0x04, 0xda, 0x7c, 0x17, 0xb5, 0xd6, 0x50, 0x72, 0x33, 0xfc,
+  0x19, 0xd8, 0x58, 0x9f, 0xf6, 0xef, 0x8f, 0xf7, 0xd2, 0xed, 0x69, 0x6e,
+  0xec, 0x18, 0x60, 0x59, 0x1b, 0x53, 0x7c, 0x8f, 0x9e, 0x83, 0xbd, 0x02,
+  0x6a, 0xaa, 0x7f, 0xe2, 0x74, 0x1b, 0x1a, 0x75, 0xfb, 0x8f, 0xea, 0xf6,
+  0x73, 0x9a, 0x66, 0x79, 0x28, 0xc4, 0xab, 0xe1, 0x1d, 0x44, 0x7f, 0xbf,
+  0xc1, 0xdf, 0x06, 0x36, 0x5a, 0xea, 0xcb, 0x8c, 0x1b, 0x5a, 0x0a, 0x4f,
+  0x8f, 0x8c, 0xb2, 0x80, 0x52, 0x4b, 0x63, 0xc7, 0x18, 0xd0, 0x3a, 0x93,
+  0x6a, 0xe5, 0x45, 0x3a, 0xd1, 0x0b, 0x43, 0x6e, 0x0c, 0x68, 0x40, 0x30,
+  0xb6, 0xd1, 0x67, 0xa5, 0xa5, 0x28, 0x51, 0x29, 0x5a, 0x54, 0xd2, 0x8a,
+  0x4a, 0xf1, 0x4c, 0xe9, 0xc0, 0xe9, 0x37, 0x8e, 0xc0, 0xb8, 0x1a, 0x1b,
+  0x03, 0x30, 0xae, 0x3e, 0x7b, 0x07, 0x11, 0x06, 0xd0, 0x6d, 0xac, 0x4f,
+  0x61, 0x2c, 0xc4, 0xce, 0xd0, 0x2b, 0xcf, 0x2f, 0xb6, 0x11, 0x82, 0x36,
+  0x01, 0x8a, 0x92, 0x43, 0xd1, 0x72, 0x48, 0x2b, 0x87, 0xe2, 0xe5, 0x90,
+  0x5e, 0x0a, 0x1d, 0xf0, 0xc5, 0x7d, 0xbc, 0x6f, 0xd1, 0x2b, 0xff, 0xe8,
+  0x01, 0x96, 0x6a, 0x04, 0x01, 0xb0, 0x54, 0x9f, 0xe2, 0xeb, 0xf1, 0xbc,
+  0xae, 0xe7, 0xde, 0x1a, 0xc8, 0xdb, 0x98, 0xfd, 0x01, 0xcb, 0x0d, 0xf9,
+  0x6a, 0x47, 0x64, 0x3d, 0xb5, 0xf4, 0x97, 0x4d, 0x6b, 0xc9, 0x8f, 0x59,
+  0x49, 0x9e, 0x04, 0xe8, 0xbc, 0xe1, 0xfd, 0x1a, 0xcc, 0x84, 0x44, 0x9e,
+  0x0b, 0x89, 0x3c, 0x17, 0x12, 0x79, 0x2e, 0x24, 0xf2, 0x5c, 0x28, 0xb2,
+  0xe7, 0xfe, 0xae, 0xef, 0xcc, 0x73, 0x3c, 0xa7, 0xde, 0xd7, 0xd6, 0x0b,
+  0xbf, 0x17, 0xa0, 0xd1, 0xfd, 0x9a, 0x70, 0x3e, 0x24, 0xf7, 0x6f, 0x48,
+  0xee, 0xdf, 0x90, 0xdc, 0xbf, 0x21, 0xb9, 0x7f, 0x43, 0x72, 0xff, 0x86,
+  0x7e, 0x96, 0x7f, 0x6b, 0xae, 0x37, 0x1a, 0x3a, 0xf7, 0xab, 0xfc, 0x73,
+  0xe0, 0x22, 0x6e, 0x46, 0x7b, 0x54, 0xf9, 0x47, 0xc1, 0x05, 0x40, 0x63,
+  0x47, 0x54, 0xd5, 0x39, 0x92, 0x27, 0xcf, 0xf4, 0xe1, 0xd5, 0xa0, 0x69,
+  0xac, 0x3a, 0xa7, 0x83, 0x0b, 0xad, 0xa7, 0x81, 0x8b, 0xb7, 0x5e, 0x42,
+  0xb5, 0x7f, 0x7c, 0xe4, 0xb9, 0x7e, 0x60, 0x0e, 0x5e, 0x64, 0x03, 0xe5,
+  0xa7, 0x05, 0xc3, 0x7c, 0x14, 0x5e, 0x42, 0x1d, 0xf4, 0x6c, 0x39, 0x18,
+  0x06, 0x3f, 0xa5, 0xe1, 0x84, 0x78, 0x49, 0x68, 0x60, 0x3e, 0xe9, 0xf0,
+  0x22, 0x93, 0xeb, 0x9a, 0x32, 0x0d, 0x5e, 0x68, 0x06, 0xa3, 0xa5, 0xda,
+  0xbf, 0x1c, 0x5c, 0xa3, 0x27, 0x6b, 0xe2, 0x5f, 0x60, 0x03, 0xcd, 0xff,
+  0x51, 0x1b, 0x68, 0xc2, 0x36, 0xa0, 0x8b, 0x53, 0x72, 0x0a, 0xf2, 0xdb,
+  0xb8, 0xc3, 0x67, 0x3e, 0xce, 0xaf, 0x5e, 0xc8, 0x9c, 0x60, 0xd6, 0x31,
+  0x39, 0x00, 0xd9, 0x92, 0x3f, 0x70, 0x61, 0x00, 0x79, 0x7a, 0xfe, 0xdf,
+  0xf6, 0x8e, 0x36, 0xb6, 0xad, 0xea, 0xfa, 0xec, 0xd8, 0x89, 0x93, 0x38,
+  0xb1, 0x9d, 0xa4, 0xf9, 0x68, 0xd2, 0xf4, 0x95, 0xd6, 0x94, 0xa6, 0x90,
+  0x86, 0xd2, 0x96, 0x36, 0xa5, 0x69, 0xc6, 0x96, 0xe2, 0xb1, 0x19, 0x2a,
+  0x44, 0x25, 0xe8, 0x58, 0xd5, 0x36, 0x4a, 0xd7, 0x4e, 0x21, 0xed, 0xf2,
+  0x81, 0x28, 0xa0, 0x12, 0x70, 0x5c, 0x9a, 0xbe, 0x19, 0x45, 0x28, 0x48,
+  0xd1, 0x3e, 0x58, 0x98, 0xfa, 0xa3, 0x63, 0x11, 0xcb, 0x90, 0x40, 0x5e,
+  0x35, 0x75, 0x71, 0xd1, 0x68, 0x61, 0x02, 0x02, 0x48, 0x2c, 0x30, 0x84,
+  0x52, 0xd6, 0x89, 0xf7, 0x96, 0x0e, 0x65, 0xa5, 0x4c, 0x81, 0x8e, 0x64,
+  0xf7, 0x9c, 0x7b, 0xee, 0xfb, 0xb2, 0x9d, 0x14, 0x7e, 0x4c, 0xd3, 0xf4,
+  0xee, 0x0f, 0x1f, 0x9f, 0xf7, 0xee, 0x3d, 0x1f, 0xf7, 0x9c, 0x7b, 0xce,
+  0xbd, 0xd7, 0xcf, 0xf7, 0xa9, 0xc9, 0x97, 0x5c, 0x90, 0xf3, 0xce, 0x24,
+  0x6f, 0xb5, 0xe4, 0x4e, 0x96, 0xed, 0x78, 0xaa, 0x7b, 0x13, 0xab, 0x89,
+  0x47, 0x7f, 0xed, 0x0f, 0x14, 0xc2, 0x5f, 0x19, 0x59, 0x9a, 0x1c, 0x07,
+  0x02, 0x79, 0x9c, 0x00, 0xab, 0x69, 0x6e, 0xff, 0x8b, 0x6a, 0xd3, 0x93,
+  0x84, 0xea, 0xb3, 0xd5, 0xf0, 0xf7, 0x29, 0x48, 0x47, 0x71, 0x7c, 0xb2,
+  0x6f, 0x0c, 0x72, 0x52, 0xc2, 0xfb, 0xd1, 0x12, 0xd9, 0x68, 0xaa, 0xfe,
+  0xb8, 0x3a, 0xd3, 0x93, 0xce, 0x90, 0xe3, 0xcd, 0x1a, 0xa8, 0xb0, 0x48,
+  0x6d, 0x1d, 0x13, 0xdd, 0x88, 0x86, 0x9c, 0xee, 0x4f, 0xc5, 0xc6, 0x58,
+  0x90, 0x99, 0x86, 0xa4, 0xd1, 0x27, 0xf3, 0x21, 0xae, 0xb2, 0x7e, 0xe3,
+  0x23, 0x32, 0x96, 0x9a, 0x83, 0x7a, 0x6c, 0x30, 0xf1, 0x89, 0x92, 0x3a,
+  0x05, 0x5b, 0xe1, 0x6a, 0x66, 0x5e, 0x7c, 0xc9, 0xad, 0x8a, 0xb5, 0x30,
+  0x12, 0x8a, 0x8d, 0xf9, 0xf0, 0x11, 0xc8, 0x58, 0xca, 0xa7, 0x48, 0x4a,
+  0x3e, 0x5b, 0x65, 0x1f, 0x45, 0x35, 0xd6, 0x0b, 0x4e, 0xe9, 0x15, 0x62,
+  0xfa, 0x93, 0x8f, 0x28, 0x3c, 0x3e, 0x5a, 0x9a, 0x84, 0x07, 0x6e, 0xf9,
+  0x37, 0xb0, 0xd9, 0xd5, 0xf3, 0x67, 0xa4, 0x2d, 0x7c, 0xfb, 0x05, 0x5f,
+  0xe3, 0x06, 0xe7, 0xb7, 0x2f, 0x83, 0x40, 0xb0, 0x97, 0xa0, 0xe4, 0x47,
+  0xf4, 0x3a, 0x1b, 0xe7, 0xad, 0x73, 0x74, 0x61, 0xb9, 0xe7, 0xd5, 0x65,
+  0xc0, 0x3c, 0x76, 0x40, 0x7e, 0xab, 0x2f, 0x62, 0xe4, 0x1d, 0xf3, 0x88,
+  0x01, 0xc1, 0xb2, 0x07, 0x3a, 0xc9, 0x3f, 0xbc, 0x14, 0x95, 0xf9, 0xbe,
+  0xc6, 0x39, 0x70, 0x87, 0x44, 0x95, 0x24, 0x36, 0x41, 0xd8, 0x74, 0xac,
+  0x05, 0xf6, 0x45, 0xc6, 0x31, 0x86, 0xf7, 0x6d, 0xe1, 0x1a, 0x8c, 0xf3,
+  0xad, 0x11, 0xa8, 0x0d, 0xee, 0x9b, 0xc4, 0x4d, 0x93, 0xb3, 0x6a, 0x5b,
+  0x15, 0xf7, 0x3c, 0xee, 0x69, 0x21, 0x51, 0x37, 0x36, 0x56, 0xc9, 0x77,
+  0x55, 0xc6, 0xa7, 0x5e, 0xd4, 0x49, 0xc5, 0x3f, 0x47, 0xbf, 0x96, 0x75,
+  0x11, 0xcf, 0xaa, 0x1b, 0x38, 0x5b, 0x83, 0x5d, 0xbc, 0x0e, 0x9d, 0xdd,
+  0xbb, 0xb1, 0x5a, 0xe6, 0x03, 0xc5, 0xbb, 0x79, 0x29, 0xfb, 0x86, 0xcc,
+  0xb8, 0xaf, 0x97, 0x56, 0x21, 0x8f, 0x09, 0xed, 0xb6, 0x5c, 0x62, 0xa6,
+  0x6f, 0xcb, 0x00, 0x5f, 0x1f, 0x3e, 0x5d, 0xad, 0xa3, 0x7e, 0x2b, 0x1a,
+  0x14, 0x0f, 0x5f, 0x03, 0x5b, 0x9f, 0x2e, 0xaa, 0xed, 0xe2, 0x04, 0x17,
+  0xa5, 0xc8, 0xd0, 0x7c, 0x42, 0xa3, 0x6e, 0x80, 0xce, 0x19, 0x65, 0x70,
+  0x54, 0xa8, 0x88, 0x7d, 0x44, 0x7a, 0x8f, 0x1a, 0x7a, 0x8f, 0x4e, 0xbd,
+  0x6f, 0x5c, 0x88, 0x8e, 0x73, 0xba, 0x63, 0x0c, 0x75, 0x99, 0xc6, 0x92,
+  0xd9, 0x28, 0xdf, 0xf2, 0xe8, 0x46, 0x19, 0x66, 0x70, 0x18, 0x7a, 0x67,
+  0xa6, 0x82, 0x5d, 0x4b, 0x6f, 0x22, 0x1e, 0x10, 0x36, 0xa4, 0x66, 0x11,
+  0x32, 0x76, 0x3e, 0x0f, 0xef, 0xf1, 0xf8, 0x87, 0x5d, 0xd5, 0xdf, 0x32,
+  0x22, 0x3a, 0x45, 0x89, 0x8e, 0x28, 0xd2, 0xa6, 0x54, 0x20, 0x06, 0x7f,
+  0xd9, 0xd3, 0x40, 0x31, 0xa5, 0x65, 0x04, 0xc6, 0x31, 0x9b, 0x23, 0x8c,
+  0x4c, 0xbd, 0x27, 0x7a, 0x87, 0x55, 0x8b, 0xb4, 0xbe, 0x1a, 0x49, 0x9d,
+  0xf7, 0x82, 0x16, 0x48, 0x6a, 0x88, 0xdd, 0x1b, 0x22, 0xdb, 0x0f, 0x5b,
+  0x6d, 0x7f, 0xa0, 0xc2, 0x6c, 0x7b, 0xd8, 0x81, 0x9b, 0xfa, 0x95, 0x9d,
+  0x61, 0xfc, 0xa8, 0x4b, 0x77, 0x09, 0x1f, 0xf6, 0x44, 0x2c, 0xe5, 0xa7,
+  0x51, 0xf4, 0xf8, 0x59, 0xc3, 0x5d, 0xfc, 0xfa, 0xbd, 0x7c, 0x16, 0x56,
+  0x80, 0x1f, 0x91, 0x2d, 0x31, 0xd5, 0x51, 0x24, 0x36, 0x77, 0xe0, 0xc3,
+  0x80, 0x3f, 0x97, 0x1c, 0x4d, 0xf6, 0xbb, 0x74, 0xcb, 0x72, 0x02, 0x0c,
+  0xee, 0x60, 0xf0, 0x8c, 0x5f, 0x29, 0x89, 0xa4, 0x3e, 0xf2, 0xa2, 0xe4,
+  0xfd, 0xd1, 0x01, 0xb6, 0x72, 0x39, 0xc6, 0x6a, 0x1e, 0xe3, 0x1a, 0x0c,
+  0x90, 0x06, 0x7f, 0x2e, 0xe7, 0x54, 0x22, 0x66, 0x32, 0x92, 0xc5, 0x11,
+  0xff, 0x54, 0x29, 0x1c, 0xf1, 0x85, 0x1a, 0xab, 0x23, 0x1e, 0x2f, 0x27,
+  0x47, 0x3c, 0x9d, 0xa3, 0x8b, 0x28, 0xa4, 0xf0, 0x31, 0x9e, 0x49, 0x25,
+  0xbf, 0xff, 0xb5, 0x58, 0x0a, 0x26, 0x3b, 0x03, 0xd0, 0x6b, 0xcc, 0x05,
+  0x40, 0x20, 0xe2, 0xee, 0x1a, 0xd7, 0x3b, 0x57, 0x89, 0x0e, 0x73, 0xff,
+  0x18, 0xc2, 0x4e, 0x62, 0x12, 0x27, 0x7d, 0x96, 0x3c, 0xa1, 0xee, 0xf8,
+  0x82, 0x45, 0x70, 0x4a, 0x4c, 0xba, 0xd6, 0x43, 0x56, 0xf7, 0x06, 0x34,
+  0x68, 0x45, 0xd3, 0x1c, 0x7b, 0x86, 0x18, 0x58, 0x3c, 0xef, 0x25, 0x6e,
+  0xa1, 0x21, 0xb2, 0xc2, 0x10, 0x74, 0xa2, 0xcd, 0x42, 0x43, 0xa4, 0x1a,
+  0xbf, 0x97, 0xd9, 0x42, 0x58, 0x27, 0x9b, 0x85, 0x86, 0x68, 0x20, 0x00,
+  0x01, 0x06, 0x77, 0x30, 0x78, 0x26, 0x88, 0x16, 0xf2, 0xcc, 0x6f, 0xa1,
+  0xf5, 0x8b, 0xcc, 0x16, 0x1a, 0x32, 0x8f, 0x3a, 0x61, 0xa1, 0x6d, 0x15,
+  0xc2, 0x42, 0xc1, 0x6a, 0xab, 0x85, 0xd4, 0x32, 0xb2, 0x50, 0x8d, 0x5b,
+  0x17, 0x51, 0x48, 0xe1, 0xcf, 0x66, 0x21, 0x8f, 0xc5, 0x42, 0xbd, 0x76,
+  0x53, 0xbc, 0x36, 0xc3, 0x4c, 0xd1, 0x1f, 0x7f, 0x90, 0x2f, 0x48, 0x7b,
+  0x23, 0x4a, 0x02, 0xbf, 0xa6, 0x34, 0x5f, 0xe4, 0xb1, 0xf3, 0xb0, 0xda,
+  0x63, 0xa3, 0x87, 0xd9, 0x49, 0x93, 0xb1, 0xc3, 0x7b, 0x31, 0xfe, 0xea,
+  0x75, 0x56, 0xa4, 0xdd, 0x14, 0x39, 0xd3, 0x27, 0xba, 0xc1, 0xc4, 0x6f,
+  0x00, 0xf8, 0xed, 0x04, 0x7e, 0x7a, 0x07, 0xcc, 0xa0, 0x21, 0x98, 0x01,
+  0xb5, 0xc6, 0x59, 0x14, 0x80, 0xc9, 0x94, 0xc2, 0x10, 0x01, 0xd7, 0x46,
+  0xae, 0xa4, 0x5f, 0xcb, 0xf9, 0x82, 0xaf, 0x9c, 0xad, 0x41, 0x3d, 0xcf,
+  0x95, 0xee, 0xb2, 0x2c, 0x25, 0x09, 0x53, 0x24, 0xbc, 0x77, 0x32, 0xb6,
+  0xb0, 0x48, 0xd7, 0xa3, 0x35, 0x2c, 0xd5, 0x51, 0x24, 0x53, 0x04, 0xe0,
+  0xab, 0x75, 0xf5, 0xd9, 0x52, 0xca, 0x5f, 0x6c, 0x0a, 0x63, 0x8c, 0xff,
+  0xcb, 0x3c, 0xe0, 0xf4, 0x1b, 0x01, 0xe7, 0x32, 0x05, 0x9c, 0xcb, 0xe6,
+  0x80, 0x73, 0xd9, 0x16, 0x70, 0xe2, 0x87, 0xb0, 0x67, 0x39, 0x40, 0x73,
+  0x25, 0xf8, 0x57, 0x08, 0x0d, 0x26, 0x01, 0xeb, 0x85, 0x80, 0xc1, 0x85,
+  0x05, 0x84, 0x3f, 0xbe, 0x69, 0x8f, 0x70, 0x8b, 0x99, 0x73, 0x93, 0x36,
+  0x35, 0x6b, 0xdb, 0x56, 0x18, 0x58, 0x69, 0xdd, 0xec, 0x80, 0xd4, 0xfd,
+  0x3b, 0x97, 0x18, 0x53, 0xf4, 0x87, 0x12, 0xf4, 0xfa, 0x5a, 0x1e, 0xaf,
+  0xa7, 0x61, 0x52, 0x16, 0x5c, 0xc9, 0x4d, 0x96, 0x88, 0x9f, 0x9b, 0x00,
+  0xef, 0x00, 0xbe, 0xea, 0x4f, 0x4b, 0x24, 0xca, 0x0e, 0xf0, 0x17, 0xfb,
+  0x64, 0xa3, 0x64, 0xab, 0xa3, 0x1e, 0x2f, 0xa1, 0x34, 0x8d, 0x95, 0xbe,
+  0x2b, 0xf2, 0x0b, 0x1a, 0x2e, 0x3e, 0x06, 0x95, 0x12, 0xf4, 0x73, 0x8a,
+  0xb7, 0xb7, 0x8c, 0x5c, 0x9c, 0x5f, 0x37, 0xcd, 0xfc, 0x76, 0x94, 0x40,
+  0x0c, 0x76, 0x05, 0xe2, 0xb4, 0xd4, 0x52, 0x95, 0xe8, 0x05, 0xe6, 0xd1,
+  0x62, 0xb4, 0x03, 0xe5, 0xee, 0x1c, 0x91, 0x59, 0x78, 0x6b, 0x22, 0xc2,
+  0xc7, 0xd7, 0xd3, 0x21, 0x10, 0x22, 0x3e, 0x8a, 0x57, 0xe6, 0xd1, 0xe6,
+  0xf5, 0x90, 0xd0, 0x66, 0x15, 0x1f, 0x75, 0xd3, 0xa5, 0xb2, 0x4d, 0x9f,
+  0xf7, 0x43, 0x26, 0x7d, 0xe2, 0x98, 0x0e, 0x46, 0x58, 0xc5, 0x37, 0xd3,
+  0x2a, 0xfe, 0xd6, 0x5c, 0xb1, 0xef, 0x28, 0xa7, 0x37, 0x8a, 0xd5, 0xce,
+  0xaa, 0x9e, 0x10, 0x0e, 0xf8, 0x09, 0xc8, 0x77, 0x28, 0x74, 0x82, 0xab,
+  0x1c, 0x3f, 0xc9, 0x65, 0x07, 0x49, 0xd1, 0xd4, 0x74, 0x21, 0xad, 0x5f,
+  0xd4, 0xbd, 0x21, 0x4a, 0x4b, 0xd7, 0x73, 0xca, 0xbb, 0x88, 0xf2, 0x73,
+  0x41, 0xa0, 0x9c, 0x40, 0x55, 0x71, 0xdb, 0x03, 0x78, 0x04, 0x4e, 0xb3,
+  0x68, 0x26, 0xd3, 0x5f, 0x60, 0x6e, 0x77, 0x0b, 0x47, 0x8e, 0xff, 0x7e,
+  0x82, 0x86, 0x12, 0xf8, 0x72, 0x02, 0x30, 0xee, 0xce, 0xa5, 0xac, 0x8a,
+  0x06, 0xff, 0xc6, 0x52, 0xb0, 0x0a, 0xf7, 0x68, 0xfc, 0x3a, 0x35, 0x2e,
+  0xc6, 0x27, 0xaf, 0x6f, 0xf7, 0xeb, 0x21, 0x76, 0x8d, 0x88, 0x0f, 0x1a,
+  0x5f, 0x07, 0x8c, 0xaf, 0x27, 0xb8, 0x82, 0x50, 0x0f, 0x93, 0x5d, 0xe2,
+  0x84, 0xce, 0x75, 0xc8, 0xa5, 0x73, 0x3d, 0x61, 0x70, 0x85, 0xaf, 0x53,
+  0xaf, 0x1b, 0x4d, 0x2a, 0x79, 0x13, 0xce, 0xd8, 0xa3, 0x33, 0x3e, 0xc6,
+  0xe9, 0x1e, 0x43, 0x6a, 0xfd, 0xf1, 0x3e, 0x80, 0xc8, 0x57, 0x49, 0xc0,
+  0x77, 0x98, 0xaa, 0x9e, 0x90, 0x16, 0x70, 0xe6, 0x37, 0x02, 0xc2, 0xfc,
+  0x87, 0x33, 0x3b, 0xf3, 0x97, 0x01, 0xb3, 0x4d, 0xef, 0xcc, 0xe4, 0xcc,
+  0xf1, 0x6e, 0x32, 0x5d, 0xc2, 0xfb, 0x4e, 0x28, 0x9b, 0x3f, 0xc3, 0x1f,
+  0xb4, 0x74, 0x7f, 0x56, 0xb0, 0x09, 0xef, 0x24, 0x2d, 0x82, 0xab, 0x98,
+  0x78, 0xd7, 0x04, 0x1f, 0xf7, 0x89, 0xf8, 0x83, 0x3a, 0xb9, 0x27, 0x42,
+  0x72, 0x9a, 0xc8, 0xfa, 0x36, 0xe2, 0x4d, 0x48, 0xd1, 0x1d, 0x88, 0xdf,
+  0x81, 0x14, 0xa1, 0xef, 0xd1, 0x3b, 0xd0, 0x8f, 0x79, 0xb7, 0xf0, 0xac,
+  0xa8, 0x0f, 0x0b, 0x16, 0xae, 0x85, 0x8f, 0x90, 0xf3, 0xb9, 0x02, 0xa7,
+  0x91, 0x71, 0x6c, 0xa6, 0x8e, 0xfe, 0x71, 0x85, 0x74, 0xb4, 0xfb, 0x59,
+  0xfc, 0xd0, 0x2e, 0x7d, 0xa9, 0xbb, 0x0a, 0x05, 0x96, 0x19, 0xed, 0xc8,
+  0xbf, 0xe7, 0xe6, 0xf4, 0xa0, 0x32, 0x46, 0x41, 0x85, 0x7e, 0xc6, 0xd4,
+  0x53, 0xc9, 0xa3, 0x97, 0x30, 0xb4, 0xd3, 0xd4, 0x8e, 0x47, 0x67, 0x88,
+  0x0b, 0xff, 0x04, 0x96, 0x34, 0x35, 0x47, 0x51, 0x1b, 0x68, 0x0e, 0xc4,
+  0xb5, 0x7d, 0x36, 0x28, 0xf2, 0x9d, 0x5c, 0x26, 0xf2, 0x9d, 0xde, 0x7f,
+  0x9f, 0xb1, 0x50, 0xab, 0xfd, 0xa8, 0x40, 0x8c, 0xf8, 0xb3, 0xea, 0xdb,
+  0x9f, 0x22, 0xb5, 0x24, 0x0b, 0x26, 0x1f, 0xf0, 0x10, 0xa9, 0xcf, 0xe0,
+  0xb9, 0x69, 0xdd, 0x57, 0xc8, 0x03, 0xe1, 0xae, 0x69, 0xfd, 0xf0, 0x0a,
+  0x2d, 0x0d, 0xa0, 0xce, 0x9a, 0x62, 0x88, 0xdf, 0x1f, 0x70, 0xfe, 0xb7,
+  0x0a, 0xfe, 0xe2, 0x36, 0xe7, 0xfc, 0x70, 0x91, 0x9e, 0x05, 0x2e, 0x12,
+  0x54, 0x09, 0x5e, 0x20, 0x38, 0xc9, 0xd9, 0x8a, 0x09, 0x34, 0x78, 0xca,
+  0xc7, 0x98, 0x19, 0x2e, 0x52, 0x66, 0xb8, 0x68, 0x4a, 0x23, 0xa3, 0x96,
+  0x34, 0xf2, 0xeb, 0x6c, 0x69, 0x64, 0x34, 0x73, 0x1a, 0x69, 0x39, 0xc9,
+  0x62, 0x21, 0x55, 0x14, 0x62, 0xc0, 0x72, 0xef, 0x24, 0x0e, 0xad, 0xe8,
+  0x34, 0xa7, 0xba, 0xdd, 0xa0, 0x3a, 0x4d, 0x95, 0xa7, 0xa7, 0xde, 0x53,
+  0x5a, 0x2e, 0x10, 0x72, 0x81, 0x5a, 0x54, 0xc2, 0x96, 0xb6, 0x65, 0x58,
+  0x61, 0xe6, 0xe6, 0x43, 0xe2, 0x69, 0x70, 0x08, 0x36, 0x25, 0x77, 0xa5,
+  0xfa, 0xa3, 0x93, 0x53, 0x2f, 0x6a, 0x3b, 0x79, 0xa2, 0x31, 0x2f, 0x06,
+  0xb4, 0x42, 0xfe, 0xc4, 0x08, 0x5a, 0x13, 0x12, 0x3c, 0x2e, 0xe3, 0x18,
+  0x7d, 0xa5, 0x65, 0x12, 0xff, 0xaf, 0xfc, 0x69, 0xe0, 0x48, 0x51, 0x63,
+  0x40, 0x96, 0x2e, 0x05, 0xee, 0x3d, 0xc7, 0xea, 0xe1, 0xb5, 0x4b, 0x81,
+  0x5d, 0xe7, 0xf6, 0x05, 0xde, 0x8d, 0x0e, 0xc3, 0x5f, 0x23, 0x87, 0x99,
+  0x3a, 0xdf, 0xee, 0x1f, 0x63, 0x5d, 0xc5, 0xb7, 0xce, 0xc9, 0x17, 0xde,
+  0x2c, 0xb6, 0xd9, 0x02, 0xdc, 0x1e, 0x68, 0xab, 0x17, 0x0b, 0xd1, 0x07,
+  0x6c, 0xdd, 0xfd, 0x54, 0x1e, 0x2d, 0x54, 0x60, 0x95, 0x61, 0x6e, 0x3e,
+  0x4c, 0xf9, 0x60, 0x87, 0x1f, 0xc7, 0xf1, 0x10, 0x09, 0x38, 0xc8, 0x67,
+  0x4d, 0x7a, 0xd6, 0x6b, 0xca, 0xd3, 0x8d, 0x9c, 0x66, 0xdc, 0xff, 0x17,
+  0xdb, 0x65, 0xb2, 0x13, 0x08, 0xcb, 0xaa, 0x81, 0x5d, 0x52, 0x60, 0xab,
+  0x57, 0x8a, 0xc8, 0x56, 0x51, 0xb4, 0x55, 0x0a, 0x6c, 0x05, 0x7d, 0xca,
+  0xec, 0x85, 0xc1, 0x83, 0xd5, 0xc1, 0xf8, 0x84, 0x56, 0x7b, 0x99, 0xfa,
+  0x97, 0x9b, 0xec, 0xfb, 0x45, 0xd9, 0x4c, 0xb6, 0xa9, 0xc0, 0x32, 0x8f,
+  0xb2, 0x76, 0xe2, 0x36, 0xef, 0x57, 0xed, 0x44, 0xd2, 0x9f, 0x91, 0x18,
+  0xe4, 0x24, 0x7a, 0x68, 0xa2, 0x6e, 0x8d, 0xf2, 0x7d, 0x46, 0x94, 0x57,
+  0xf3, 0x45, 0x94, 0xbf, 0x1d, 0x19, 0x0d, 0x12, 0xa3, 0xc1, 0xfe, 0x44,
+  0x37, 0x0f, 0xe1, 0x7d, 0x3c, 0xfa, 0x2a, 0xa6, 0x58, 0xfe, 0xb2, 0x3f,
+  0x83, 0x3e, 0x18, 0x11, 0x0e, 0x30, 0x72, 0xda, 0x03, 0x73, 0x22, 0xc1,
+  0xa5, 0x79, 0xca, 0x7f, 0xc7, 0xa6, 0x59, 0xcc, 0x79, 0xd2, 0x6c, 0xce,
+  0x9b, 0xfd, 0x57, 0x67, 0x4e, 0x8b, 0x21, 0xff, 0x52, 0x68, 0x8f, 0x83,
+  0x68, 0xc5, 0x2e, 0x9f, 0x6e, 0xc5, 0x74, 0x05, 0x1f, 0xe6, 0x73, 0xb1,
+  0x8c, 0x3a, 0x40, 0x72, 0x3e, 0xc4, 0x99, 0x64, 0xd3, 0xd1, 0x03, 0x75,
+  0xda, 0xe7, 0xaf, 0x83, 0xfd, 0xd0, 0x1f, 0xdf, 0x6d, 0x4c, 0x2c, 0xee,
+  0xc3, 0x8c, 0x7f, 0x08, 0x33, 0x7e, 0x3b, 0xcf, 0xf8, 0x94, 0xc4, 0xee,
+  0x41, 0x17, 0xd5, 0xbb, 0x3a, 0x4d, 0x5c, 0x8f, 0x6b, 0x7e, 0x71, 0xef,
+  0xbe, 0x0a, 0x71, 0xb7, 0x5f, 0x95, 0xb8, 0x11, 0x93, 0x8c, 0x77, 0x73,
+  0x19, 0xe3, 0x8f, 0xf0, 0x0c, 0x1d, 0xc1, 0x0c, 0x0d, 0x26, 0x0c, 0xea,
+  0x26, 0x44, 0x9d, 0xb4, 0xb0, 0xa9, 0x82, 0x92, 0x00, 0x8d, 0x71, 0x53,
+  0xad, 0xd8, 0x74, 0x99, 0x77, 0x84, 0x82, 0x92, 0x2a, 0x89, 0xed, 0xe9,
+  0xda, 0xa3, 0x7c, 0xbc, 0x53, 0x4d, 0x3d, 0x81, 0x4b, 0x58, 0xfe, 0xf1,
+  0xf1, 0x2c, 0xd4, 0xba, 0x87, 0xa6, 0x0d, 0xb8, 0xd5, 0xa3, 0x60, 0x75,
+  0x9a, 0x85, 0xf1, 0x96, 0x83, 0x6c, 0x99, 0x42, 0x93, 0xa9, 0x05, 0x87,
+  0xd9, 0x63, 0xb9, 0x5f, 0x63, 0x98, 0xfd, 0x2c, 0x3f, 0xdb, 0x30, 0x73,
+  0x33, 0x72, 0xda, 0x43, 0x73, 0x24, 0x05, 0x19, 0x38, 0xe6, 0x77, 0x2d,
+  0x20, 0xc5, 0x15, 0xaf, 0x90, 0xe2, 0x3c, 0xef, 0xaf, 0xdd, 0x7a, 0x3f,
+  0x6f, 0xc0, 0x89, 0xb3, 0x2e, 0x45, 0xcb, 0x20, 0x17, 0xa1, 0x2e, 0xab,
+  0x08, 0x8f, 0x42, 0x70, 0x3a, 0x8e, 0x3d, 0x73, 0x9f, 0xe8, 0xa8, 0x66,
+  0x33, 0x91, 0x31, 0x24, 0xf2, 0x32, 0x71, 0xe1, 0xe4, 0x2e, 0xfa, 0xb2,
+  0x91, 0x6b, 0x00, 0x72, 0x9b, 0x17, 0x6a, 0x7f, 0x2a, 0x6b, 0xfb, 0x69,
+  0x8f, 0xa5, 0x5b, 0xb5, 0xbf, 0xc2, 0x34, 0xed, 0x10, 0x9b, 0x92, 0x69,
+  0x7f, 0xe0, 0xab, 0xe1, 0xec, 0xbd, 0xf2, 0x37, 0x8f, 0xe8, 0x95, 0xdb,
+  0xae, 0xde, 0x36, 0x5b, 0xb2, 0x4a, 0x02, 0xa7, 0xf8, 0x4f, 0x3d, 0x89,
+  0x49, 0x94, 0x25, 0x57, 0x9f, 0x37, 0x6d, 0x9b, 0x50, 0xdb, 0x8d, 0xeb,
+  0x7b, 0x96, 0xa7, 0x91, 0x29, 0xa4, 0x4a, 0x53, 0x0a, 0x48, 0x5a, 0x52,
+  0xc0, 0x77, 0xb2, 0xe5, 0xd1, 0xe4, 0x02, 0x29, 0xa0, 0x52, 0xdf, 0x54,
+  0xe4, 0x49, 0x1e, 0xde, 0x45, 0x33, 0x75, 0x4a, 0x34, 0xb4, 0xdd, 0xec,
+  0xf2, 0x58, 0x26, 0x0e, 0x49, 0x43, 0xd8, 0x24, 0x9f, 0x39, 0x9c, 0x55,
+  0xb7, 0xb3, 0x2a, 0xda, 0x6d, 0x7c, 0x9a, 0x83, 0xbb, 0xc7, 0x6b, 0x3c,
+  0xb0, 0x29, 0x8d, 0x13, 0xc7, 0x2c, 0x4f, 0x0d, 0xc0, 0x33, 0x77, 0x2c,
+  0x19, 0xc6, 0xc6, 0xf2, 0x62, 0x93, 0x33, 0xf8, 0xbb, 0xc2, 0xa4, 0xf8,
+  0x3e, 0xa9, 0xfd, 0x91, 0xfb, 0xea, 0x8c, 0x22, 0x29, 0x51, 0xd5, 0x75,
+  0x2e, 0x36, 0xd3, 0x10, 0x78, 0x82, 0x0e, 0x70, 0x81, 0xfd, 0xd0, 0x09,
+  0xba, 0x0e, 0x4b, 0x36, 0xd3, 0x2e, 0x08, 0x9b, 0x39, 0x2b, 0xf9, 0x14,
+  0x8b, 0xa2, 0x2a, 0xe8, 0xbe, 0xea, 0x9c, 0xf6, 0x73, 0x58, 0x29, 0x7d,
+  0x22, 0xda, 0x62, 0x08, 0x7a, 0x6c, 0x66, 0x94, 0xe1, 0x81, 0xd8, 0x3b,
+  0xa6, 0xab, 0x9c, 0x2a, 0xa7, 0xc2, 0x68, 0x82, 0x64, 0x33, 0xbe, 0x40,
+  0x7c, 0x99, 0x51, 0x25, 0x48, 0x1b, 0x33, 0x1e, 0xc1, 0x23, 0x12, 0x53,
+  0x83, 0x5a, 0x93, 0x2b, 0x13, 0xe5, 0xc3, 0xf3, 0x37, 0x13, 0x7b, 0x3c,
+  0xb0, 0x35, 0xc9, 0xe0, 0x19, 0x8f, 0x52, 0x02, 0xfb, 0xff, 0xae, 0xb7,
+  0x22, 0xcc, 0x7b, 0x70, 0x9f, 0x9e, 0x2d, 0x92, 0xdc, 0x59, 0x44, 0x9b,
+  0x87, 0xae, 0xac, 0xfd, 0x06, 0x3c, 0x42, 0x32, 0xb8, 0xfb, 0xa8, 0x23,
+  0x90, 0xa8, 0x24, 0x56, 0xb9, 0x3a, 0x11, 0x7d, 0xb3, 0x49, 0xd9, 0x31,
+  0x19, 0x69, 0x7d, 0x9b, 0x84, 0x88, 0x69, 0xae, 0x53, 0x7c, 0xca, 0xcf,
+  0x18, 0xb7, 0x4c, 0xae, 0x3a, 0x03, 0xb7, 0x96, 0xbd, 0x85, 0xeb, 0x37,
+  0x63, 0xd7, 0x90, 0x28, 0x33, 0xaa, 0xac, 0x97, 0xc1, 0x38, 0xea, 0x4e,
+  0xd8, 0x54, 0x33, 0x7e, 0xa5, 0x5a, 0x2e, 0xe9, 0xa7, 0xcb, 0xf4, 0xad,
+  0x99, 0x85, 0x20, 0xe0, 0x0a, 0xf4, 0x3d, 0x80, 0x5f, 0xdc, 0x81, 0xbe,
+  0xef, 0xc1, 0x0f, 0x18, 0xaf, 0xce, 0xc1, 0xaa, 0x88, 0xd7, 0x9f, 0x5b,
+  0xbf, 0x36, 0x57, 0x96, 0xe6, 0xc2, 0xeb, 0xd8, 0x27, 0xe2, 0x61, 0xc0,
+  0xf1, 0xad, 0x4e, 0xda, 0x24, 0xfc, 0xdc, 0x11, 0xae, 0x03, 0x1c, 0x7f,
+  0x02, 0x19, 0x47, 0xfc, 0x1a, 0xc0, 0x61, 0x5b, 0x01, 0x7f, 0xd0, 0x9a,
+  0x0b, 0x2f, 0x06, 0x1c, 0xce, 0xb8, 0xd0, 0x46, 0x11, 0x2f, 0x01, 0x1c,
+  0x96, 0x58, 0xda, 0x30, 0xe2, 0x05, 0x80, 0x63, 0x08, 0x1f, 0x40, 0xdc,
+  0x0d, 0x38, 0x1c, 0x56, 0xa1, 0xf5, 0x22, 0xfe, 0x85, 0x97, 0xe1, 0xf0,
+  0x7b, 0x9a, 0x76, 0x08, 0xf1, 0x4b, 0x80, 0xc3, 0x2c, 0x41, 0xdb, 0x8d,
+  0xf8, 0xdf, 0x01, 0x87, 0x5f, 0xd5, 0xb5, 0xed, 0x88, 0x7f, 0x04, 0x38,
+  0xfc, 0x56, 0xa3, 0x35, 0x23, 0xfe, 0x3e, 0xe0, 0x70, 0x24, 0x94, 0xd6,
+  0x80, 0xf8, 0xdb, 0x80, 0xc3, 0xb2, 0x55, 0x93, 0x11, 0x7f, 0x0d, 0x70,
+  0x18, 0xae, 0x5a, 0x10, 0xf1, 0x33, 0x80, 0x17, 0xa3, 0xc5, 0x10, 0x3f,
+  0x05, 0x38, 0xfc, 0xd4, 0xa7, 0x4d, 0xcf, 0x02, 0xfe, 0x02, 0xe0, 0x41,
+  0xd4, 0x1f, 0xf1, 0xe7, 0x00, 0x0f, 0xa1, 0xfe, 0x88, 0xff, 0x12, 0xf0,
+  0x12, 0xd4, 0x1f, 0xf1, 0x9f, 0x00, 0x5e, 0x8a, 0xfa, 0x23, 0xfe, 0x14,
+  0xe0, 0x65, 0xa8, 0x3f, 0xe2, 0xc7, 0x01, 0x5f, 0x84, 0xfa, 0x23, 0xfe,
+  0x38, 0xe0, 0xe5, 0xa8, 0x3f, 0xe2, 0x0f, 0x01, 0x5e, 0x81, 0xfa, 0x23,
+  0xde, 0x09, 0x78, 0x25, 0xea, 0x8f, 0xf8, 0x0f, 0x01, 0xaf, 0x42, 0xfd,
+  0x11, 0xdf, 0x0b, 0xf8, 0x62, 0xd4, 0x1f, 0xf1, 0x9d, 0x80, 0x57, 0xa3,
+  0xfe, 0x88, 0xdf, 0x05, 0x78, 0x0d, 0xea, 0x8f, 0xf8, 0xed, 0x80, 0x2f,
+  0x41, 0xfd, 0x11, 0xbf, 0x15, 0xf0, 0x5a, 0xd4, 0x1f, 0xf1, 0x46, 0xc0,
+  0x97, 0xa2, 0xfe, 0x5f, 0x02, 0xbe, 0x16, 0x70, 0x19, 0xf5, 0x47, 0xbc,
+  0x0e, 0xf0, 0x65, 0xa8, 0x3f, 0xc3, 0x25, 0x6b, 0xe9, 0xdd, 0xda, 0xfc,
+  0x95, 0xf0, 0xf9, 0x4a, 0xaf, 0xe5, 0xbb, 0xab, 0xc6, 0xbd, 0xa4, 0xb8,
+  0x32, 0xa7, 0xb6, 0xbc, 0x2c, 0x50, 0x15, 0xf2, 0xf8, 0x96, 0x56, 0x17,
+  0x55, 0x2c, 0x2a, 0x0d, 0xe6, 0x2d, 0xf6, 0x97, 0xe4, 0x16, 0x7a, 0x0b,
+  0xf2, 0x97, 0x96, 0xd7, 0x2e, 0x2a, 0x29, 0x58, 0xe2, 0x2e, 0x0b, 0x05,
+  0x8a, 0xf2, 0x73, 0x6b, 0x5c, 0x15, 0xa5, 0x85, 0x39, 0xc1, 0xe2, 0xbc,
+  0x4a, 0xbf, 0xc7, 0x57, 0xe5, 0x5d, 0xcc, 0xba, 0xc3, 0xe5, 0x5e, 0x9f,
+  0x93, 0xb7, 0xa1, 0xda, 0x73, 0xed, 0x2a, 0xdf, 0x35, 0x37, 0x37, 0xd4,
+  0x34, 0x79, 0x57, 0xd6, 0x5f, 0x5f, 0x57, 0x9e, 0x5f, 0xb9, 0x7c, 0xf3,
+  0xc6, 0x1b, 0x4b, 0x96, 0x14, 0x6e, 0x5d, 0x97, 0xbb, 0x38, 0x7c, 0xdd,
+  0xb2, 0x35, 0x5b, 0x6e, 0x58, 0xbd, 0xa8, 0xa2, 0x31, 0x54, 0x70, 0x53,
+  0xd5, 0x0a, 0xf9, 0x96, 0xb2, 0x4d, 0xc1, 0xb5, 0x4b, 0x4b, 0x03, 0xb5,
+  0xc5, 0x45, 0xfe, 0xad, 0xc1, 0xa6, 0xbc, 0xc0, 0x8a, 0x2d, 0x39, 0xb9,
+  0xc5, 0xe5, 0x8b, 0x97, 0xaf, 0xb9, 0xc5, 0x9d, 0xef, 0xad, 0x29, 0x2c,
+  0x5a, 0x54, 0x57, 0x5a, 0xb5, 0xf4, 0x9a, 0xeb, 0xea, 0xd7, 0x6d, 0x76,
+  0x85, 0x7c, 0x61, 0x4f, 0x45, 0x75, 0x43, 0xc1, 0x12, 0xff, 0xea, 0x32,
+  0x79, 0xd5, 0xfa, 0x92, 0x6b, 0x2b, 0x6f, 0xac, 0xbd, 0x7e, 0xd9, 0x86,
+  0x95, 0x6b, 0x6f, 0xb8, 0xf9, 0xa6, 0x8d, 0x9b, 0x1a, 0xa5, 0xce, 0xd5,
+  0x52, 0x14, 0xcf, 0x0d, 0x96, 0xdb, 0x3a, 0x3b, 0x0f, 0x76, 0xca, 0x96,
+  0xf3, 0xa7, 0x0b, 0xa4, 0xbb, 0xda, 0xbe, 0xee, 0xcd, 0x70, 0x8f, 0xd4,
+  0xd0, 0xb8, 0xed, 0x40, 0x7b, 0x5b, 0x63, 0x56, 0xc8, 0xaa, 0x84, 0xdb,
+  0xdb, 0x7b, 0xc2, 0xad, 0x05, 0xd2, 0x37, 0xf7, 0x74, 0x74, 0x1c, 0xec,
+  0x96, 0x5b, 0x3b, 0xdb, 0xf6, 0x74, 0xb7, 0xc9, 0x82, 0x8a, 0xbc, 0x0f,
+  0xea, 0xc9, 0xe1, 0xae, 0x02, 0x49, 0xa6, 0x72, 0x43, 0x23, 0x7c, 0x36,
+  0x34, 0xde, 0xd5, 0xd3, 0xd1, 0xd5, 0x18, 0xee, 0x49, 0xbf, 0xf1, 0x8d,
+  0xf6, 0xf6, 0xc6, 0x70, 0x97, 0x0c, 0x1c, 0xa0, 0x82, 0xbc, 0xad, 0xa7,
+  0xa3, 0x15, 0xce, 0x56, 0x46, 0x24, 0x5c, 0xdf, 0xb0, 0x76, 0x5f, 0x38,
+  0xac, 0x1f, 0xd8, 0x76, 0x6f, 0x73, 0x67, 0x1a, 0x01, 0x94, 0x0d, 0x28,
+  0xcc, 0xd3, 0xf0, 0xde, 0x66, 0xa3, 0x55, 0x78, 0x7d, 0x0f, 0xab, 0x9e,
+  0x4e, 0x86, 0x9a, 0x03, 0x29, 0x3b, 0xdb, 0x6c, 0xed, 0x97, 0x43, 0x11,
+  0x17, 0xc2, 0x1b, 0x59, 0xdf, 0xd4, 0xe9, 0xd8, 0x26, 0x86, 0xa5, 0xf3,
+  0xa2, 0x0b, 0xfc, 0x8c, 0x4e, 0x28, 0xe2, 0xec, 0xba, 0x2b, 0x73, 0x73,
+  0xf8, 0xc6, 0x5e, 0x71, 0xe6, 0x9e, 0x38, 0x33, 0xaf, 0xb9, 0x86, 0xc3,
+  0xcf, 0x66, 0xf9, 0xfd, 0x69, 0x99, 0xe3, 0x5e, 0xba, 0xbf, 0x9f, 0x0e,
+  0x89, 0x13, 0x67, 0xe6, 0x0d, 0x10, 0x01, 0x21, 0xfb, 0xbb, 0xf4, 0x45,
+  0x9c, 0x6d, 0x57, 0x49, 0x50, 0x9c, 0xa5, 0x37, 0xb1, 0xc2, 0x2a, 0x87,
+  0x78, 0x3f, 0x60, 0xbe, 0xad, 0xbe, 0x38, 0xdb, 0x4f, 0xbc, 0x57, 0x49,
+  0x9c, 0x01, 0xd8, 0x40, 0x37, 0xc4, 0x19, 0x8b, 0x72, 0x98, 0x43, 0x71,
+  0xe6, 0x9c, 0xe0, 0xf3, 0x39, 0xe9, 0x97, 0xad, 0x88, 0xf7, 0xaf, 0xda,
+  0xcb, 0x33, 0xf4, 0xde, 0x95, 0xe7, 0x09, 0x9e, 0x26, 0xf8, 0x06, 0xc1,
+  0x0f, 0x09, 0x7e, 0x42, 0x70, 0x96, 0x60, 0x31, 0xbd, 0xe7, 0xa6, 0x96,
+  0x60, 0x3d, 0xc1, 0x26, 0x82, 0x77, 0x10, 0xdc, 0x45, 0xb0, 0x83, 0xe0,
+  0x11, 0x82, 0x4f, 0x12, 0x7c, 0x86, 0xe0, 0xf3, 0x04, 0x4f, 0x13, 0x7c,
+  0x83, 0xe0, 0x87, 0x04, 0x3f, 0x21, 0x38, 0x4b, 0xb0, 0x98, 0xde, 0xa7,
+  0x53, 0x4b, 0xb0, 0x9e, 0x60, 0x13, 0xc1, 0x3b, 0x08, 0xee, 0x22, 0xd8,
+  0x41, 0xf0, 0x08, 0xc1, 0x27, 0x09, 0x3e, 0x43, 0xf0, 0x79, 0xdb, 0xfb,
+  0x79, 0xd2, 0x4a, 0x3d, 0x1e, 0x38, 0x5f, 0x8f, 0xe7, 0xcd, 0xe3, 0x67,
+  0x7d, 0xe7, 0x41, 0xa9, 0x7e, 0x6f, 0x57, 0x17, 0xc3, 0x0e, 0x77, 0x74,
+  0x1d, 0xbe, 0x9f, 0xc3, 0xee, 0x4e, 0x84, 0x7b, 0xee, 0x3f, 0xd0, 0x2a,
+  0xd5, 0xff, 0xe0, 0x20, 0x6b, 0x01, 0xe7, 0x7e, 0xd7, 0x77, 0xb6, 0xb5,
+  0xef, 0x31, 0x7d, 0xc3, 0x1b, 0xfb, 0xf7, 0x74, 0xed, 0x67, 0x75, 0x3a,
+  0x7a, 0xe8, 0x5b, 0xd7, 0x7e, 0xd6, 0xba, 0x7b, 0xcf, 0xde, 0xf9, 0xe5,
+  0xb8, 0xca, 0x02, 0x89, 0x05, 0x7c, 0x52, 0xf8, 0x91, 0xf0, 0x5b, 0x01,
+  0x27, 0xe8, 0xb0, 0x44, 0xb8, 0x0f, 0x97, 0x84, 0x7f, 0x0a, 0x7f, 0x84,
+  0xe9, 0x48, 0x8e, 0xa9, 0xbd, 0x18, 0x07, 0x02, 0xbe, 0x6b, 0x3e, 0xe4,
+  0x51, 0x4a, 0x7f, 0x1f, 0x2f, 0x9c, 0xc1, 0xec, 0x35, 0xb5, 0x17, 0xe3,
+  0x4c, 0xc0, 0x11, 0x8f, 0xb5, 0x9d, 0xe0, 0x2f, 0xc6, 0x25, 0x3c, 0x51,
+  0xfa, 0x2f, 0xe6, 0xd3, 0xa2, 0xbd, 0x18, 0x97, 0x02, 0xaa, 0x39, 0x99,
+  0xdb, 0x8b, 0x12, 0x21, 0x5a, 0xa2, 0xbd, 0x18, 0x87, 0x02, 0x8a, 0x71,
+  0x08, 0xed, 0x0b, 0xa5, 0x74, 0xfd, 0x9b, 0x6c, 0xed, 0xc5, 0xb8, 0x13,
+  0xb0, 0x21, 0x67, 0xfe, 0xf6, 0x2e, 0xc9, 0x78, 0x87, 0x32, 0x14, 0xe3,
+  0x7d, 0xcd, 0x1c, 0x5f, 0x2b, 0x04, 0xc8, 0x22, 0xff, 0x26, 0x5b, 0xfb,
+  0x63, 0x34, 0xee, 0x8e, 0x1d, 0x22, 0xfe, 0x6e, 0x6b, 0x7d, 0x7b, 0xff,
+  0x15, 0x51, 0x7b, 0x11, 0x57, 0x8c, 0xf7, 0x29, 0x73, 0x5c, 0xb5, 0xb5,
+  0xb7, 0xbf, 0x1b, 0x77, 0x35, 0xf1, 0x16, 0xed, 0x8d, 0xf7, 0x38, 0x53,
+  0x7d, 0xea, 0x78, 0x41, 0x46, 0xf0, 0x17, 0x74, 0xd6, 0xd9, 0xf8, 0x8b,
+  0xb8, 0x96, 0xa4, 0x43, 0xb1, 0x9b, 0x6d, 0x0e, 0x63, 0x97, 0x5f, 0x9c,
+  0x8f, 0x2a, 0xda, 0x1b, 0xef, 0x9f, 0x96, 0x32, 0x16, 0x7b, 0xff, 0x95,
+  0xd3, 0xb5, 0xaf, 0xdb, 0x7e, 0xaf, 0x64, 0x3d, 0x6f, 0x55, 0x14, 0xd1,
+  0xbe, 0xdd, 0x76, 0xdd, 0xee, 0xff, 0x4e, 0x71, 0x8a, 0x53, 0x9c, 0xe2,
+  0x14, 0xa7, 0x38, 0xc5, 0x29, 0x4e, 0x71, 0x8a, 0x53, 0x9c, 0xe2, 0x14,
+  0xa7, 0x38, 0xc5, 0x29, 0x4e, 0x71, 0x8a, 0x53, 0x9c, 0xe2, 0x14, 0xa7,
+  0x38, 0xc5, 0x29, 0x4e, 0x71, 0x8a, 0x53, 0x9c, 0xe2, 0x14, 0xa7, 0x38,
+  0xc5, 0x29, 0x4e, 0xf9, 0xdf, 0x2c, 0xff, 0x01, 0x3e, 0x1c, 0x90, 0x78,
+  0x00, 0xa0, 0x00, 0x00
+};
+const unsigned int libtcc1_so_len = 9316;
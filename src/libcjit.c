@@ -0,0 +1,203 @@
+#include "libcjit.h"
+
+#include <stdlib.h>
+
+#include "adapters/compiler/tinycc_adapter.h"
+#include "cjit.h"
+#include "domain/runtime_session.h"
+#include "ports/compiler_port.h"
+
+struct CJITSession {
+    CJITState *cjit;
+    CompilerPort compiler;
+    RuntimeSession runtime;
+    const char *error;
+};
+
+/**
+ * Syncs the runtime session with the compiler state before a call.
+ */
+static CompilerPort *begin(CJITSession *session)
+{
+    session->error = NULL;
+    session->compiler.begin_session(session->compiler.context, &session->runtime);
+    return &session->compiler;
+}
+
+static int finish(CJITSession *session, CJITResult result)
+{
+    session->compiler.end_session(session->compiler.context, &session->runtime);
+    if (!result.ok) {
+        session->error = result.message ? result.message : "libcjit error";
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Sources and options are refused once the program is in memory.
+ */
+static int adding(CJITSession *session)
+{
+    if (session->cjit->done_relocate) {
+        session->error = "Program compiled already";
+        return 0;
+    }
+    return 1;
+}
+
+CJITSession *cjit_session_new(void)
+{
+    CJITSession *session = calloc(1, sizeof(CJITSession));
+
+    if (!session) {
+        return NULL;
+    }
+    session->cjit = cjit_new();
+    if (!session->cjit) {
+        free(session);
+        return NULL;
+    }
+    /* a library prints only diagnostics */
+    session->cjit->quiet = true;
+    session->compiler = tinycc_compiler_port;
+    session->compiler.context = session->cjit;
+    begin(session);
+    return session;
+}
+
+void cjit_session_free(CJITSession *session)
+{
+    if (!session) {
+        return;
+    }
+    cjit_free(session->cjit);
+    free(session);
+}
+
+const char *cjit_session_error(CJITSession *session)
+{
+    return session->error;
+}
+
+int cjit_session_define(CJITSession *session, const char *name, const char *value)
+{
+    CompilerPort *compiler;
+
+    if (!adding(session)) {
+        return -1;
+    }
+    compiler = begin(session);
+    return finish(session, compiler->define_symbol(compiler->context, &session->runtime,
+                                                   name, value));
+}
+
+int cjit_session_add_include_path(CJITSession *session, const char *path)
+{
+    CompilerPort *compiler;
+
+    if (!adding(session)) {
+        return -1;
+    }
+    compiler = begin(session);
+    return finish(session, compiler->add_include_path(compiler->context, &session->runtime,
+                                                      path));
+}
+
+int cjit_session_add_library_path(CJITSession *session, const char *path)
+{
+    CompilerPort *compiler;
+
+    if (!adding(session)) {
+        return -1;
+    }
+    compiler = begin(session);
+    return finish(session, compiler->add_library_path(compiler->context, &session->runtime,
+                                                      path));
+}
+
+int cjit_session_add_library(CJITSession *session, const char *name)
+{
+    if (!adding(session)) {
+        return -1;
+    }
+    begin(session);
+    cjit_add_library(session->cjit, name);
+    return finish(session, cjit_result_ok());
+}
+
+int cjit_session_set_options(CJITSession *session, const char *options)
+{
+    CompilerPort *compiler;
+
+    if (!adding(session)) {
+        return -1;
+    }
+    compiler = begin(session);
+    return finish(session, compiler->set_options(compiler->context, &session->runtime,
+                                                 options));
+}
+
+int cjit_session_add_files(CJITSession *session, const char **paths, int count)
+{
+    CompilerPort *compiler;
+
+    if (!adding(session)) {
+        return -1;
+    }
+    compiler = begin(session);
+    return finish(session, compiler->add_source_files(compiler->context, &session->runtime,
+                                                      paths, count));
+}
+
+int cjit_session_add_buffers(CJITSession *session, const char **buffers, int count)
+{
+    CompilerPort *compiler;
+    CJITResult result = cjit_result_ok();
+    int i;
+
+    if (!adding(session)) {
+        return -1;
+    }
+    compiler = begin(session);
+    for (i = 0; i < count && result.ok; i++) {
+        result = compiler->add_source_buffer(compiler->context, &session->runtime, buffers[i]);
+    }
+    return finish(session, result);
+}
+
+int cjit_session_compile(CJITSession *session)
+{
+    CompilerPort *compiler = begin(session);
+
+    return finish(session, compiler->relocate(compiler->context, &session->runtime));
+}
+
+void *cjit_session_symbol(CJITSession *session, const char *name)
+{
+    CompilerPort *compiler = begin(session);
+    CJITResult result;
+    void *symbol = NULL;
+
+    result = compiler->relocate(compiler->context, &session->runtime);
+    if (result.ok) {
+        result = compiler->resolve_symbol(compiler->context, &session->runtime, name, &symbol);
+    }
+    return finish(session, result) < 0 ? NULL : symbol;
+}
+
+int cjit_session_run(CJITSession *session, int mode, int argc, char **argv)
+{
+    CompilerPort *compiler = begin(session);
+    CJITResult result;
+    int exit_status = -1;
+
+    result = compiler->run_program(compiler->context, &session->runtime,
+                                   mode == CJIT_SESSION_RUN_IN_PROCESS,
+                                   argc, argv, &exit_status);
+    /* a program exiting with an error is not a failure of the session */
+    if (!result.ok && result.code == CJIT_RESULT_EXEC_ERROR) {
+        result = cjit_result_ok();
+    }
+    return finish(session, result) < 0 ? -1 : exit_status;
+}
@@ -0,0 +1,84 @@
+#ifndef LIBCJIT_H
+#define LIBCJIT_H
+
+/**
+ * libcjit: the C compiler and runtime of cjit as a library.
+ *
+ * A session compiles C sources and buffers to a program linked in
+ * memory, then looks up its symbols or runs its entry point as many
+ * times as needed. Functions returning int give 0 on success and -1 on
+ * errors, described by cjit_session_error(). Diagnostics of the
+ * compiler are printed on stderr.
+ *
+ * Sessions are independent and may be used from different threads,
+ * one thread per session at a time.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct CJITSession CJITSession;
+
+/* how cjit_session_run calls the entry point */
+#define CJIT_SESSION_RUN_FORK 0       /* in a child process, isolated */
+#define CJIT_SESSION_RUN_IN_PROCESS 1 /* in the calling process */
+
+/**
+ * Creates a session, extracting the runtime headers on first use.
+ * Returns NULL on errors.
+ */
+CJITSession *cjit_session_new(void);
+
+/**
+ * Releases the session and the memory of its program: symbols looked
+ * up from it are not valid anymore.
+ */
+void cjit_session_free(CJITSession *session);
+
+/**
+ * Message of the last failed call, or NULL.
+ */
+const char *cjit_session_error(CJITSession *session);
+
+/* compiler options, to be given before adding sources */
+int cjit_session_define(CJITSession *session, const char *name, const char *value);
+int cjit_session_add_include_path(CJITSession *session, const char *path);
+int cjit_session_add_library_path(CJITSession *session, const char *path);
+int cjit_session_add_library(CJITSession *session, const char *name);
+int cjit_session_set_options(CJITSession *session, const char *options);
+
+/**
+ * Adds C sources, objects and archives. The C sources are compiled in
+ * parallel, one thread per core unless CJIT_JOBS says otherwise.
+ */
+int cjit_session_add_files(CJITSession *session, const char **paths, int count);
+
+/**
+ * Compiles `count` buffers of C source code in order.
+ */
+int cjit_session_add_buffers(CJITSession *session, const char **buffers, int count);
+
+/**
+ * Links what was added into an image in memory. Done once: adding more
+ * code afterwards is an error.
+ */
+int cjit_session_compile(CJITSession *session);
+
+/**
+ * Address of `name` in the program, compiled first when needed. Returns
+ * NULL when the symbol is missing.
+ */
+void *cjit_session_symbol(CJITSession *session, const char *name);
+
+/**
+ * Calls the `main` function of the program with `argc` and `argv`, in
+ * the way `mode` says, and returns its exit status, or -1 on errors.
+ */
+int cjit_session_run(CJITSession *session, int mode, int argc, char **argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -38,6 +38,10 @@
 #include <app/extract_archive.h>
 #include <adapters/cli/route_parser.h>
 #include <adapters/cli/render_response.h>
+#include <adapters/compiler/codegen_report.h>
+#include <adapters/compiler/make_deps.h>
+#include <adapters/platform/compile_server.h>
+#include <adapters/platform/watch.h>
 
 #ifdef SELFHOST
 extern const char *cjit_source;
@@ -55,6 +59,7 @@ static char** remove_args(int* argc,  char** argv,
 						  const char** to_remove, int remove_count);
 static int handle_archive_mode(CJITState *cjit, int argc, char **argv);
 static int handle_conftest_mode(CJITState *cjit, const char *source_path);
+static int run_cli(CJITState *CJIT, int argc, char **argv);
 
 #define MAX_ARG_STRING 1024
 static int parse_value(char *str) {
@@ -103,6 +108,18 @@ const char cli_help[] =
 	" -e fun\t run starting from entry function (-) main\n"
 	" -p pid\t write execution process ID to (+) pid\n"
 	" --verb\t don't go quiet, verbose logs\n"
+	" --tiered\t recompile hot functions with the host cc\n"
+	" --hot-reload\t swap in functions of sources edited while running\n"
+	" --watch\t rebuild and restart when sources or headers change\n"
+	" --relink\t with --watch, link only the sources changed\n"
+	" --codegen-report\t per-function code statistics (=) json\n"
+	" --no-cache\t always compile, skip the object cache\n"
+	" --layout\t order functions by the profile of an earlier run\n"
+	" --gc-sections\t drop functions the program never reaches\n"
+#if !defined(WINDOWS)
+	" --server sock\t serve runs sent to (+) sock, see CJIT_SERVER\n"
+	" --prelude h\t with --server, parse header (+) h once for all\n"
+#endif
 #if !defined(SHAREDTCC)
 	" --xass\t just extract runtime assets (=) to path\n"
 #endif
@@ -119,6 +136,7 @@ const char *ignored_args[] = {
 	"-O:",
 	"-f:",
 	"-W:",
+	// make dependency options, read before by cjit_make_deps_option()
 	"-MF:",
 	"-MQ:",
 	"-MT:",
@@ -127,14 +145,26 @@ const char *ignored_args[] = {
 };
 
 int main(int argc, char **argv) {
+  // hand the run to a compile server when one is listening
+  const char *server = getenv("CJIT_SERVER");
+  if(server && *server) {
+	  int res = cjit_client_run(server, argc, argv);
+	  if(res>=0) exit(res);
+  }
   CJITState *CJIT = cjit_new();
   if(!CJIT) exit(1);
+  exit(run_cli(CJIT, argc, argv));
+}
 
+static int run_cli(CJITState *CJIT, int argc, char **argv) {
   int arg_separator = 0;
   int res = 1;
   int i, c;
   CliRoute forced_route = CLI_ROUTE_NONE;
   const char *forced_route_path = NULL;
+  const char *server = NULL;
+  const char *prelude = NULL;
+  bool watch = false;
 
 #ifndef CJIT_WITHOUT_AR
   if(argv[1] && strlen(argv[1])==3 && strcmp(argv[1],"-ar")==0) {
@@ -150,6 +180,10 @@ int main(int argc, char **argv) {
 	  exit(res);
   }
 
+  for(i=1; i<argc && strcmp(argv[i],"--"); i++) {
+	  int taken = cjit_make_deps_option(CJIT, argc, argv, i);
+	  if(taken) i += taken - 1;
+  }
   // clean up argv from ignored args and update argc
   int ignored_count = sizeof(ignored_args) / sizeof(ignored_args[0]);
   char** clean_argv = remove_args(&argc, argv, ignored_args, ignored_count);
@@ -159,6 +193,18 @@ int main(int argc, char **argv) {
   static ko_longopt_t longopts[] = {
 	  { "help", ko_no_argument, 100 },
 	  { "verb", ko_no_argument, 101 },
+	  { "tiered", ko_no_argument, 102 },
+	  { "codegen-report", ko_optional_argument, 601 },
+	  { "no-cache", ko_no_argument, 602 },
+	  { "hot-reload", ko_no_argument, 605 },
+	  { "watch", ko_no_argument, 606 },
+	  { "layout", ko_no_argument, 607 },
+	  { "relink", ko_no_argument, 608 },
+	  { "gc-sections", ko_no_argument, 609 },
+#if !defined(WINDOWS)
+	  { "server", ko_required_argument, 603 },
+	  { "prelude", ko_required_argument, 604 },
+#endif
 #if defined(SELFHOST)
 	  { "src",  ko_no_argument, 311 },
 #endif
@@ -183,6 +229,33 @@ int main(int argc, char **argv) {
 	  } else if (c==101 ) { // verb
 		  CJIT->quiet = false;
 		  CJIT->verbose = true;
+	  } else if (c==102 ) { // tiered
+		  CJIT->tiered = true;
+	  } else if (c==601 ) { // codegen-report
+		  CJIT->codegen_report = cjit_codegen_report_format(opt.arg);
+		  if(!CJIT->codegen_report) {
+			  _err("Invalid codegen report format: %s", opt.arg);
+			  res = 1;
+			  goto endgame;
+		  }
+	  } else if (c==602 ) { // no-cache
+		  CJIT->objcache = false;
+	  } else if (c==605 ) { // hot-reload
+		  CJIT->hot_reload = true;
+	  } else if (c==606 ) { // watch
+		  watch = true;
+	  } else if (c==607 ) { // layout
+		  CJIT->layout = true;
+	  } else if (c==608 ) { // relink
+		  CJIT->relink = true;
+	  } else if (c==609 ) { // gc-sections
+		  CJIT->gc_sections = true;
+#if !defined(WINDOWS)
+	  } else if (c==603 ) { // server
+		  server = opt.arg;
+	  } else if (c==604 ) { // prelude
+		  prelude = opt.arg;
+#endif
 	  } else if (c == 'D') { // define
 		  int _res;
 		  _res = parse_value(opt.arg);
@@ -267,6 +340,17 @@ int main(int argc, char **argv) {
 		  arg_separator = opt.ind+1; break;
 	  }
   }
+  if(server) {
+	  res = cjit_server_run(CJIT, server, prelude, run_cli);
+	  goto endgame;
+  }
+  if(prelude) _err("Prelude %s is only used by a --server",prelude);
+  if(CJIT->relink && !watch && CJIT->relink_fd < 0)
+	  _err("Relink is only used with --watch");
+  if(watch) {
+	  res = cjit_watch_run(CJIT, argc, argv, run_cli);
+	  goto endgame;
+  }
   if(!CJIT->quiet)
 	_err("cjit version %s (c) 2024-2026 Dyne.org foundation",&VERSION[1]);
 
@@ -334,7 +418,7 @@ int main(int argc, char **argv) {
   free(clean_argv);
   // free TCC
   cjit_free(CJIT);
-  exit(res);
+  return(res);
 }
 
 char** remove_args(int* argc, char** argv,
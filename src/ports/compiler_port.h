@@ -19,6 +19,8 @@ typedef struct CompilerPort {
     CJITResult (*set_output_mode)(void *context, RuntimeSession *session, int output_mode);
     CJITResult (*add_source_file)(void *context, RuntimeSession *session, const char *path);
     CJITResult (*add_source_buffer)(void *context, RuntimeSession *session, const char *buffer);
+    CJITResult (*add_source_files)(void *context, RuntimeSession *session,
+                                   const char **paths, int count);
     CJITResult (*add_binary_input)(void *context, RuntimeSession *session, const char *path);
     CJITResult (*define_symbol)(void *context, RuntimeSession *session,
                                 const char *name, const char *value);
@@ -30,6 +32,8 @@ typedef struct CompilerPort {
     CJITResult (*link_executable)(void *context, RuntimeSession *session);
     CJITResult (*execute_program)(void *context, RuntimeSession *session,
                                   int argc, char **argv, int *exit_status);
+    CJITResult (*run_program)(void *context, RuntimeSession *session, int in_process,
+                              int argc, char **argv, int *exit_status);
     CJITResult (*relocate)(void *context, RuntimeSession *session);
     CJITResult (*resolve_symbol)(void *context, RuntimeSession *session,
                                  const char *symbol_name, void **symbol);
@@ -0,0 +1,75 @@
+#include <stdio.h>
+
+#include "cjit.h"
+
+/* each run bumps the counter, whose value the exit status tells */
+static const char *source =
+    "int counter;\n"
+    "int bump(void) { return ++counter; }\n"
+    "int main(int argc, char **argv) { return argc + bump(); }\n";
+
+static int check(int ok, const char *what)
+{
+    if (ok) {
+        return 0;
+    }
+    fprintf(stderr, "cjit run check failed: %s\n", what);
+    return 1;
+}
+
+/* runs main with one argument, returning its exit status or -1 */
+static int run(CJITState *cjit, int mode)
+{
+    char *argv[] = { "program", NULL };
+    int status = -1;
+    CJITResult result = cjit_run_result(cjit, mode, 1, argv, &status);
+
+    if (!result.ok && result.code != CJIT_RESULT_EXEC_ERROR) {
+        return -1;
+    }
+    return status;
+}
+
+int main(void)
+{
+    CJITState *cjit = cjit_new();
+    int (*bump)(void);
+    int *counter;
+    int failures = 0;
+
+    if (!cjit) {
+        fprintf(stderr, "cjit run check failed: no state\n");
+        return 1;
+    }
+    cjit->quiet = true;
+    failures += check(cjit_add_buffer(cjit, source), "add buffer");
+
+    /* the lookup links the program */
+    bump = (int (*)(void))cjit_get_symbol(cjit, "bump");
+    counter = (int *)cjit_get_symbol(cjit, "counter");
+    failures += check(bump && counter, "symbols before a run");
+    failures += check(cjit_get_symbol(cjit, "missing") == NULL, "missing symbol");
+    if (!bump || !counter) {
+        cjit_free(cjit);
+        return 1;
+    }
+    failures += check(cjit_load_result(cjit).ok, "load once linked");
+    failures += check(cjit_get_symbol(cjit, "bump") == (void *)bump, "load links again");
+
+    /* the runs in process share the program with its symbols */
+    failures += check(run(cjit, CJIT_RUN_IN_PROCESS) == 2, "first run in process");
+    failures += check(run(cjit, CJIT_RUN_IN_PROCESS) == 3, "second run in process");
+    failures += check(bump() == 3 && *counter == 3, "symbol called between runs");
+
+    /* a forked run starts from the program as it is, and leaves it so */
+    failures += check(run(cjit, CJIT_RUN_FORK) == 5, "first forked run");
+    failures += check(run(cjit, CJIT_RUN_FORK) == 5, "second forked run");
+    failures += check(*counter == 3, "forked runs leave the program");
+    failures += check(run(cjit, CJIT_RUN_IN_PROCESS) == 5, "run in process after forks");
+
+    failures += check(cjit_get_symbol(cjit, "bump") == (void *)bump
+                      && cjit_get_symbol(cjit, "counter") == (void *)counter,
+                      "symbols after the runs");
+    cjit_free(cjit);
+    return failures ? 1 : 0;
+}
@@ -67,6 +67,149 @@ load bats_setup
     assert_line --partial 'hello from myfunc3'
 }
 
+@test "Execute multiple files compiled in parallel" {
+    skip_if_systcc_execute_is_unavailable
+    CJIT_JOBS=4 run ${CJIT} --verb test/multifile/*.c
+    assert_success
+    assert_line --partial 'Compiling 4 sources on 4 threads'
+    assert_line --partial 'hello from myfunc'
+    assert_line --partial 'hello from myfunc2'
+    assert_line --partial 'hello from myfunc3'
+}
+
+@test "Reuse cached objects of unchanged sources" {
+    skip_if_systcc_execute_is_unavailable
+    run ${CJIT} -q test/cflags.c -DALLOWED
+    sleep 1
+    run ${CJIT} --verb test/cflags.c -DALLOWED
+    assert_success
+    run ${CJIT} --verb test/cflags.c -DALLOWED
+    assert_success
+    assert_line '+C test/cflags.c'
+    assert_line --partial 'Success.'
+    run ${CJIT} --verb --no-cache test/cflags.c -DALLOWED
+    assert_success
+    assert_line '+S test/cflags.c'
+    run ${CJIT} -q test/cflags.c
+    assert_failure
+    assert_line --partial 'Running this program is not allowed'
+}
+
+@test "Run through a compile server" {
+    skip_if_systcc_execute_is_unavailable
+    sock="$BATS_TEST_TMPDIR/cjit.sock"
+    ${CJIT} --server "$sock" 3>&- 2>/dev/null &
+    server=$!
+    for i in 1 2 3 4 5 6 7 8 9 10; do
+        [ -S "$sock" ] && break
+        sleep 0.1
+    done
+    CJIT_SERVER="$sock" run ${CJIT} -q test/cargs.c -- a b c
+    kill $server
+    assert_success
+    assert_line '3: c'
+}
+
+@test "Compile over the prelude of a compile server" {
+    skip_if_systcc_execute_is_unavailable
+    sock="$BATS_TEST_TMPDIR/cjit.sock"
+    echo '#include <stdio.h>' > "$BATS_TEST_TMPDIR/prelude.h"
+    echo 'static int twice(int x) { return 2 * x; }' >> "$BATS_TEST_TMPDIR/prelude.h"
+    echo 'int main() { printf("twice %d\n", twice(21)); return 0; }' \
+         > "$BATS_TEST_TMPDIR/twice.c"
+    ${CJIT} --server "$sock" --prelude "$BATS_TEST_TMPDIR/prelude.h" 3>&- 2>/dev/null &
+    server=$!
+    for i in 1 2 3 4 5 6 7 8 9 10; do
+        [ -S "$sock" ] && break
+        sleep 0.1
+    done
+    CJIT_SERVER="$sock" run ${CJIT} -q "$BATS_TEST_TMPDIR/twice.c"
+    kill $server
+    assert_success
+    assert_line 'twice 42'
+}
+
+@test "Hot reload swaps the functions of an edited source" {
+    skip_if_systcc_execute_is_unavailable
+    if [ -n "${SYSTCC:-}" ]; then
+        skip "hot reload needs the bundled tinycc"
+    fi
+    src="$BATS_TEST_TMPDIR"
+    echo 'static int calls; int value(void) { calls++; return 1; }' > "$src/value.c"
+    cat > "$src/loop.c" <<'EOF'
+#include <stdio.h>
+#include <unistd.h>
+int value(void);
+int main(void) {
+    for (int i = 0; i < 100; i++) {
+        int v = value();
+        if (v == 2) { puts("reloaded"); return 0; }
+        if (v == 3) { puts("state lost"); return 1; }
+        usleep(50000);
+    }
+    return 1;
+}
+EOF
+    (sleep 1; echo 'static int calls; int value(void) { return ++calls > 1 ? 2 : 3; }' \
+         > "$src/value.c") &
+    run ${CJIT} -q --hot-reload "$src/loop.c" "$src/value.c"
+    assert_success
+    assert_output 'reloaded'
+}
+
+@test "Watch mode restarts the program when a header changes" {
+    skip_if_systcc_execute_is_unavailable
+    src="$BATS_TEST_TMPDIR"
+    printf '#define GREETING "one"\n' > "$src/greet.h"
+    printf '#include <stdio.h>\n#include <unistd.h>\n#include "greet.h"\nint main(void) { puts(GREETING); fflush(stdout); pause(); return 0; }\n' \
+           > "$src/greet.c"
+    ${CJIT} -q --watch "$src/greet.c" > "$src/out.txt" 2>&1 3>&- &
+    watcher=$!
+    for i in 1 2 3 4 5 6 7 8 9 10; do
+        grep -q one "$src/out.txt" && break
+        sleep 0.2
+    done
+    printf '#define GREETING "two"\n' > "$src/greet.h"
+    for i in 1 2 3 4 5 6 7 8 9 10; do
+        grep -q two "$src/out.txt" && break
+        sleep 0.2
+    done
+    kill $watcher
+    run cat "$src/out.txt"
+    assert_line 'one'
+    assert_line 'two'
+}
+
+@test "Watch mode relinks only the source that changed" {
+    skip_if_systcc_execute_is_unavailable
+    if [ -n "${SYSTCC:-}" ]; then
+        skip "relinking needs the bundled tinycc"
+    fi
+    src="$BATS_TEST_TMPDIR"
+    printf 'int counter = 10;\nstatic const char *w = "one";\nconst char *word(void) { return w; }\n' \
+           > "$src/word.c"
+    printf '#include <stdio.h>\n#include <unistd.h>\nconst char *word(void);\nextern int counter;\nint main(void) { counter++; printf("%%s %%d\\n", word(), counter); fflush(stdout); pause(); return 0; }\n' \
+           > "$src/main.c"
+    ${CJIT} --verb --watch --relink "$src/main.c" "$src/word.c" > "$src/out.txt" 2>&1 3>&- &
+    watcher=$!
+    for i in 1 2 3 4 5 6 7 8 9 10; do
+        grep -q 'one 11' "$src/out.txt" && break
+        sleep 0.2
+    done
+    printf 'int counter = 20;\nstatic const char *w = "two";\nconst char *word(void) { return w; }\n' \
+           > "$src/word.c"
+    for i in 1 2 3 4 5 6 7 8 9 10; do
+        grep -q 'two 21' "$src/out.txt" && break
+        sleep 0.2
+    done
+    kill $watcher
+    run cat "$src/out.txt"
+    assert_line 'one 11'
+    assert_line --partial 'word.c, 1 functions repointed'
+    assert_line 'two 21'
+    refute_line --partial 'changed, restarting'
+}
+
 @test "Pass arguments to executed source" {
     skip_if_systcc_execute_is_unavailable
     run ${CJIT} -q test/cargs.c -- a b c
@@ -148,10 +291,18 @@ load bats_setup
     assert_line --partial 'Build system:'
 }
 
-@test "Compile driver ignores make dependency flags" {
+@test "Compile driver writes make dependency files" {
     run ${CJIT} -MMD -MP -MF ${TMP}/hello.d -c test/hello.c -o ${TMP}/hello.o
     assert_success
     [ -f "${TMP}/hello.o" ]
+    run cat ${TMP}/hello.d
+    assert_line "${TMP}/hello.o: \\"
+    assert_line '  test/hello.c'
+    run ${CJIT} -MD -MT 'my obj' -c test/hello.c -o ${TMP}/world.o
+    assert_success
+    run cat ${TMP}/world.d
+    assert_line 'my obj: \'
+    assert_line --partial 'stdio.h'
 }
 
 @test "Argument separator preserves app flags" {
@@ -184,3 +335,47 @@ load bats_setup
     assert_success
     [ -f "${TMP}/bundle-out/bundle/hello.txt" ]
 }
+
+@test "Codegen report lists compiled functions" {
+    skip_if_systcc_execute_is_unavailable
+    if [ -n "${SYSTCC:-}" ]; then
+        skip "the codegen report needs the bundled tinycc"
+    fi
+    run ${CJIT} -q --codegen-report test/hello.c
+    assert_success
+    assert_line --partial 'Codegen report: 1 functions'
+    assert_line --regexp '^ +[0-9]+ +0 +0 +[0-9.]+  main \(test/hello.c\)$'
+    assert_line 'Hello World!'
+    run ${CJIT} -q --codegen-report=json test/hello.c
+    assert_success
+    assert_line --regexp '^  \{"name": "main", "file": "test/hello.c", "size": [0-9]+, "spills": 0, "helper_calls": 0, "ns": [0-9]+\}$'
+    run ${CJIT} -q --codegen-report=xml test/hello.c
+    assert_failure
+}
+
+@test "SIMD intrinsics headers are not disabled" {
+    skip_if_systcc_execute_is_unavailable
+    if [ -n "${SYSTCC:-}" ]; then
+        skip "the intrinsics headers come with the bundled tinycc"
+    fi
+    cat > ${TMP}/simd.c <<EOF2
+#include <stdio.h>
+#ifndef SDL_DISABLE_IMMINTRIN_H
+#include <immintrin.h>
+#endif
+int main(void) {
+#ifdef SDL_DISABLE_IMMINTRIN_H
+    printf("disabled\n");
+#else
+    int out[4];
+    __m128i v = _mm_set1_epi32(21);
+    _mm_storeu_si128((__m128i *)out, _mm_add_epi32(v, v));
+    printf("%d\n", out[3]);
+#endif
+    return 0;
+}
+EOF2
+    run ${CJIT} -q ${TMP}/simd.c
+    assert_success
+    assert_output '42'
+}
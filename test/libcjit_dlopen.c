@@ -0,0 +1,39 @@
+#include <dlfcn.h>
+#include <stdio.h>
+
+#include "libcjit.h"
+
+/* libcjit.so loaded the way FFI bindings do, after the process started */
+int main(int argc, char **argv)
+{
+    const char *source = "int twice(int x) { return 2 * x; }\n";
+    void *lib = dlopen(argc > 1 ? argv[1] : "./libcjit.so", RTLD_NOW | RTLD_LOCAL);
+    CJITSession *(*session_new)(void);
+    void (*session_free)(CJITSession *);
+    int (*add_buffers)(CJITSession *, const char **, int);
+    void *(*symbol)(CJITSession *, const char *);
+    CJITSession *session;
+    int (*twice)(int);
+
+    if (!lib) {
+        fprintf(stderr, "libcjit dlopen check failed: %s\n", dlerror());
+        return 1;
+    }
+    session_new = (CJITSession *(*)(void))dlsym(lib, "cjit_session_new");
+    session_free = (void (*)(CJITSession *))dlsym(lib, "cjit_session_free");
+    add_buffers = (int (*)(CJITSession *, const char **, int))dlsym(lib, "cjit_session_add_buffers");
+    symbol = (void *(*)(CJITSession *, const char *))dlsym(lib, "cjit_session_symbol");
+    if (!session_new || !session_free || !add_buffers || !symbol) {
+        fprintf(stderr, "libcjit dlopen check failed: missing exports\n");
+        return 1;
+    }
+    session = session_new();
+    if (!session || add_buffers(session, &source, 1) < 0
+        || !(twice = (int (*)(int))symbol(session, "twice")) || twice(21) != 42) {
+        fprintf(stderr, "libcjit dlopen check failed: compile and call\n");
+        return 1;
+    }
+    session_free(session);
+    dlclose(lib);
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "libcjit.h"
+
+static const char *sources[] = {
+    "int counter;\n"
+    "int add(int x) { return counter += x; }\n",
+    "extern int counter;\n"
+    "int main(int argc, char **argv) { return argc + counter; }\n"
+};
+
+static int check(int ok, const char *what, CJITSession *session)
+{
+    if (ok) {
+        return 0;
+    }
+    fprintf(stderr, "libcjit check failed: %s (%s)\n", what,
+            cjit_session_error(session) ? cjit_session_error(session) : "no error");
+    return 1;
+}
+
+int main(void)
+{
+    char *argv[] = { "snippet", "one", NULL };
+    CJITSession *session = cjit_session_new();
+    int (*add)(int);
+    int failures = 0;
+    int i;
+
+    if (!session) {
+        fprintf(stderr, "libcjit check failed: no session\n");
+        return 1;
+    }
+    failures += check(cjit_session_define(session, "UNUSED", "1") == 0, "define", session);
+    failures += check(cjit_session_add_buffers(session, sources, 2) == 0, "add buffers", session);
+    failures += check(cjit_session_compile(session) == 0, "compile", session);
+    failures += check(cjit_session_add_buffers(session, sources, 1) < 0,
+                      "adding after compile is refused", session);
+
+    add = (int (*)(int))cjit_session_symbol(session, "add");
+    failures += check(add != NULL, "symbol lookup", session);
+    failures += check(cjit_session_symbol(session, "missing") == NULL, "missing symbol", session);
+    if (add) {
+        failures += check(add(40) == 40, "call a symbol", session);
+    }
+    for (i = 0; i < 1000; i++) {
+        failures += check(cjit_session_run(session, CJIT_SESSION_RUN_IN_PROCESS, 2, argv) == 42,
+                          "run in process", session);
+    }
+    failures += check(cjit_session_run(session, CJIT_SESSION_RUN_FORK, 1, argv) == 41,
+                      "run in a child", session);
+    cjit_session_free(session);
+    return failures ? 1 : 0;
+}
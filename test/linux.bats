@@ -115,3 +115,261 @@ EOF
     assert_success
     assert_output --partial 'Terminal name'
 }
+
+@test "Tiered execution moves hot functions to the host compiler" {
+    skip_if_systcc_execute_is_unavailable
+    command -v cc >/dev/null || skip "no host C compiler"
+    cat << EOF > tiered.c
+#include <stdio.h>
+#include <unistd.h>
+int native(void) {
+#if defined(__TINYC__)
+        return 0;
+#else
+        return 1;
+#endif
+}
+int main() {
+        int i;
+        for (i = 0; i < 10000 && !native(); i++)
+                usleep(1000);
+        printf("%s\n", native() ? "native" : "tinycc");
+        return 0;
+}
+EOF
+    CJIT_TIER_THRESHOLD=10 run ${CJIT} -q --tiered tiered.c
+    assert_success
+    assert_output 'native'
+}
+
+@test "Resolve the symbols of a large program through the symbol map" {
+    skip_if_systcc_execute_is_unavailable
+    if [ -n "${SYSTCC:-}" ]; then
+        skip "the symbol map needs the bundled tinycc"
+    fi
+    command -v nm >/dev/null || skip "no nm"
+    libc="$(ldd ${CJIT} | awk '/libc\.so/ {print $3}')"
+    [ -n "$libc" ] || skip "no dynamic libc"
+    nm -D --defined-only "$libc" \
+        | awk '$2 == "T" && $3 ~ /@@/ {sub(/@@.*/, "", $3); print $3}' \
+        | grep -E '^[a-z][a-z0-9_]+$' | sort -u | head -400 > ${TMP}/names.txt
+    {
+        awk '{print "extern char " $1 "[];"}' ${TMP}/names.txt
+        echo 'void *all[] = {'
+        awk '{print "    " $1 ","}' ${TMP}/names.txt
+        echo '};'
+        echo 'int main(void) { return all[0] && all[sizeof(all) / sizeof(*all) - 1] ? 0 : 1; }'
+    } > ${TMP}/symbols.c
+    mkdir -p ${TMP}/symbols-tmp
+    TMPDIR=${TMP}/symbols-tmp run ${CJIT} --verb ${TMP}/symbols.c
+    assert_success
+    assert_line --partial 'symbols from the new symbol map'
+    TMPDIR=${TMP}/symbols-tmp run ${CJIT} --verb ${TMP}/symbols.c
+    assert_success
+    assert_line --partial 'symbols from the cached symbol map'
+}
+
+@test "Link members of a static archive that depend on earlier members" {
+    skip_if_systcc_execute_is_unavailable
+    mkdir -p ${TMP}/chain
+    echo 'int one(void) { return 1; }' > ${TMP}/chain/one.c
+    for n in two:one three:two four:three; do
+        cat > ${TMP}/chain/${n%:*}.c <<EOF2
+int ${n#*:}(void);
+int ${n%:*}(void) { return ${n#*:}() + 1; }
+EOF2
+        run ${CJIT} -c ${TMP}/chain/${n%:*}.c -o ${TMP}/chain/${n%:*}.o
+        assert_success
+    done
+    run ${CJIT} -c ${TMP}/chain/one.c -o ${TMP}/chain/one.o
+    assert_success
+    run ${CJIT} -ar rcs ${TMP}/chain/libchain.a \
+        ${TMP}/chain/one.o ${TMP}/chain/two.o ${TMP}/chain/three.o ${TMP}/chain/four.o
+    assert_success
+    cat > ${TMP}/chain/main.c <<EOF2
+#include <stdio.h>
+int four(void);
+int main(void) { printf("%d\n", four()); return 0; }
+EOF2
+    run ${CJIT} -q ${TMP}/chain/main.c ${TMP}/chain/libchain.a
+    assert_success
+    assert_output '4'
+}
+
+@test "Apply the relocations of a large program on several threads" {
+    skip_if_systcc_execute_is_unavailable
+    if [ -n "${SYSTCC:-}" ]; then
+        skip "parallel relocation needs the bundled tinycc"
+    fi
+    {
+        echo '#include <stdio.h>'
+        seq 0 69999 | awk '{print "static int f" $1 "(void) { return " $1 " % 7; }"}'
+        echo 'static int (*tab[])(void) = {'
+        seq 0 69999 | awk '{print "    f" $1 ","}'
+        echo '};'
+        echo 'int main(void) {'
+        echo '    long s = 0;'
+        echo '    for (unsigned i = 0; i < sizeof(tab) / sizeof(*tab); i++) s += tab[i]();'
+        echo '    printf("%ld\n", s);'
+        echo '    return 0;'
+        echo '}'
+    } > ${TMP}/relocs.c
+    CJIT_JOBS=2 run ${CJIT} --verb ${TMP}/relocs.c
+    assert_success
+    assert_line --partial 'linker jobs on 2 threads'
+    assert_line '210000'
+}
+
+@test "Run programs from read-only executable memory" {
+    skip_if_systcc_execute_is_unavailable
+    cat > ${TMP}/wx.c <<EOF2
+#include <stdio.h>
+#include <string.h>
+int main(void) {
+    unsigned long a, b, pc = (unsigned long)(void *)main;
+    char line[512], perms[8];
+    FILE *f = fopen("/proc/self/maps", "r");
+    while (f && fgets(line, sizeof line, f))
+        if (sscanf(line, "%lx-%lx %7s", &a, &b, perms) == 3 && pc >= a && pc < b)
+            printf("%s\n", perms);
+    return 0;
+}
+EOF2
+    run ${CJIT} -q ${TMP}/wx.c
+    assert_success
+    assert_output --regexp '^r-x[ps]$'
+}
+
+@test "Lay out hot and cold functions by a recorded profile" {
+    skip_if_systcc_execute_is_unavailable
+    cat > ${TMP}/layout.c <<EOF2
+#include <stdio.h>
+static int cold_path(int x) { printf("cold %d\n", x); return x; }
+int hot(int i) { return i * 3 + 1; }
+int main(int argc, char **argv) {
+    long s = 0;
+    if (argc > 5) s = cold_path(argc);
+    for (int i = 0; i < 1000; i++) s += hot(i);
+    printf("%ld %d %d\n", s, (char *)hot < (char *)main, (char *)main < (char *)cold_path);
+    return 0;
+}
+EOF2
+    mkdir -p ${TMP}/layout-tmp
+    TMPDIR=${TMP}/layout-tmp run ${CJIT} --verb --layout ${TMP}/layout.c
+    assert_success
+    assert_line --partial 'Recording layout profile'
+    assert_line '1499500 1 0'
+    TMPDIR=${TMP}/layout-tmp run ${CJIT} --verb --layout ${TMP}/layout.c
+    assert_success
+    assert_line --partial '2 hot and 1 cold functions'
+    assert_line '1499500 1 1'
+}
+
+@test "Drop the functions a program never reaches" {
+    skip_if_systcc_execute_is_unavailable
+    cat > ${TMP}/gc.c <<EOF2
+#include <stdio.h>
+extern void not_linked(void);
+void unused(void) { not_linked(); }
+int main(void) { printf("reached\n"); return 0; }
+EOF2
+    run ${CJIT} -q ${TMP}/gc.c
+    assert_failure
+    run ${CJIT} -q --gc-sections ${TMP}/gc.c
+    assert_success
+    assert_output 'reached'
+}
+
+@test "Drop functions of programs with more functions than sections" {
+    skip_if_systcc_execute_is_unavailable
+    seq 0 39999 | awk '{print "int f" $1 "(void) { return " $1 " % 7; }"}' > ${TMP}/many-a.c
+    {
+        echo '#include <stdio.h>'
+        seq 40000 79999 | awk '{print "int f" $1 "(void) { return " $1 " % 7; }"}'
+        echo 'int f3(void);'
+        echo 'int main(void) { printf("%d\n", f3() + f79999()); return 0; }'
+    } > ${TMP}/many-b.c
+    cat ${TMP}/many-a.c ${TMP}/many-b.c > ${TMP}/many.c
+    run ${CJIT} -q --gc-sections --no-cache ${TMP}/many.c
+    assert_success
+    assert_output '6'
+    run ${CJIT} -q --gc-sections ${TMP}/many-a.c ${TMP}/many-b.c
+    assert_success
+    assert_output '6'
+}
+
+@test "Map the runtime library prelinked instead of linking it" {
+    skip_if_systcc_execute_is_unavailable
+    cat > ${TMP}/rtimage.c <<EOF2
+#include <stdio.h>
+#include <string.h>
+int main(void) {
+    volatile double d = 1e19;
+    char line[512];
+    FILE *maps = fopen("/proc/self/maps", "r");
+    printf("%llu\n", (unsigned long long)d);
+    while (fgets(line, sizeof(line), maps))
+        if (strstr(line, "libtcc1.so")) { printf("mapped\n"); break; }
+    return 0;
+}
+EOF2
+    run ${CJIT} -q ${TMP}/rtimage.c
+    assert_success
+    assert_line '10000000000000000000'
+    assert_line 'mapped'
+}
+
+@test "Register atexit handlers with the runtime library prelinked" {
+    skip_if_systcc_execute_is_unavailable
+    cat > ${TMP}/rtatexit.c <<EOF2
+#include <stdio.h>
+#include <stdlib.h>
+static void bye(void) { printf("bye\n"); }
+int main(void) { atexit(bye); printf("hi\n"); return 0; }
+EOF2
+    run ${CJIT} -q ${TMP}/rtatexit.c
+    assert_success
+    assert_output $'hi\nbye'
+    run ${CJIT} -q --no-cache ${TMP}/rtatexit.c
+    assert_success
+    assert_output $'hi\nbye'
+}
+
+@test "Link the pragma libraries of sources compiled in parallel" {
+    skip_if_systcc_execute_is_unavailable
+    [ -r /usr/include/zlib.h ] || skip "no zlib"
+    cat > ${TMP}/pragma-a.c <<EOF2
+#pragma comment(lib, "z")
+const char *zlibVersion(void);
+const char *zver(void) { return zlibVersion(); }
+EOF2
+    cat > ${TMP}/pragma-b.c <<EOF2
+#include <stdio.h>
+const char *zver(void);
+int main(void) { printf("%s\n", zver() ? "zlib" : "none"); return 0; }
+EOF2
+    CJIT_JOBS=2 run ${CJIT} -q --no-cache ${TMP}/pragma-a.c ${TMP}/pragma-b.c
+    assert_success
+    assert_output 'zlib'
+}
+
+@test "Link the pragma libraries of cached objects" {
+    skip_if_systcc_execute_is_unavailable
+    [ -r /usr/include/zlib.h ] || skip "no zlib"
+    cat > ${TMP}/pragma-cached.c <<EOF2
+#include <stdio.h>
+#pragma comment(lib, "z")
+const char *zlibVersion(void);
+int main(void) { printf("%s\n", zlibVersion() ? "zlib" : "none"); return 0; }
+EOF2
+    mkdir -p ${TMP}/pragma-tmp
+    TMPDIR=${TMP}/pragma-tmp run ${CJIT} -q ${TMP}/pragma-cached.c
+    assert_success
+    assert_output 'zlib'
+    sleep 1
+    TMPDIR=${TMP}/pragma-tmp run ${CJIT} -q ${TMP}/pragma-cached.c
+    TMPDIR=${TMP}/pragma-tmp run ${CJIT} --verb ${TMP}/pragma-cached.c
+    assert_success
+    assert_line "+C ${TMP}/pragma-cached.c"
+    assert_line 'zlib'
+}